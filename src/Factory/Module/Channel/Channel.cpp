@@ -8,6 +8,8 @@
 
 #include "Tools/Algo/Gaussian_noise_generator/Standard/Gaussian_noise_generator_std.hpp"
 #include "Tools/Algo/Gaussian_noise_generator/Fast/Gaussian_noise_generator_fast.hpp"
+#include "Tools/Algo/Gaussian_noise_generator/Counter/Gaussian_noise_generator_counter.hpp"
+#include "Tools/Algo/Gaussian_noise_generator/Ziggurat/Gaussian_noise_generator_ziggurat.hpp"
 #ifdef CHANNEL_MKL
 #include "Tools/Algo/Gaussian_noise_generator/MKL/Gaussian_noise_generator_MKL.hpp"
 #endif
@@ -58,7 +60,7 @@ void Channel::parameters
 		 "type of the channel to use in the simulation.",
 		 "NO, USER, AWGN, RAYLEIGH, RAYLEIGH_USER"};
 
-	std::string implem_avail = "STD, FAST";
+	std::string implem_avail = "STD, FAST, THREEFRY, ZIGGURAT";
 #ifdef CHANNEL_GSL
 	implem_avail += ", GSL";
 #endif
@@ -150,20 +152,34 @@ void Channel::parameters
 }
 
 template <typename R>
-module::Channel<R>* Channel::parameters
-::build() const
+tools::Gaussian_noise_generator<R>* Channel::parameters
+::build_noise_generator(const unsigned n_streams, const unsigned stream_id) const
 {
-	tools::Gaussian_noise_generator<R>* n = nullptr;
-	     if (implem == "STD" ) n = new tools::Gaussian_noise_generator_std <R>(seed);
-	else if (implem == "FAST") n = new tools::Gaussian_noise_generator_fast<R>(seed);
+	     if (implem == "STD" ) return new tools::Gaussian_noise_generator_std <R>(seed);
+	else if (implem == "FAST") return new tools::Gaussian_noise_generator_fast<R>(seed);
 #ifdef CHANNEL_MKL
-	else if (implem == "MKL" ) n = new tools::Gaussian_noise_generator_MKL <R>(seed);
+	else if (implem == "MKL" ) return new tools::Gaussian_noise_generator_MKL <R>(seed);
 #endif
 #ifdef CHANNEL_GSL
-	else if (implem == "GSL" ) n = new tools::Gaussian_noise_generator_GSL <R>(seed);
+	else if (implem == "GSL" ) return new tools::Gaussian_noise_generator_GSL <R>(seed);
 #endif
-	else
-		throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+	else if (implem == "ZIGGURAT") return new tools::Gaussian_noise_generator_ziggurat<R>(seed);
+	else if (implem == "THREEFRY")
+	{
+		// with 'add_users', the frames of a call share the noise of one frame
+		auto g = new tools::Gaussian_noise_generator_counter<R>(seed);
+		g->set_interleaving(n_streams, stream_id, add_users ? 1 : n_frames);
+		return g;
+	}
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
+template <typename R>
+module::Channel<R>* Channel::parameters
+::build(const unsigned n_streams, const unsigned stream_id) const
+{
+	auto n = this->template build_noise_generator<R>(n_streams, stream_id);
 
 	     if (type == "AWGN"         ) return new module::Channel_AWGN_LLR         <R>(N,                            n, add_users, sigma, n_frames);
 	else if (type == "RAYLEIGH"     ) return new module::Channel_Rayleigh_LLR     <R>(N, complex,                   n, add_users, sigma, n_frames);
@@ -184,20 +200,23 @@ module::Channel<R>* Channel::parameters
 
 template <typename R>
 module::Channel<R>* Channel
-::build(const parameters &params)
+::build(const parameters &params, const unsigned n_streams, const unsigned stream_id)
 {
-	return params.template build<R>();
+	return params.template build<R>(n_streams, stream_id);
 }
 
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef MULTI_PREC
-template aff3ct::module::Channel<R_32>* aff3ct::factory::Channel::parameters::build<R_32>() const;
-template aff3ct::module::Channel<R_64>* aff3ct::factory::Channel::parameters::build<R_64>() const;
-template aff3ct::module::Channel<R_32>* aff3ct::factory::Channel::build<R_32>(const aff3ct::factory::Channel::parameters&);
-template aff3ct::module::Channel<R_64>* aff3ct::factory::Channel::build<R_64>(const aff3ct::factory::Channel::parameters&);
+template aff3ct::module::Channel<R_32>* aff3ct::factory::Channel::parameters::build<R_32>(const unsigned, const unsigned) const;
+template aff3ct::module::Channel<R_64>* aff3ct::factory::Channel::parameters::build<R_64>(const unsigned, const unsigned) const;
+template aff3ct::module::Channel<R_32>* aff3ct::factory::Channel::build<R_32>(const aff3ct::factory::Channel::parameters&, const unsigned, const unsigned);
+template aff3ct::module::Channel<R_64>* aff3ct::factory::Channel::build<R_64>(const aff3ct::factory::Channel::parameters&, const unsigned, const unsigned);
+template aff3ct::tools::Gaussian_noise_generator<R_32>* aff3ct::factory::Channel::parameters::build_noise_generator<R_32>(const unsigned, const unsigned) const;
+template aff3ct::tools::Gaussian_noise_generator<R_64>* aff3ct::factory::Channel::parameters::build_noise_generator<R_64>(const unsigned, const unsigned) const;
 #else
-template aff3ct::module::Channel<R>* aff3ct::factory::Channel::parameters::build<R>() const;
-template aff3ct::module::Channel<R>* aff3ct::factory::Channel::build<R>(const aff3ct::factory::Channel::parameters&);
+template aff3ct::module::Channel<R>* aff3ct::factory::Channel::parameters::build<R>(const unsigned, const unsigned) const;
+template aff3ct::module::Channel<R>* aff3ct::factory::Channel::build<R>(const aff3ct::factory::Channel::parameters&, const unsigned, const unsigned);
+template aff3ct::tools::Gaussian_noise_generator<R>* aff3ct::factory::Channel::parameters::build_noise_generator<R>(const unsigned, const unsigned) const;
 #endif
 // ==================================================================================== explicit template instantiation
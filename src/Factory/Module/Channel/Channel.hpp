@@ -4,6 +4,7 @@
 #include <string>
 
 #include "Module/Channel/Channel.hpp"
+#include "Tools/Algo/Gaussian_noise_generator/Gaussian_noise_generator.hpp"
 
 #include "../../Factory.hpp"
 
@@ -46,11 +47,15 @@ struct Channel : public Factory
 
 		// builder
 		template <typename R = float>
-		module::Channel<R>* build() const;
+		module::Channel<R>* build(const unsigned n_streams = 1, const unsigned stream_id = 0) const;
+
+		template <typename R = float>
+		tools::Gaussian_noise_generator<R>* build_noise_generator(const unsigned n_streams = 1, const unsigned stream_id = 0) const;
 	};
 
 	template <typename R = float>
-	static module::Channel<R>* build(const parameters &params);
+	static module::Channel<R>* build(const parameters &params, const unsigned n_streams = 1,
+	                                 const unsigned stream_id = 0);
 };
 }
 }
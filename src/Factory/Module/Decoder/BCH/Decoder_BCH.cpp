@@ -1,6 +1,8 @@
+#include <memory>
 #include <sstream>
 
 #include "Module/Decoder/BCH/Decoder_BCH.hpp"
+#include "Module/Decoder/Generic/Chase/Decoder_chase_fast.hpp"
 
 #include "Tools/Exception/exception.hpp"
 
@@ -71,7 +73,7 @@ void Decoder_BCH::parameters
 {
 	Decoder::parameters::get_headers(headers, full);
 
-	if (this->type != "ML" && this->type != "CHASE")
+	if ((this->type != "ML" && this->type != "CHASE") || (this->type == "CHASE" && this->implem == "FAST"))
 	{
 		auto p = this->get_prefix();
 		
@@ -84,6 +86,14 @@ template <typename B, typename Q>
 module::Decoder_SIHO<B,Q>* Decoder_BCH::parameters
 ::build(const tools::BCH_polynomial_generator &GF, module::Encoder<B> *encoder) const
 {
+	// Chase-II with the algebraic decoder as inner decoder
+	if (this->type == "CHASE" && this->implem == "FAST" && encoder)
+	{
+		std::shared_ptr<module::Decoder_HIHO<B>> inner(new module::Decoder_BCH<B,Q>(this->K, this->N_cw, GF, 1));
+		return new module::Decoder_chase_fast<B,Q>(this->K, this->N_cw, *encoder, this->flips, this->hamming, inner,
+		                                           this->n_frames);
+	}
+
 	try
 	{
 		return Decoder::parameters::build<B,Q>(encoder);
@@ -1,6 +1,8 @@
 #include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood_std.hpp"
 #include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood_naive.hpp"
+#include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood_fast.hpp"
 #include "Module/Decoder/Generic/Chase/Decoder_chase_std.hpp"
+#include "Module/Decoder/Generic/Chase/Decoder_chase_fast.hpp"
 
 #include "Decoder.hpp"
 
@@ -52,7 +54,7 @@ void Decoder::parameters
 	opt_args[{p+"-implem"}] =
 		{"string",
 		 "select the implementation of the algorithm to decode.",
-		 "STD, NAIVE"};
+		 "STD, NAIVE, FAST"};
 
 	opt_args[{p+"-hamming"}] =
 		{"",
@@ -61,6 +63,10 @@ void Decoder::parameters
 	opt_args[{p+"-flips"}] =
 		{"strictly_positive_int",
 		 "set the maximum number of flips in the CHASE decoder."};
+
+	opt_args[{p+"-threads"}] =
+		{"strictly_positive_int",
+		 "set the number of threads to search the codebook in the ML decoder (FAST implementation)."};
 }
 
 void Decoder::parameters
@@ -72,6 +78,7 @@ void Decoder::parameters
 	if(exist(vals, {p+"-cw-size",   "N"})) this->N_cw       = std::stoi(vals.at({p+"-cw-size",   "N"}));
 	if(exist(vals, {p+"-fra",       "F"})) this->n_frames   = std::stoi(vals.at({p+"-fra",       "F"}));
 	if(exist(vals, {p+"-flips"         })) this->flips      = std::stoi(vals.at({p+"-flips"         }));
+	if(exist(vals, {p+"-threads"       })) this->n_threads  = std::stoi(vals.at({p+"-threads"       }));
 	if(exist(vals, {p+"-type",      "D"})) this->type       =           vals.at({p+"-type",      "D"});
 	if(exist(vals, {p+"-implem"        })) this->implem     =           vals.at({p+"-implem"        });
 	if(exist(vals, {p+"-no-sys"        })) this->systematic = false;
@@ -96,6 +103,8 @@ void Decoder::parameters
 		headers[p].push_back(std::make_pair("Distance", this->hamming ? "Hamming" : "Euclidean"));
 	if(this->type == "CHASE")
 		headers[p].push_back(std::make_pair("Max flips", std::to_string(this->flips)));
+	if(this->type == "ML" && this->implem == "FAST")
+		headers[p].push_back(std::make_pair("Threads", std::to_string(this->n_threads)));
 }
 
 template <typename B, typename Q>
@@ -108,10 +117,12 @@ module::Decoder_SIHO<B,Q>* Decoder::parameters
 		{
 			if (this->implem == "STD"  ) return new module::Decoder_ML_std  <B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->n_frames);
 			if (this->implem == "NAIVE") return new module::Decoder_ML_naive<B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->n_frames);
+			if (this->implem == "FAST" ) return new module::Decoder_ML_fast <B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->n_threads, this->n_frames);
 		}
 		else if (this->type == "CHASE")
 		{
-			if (this->implem == "STD") return new module::Decoder_chase_std<B,Q>(this->K, this->N_cw, *encoder, this->flips, this->hamming, this->n_frames);
+			if (this->implem == "STD" ) return new module::Decoder_chase_std <B,Q>(this->K, this->N_cw, *encoder, this->flips, this->hamming, this->n_frames);
+			if (this->implem == "FAST") return new module::Decoder_chase_fast<B,Q>(this->K, this->N_cw, *encoder, this->flips, this->hamming, nullptr, this->n_frames);
 		}
 	}
 	
@@ -10,6 +10,7 @@
 #include "Module/Decoder/LDPC/BP/Layered/LSPA/Decoder_LDPC_BP_layered_log_sum_product.hpp"
 #include "Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_offset_normalize_min_sum.hpp"
 #include "Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_ONMS_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_ONMS_intra.hpp"
 #include "Module/Decoder/LDPC/BP/Layered/AMS/Decoder_LDPC_BP_layered_approximate_min_star.hpp"
 
 #include "Decoder_LDPC.hpp"
@@ -86,8 +87,8 @@ void Decoder_LDPC::parameters
 
 	opt_args[{p+"-simd"}] =
 		{"string",
-		 "the SIMD strategy you want to use.",
-		 "INTER"};
+		 "the SIMD strategy you want to use ('INTRA' requires a QC H matrix).",
+		 "INTER, INTRA"};
 }
 
 void Decoder_LDPC::parameters
@@ -182,6 +183,10 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 	{
 		     if (this->implem == "ONMS") return new module::Decoder_LDPC_BP_layered_ONMS_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->norm_factor, (Q)this->offset, this->enable_syndrome, this->syndrome_depth, this->n_frames);
 	}
+	else if (this->type == "BP_LAYERED" && this->simd_strategy == "INTRA")
+	{
+		     if (this->implem == "ONMS") return new module::Decoder_LDPC_BP_layered_ONMS_intra<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->norm_factor, (Q)this->offset, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+	}
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
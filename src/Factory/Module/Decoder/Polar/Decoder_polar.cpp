@@ -1,29 +1,37 @@
+#include <sstream>
+#include <iostream>
+
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Display/bash_tools.h"
 
 #include "Module/Decoder/Polar/SC/Decoder_polar_SC_naive.hpp"
 #include "Module/Decoder/Polar/SC/Decoder_polar_SC_naive_sys.hpp"
 #include "Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys.hpp"
+#include "Module/Decoder/Polar/SC/Decoder_polar_SC_spec_sys.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_MEM_fast_sys.hpp"
+#include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_LV_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_CA_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_MEM_fast_CA_sys.hpp"
+#include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_LV_fast_CA_sys.hpp"
 #include "Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_fast_CA_sys.hpp"
 #include "Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_MEM_fast_CA_sys.hpp"
+#include "Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_inter_CA_sys.hpp"
 
 //#define API_POLAR_DYNAMIC 1
 
 #include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
 #include "Tools/Code/Polar/API/API_polar_dynamic_intra.hpp"
-#ifdef API_POLAR_DYNAMIC
+// the inter-frame SC stage of the ASCL decoder always uses the dynamic API
 #include "Tools/Code/Polar/API/API_polar_dynamic_inter.hpp"
 #include "Tools/Code/Polar/API/API_polar_dynamic_inter_8bit_bitpacking.hpp"
-#else
+#ifndef API_POLAR_DYNAMIC
 #include "Tools/Code/Polar/API/API_polar_static_seq.hpp"
 #include "Tools/Code/Polar/API/API_polar_static_inter.hpp"
 #include "Tools/Code/Polar/API/API_polar_static_inter_8bit_bitpacking.hpp"
@@ -89,12 +97,14 @@ void Decoder_polar::parameters
 
 	opt_args[{p+"-simd"}] =
 		{"string",
-		 "the SIMD strategy you want to use.",
-		 "INTRA, INTER"};
+		 "the SIMD strategy you want to use (INTER with the ASCL decoder: the SC decoding is vectorized over the "
+		 "frames and only the frames with a wrong CRC are list decoded).",
+		 "INTRA, INTER, LIST"};
 
 	opt_args[{p+"-polar-nodes"}] =
 		{"string",
-		 "the type of nodes you want to detect in the Polar tree (ex: \"{R0,R1,R0L,REP_2-8,REPL,SPC_4+}\")."};
+		 "the type of nodes you want to detect in the Polar tree (ex: \"{R0,R1,R0L,REP_2-8,REPL,SPC_4+}\"), the "
+		 "generalized nodes T2, T4 and T5 are only supported by the SC decoder."};
 
 	opt_args[{p+"-partial-adaptive"}] =
 		{"",
@@ -147,11 +157,12 @@ void Decoder_polar::parameters
 			headers[p].push_back(std::make_pair("Adaptative mode", adaptative_mode));
 		}
 
-		if ((this->type == "SC"      ||
-		     this->type == "SCL"     ||
-		     this->type == "ASCL"    ||
-		     this->type == "SCL_MEM" ||
-		     this->type == "ASCL_MEM") && this->implem == "FAST")
+		if (((this->type == "SC"      ||
+		      this->type == "SCL"     ||
+		      this->type == "ASCL"    ||
+		      this->type == "SCL_MEM" ||
+		      this->type == "ASCL_MEM") && this->implem == "FAST") ||
+		    (this->type == "SC" && this->implem == "SPEC"))
 			headers[p].push_back(std::make_pair("Polar node types", this->polar_nodes));
 	}
 }
@@ -213,6 +224,13 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 				     if (this->type == "SC"  ) return new module::Decoder_polar_SC_fast_sys<B, Q, API_polar>(this->K, this->N_cw, frozen_bits, polar_patterns, idx_r0, idx_r1, this->n_frames);
 			}
 		}
+		else if (this->implem == "SPEC")
+		{
+			if (crc == nullptr || crc->get_size() == 0)
+			{
+				     if (this->type == "SC"  ) return new module::Decoder_polar_SC_spec_sys<B, Q, API_polar>(this->K, this->N_cw, frozen_bits, polar_patterns, idx_r0, idx_r1, this->n_frames);
+			}
+		}
 	}
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
@@ -225,7 +243,61 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 	int idx_r0, idx_r1;
 	auto polar_patterns = tools::nodes_parser(this->polar_nodes, idx_r0, idx_r1);
 
-	if (this->implem == "FAST" && this->systematic)
+	// the list decoders do not have the path metric rules of the Type-II, Type-IV and Type-V nodes
+	for (auto pattern : polar_patterns)
+		if (pattern->type() == tools::polar_node_t::TYPE_2 ||
+		    pattern->type() == tools::polar_node_t::TYPE_4 ||
+		    pattern->type() == tools::polar_node_t::TYPE_5)
+		{
+			for (auto p : polar_patterns) delete p;
+
+			std::stringstream message;
+			message << "The Type-II, Type-IV and Type-V nodes are not supported by the SCL and ASCL decoders "
+			        << "('polar_nodes' = " << this->polar_nodes << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+	if (this->implem == "FAST" && this->systematic && this->simd_strategy == "LIST")
+	{
+		// the paths are vectorized instead of the nodes
+		if (crc != nullptr && crc->get_size() > 0)
+		{
+			if (this->type == "SCL") return new module::Decoder_polar_SCL_LV_fast_CA_sys<B, Q, API_polar>(this->K, this->N_cw, this->L, frozen_bits, polar_patterns, idx_r0, idx_r1, *crc, this->n_frames);
+		}
+		else
+		{
+			if (this->type == "SCL") return new module::Decoder_polar_SCL_LV_fast_sys   <B, Q, API_polar>(this->K, this->N_cw, this->L, frozen_bits, polar_patterns, idx_r0, idx_r1,       this->n_frames);
+		}
+	}
+	else if (this->implem == "FAST" && this->systematic && this->simd_strategy == "INTER")
+	{
+		// the SC decoding is vectorized over the frames, the list decoding is sequential
+		if (crc != nullptr && crc->get_size() > 0 && this->type == "ASCL")
+		{
+			// the SC stage decodes 'mipp::nElReg<Q>()' frames per call: the missing frames are decoded for nothing
+			if (this->n_frames % mipp::nElReg<Q>())
+				std::clog << tools::format_warning("The SC stage of the INTER ASCL decoder processes the frames by "
+				                                   "groups of " + std::to_string(mipp::nElReg<Q>()) + " (SIMD width), "
+				                                   "'n_frames' should be a multiple of it ('n_frames' = " +
+				                                   std::to_string(this->n_frames) + ").") << std::endl;
+
+			if (typeid(B) == typeid(signed char))
+			{
+#ifdef ENABLE_BIT_PACKING
+				using API_polar_inter = tools::API_polar_dynamic_inter_8bit_bitpacking<B,Q>;
+#else
+				using API_polar_inter = tools::API_polar_dynamic_inter<B,Q>;
+#endif
+				return new module::Decoder_polar_ASCL_inter_CA_sys<B, Q, API_polar_inter, API_polar>(this->K, this->N_cw, this->L, frozen_bits, polar_patterns, idx_r0, idx_r1, *crc, this->full_adaptive, this->n_frames);
+			}
+			else
+			{
+				using API_polar_inter = tools::API_polar_dynamic_inter<B,Q>;
+				return new module::Decoder_polar_ASCL_inter_CA_sys<B, Q, API_polar_inter, API_polar>(this->K, this->N_cw, this->L, frozen_bits, polar_patterns, idx_r0, idx_r1, *crc, this->full_adaptive, this->n_frames);
+			}
+		}
+	}
+	else if (this->implem == "FAST" && this->systematic)
 	{
 		if (crc != nullptr && crc->get_size() > 0)
 		{
@@ -256,7 +328,7 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 	{
 		if (this->type.find("SCL") != std::string::npos && this->implem == "FAST")
 		{
-			if (this->simd_strategy == "INTRA")
+			if (this->simd_strategy == "INTRA" || this->simd_strategy == "LIST")
 			{
 				if (typeid(B) == typeid(signed char))
 				{
@@ -271,13 +343,13 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 					return _build_scl_fast<B,Q,tools::API_polar_dynamic_intra<B,Q>>(frozen_bits, crc, encoder);
 				}
 			}
-			else if (this->simd_strategy.empty())
+			else if (this->simd_strategy.empty() || (this->simd_strategy == "INTER" && this->type == "ASCL"))
 			{
 				return _build_scl_fast<B,Q,tools::API_polar_dynamic_seq<B,Q>>(frozen_bits, crc, encoder);
 			}
 		}
 
-		if (this->simd_strategy == "INTER" && this->type == "SC" && this->implem == "FAST")
+		if (this->simd_strategy == "INTER" && this->type == "SC" && (this->implem == "FAST" || this->implem == "SPEC"))
 		{
 			if (typeid(B) == typeid(signed char))
 			{
@@ -306,7 +378,7 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 				return _build<B,Q,API_polar>(frozen_bits, crc, encoder);
 			}
 		}
-		else if (this->simd_strategy == "INTRA" && this->implem == "FAST")
+		else if (this->simd_strategy == "INTRA" && (this->implem == "FAST" || this->implem == "SPEC"))
 		{
 			if (typeid(B) == typeid(signed char))
 			{
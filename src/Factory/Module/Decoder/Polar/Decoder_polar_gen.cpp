@@ -8,6 +8,8 @@
 
 // before to uncomment these next lines, make sure to run the script to generate the decoders
 // (see "scripts/generate_polar_decoders.sh")
+// the "SPEC" implementation (see "Decoder_polar_SC_spec_sys") specializes the SC decoder at runtime for any frozen bits
+// without generating the decoders
 
 // RATE 1/2
 //#define ENABLE_DECODER_SC_FAST_N4_K2_SNR25
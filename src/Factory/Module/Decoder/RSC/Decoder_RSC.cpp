@@ -21,6 +21,10 @@
 #include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_fast.hpp"
 #include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_very_fast.hpp"
 
+#include "Module/Decoder/RSC/BCJR/Inter_generic/Decoder_RSC_BCJR_inter_generic.hpp"
+
+#include "Module/Decoder/RSC/BCJR/Window/Decoder_RSC_BCJR_window.hpp"
+
 #include "Decoder_RSC.hpp"
 
 using namespace aff3ct;
@@ -63,7 +67,11 @@ void Decoder_RSC::parameters
 	opt_args[{p+"-simd"}] =
 		{"string",
 		 "the SIMD strategy you want to use.",
-		 "INTRA, INTER"};
+		 "INTRA, INTER, WINDOW"};
+
+	opt_args[{p+"-win-size"}] =
+		{"strictly_positive_int",
+		 "the window size of the sub-block parallel BCJR (WINDOW SIMD strategy, one sub-block per SIMD lane)."};
 
 	opt_args[{p+"-max"}] =
 		{"string",
@@ -91,10 +99,11 @@ void Decoder_RSC::parameters
 
 	auto p = this->get_prefix();
 
-	if(exist(vals, {p+"-simd"   })) this->simd_strategy = vals.at({p+"-simd"});
-	if(exist(vals, {p+"-max"    })) this->max           = vals.at({p+"-max" });
-	if(exist(vals, {p+"-std"    })) this->standard      = vals.at({p+"-std" });
-	if(exist(vals, {p+"-no-buff"})) this->buffered      = false;
+	if(exist(vals, {p+"-simd"    })) this->simd_strategy = vals.at({p+"-simd"});
+	if(exist(vals, {p+"-max"     })) this->max           = vals.at({p+"-max" });
+	if(exist(vals, {p+"-std"     })) this->standard      = vals.at({p+"-std" });
+	if(exist(vals, {p+"-no-buff" })) this->buffered      = false;
+	if(exist(vals, {p+"-win-size"})) this->win_size      = std::stoi(vals.at({p+"-win-size"}));
 
 	if (this->standard == "LTE" && !exist(vals, {p+"-poly"}))
 		this->poly = {013, 015};
@@ -152,6 +161,9 @@ void Decoder_RSC::parameters
 		if (!this->simd_strategy.empty())
 			headers[p].push_back(std::make_pair(std::string("SIMD strategy"), this->simd_strategy));
 
+		if (this->simd_strategy == "WINDOW")
+			headers[p].push_back(std::make_pair(std::string("Window size"), std::to_string(this->win_size)));
+
 		headers[p].push_back(std::make_pair(std::string("Max type"), this->max));
 	}
 }
@@ -185,8 +197,12 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_RSC::parameters
 		     if (this->implem == "STD"      ) return new module::Decoder_RSC_BCJR_inter_std      <B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
 		else if (this->implem == "FAST"     ) return new module::Decoder_RSC_BCJR_inter_fast     <B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
 		else if (this->implem == "VERY_FAST") return new module::Decoder_RSC_BCJR_inter_very_fast<B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
+		else if (this->implem == "GENERIC"  ) return new module::Decoder_RSC_BCJR_inter_generic  <B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
 	}
 
+	if (this->type == "BCJR" && this->simd_strategy == "WINDOW")
+		return new module::Decoder_RSC_BCJR_window<B,Q,MAX>(this->K, trellis, this->win_size, this->buffered, this->n_frames);
+
 	if (this->type == "BCJR" && this->simd_strategy == "INTRA")
 	{
 		if (this->implem == "STD")
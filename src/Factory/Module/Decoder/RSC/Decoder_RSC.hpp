@@ -31,6 +31,7 @@ struct Decoder_RSC : public Decoder
 		std::string      standard      = "LTE";
 		bool             buffered      = true;
 		std::vector<int> poly          = {013, 015};
+		int              win_size      = 32;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Decoder_RSC_prefix);
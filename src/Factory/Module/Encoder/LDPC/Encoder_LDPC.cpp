@@ -53,6 +53,15 @@ void Encoder_LDPC::parameters
 		 "specify if the check nodes (CNs) from H have to be reordered, 'NONE': do nothing (default), 'ASC': from the "
 		 "smallest to the biggest CNs, 'DSC': from the biggest to the smallest CNs.",
 		 "NONE, ASC, DSC"};
+
+	opt_args[{p+"-g-cache"}] =
+		{"string",
+		 "path to a directory where the G matrices built from H are cached (used by the \"LDPC_H\" encoder)."};
+
+	opt_args[{p+"-m4r-budget"}] =
+		{"positive_int",
+		 "memory budget in MB of the Four Russians tables of G, shared by the threads (used by the \"LDPC\" and "
+		 "\"LDPC_H\" encoders)."};
 }
 
 void Encoder_LDPC::parameters
@@ -62,9 +71,11 @@ void Encoder_LDPC::parameters
 
 	auto p = this->get_prefix();
 
-	if(exist(vals, {p+"-h-path"   })) this->H_path    = vals.at({p+"-h-path"   });
-	if(exist(vals, {p+"-g-path"   })) this->G_path    = vals.at({p+"-g-path"   });
-	if(exist(vals, {p+"-h-reorder"})) this->H_reorder = vals.at({p+"-h-reorder"});
+	if(exist(vals, {p+"-h-path"    })) this->H_path     =           vals.at({p+"-h-path"    });
+	if(exist(vals, {p+"-g-path"    })) this->G_path     =           vals.at({p+"-g-path"    });
+	if(exist(vals, {p+"-h-reorder" })) this->H_reorder  =           vals.at({p+"-h-reorder" });
+	if(exist(vals, {p+"-g-cache"   })) this->G_cache    =           vals.at({p+"-g-cache"   });
+	if(exist(vals, {p+"-m4r-budget"})) this->M4R_budget = std::stoi(vals.at({p+"-m4r-budget"}));
 }
 
 void Encoder_LDPC::parameters
@@ -81,14 +92,20 @@ void Encoder_LDPC::parameters
 		headers[p].push_back(std::make_pair("H matrix path", this->H_path));
 		headers[p].push_back(std::make_pair("H matrix reordering", this->H_reorder));
 	}
+	if (this->type == "LDPC_H" && !this->G_cache.empty())
+		headers[p].push_back(std::make_pair("G matrix cache", this->G_cache));
+	if (this->type == "LDPC" || this->type == "LDPC_H")
+		headers[p].push_back(std::make_pair("M4R tables budget", std::to_string(this->M4R_budget) + " MB"));
 }
 
 template <typename B>
 module::Encoder_LDPC<B>* Encoder_LDPC::parameters
 ::build(const tools::Sparse_matrix &G, const tools::Sparse_matrix &H, const tools::dvbs2_values* dvbs2) const
 {
-	     if (this->type == "LDPC"      ) return new module::Encoder_LDPC        <B>(this->K, this->N_cw, G, this->n_frames);
-	else if (this->type == "LDPC_H"    ) return new module::Encoder_LDPC_from_H <B>(this->K, this->N_cw, H, this->n_frames);
+	const auto m4r_budget = (size_t)this->M4R_budget << 20;
+
+	     if (this->type == "LDPC"      ) return new module::Encoder_LDPC        <B>(this->K, this->N_cw, G, this->n_frames, m4r_budget);
+	else if (this->type == "LDPC_H"    ) return new module::Encoder_LDPC_from_H <B>(this->K, this->N_cw, H, this->n_frames, this->G_cache, m4r_budget);
 	else if (this->type == "LDPC_QC"   ) return new module::Encoder_LDPC_from_QC<B>(this->K, this->N_cw, H, this->n_frames);
 	else if (this->type == "LDPC_DVBS2" && dvbs2 != nullptr)
 		return new module::Encoder_LDPC_DVBS2  <B>(*dvbs2, this->n_frames);
@@ -26,7 +26,9 @@ struct Encoder_LDPC : public Encoder
 		std::string G_path = "";
 
 		// optional parameters
-		std::string H_reorder = "NONE";
+		std::string H_reorder  = "NONE";
+		std::string G_cache    = "";
+		int         M4R_budget = 64;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Encoder_LDPC_prefix);
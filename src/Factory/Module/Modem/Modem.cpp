@@ -101,6 +101,13 @@ void Modem::parameters
 		 "select the type of the max operation to use in the demodulator.",
 		 "MAX, MAXL, MAXS, MAXSS"};
 
+	opt_args[{p+"-implem"}] =
+		{"string",
+		 "select the implementation of the PAM and QAM demodulators: the search over all the symbols for each bit "
+		 "(STD) or the separable search over the points of each dimension, shared by the bits of a symbol (FAST). "
+		 "Both give the same LLRs with MAX, MAXS and MAXSS, MAXL differs on QAM (not associative).",
+		 "STD, FAST"};
+
 	opt_args[{p+"-sigma"}] =
 		{"strictly_posive_float",
 		 "noise variance value for the demodulator."};
@@ -192,6 +199,7 @@ void Modem::parameters
 	if(exist(vals, {p+"-ite"    })) this->n_ite   = std::stoi(vals.at({p+"-ite"  }));
 	if(exist(vals, {p+"-max"    })) this->max     =           vals.at({p+"-max"  });
 	if(exist(vals, {p+"-psi"    })) this->psi     =           vals.at({p+"-psi"  });
+	if(exist(vals, {p+"-implem" })) this->implem  =           vals.at({p+"-implem"});
 }
 
 void Modem::parameters
@@ -233,6 +241,8 @@ void Modem::parameters
 	headers[p].push_back(std::make_pair("Sigma square", demod_sig2));
 	if (demod_max != "unused")
 		headers[p].push_back(std::make_pair("Max type", demod_max));
+	if (this->type == "PAM" || this->type == "QAM")
+		headers[p].push_back(std::make_pair("Implementation", this->implem));
 	if (this->type == "SCMA")
 	{
 		headers[p].push_back(std::make_pair("Number of iterations", demod_ite));
@@ -247,8 +257,8 @@ module::Modem<B,R,Q>* Modem::parameters
 	     if (this->type == "BPSK"     ) return new module::Modem_BPSK     <B,R,Q    >(this->N,                   this->sigma,                                                                                               this->no_sig2, this->n_frames);
 	else if (this->type == "BPSK_FAST") return new module::Modem_BPSK_fast<B,R,Q    >(this->N,                   this->sigma,                                                                                               this->no_sig2, this->n_frames);
 	else if (this->type == "OOK"      ) return new module::Modem_OOK      <B,R,Q    >(this->N,                   this->sigma,                                                                                               this->no_sig2, this->n_frames);
-	else if (this->type == "PAM"      ) return new module::Modem_PAM      <B,R,Q,MAX>(this->N,                   this->sigma, this->bps,                                                                                    this->no_sig2, this->n_frames);
-	else if (this->type == "QAM"      ) return new module::Modem_QAM      <B,R,Q,MAX>(this->N,                   this->sigma, this->bps,                                                                                    this->no_sig2, this->n_frames);
+	else if (this->type == "PAM"      ) return new module::Modem_PAM      <B,R,Q,MAX>(this->N,                   this->sigma, this->bps,                                                                                    this->no_sig2, this->n_frames, this->implem == "FAST");
+	else if (this->type == "QAM"      ) return new module::Modem_QAM      <B,R,Q,MAX>(this->N,                   this->sigma, this->bps,                                                                                    this->no_sig2, this->n_frames, this->implem == "FAST");
 	else if (this->type == "PSK"      ) return new module::Modem_PSK      <B,R,Q,MAX>(this->N,                   this->sigma, this->bps,                                                                                    this->no_sig2, this->n_frames);
 	else if (this->type == "USER"     ) return new module::Modem_user     <B,R,Q,MAX>(this->N, this->const_path, this->sigma, this->bps,                                                                                    this->no_sig2, this->n_frames);
 	else if (this->type == "CPM"      ) return new module::Modem_CPM      <B,R,Q,MAX>(this->N,                   this->sigma, this->bps, this->upf, this->cpm_L, this->cpm_k, this->cpm_p, this->mapping, this->wave_shape, this->no_sig2, this->n_frames);
@@ -43,6 +43,7 @@ struct Modem : public Factory
 		// ------- demodulator parameters
 		std::string max        = "MAX";     // max to use in the demodulation (MAX = max, MAXL = max_linear, MAXS = max_star)
 		std::string psi        = "PSI0";    // psi function to use in the SCMA demodulation (PSI0, PSI1, PSI2, PSI3)
+		std::string implem     = "STD";     // demodulator implementation of the PAM and the QAM (STD, FAST)
 		bool        no_sig2    = false;     // do not divide by (sig^2) / 2 in the demodulation
 		int         n_ite      = 1;         // number of demodulations/decoding sessions to perform in the BFERI simulations
 		int         N_fil      = 0;         // frame size at the output of the filter
@@ -1,4 +1,5 @@
 #include <thread>
+#include <sstream>
 
 #include "BFER.hpp"
 
@@ -124,6 +125,27 @@ void BFER::parameters
 	opt_args[{p+"-coded"}] =
 		{"",
 		 "enable the coded monitoring (extends the monitored bits to the entire codeword)."};
+
+	opt_args[{p+"-snr-adapt"}] =
+		{"positive_float",
+		 "refine the SNR step around the waterfall: a middle point is simulated when the FER drops by more than this "
+		 "number of decades between two points (0 is disabled)."};
+
+	opt_args[{p+"-snr-step-min"}] =
+		{"positive_float",
+		 "minimal SNR distance between two refined points, in ]0, '--sim-snr-step'] (see the '--sim-snr-adapt' "
+		 "parameter, by default a quarter of the SNR step). The refined points are simulated and displayed after the "
+		 "points which surround them."};
+
+	opt_args[{p+"-stop-fer"}] =
+		{"positive_float",
+		 "FER floor: stop the current SNR point and the sweep when the 95% confidence interval of the FER is below "
+		 "this value (0 is disabled)."};
+
+	opt_args[{p+"-stop-ci"}] =
+		{"positive_float",
+		 "stop the current SNR point when the half width of the 95% confidence interval of the FER is below this "
+		 "fraction of the FER (0 is disabled)."};
 }
 
 void BFER::parameters
@@ -144,11 +166,17 @@ void BFER::parameters
 	if(exist(vals, {p+"-err-trk"        })) this->err_track_enable    = true;
 	if(exist(vals, {p+"-coset",      "c"})) this->coset               = true;
 	if(exist(vals, {p+"-coded",         })) this->coded_monitoring    = true;
+	if(exist(vals, {p+"-snr-adapt"      })) this->snr_adapt           = std::stof(vals.at({p+"-snr-adapt"    }));
+	if(exist(vals, {p+"-snr-step-min"   })) this->snr_step_min        = std::stof(vals.at({p+"-snr-step-min" }));
+	else                                      this->snr_step_min        = this->snr_step / 4.f;
+	if(exist(vals, {p+"-stop-fer"       })) this->stop_fer            = std::stof(vals.at({p+"-stop-fer"     }));
+	if(exist(vals, {p+"-stop-ci"        })) this->stop_ci             = std::stof(vals.at({p+"-stop-ci"      }));
 
 	if (this->err_track_revert)
 	{
 		this->err_track_enable = false;
 		this->n_threads = 1;
+		this->snr_adapt = 0.f; // only the saved SNR points can be replayed
 	}
 }
 
@@ -163,6 +191,27 @@ void BFER::parameters
 	headers[p].push_back(std::make_pair("Coset approach (c)", this->coset ? "yes" : "no"));
 	headers[p].push_back(std::make_pair("Coded monitoring", this->coded_monitoring ? "yes" : "no"));
 
+	if (this->snr_adapt > 0.f)
+	{
+		std::stringstream adapt;
+		adapt << this->snr_adapt << " decades (min step = " << this->snr_step_min << " dB)";
+		headers[p].push_back(std::make_pair("SNR refinement", adapt.str()));
+	}
+
+	if (this->stop_fer > 0.f)
+	{
+		std::stringstream stop_fer;
+		stop_fer << this->stop_fer;
+		headers[p].push_back(std::make_pair("FER floor", stop_fer.str()));
+	}
+
+	if (this->stop_ci > 0.f)
+	{
+		std::stringstream stop_ci;
+		stop_ci << this->stop_ci;
+		headers[p].push_back(std::make_pair("FER relative conf. interval", stop_ci.str()));
+	}
+
 	std::string enable_track = (this->err_track_enable) ? "on" : "off";
 	headers[p].push_back(std::make_pair("Bad frames tracking", enable_track));
 
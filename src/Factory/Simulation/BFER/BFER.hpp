@@ -34,6 +34,10 @@ struct BFER : Simulation
 		bool        err_track_enable    = false;
 		bool        coset               = false;
 		bool        coded_monitoring    = false;
+		float       snr_step_min        = 0.f;
+		float       snr_adapt           = 0.f;
+		float       stop_fer            = 0.f;
+		float       stop_ci             = 0.f;
 
 		// module parameters
 		Source       ::parameters *src = nullptr;
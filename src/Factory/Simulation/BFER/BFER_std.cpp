@@ -43,18 +43,73 @@ void BFER_std::parameters
 ::get_description(arg_map &req_args, arg_map &opt_args) const
 {
 	BFER::parameters::get_description(req_args, opt_args);
+
+	auto p = this->get_prefix();
+
+	opt_args[{p+"-sched"}] =
+		{"string",
+		 "select the threads scheduler: one full communication chain per thread (CHAIN), the tasks of the chains "
+		 "(replicated '--sim-threads' times) executed by a pool of work-stealing threads (STEAL) or each chain split "
+		 "in a pipeline of stages, one thread per stage (PIPELINE).",
+		 "CHAIN, STEAL, PIPELINE"};
+
+	opt_args[{p+"-workers"}] =
+		{"positive_int",
+		 "number of threads in the work-stealing pool (0 is the number of threads), to use with \"--sim-sched STEAL\"."};
+
+	opt_args[{p+"-pin"}] =
+		{"",
+		 "pin the threads on the cores of the machine."};
+
+	opt_args[{p+"-packed"}] =
+		{"",
+		 "pack the bits between the source, the CRC and the encoder, and between the decoder, the CRC and the "
+		 "monitor (8 bits per byte instead of one bit per element, the codewords are unpacked before the modem)."};
+
+	opt_args[{p+"-fused-fe"}] =
+		{"",
+		 "fuse the BPSK modulation, the AWGN channel, the demodulation and the quantization in a single pass over "
+		 "the frames (requires a BPSK modem, an AWGN channel and a standard quantizer)."};
+
+	opt_args[{p+"-snr-par"}] =
+		{"positive_int",
+		 "number of SNR points simulated at the same time: the threads are split in as many groups, one SNR point "
+		 "per group (the reports are displayed by increasing SNR at the end of each group of points)."};
 }
 
 void BFER_std::parameters
 ::store(const arg_val_map &vals)
 {
 	BFER::parameters::store(vals);
+
+	auto p = this->get_prefix();
+
+	if(exist(vals, {p+"-sched"   })) this->sched     =           vals.at({p+"-sched"   });
+	if(exist(vals, {p+"-workers" })) this->n_workers = std::stoi(vals.at({p+"-workers" }));
+	if(exist(vals, {p+"-pin"     })) this->pinning   = true;
+	if(exist(vals, {p+"-packed"  })) this->packed    = true;
+	if(exist(vals, {p+"-fused-fe"})) this->fused_fe  = true;
+	if(exist(vals, {p+"-snr-par" })) this->snr_par   = std::stoi(vals.at({p+"-snr-par" }));
+
+	if (this->n_workers <= 0)
+		this->n_workers = this->n_threads;
 }
 
 void BFER_std::parameters
 ::get_headers(std::map<std::string,header_list>& headers, const bool full) const
 {
 	BFER::parameters::get_headers(headers, full);
+
+	auto p = this->get_prefix();
+
+	headers[p].push_back(std::make_pair("Scheduler", this->sched));
+	if (this->sched == "STEAL")
+		headers[p].push_back(std::make_pair("Work-stealing threads", std::to_string(this->n_workers)));
+	headers[p].push_back(std::make_pair("Threads pinning", this->pinning ? "on" : "off"));
+	headers[p].push_back(std::make_pair("Packed bits", this->packed ? "on" : "off"));
+	headers[p].push_back(std::make_pair("Fused front-end", this->fused_fe ? "on" : "off"));
+	if (this->snr_par > 1)
+		headers[p].push_back(std::make_pair("Parallel SNR points", std::to_string(this->snr_par)));
 }
 
 template <typename B, typename R, typename Q>
@@ -28,6 +28,14 @@ struct BFER_std : BFER
 	{
 	public:
 		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		std::string sched     = "CHAIN";
+		int         n_workers = 0;
+		bool        pinning   = false;
+		bool        packed    = false;
+		bool        fused_fe  = false;
+		int         snr_par   = 1;
+
 		// module parameters
 		Codec_SIHO::parameters *cdc = nullptr;
 
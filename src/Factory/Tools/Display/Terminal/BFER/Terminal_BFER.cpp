@@ -34,6 +34,19 @@ void Terminal_BFER::parameters
 		{"string",
 		 "select the terminal type you want.",
 		 "STD"};
+
+	opt_args[{p+"-rec-path"}] =
+		{"string",
+		 "path to a file (or to a named pipe) where to write machine-readable records of the simulation."};
+
+	opt_args[{p+"-rec-type"}] =
+		{"string",
+		 "format of the records: one JSON object per line or comma-separated values.",
+		 "JSON, CSV"};
+
+	opt_args[{p+"-rec-freq"}] =
+		{"positive_int",
+		 "records frequency in ms (time step between two temporary records, 0 = only the final records)."};
 }
 
 void Terminal_BFER::parameters
@@ -43,7 +56,10 @@ void Terminal_BFER::parameters
 
 	auto p = this->get_prefix();
 
-	if(exist(vals, {p+"-type"})) this->type = vals.at({p+"-type"});
+	if(exist(vals, {p+"-type"    })) this->type     = vals.at({p+"-type"});
+	if(exist(vals, {p+"-rec-path"})) this->rec_path = vals.at({p+"-rec-path"});
+	if(exist(vals, {p+"-rec-type"})) this->rec_type = vals.at({p+"-rec-type"});
+	if(exist(vals, {p+"-rec-freq"})) this->rec_freq = std::chrono::milliseconds(std::stoi(vals.at({p+"-rec-freq"})));
 }
 
 void Terminal_BFER::parameters
@@ -52,6 +68,12 @@ void Terminal_BFER::parameters
 	auto p = this->get_prefix();
 
 	headers[p].push_back(std::make_pair("Type", this->type));
+	if (!this->rec_path.empty())
+	{
+		headers[p].push_back(std::make_pair("Records path", this->rec_path));
+		headers[p].push_back(std::make_pair("Records type", this->rec_type));
+		headers[p].push_back(std::make_pair("Records frequency (ms)", std::to_string(this->rec_freq.count())));
+	}
 
 	Terminal::parameters::get_headers(headers, full);
 }
@@ -65,6 +87,16 @@ tools::Terminal_BFER<B>* Terminal_BFER::parameters
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
 
+template <typename B>
+tools::Terminal_BFER_record<B>* Terminal_BFER::parameters
+::build_record(const module::Monitor_BFER<B> &monitor) const
+{
+	if (this->rec_type == "JSON" || this->rec_type == "CSV")
+		return new tools::Terminal_BFER_record<B>(monitor, this->rec_type);
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
 template <typename B>
 tools::Terminal_BFER<B>* Terminal_BFER
 ::build(const parameters &params, const module::Monitor_BFER<B> &monitor)
@@ -72,6 +104,13 @@ tools::Terminal_BFER<B>* Terminal_BFER
 	return params.template build<B>(monitor);
 }
 
+template <typename B>
+tools::Terminal_BFER_record<B>* Terminal_BFER
+::build_record(const parameters &params, const module::Monitor_BFER<B> &monitor)
+{
+	return params.template build_record<B>(monitor);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef MULTI_PREC
@@ -83,7 +122,17 @@ template aff3ct::tools::Terminal_BFER<B_8 >* aff3ct::factory::Terminal_BFER::bui
 template aff3ct::tools::Terminal_BFER<B_16>* aff3ct::factory::Terminal_BFER::build<B_16>(const aff3ct::factory::Terminal_BFER::parameters&, const aff3ct::module::Monitor_BFER<B_16>&);
 template aff3ct::tools::Terminal_BFER<B_32>* aff3ct::factory::Terminal_BFER::build<B_32>(const aff3ct::factory::Terminal_BFER::parameters&, const aff3ct::module::Monitor_BFER<B_32>&);
 template aff3ct::tools::Terminal_BFER<B_64>* aff3ct::factory::Terminal_BFER::build<B_64>(const aff3ct::factory::Terminal_BFER::parameters&, const aff3ct::module::Monitor_BFER<B_64>&);
+template aff3ct::tools::Terminal_BFER_record<B_8 >* aff3ct::factory::Terminal_BFER::parameters::build_record<B_8 >(const aff3ct::module::Monitor_BFER<B_8 >&) const;
+template aff3ct::tools::Terminal_BFER_record<B_16>* aff3ct::factory::Terminal_BFER::parameters::build_record<B_16>(const aff3ct::module::Monitor_BFER<B_16>&) const;
+template aff3ct::tools::Terminal_BFER_record<B_32>* aff3ct::factory::Terminal_BFER::parameters::build_record<B_32>(const aff3ct::module::Monitor_BFER<B_32>&) const;
+template aff3ct::tools::Terminal_BFER_record<B_64>* aff3ct::factory::Terminal_BFER::parameters::build_record<B_64>(const aff3ct::module::Monitor_BFER<B_64>&) const;
+template aff3ct::tools::Terminal_BFER_record<B_8 >* aff3ct::factory::Terminal_BFER::build_record<B_8 >(const aff3ct::factory::Terminal_BFER::parameters&, const aff3ct::module::Monitor_BFER<B_8 >&);
+template aff3ct::tools::Terminal_BFER_record<B_16>* aff3ct::factory::Terminal_BFER::build_record<B_16>(const aff3ct::factory::Terminal_BFER::parameters&, const aff3ct::module::Monitor_BFER<B_16>&);
+template aff3ct::tools::Terminal_BFER_record<B_32>* aff3ct::factory::Terminal_BFER::build_record<B_32>(const aff3ct::factory::Terminal_BFER::parameters&, const aff3ct::module::Monitor_BFER<B_32>&);
+template aff3ct::tools::Terminal_BFER_record<B_64>* aff3ct::factory::Terminal_BFER::build_record<B_64>(const aff3ct::factory::Terminal_BFER::parameters&, const aff3ct::module::Monitor_BFER<B_64>&);
 #else
 template aff3ct::tools::Terminal_BFER<B>* aff3ct::factory::Terminal_BFER::parameters::build<B>(const aff3ct::module::Monitor_BFER<B>&) const;
 template aff3ct::tools::Terminal_BFER<B>* aff3ct::factory::Terminal_BFER::build<B>(const aff3ct::factory::Terminal_BFER::parameters&, const aff3ct::module::Monitor_BFER<B>&);
+template aff3ct::tools::Terminal_BFER_record<B>* aff3ct::factory::Terminal_BFER::parameters::build_record<B>(const aff3ct::module::Monitor_BFER<B>&) const;
+template aff3ct::tools::Terminal_BFER_record<B>* aff3ct::factory::Terminal_BFER::build_record<B>(const aff3ct::factory::Terminal_BFER::parameters&, const aff3ct::module::Monitor_BFER<B>&);
 #endif
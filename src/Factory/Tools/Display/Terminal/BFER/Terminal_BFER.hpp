@@ -5,6 +5,7 @@
 #include <chrono>
 
 #include "Tools/Display/Terminal/BFER/Terminal_BFER.hpp"
+#include "Tools/Display/Terminal/BFER/Terminal_BFER_record.hpp"
 
 #include "Module/Monitor/BFER/Monitor_BFER.hpp"
 
@@ -23,7 +24,10 @@ struct Terminal_BFER : Terminal
 	public:
 		// ------------------------------------------------------------------------------------------------- PARAMETERS
 		// optional parameters
-		std::string type = "STD";
+		std::string               type     = "STD";
+		std::string               rec_path = "";     // machine-readable records (file or FIFO, empty = disabled)
+		std::string               rec_type = "JSON";
+		std::chrono::milliseconds rec_freq = std::chrono::milliseconds(1000);
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Terminal_BFER_prefix);
@@ -38,10 +42,16 @@ struct Terminal_BFER : Terminal
 		// builder
 		template <typename B = int>
 		tools::Terminal_BFER<B>* build(const module::Monitor_BFER<B> &monitor) const;
+
+		template <typename B = int>
+		tools::Terminal_BFER_record<B>* build_record(const module::Monitor_BFER<B> &monitor) const;
 	};
 
 	template <typename B = int>
 	static tools::Terminal_BFER<B>* build(const parameters &params, const module::Monitor_BFER<B> &monitor);
+
+	template <typename B = int>
+	static tools::Terminal_BFER_record<B>* build_record(const parameters &params, const module::Monitor_BFER<B> &monitor);
 };
 }
 }
@@ -11,8 +11,10 @@
 #include <string>
 #include <vector>
 #include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
 
 #include "Module/Module.hpp"
 
@@ -24,14 +26,16 @@ namespace module
 	{
 		namespace tsk
 		{
-			enum list { build, extract, check, SIZE };
+			enum list { build, extract, check, build_packed, extract_packed, SIZE };
 		}
 
 		namespace sck
 		{
-			namespace build   { enum list { U_K1, U_K2, SIZE }; }
-			namespace extract { enum list { V_K1, V_K2, SIZE }; }
-			namespace check   { enum list { V_K       , SIZE }; }
+			namespace build          { enum list { U_K1, U_K2, SIZE }; }
+			namespace extract        { enum list { V_K1, V_K2, SIZE }; }
+			namespace check          { enum list { V_K       , SIZE }; }
+			namespace build_packed   { enum list { U_K1, U_K2, SIZE }; }
+			namespace extract_packed { enum list { V_K1, V_K2, SIZE }; }
 		}
 	}
 
@@ -51,6 +55,8 @@ protected:
 	const int K; /*!< Number of information bits (the CRC bits are not included in K) */
 	const int size;
 
+	std::vector<B> buff_unpacked; // unpacked frames for the default implementations of the packed methods
+
 public:
 	/*!
 	 * \brief Constructor.
@@ -101,6 +107,28 @@ public:
 		{
 			return this->check(static_cast<B*>(p3s_V_K.get_dataptr())) ? 1 : 0;
 		});
+
+		auto &p4 = this->create_task("build_packed");
+		auto &p4s_U_K1 = this->template create_socket_in <B>(p4, "U_K1",  this->K               * this->n_frames);
+		auto &p4s_U_K2 = this->template create_socket_out<B>(p4, "U_K2", (this->K + this->size) * this->n_frames);
+		this->create_codelet(p4, [this, &p4s_U_K1, &p4s_U_K2]() -> int
+		{
+			this->build_packed(static_cast<B*>(p4s_U_K1.get_dataptr()),
+			                   static_cast<B*>(p4s_U_K2.get_dataptr()));
+
+			return 0;
+		});
+
+		auto &p5 = this->create_task("extract_packed");
+		auto &p5s_V_K1 = this->template create_socket_in <B>(p5, "V_K1", (this->K + this->size) * this->n_frames);
+		auto &p5s_V_K2 = this->template create_socket_out<B>(p5, "V_K2",  this->K               * this->n_frames);
+		this->create_codelet(p5, [this, &p5s_V_K1, &p5s_V_K2]() -> int
+		{
+			this->extract_packed(static_cast<B*>(p5s_V_K1.get_dataptr()),
+			                     static_cast<B*>(p5s_V_K2.get_dataptr()));
+
+			return 0;
+		});
 	}
 
 	/*!
@@ -216,6 +244,104 @@ public:
 			               f);
 	}
 
+	/*!
+	 * \brief Computes and adds the CRC (works on packed bits).
+	 *
+	 * \param U_K1: a vector of packed information bits.
+	 * \param U_K2: a vector of packed information bits followed by the CRC bits.
+	 *
+	 * The frames keep the stride of the unpacked frames, their bits are packed in their first bytes.
+	 */
+	template <class A = std::allocator<B>>
+	void build_packed(const std::vector<B,A>& U_K1, std::vector<B,A>& U_K2, const int frame_id = -1)
+	{
+		if (this->K * this->n_frames != (int)U_K1.size())
+		{
+			std::stringstream message;
+			message << "'U_K1.size()' has to be equal to 'K' * 'n_frames' ('U_K1.size()' = " << U_K1.size()
+			        << ", 'K' = " << this->K << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if ((this->K + this->get_size()) * this->n_frames != (int)U_K2.size())
+		{
+			std::stringstream message;
+			message << "'U_K2.size()' has to be equal to ('K' + 'get_size()') * 'n_frames' ('U_K2.size()' = "
+			        << U_K2.size() << ", 'K' = " << this->K << ", 'get_size()' = " << this->get_size()
+			        << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (frame_id != -1 && frame_id >= this->n_frames)
+		{
+			std::stringstream message;
+			message << "'frame_id' has to be equal to '-1' or to be smaller than 'n_frames' ('frame_id' = " 
+			        << frame_id << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->build_packed(U_K1.data(), U_K2.data(), frame_id);
+	}
+
+	void build_packed(const B *U_K1, B *U_K2, const int frame_id = -1)
+	{
+		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+		for (auto f = f_start; f < f_stop; f++)
+			this->_build_packed(U_K1 + f *  this->K,
+			                    U_K2 + f * (this->K + this->get_size()),
+			                    f);
+	}
+
+	/*!
+	 * \brief Extracts the information bits (works on packed bits).
+	 *
+	 * \param V_K1: a vector of packed information bits followed by the CRC bits.
+	 * \param V_K2: a vector of packed information bits.
+	 */
+	template <class A = std::allocator<B>>
+	void extract_packed(const std::vector<B,A>& V_K1, std::vector<B,A>& V_K2, const int frame_id = -1)
+	{
+		if ((this->K + this->get_size()) * this->n_frames != (int)V_K1.size())
+		{
+			std::stringstream message;
+			message << "'V_K1.size()' has to be equal to ('K' + 'get_size()') * 'n_frames' ('V_K1.size()' = "
+			        << V_K1.size() << ", 'K' = " << this->K << ", 'get_size()' = " << this->get_size()
+			        << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->K * this->n_frames != (int)V_K2.size())
+		{
+			std::stringstream message;
+			message << "'V_K2.size()' has to be equal to 'K' * 'n_frames' ('V_K2.size()' = " << V_K2.size()
+			        << ", 'K' = " << this->K << ", 'n_frames' =  " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (frame_id != -1 && frame_id >= this->n_frames)
+		{
+			std::stringstream message;
+			message << "'frame_id' has to be equal to '-1' or to be smaller than 'n_frames' ('frame_id' = " 
+			        << frame_id << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->extract_packed(V_K1.data(), V_K2.data(), frame_id);
+	}
+
+	void extract_packed(const B *V_K1, B *V_K2, const int frame_id = -1)
+	{
+		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+		for (auto f = f_start; f < f_stop; f++)
+			this->_extract_packed(V_K1 + f * (this->K + this->get_size()),
+			                      V_K2 + f *  this->K,
+			                      f);
+	}
+
 	/*!
 	 * \brief Checks if the CRC is verified or not.
 	 *
@@ -335,6 +461,29 @@ protected:
 		throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
 	}
 
+	virtual void _build_packed(const B *U_K1, B *U_K2, const int frame_id)
+	{
+		this->buff_unpacked.resize(2 * this->K + this->get_size());
+		const auto U_K1_unpacked = this->buff_unpacked.data();
+		const auto U_K2_unpacked = this->buff_unpacked.data() + this->K;
+
+		tools::Bit_packer<B>::unpack(U_K1, U_K1_unpacked, this->K);
+		this->_build(U_K1_unpacked, U_K2_unpacked, frame_id);
+		tools::Bit_packer<B>::pack(U_K2_unpacked, U_K2, this->K + this->get_size());
+	}
+
+	virtual void _extract_packed(const B *V_K1, B *V_K2, const int frame_id)
+	{
+		// the information bits are the first bits of the frame
+		const auto n_bytes = (this->K + 7) / 8;
+		const auto bytes_in  = (const unsigned char*)V_K1;
+		      auto bytes_out = (unsigned char*)V_K2;
+
+		std::copy(bytes_in, bytes_in + n_bytes, bytes_out);
+		if (this->K % 8)
+			bytes_out[n_bytes -1] &= (unsigned char)((1 << (this->K % 8)) -1);
+	}
+
 	virtual bool _check(const B *V_K, const int frame_id)
 	{
 		throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
@@ -60,6 +60,33 @@ void CRC_polynomial_fast<B>
 		U_K2[this->K +i] = (crc >> i) & 1;
 }
 
+template <typename B>
+void CRC_polynomial_fast<B>
+::_build_packed(const B *U_K1, B *U_K2, const int frame_id)
+{
+#if __BYTE_ORDER != __LITTLE_ENDIAN
+	throw tools::runtime_error(__FILE__, __LINE__, __func__, "The code of the fast CRC works only on little endian CPUs.");
+#endif
+
+	const auto bytes_in  = (const unsigned char*)U_K1;
+	const auto bytes_out = (unsigned char*)U_K2;
+	const auto crc       = this->compute_crc_v3((void*)bytes_in, this->K);
+
+	const auto n_bytes_K   = (this->K + 7) / 8;
+	const auto n_bytes_crc = (this->K + this->size + 7) / 8;
+	const auto rest        = this->K % 8;
+
+	if (bytes_out != bytes_in)
+		std::copy(bytes_in, bytes_in + n_bytes_K, bytes_out);
+	if (rest)
+		bytes_out[n_bytes_K -1] &= (unsigned char)((1 << rest) -1);
+	std::fill(bytes_out + n_bytes_K, bytes_out + n_bytes_crc, (unsigned char)0);
+
+	// the CRC bits follow the information bits
+	for (auto i = 0; i < this->size; i++)
+		bytes_out[(this->K + i) / 8] |= (unsigned char)(((crc >> i) & 1) << ((this->K + i) % 8));
+}
+
 template <typename B>
 bool CRC_polynomial_fast<B>
 ::_check(const B *V_K, const int frame_id)
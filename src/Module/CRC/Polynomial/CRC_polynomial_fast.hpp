@@ -22,6 +22,7 @@ public:
 
 protected:
 	virtual void _build       (const B *U_K1, B *U_K2, const int frame_id);
+	virtual void _build_packed(const B *U_K1, B *U_K2, const int frame_id);
 	virtual bool _check       (const B *V_K          , const int frame_id);
 	virtual bool _check_packed(const B *V_K          , const int frame_id);
 
@@ -68,14 +68,22 @@ void Channel_AWGN_LLR<R>
 		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
 		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
 
-		if (frame_id < 0)
-			noise_generator->generate(this->noise, this->sigma);
-		else
-			noise_generator->generate(this->noise.data() + f_start * this->N, this->N, this->sigma);
+		if (this->noise_storage)
+		{
+			if (frame_id < 0)
+				noise_generator->generate(this->noise, this->sigma);
+			else
+				noise_generator->generate(this->noise.data() + f_start * this->N, this->N, this->sigma);
 
-		for (auto f = f_start; f < f_stop; f++)
-			for (auto n = 0; n < this->N; n++)
-				Y_N[f * this->N +n] = X_N[f * this->N +n] + this->noise[f * this->N +n];
+			for (auto f = f_start; f < f_stop; f++)
+				for (auto n = 0; n < this->N; n++)
+					Y_N[f * this->N +n] = X_N[f * this->N +n] + this->noise[f * this->N +n];
+		}
+		else // the noise is directly generated in 'Y_N' (single pass, no intermediate buffer)
+			noise_generator->generate_and_add(X_N + f_start * this->N,
+			                                  Y_N + f_start * this->N,
+			                                  (f_stop - f_start) * this->N,
+			                                  this->sigma);
 	}
 }
 
@@ -52,6 +52,7 @@ protected:
 	      R   sigma; /*!< Sigma^2, the noise variance */
 
 	std::vector<R> noise;
+	bool noise_storage; /*!< If false, the channel is allowed to add the noise without storing it in 'noise' */
 
 public:
 	/*!
@@ -62,7 +63,7 @@ public:
 	 * \param name:     Channel's name.
 	 */
 	Channel(const int N, const R sigma = -1.f, const int n_frames = 1)
-	: Module(n_frames), N(N), sigma(sigma), noise(this->N * this->n_frames, 0)
+	: Module(n_frames), N(N), sigma(sigma), noise(this->N * this->n_frames, 0), noise_storage(true)
 	{
 		const std::string name = "Channel";
 		this->set_name(name);
@@ -122,6 +123,18 @@ public:
 		return noise;
 	}
 
+	/*!
+	 * \brief Enables or disables the storage of the generated noise (see get_noise()).
+	 *
+	 * When the noise is not stored, a channel can add the noise directly into its output signal.
+	 *
+	 * \param noise_storage: true to store the noise in the vector returned by get_noise() (default).
+	 */
+	void set_noise_storage(const bool noise_storage)
+	{
+		this->noise_storage = noise_storage;
+	}
+
 	virtual void set_sigma(const R sigma)
 	{
 		if (sigma <= 0)
@@ -27,7 +27,8 @@ Codec_turbo<B,Q>
 : Codec     <B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
   Codec_SIHO<B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
   sub_enc(nullptr),
-  sub_dec(nullptr)
+  sub_dec_n(nullptr),
+  sub_dec_i(nullptr)
 {
 	const std::string name = "Codec_turbo";
 	this->set_name(name);
@@ -111,8 +112,14 @@ Codec_turbo<B,Q>
 	}
 	catch (tools::cannot_allocate const&)
 	{
-		sub_dec = factory::Decoder_RSC::build_siso<B,Q>(*dec_params.sub1, trellis, json_stream, dec_params.n_ite);
-		decoder_turbo = factory::Decoder_turbo::build<B,Q>(dec_params, this->get_interleaver_llr(), *sub_dec, *sub_dec,
+		sub_dec_n = factory::Decoder_RSC::build_siso<B,Q>(*dec_params.sub1, trellis, json_stream, dec_params.n_ite);
+
+		// the windowed BCJR keeps the boundary metrics of the previous call: one decoder per domain
+		if (dec_params.sub1->simd_strategy == "WINDOW")
+			sub_dec_i = factory::Decoder_RSC::build_siso<B,Q>(*dec_params.sub1, trellis, json_stream, dec_params.n_ite);
+
+		decoder_turbo = factory::Decoder_turbo::build<B,Q>(dec_params, this->get_interleaver_llr(),
+		                                                   *sub_dec_n, sub_dec_i ? *sub_dec_i : *sub_dec_n,
 		                                                   this->get_encoder());
 		this->set_decoder_siho(decoder_turbo);
 	}
@@ -158,7 +165,8 @@ Codec_turbo<B,Q>
 ::~Codec_turbo()
 {
 	if (sub_enc != nullptr) { delete sub_enc; sub_enc = nullptr; }
-	if (sub_dec != nullptr) { delete sub_dec; sub_dec = nullptr; }
+	if (sub_dec_n != nullptr) { delete sub_dec_n; sub_dec_n = nullptr; }
+	if (sub_dec_i != nullptr) { delete sub_dec_i; sub_dec_i = nullptr; }
 
 	if (post_pros.size())
 		for (auto i = 0; i < (int)post_pros.size(); i++)
@@ -26,7 +26,8 @@ class Codec_turbo : public Codec_SIHO<B,Q>
 protected:
 	std::vector<std::vector<int>>                  trellis;
 	module::Encoder_RSC_sys<B>*                    sub_enc;
-	module::Decoder_SISO   <Q>*                    sub_dec;
+	module::Decoder_SISO   <Q>*                    sub_dec_n;
+	module::Decoder_SISO   <Q>*                    sub_dec_i;
 	std::vector<tools::Post_processing_SISO<B,Q>*> post_pros;
 	std::ofstream                                  json_stream;
 
@@ -3,6 +3,7 @@
 
 #include "Tools/Perf/hard_decision.h"
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Timer/Sub_task_timer.hpp"
 
 #include "Decoder_BCH.hpp"
 
@@ -203,84 +204,60 @@ template <typename B, typename R>
 void Decoder_BCH<B, R>
 ::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_hiho]);
 	std::copy(Y_N, Y_N + this->N, YH_N.begin());
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_hiho::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	this->_decode(YH_N.data());
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_hiho::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	std::copy(YH_N.data() + this->N - this->K, YH_N.data() + this->N, V_K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::load,   d_load);
-//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::decode, d_decod);
-//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::store,  d_store);
+	timer.lap(dec::tm::decode_hiho::store);
 }
 
 template <typename B, typename R>
 void Decoder_BCH<B, R>
 ::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_hiho_cw]);
 	std::copy(Y_N, Y_N + this->N, YH_N.begin());
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_hiho_cw::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	this->_decode(YH_N.data());
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_hiho_cw::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	std::copy(YH_N.data(), YH_N.data() + this->N, V_N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::store,  d_store);
+	timer.lap(dec::tm::decode_hiho_cw::store);
 }
 
 template <typename B, typename R>
 void Decoder_BCH<B, R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho]);
 	tools::hard_decide(Y_N, YH_N.data(), this->N);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	this->_decode(YH_N.data());
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	std::copy(YH_N.data() + this->N - this->K, YH_N.data() + this->N, V_K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	timer.lap(dec::tm::decode_siho::store);
 }
 
 template <typename B, typename R>
 void Decoder_BCH<B, R>
 ::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho_cw]);
 	tools::hard_decide(Y_N, YH_N.data(), this->N);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho_cw::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	this->_decode(YH_N.data());
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho_cw::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	std::copy(YH_N.data(), YH_N.data() + this->N, V_N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+	timer.lap(dec::tm::decode_siho_cw::store);
 }
 
 // ==================================================================================== explicit template instantiation
@@ -19,16 +19,17 @@ namespace module
 	{
 		namespace tsk
 		{
-			enum list { decode_hiho, decode_hiho_cw, decode_siho, decode_siho_cw, decode_siso, SIZE };
+			enum list { decode_hiho, decode_hiho_cw, decode_siho, decode_siho_cw, decode_siho_packed, decode_siso, SIZE };
 		}
 
 		namespace sck
 		{
-			namespace decode_hiho   { enum list { Y_N,  V_K , SIZE }; }
-			namespace decode_hiho_cw{ enum list { Y_N,  V_N , SIZE }; }
-			namespace decode_siho   { enum list { Y_N,  V_K , SIZE }; }
-			namespace decode_siho_cw{ enum list { Y_N,  V_N , SIZE }; }
-			namespace decode_siso   { enum list { Y_N1, Y_N2, SIZE }; }
+			namespace decode_hiho       { enum list { Y_N,  V_K , SIZE }; }
+			namespace decode_hiho_cw    { enum list { Y_N,  V_N , SIZE }; }
+			namespace decode_siho       { enum list { Y_N,  V_K , SIZE }; }
+			namespace decode_siho_cw    { enum list { Y_N,  V_N , SIZE }; }
+			namespace decode_siho_packed{ enum list { Y_N,  V_K , SIZE }; }
+			namespace decode_siso       { enum list { Y_N1, Y_N2, SIZE }; }
 		}
 
 		namespace tm
@@ -15,6 +15,7 @@
 #include <sstream>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
 
 #include "Decoder.hpp"
 
@@ -87,6 +88,18 @@ public:
 		this->register_timer(p2, "decode");
 		this->register_timer(p2, "store");
 		this->register_timer(p2, "total");
+
+		// the timers of the decoding are updated in the 'decode_siho' task
+		auto &p3 = this->create_task("decode_siho_packed", dec::tsk::decode_siho_packed);
+		auto &p3s_Y_N = this->template create_socket_in <R>(p3, "Y_N", this->N * this->n_frames);
+		auto &p3s_V_K = this->template create_socket_out<B>(p3, "V_K", this->K * this->n_frames);
+		this->create_codelet(p3, [this, &p3s_Y_N, &p3s_V_K]() -> int
+		{
+			this->decode_siho_packed(static_cast<R*>(p3s_Y_N.get_dataptr()),
+			                         static_cast<B*>(p3s_V_K.get_dataptr()));
+
+			return 0;
+		});
 	}
 
 	/*!
@@ -182,6 +195,55 @@ public:
 		}
 	}
 
+	/*!
+	 * \brief Decodes the noisy frame and packs the decoded bits.
+	 *
+	 * \param Y_N: a noisy frame.
+	 * \param V_K: a packed decoded codeword (only the information bits), the frames keep the stride of the unpacked
+	 *             frames and their bits are packed in their first bytes.
+	 */
+	template <class AR = std::allocator<R>, class AB = std::allocator<B>>
+	void decode_siho_packed(const std::vector<R,AR>& Y_N, std::vector<B,AB>& V_K, const int frame_id = -1)
+	{
+		if (this->N * this->n_frames != (int)Y_N.size())
+		{
+			std::stringstream message;
+			message << "'Y_N.size()' has to be equal to 'N' * 'n_frames' ('Y_N.size()' = " << Y_N.size()
+			        << ", 'N' = " << this->N << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->K * this->n_frames != (int)V_K.size())
+		{
+			std::stringstream message;
+			message << "'V_K.size()' has to be equal to 'K' * 'n_frames' ('V_K.size()' = " << V_K.size()
+			        << ", 'K' = " << this->K << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (frame_id != -1 && frame_id >= this->n_frames)
+		{
+			std::stringstream message;
+			message << "'frame_id' has to be equal to '-1' or to be smaller than 'n_frames' ('frame_id' = " 
+			        << frame_id << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->decode_siho_packed(Y_N.data(), V_K.data(), frame_id);
+	}
+
+	void decode_siho_packed(const R *Y_N, B *V_K, const int frame_id = -1)
+	{
+		this->decode_siho(Y_N, V_K, frame_id);
+
+		// each frame is packed in place (the packed bits of a frame never overwrite its unread bits)
+		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+		for (auto f = f_start; f < f_stop; f++)
+			tools::Bit_packer<B>::pack(V_K + f * this->K, this->K);
+	}
+
 	template <class AR = std::allocator<R>, class AB = std::allocator<B>>
 	void decode_siho_cw(const std::vector<R,AR>& Y_N, std::vector<B,AB>& V_N, const int frame_id = -1)
 	{
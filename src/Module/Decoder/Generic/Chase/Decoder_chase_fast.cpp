@@ -0,0 +1,314 @@
+#include <cmath>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <numeric>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/hard_decision.h"
+
+#include "Decoder_chase_fast.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_chase_fast<B,R>
+::Decoder_chase_fast(const int K, const int N, Encoder<B> &encoder, const uint32_t max_flips, const bool hamming,
+                     std::shared_ptr<Decoder_HIHO<B>> inner_decoder, const int n_frames)
+: Decoder          (K, N, n_frames, 1),
+  Decoder_SIHO<B,R>(K, N, n_frames, 1),
+  encoder(encoder),
+  inner_decoder(inner_decoder),
+  max_flips(max_flips),
+  hamming(hamming),
+  n_words((N + 63) / 64),
+  n_low(std::min((int)max_flips, 4)),
+  n_patterns(1 << n_low),
+  syndrome_cols(N * n_words),
+  less_reliable_llrs(N),
+  best_X_N(N),
+  hard_X_N(N),
+  test_X_N(N),
+  cand_X_N(N),
+  syndrome(n_words),
+  batch_syndromes(n_patterns * n_words),
+  batch_metrics(n_patterns)
+{
+	const std::string name = "Decoder_chase_fast";
+	this->set_name(name);
+
+	if (max_flips > (uint32_t)N)
+	{
+		std::stringstream message;
+		message << "'max_flips' has to be smaller than 'N' ('max_flips' = " << max_flips
+		        << ", 'N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (max_flips > 31)
+	{
+		std::stringstream message;
+		message << "'max_flips' has to be smaller or equal to 31 ('max_flips' = " << max_flips << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (!encoder.is_sys())
+	{
+		std::stringstream message;
+		message << "'encoder.is_sys()' has to be true.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (inner_decoder != nullptr)
+	{
+		if (inner_decoder->get_K() != K || inner_decoder->get_N() != N)
+		{
+			std::stringstream message;
+			message << "'inner_decoder->get_K()' and 'inner_decoder->get_N()' have to be equal to 'K' and 'N' "
+			        << "('inner_decoder->get_K()' = " << inner_decoder->get_K() << ", 'inner_decoder->get_N()' = "
+			        << inner_decoder->get_N() << ", 'K' = " << K << ", 'N' = " << N << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (inner_decoder->get_n_frames() != 1)
+		{
+			std::stringstream message;
+			message << "'inner_decoder->get_n_frames()' has to be equal to 1 ('inner_decoder->get_n_frames()' = "
+			        << inner_decoder->get_n_frames() << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	this->build_syndrome_cols();
+}
+
+template <typename B, typename R>
+Decoder_chase_fast<B,R>
+::~Decoder_chase_fast()
+{
+}
+
+template <typename B, typename R>
+void Decoder_chase_fast<B,R>
+::build_syndrome_cols()
+{
+	// the syndrome of 'X_N' is 'X_N ^ encode(info bits of X_N)': it is linear in 'X_N' and null only for the codewords
+	std::vector<B> U_K(this->K), X_N(this->N);
+	const auto &info_bits_pos = this->encoder.get_info_bits_pos();
+
+	for (auto n = 0; n < this->N; n++)
+		this->syndrome_cols[n * this->n_words + (n >> 6)] = (uint64_t)1 << (n & 63);
+
+	for (auto k = 0; k < this->K; k++)
+	{
+		std::fill(U_K.begin(), U_K.end(), (B)0);
+		U_K[k] = (B)1;
+		this->encoder.encode(U_K.data(), X_N.data(), 0);
+
+		auto col = this->syndrome_cols.data() + info_bits_pos[k] * this->n_words;
+		for (auto n = 0; n < this->N; n++)
+			if (X_N[n])
+				col[n >> 6] ^= (uint64_t)1 << (n & 63);
+	}
+
+	// the syndrome is valid only if the code is linear: check it on some codewords
+	std::mt19937 rd_engine(0);
+	std::bernoulli_distribution dist;
+	for (auto t = 0; t < 32; t++)
+	{
+		for (auto k = 0; k < this->K; k++)
+			U_K[k] = (t == 0) ? (B)0 : (B)dist(rd_engine);
+		this->encoder.encode(U_K.data(), X_N.data(), 0);
+
+		this->compute_syndrome(X_N.data(), this->syndrome.data());
+		if (std::any_of(this->syndrome.begin(), this->syndrome.end(), [](const uint64_t s) { return s != 0; }))
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The code has to be linear.");
+	}
+}
+
+template <typename B, typename R>
+void Decoder_chase_fast<B,R>
+::compute_syndrome(const B *X_N, uint64_t *syn) const
+{
+	std::fill(syn, syn + this->n_words, (uint64_t)0);
+	for (auto n = 0; n < this->N; n++)
+		if (X_N[n])
+			for (auto w = 0; w < this->n_words; w++)
+				syn[w] ^= this->syndrome_cols[n * this->n_words + w];
+}
+
+template <typename B, typename R>
+float Decoder_chase_fast<B,R>
+::flip_metric(const R *Y_N, const uint32_t n) const
+{
+	return this->hamming ? 1.f : std::abs((float)Y_N[n]);
+}
+
+template <typename B, typename R>
+void Decoder_chase_fast<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_decode_siho_cw(Y_N, this->best_X_N.data(), frame_id);
+
+	const auto &info_bits_pos = this->encoder.get_info_bits_pos();
+	for (auto k = 0; k < this->K; k++)
+		V_K[k] = this->best_X_N[info_bits_pos[k]];
+}
+
+template <typename B, typename R>
+void Decoder_chase_fast<B,R>
+::_decode_siho_cw_syndrome(const R *Y_N, B *V_N)
+{
+	const auto n_high = (int)this->max_flips - this->n_low;
+	const auto W      = this->n_words;
+	const auto cols   = this->syndrome_cols.data();
+	      auto bs     = this->batch_syndromes.data();
+	      auto bm     = this->batch_metrics.data();
+
+	// syndromes and metrics of the patterns of a batch (flips of the 'n_low' least reliable bits)
+	std::fill(bs, bs + W, (uint64_t)0);
+	bm[0] = 0.f;
+	for (auto l = 1; l < this->n_patterns; l++)
+	{
+		auto b = 0;
+		while (!((l >> b) & 1))
+			b++;
+
+		const auto prev = l & (l -1);
+		const auto pos  = this->less_reliable_llrs[b];
+		for (auto w = 0; w < W; w++)
+			bs[l * W + w] = bs[prev * W + w] ^ cols[pos * W + w];
+		bm[l] = bm[prev] + this->flip_metric(Y_N, pos);
+	}
+
+	auto best_metric = std::numeric_limits<float>::max();
+	auto best_low    = (uint32_t)0;
+	auto best_high   = (uint32_t)0;
+
+	// the flips of the other bits are enumerated in Gray-code order, the syndrome is updated with one column per batch
+	auto gray        = (uint32_t)0;
+	auto high_metric = 0.f;
+	for (uint32_t h = 0; h < ((uint32_t)1 << n_high); h++)
+	{
+		if (h)
+		{
+			auto b = 0;
+			while (!((h >> b) & 1))
+				b++;
+
+			const auto pos = this->less_reliable_llrs[this->n_low + b];
+			gray ^= (uint32_t)1 << b;
+			high_metric += ((gray >> b) & 1) ? this->flip_metric(Y_N, pos) : -this->flip_metric(Y_N, pos);
+			for (auto w = 0; w < W; w++)
+				this->syndrome[w] ^= cols[pos * W + w];
+		}
+
+		// evaluate the patterns of the batch
+		for (auto l = 0; l < this->n_patterns; l++)
+		{
+			uint64_t diff = 0;
+			for (auto w = 0; w < W; w++)
+				diff |= this->syndrome[w] ^ bs[l * W + w];
+
+			const auto metric = high_metric + bm[l];
+			if (!diff && metric < best_metric)
+			{
+				best_metric = metric;
+				best_low    = (uint32_t)l;
+				best_high   = gray;
+			}
+		}
+	}
+
+	// apply the best pattern (if none, the hard decision is kept)
+	for (auto b = 0; b < this->n_low; b++)
+		if ((best_low >> b) & 1)
+			V_N[this->less_reliable_llrs[b]] = !V_N[this->less_reliable_llrs[b]];
+	for (auto b = 0; b < n_high; b++)
+		if ((best_high >> b) & 1)
+			V_N[this->less_reliable_llrs[this->n_low + b]] = !V_N[this->less_reliable_llrs[this->n_low + b]];
+}
+
+template <typename B, typename R>
+void Decoder_chase_fast<B,R>
+::_decode_siho_cw_inner(const R *Y_N, B *V_N)
+{
+	std::copy(V_N, V_N + this->N, this->hard_X_N.begin());
+	std::copy(V_N, V_N + this->N, this->test_X_N.begin());
+
+	auto best_metric = std::numeric_limits<float>::max();
+
+	// the test vectors are enumerated in Gray-code order: one bit is flipped from a test vector to the next one
+	for (uint32_t t = 0; t < ((uint32_t)1 << this->max_flips); t++)
+	{
+		if (t)
+		{
+			auto b = 0;
+			while (!((t >> b) & 1))
+				b++;
+
+			const auto pos = this->less_reliable_llrs[b];
+			this->test_X_N[pos] = !this->test_X_N[pos];
+		}
+
+		this->inner_decoder->decode_hiho_cw(this->test_X_N.data(), this->cand_X_N.data());
+
+		auto metric = 0.f;
+		for (auto n = 0; n < this->N; n++)
+			if (this->cand_X_N[n] != this->hard_X_N[n])
+				metric += this->flip_metric(Y_N, n);
+
+		if (metric < best_metric)
+		{
+			// the inner decoder can fail: check that the decoded test vector is a codeword
+			this->compute_syndrome(this->cand_X_N.data(), this->syndrome.data());
+			if (std::all_of(this->syndrome.begin(), this->syndrome.end(), [](const uint64_t s) { return s == 0; }))
+			{
+				best_metric = metric;
+				std::copy(this->cand_X_N.begin(), this->cand_X_N.end(), V_N);
+			}
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_chase_fast<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	tools::hard_decide(Y_N, V_N, this->N);
+
+	if (!this->max_flips)
+		return;
+
+	this->compute_syndrome(V_N, this->syndrome.data());
+	if (std::all_of(this->syndrome.begin(), this->syndrome.end(), [](const uint64_t s) { return s == 0; }))
+		return;
+
+	std::iota(less_reliable_llrs.begin(), less_reliable_llrs.end(), 0);
+
+	std::partial_sort(less_reliable_llrs.begin(),
+	                  less_reliable_llrs.begin() + this->max_flips,
+	                  less_reliable_llrs.end(),
+	                  [&Y_N](const uint32_t i1, const uint32_t i2) {
+		return std::abs(Y_N[i1]) < std::abs(Y_N[i2]);
+	});
+
+	if (this->inner_decoder != nullptr)
+		this->_decode_siho_cw_inner(Y_N, V_N);
+	else
+		this->_decode_siho_cw_syndrome(Y_N, V_N);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_chase_fast<B_8,Q_8>;
+template class aff3ct::module::Decoder_chase_fast<B_16,Q_16>;
+template class aff3ct::module::Decoder_chase_fast<B_32,Q_32>;
+template class aff3ct::module::Decoder_chase_fast<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_chase_fast<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
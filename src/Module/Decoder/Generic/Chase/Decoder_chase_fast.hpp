@@ -0,0 +1,70 @@
+#ifndef DECODER_CHASE_FAST_HPP_
+#define DECODER_CHASE_FAST_HPP_
+
+#include <memory>
+#include <vector>
+
+#include "Module/Encoder/Encoder.hpp"
+
+#include "../../Decoder_SIHO.hpp"
+#include "../../Decoder_HIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Chase-II decoder for the linear systematic codes. The test patterns flip the 'max_flips' least reliable bits and
+ * are enumerated in Gray-code order (one bit changes from a pattern to the next one).
+ *
+ * Without inner decoder, a test pattern is a candidate if it leads to a codeword: the syndrome and the metric are
+ * updated incrementally and the patterns are evaluated by batches (the patterns of a batch only differ on the
+ * least reliable bits, their syndromes and metrics are precomputed per frame).
+ *
+ * With an inner HIHO decoder (e.g. Decoder_BCH), each test vector is decoded by the inner decoder and the closest
+ * decoded codeword is selected (the decoding failures are detected with the syndrome).
+ */
+template <typename B = int, typename R = float>
+class Decoder_chase_fast : public Decoder_SIHO<B,R>
+{
+protected:
+	Encoder<B> &encoder;
+	std::shared_ptr<Decoder_HIHO<B>> inner_decoder;
+	const uint32_t max_flips;
+	const bool     hamming;
+	const int      n_words;    // number of 64-bit words per syndrome
+	const int      n_low;      // number of flips evaluated per batch
+	const int      n_patterns; // number of patterns per batch
+
+	std::vector<uint64_t> syndrome_cols; // syndrome of each bit of the codeword (n_words per bit)
+	std::vector<uint32_t> less_reliable_llrs;
+	std::vector<B>        best_X_N;
+	std::vector<B>        hard_X_N; // hard decision (inner decoder)
+	std::vector<B>        test_X_N; // test vector (inner decoder)
+	std::vector<B>        cand_X_N; // decoded test vector (inner decoder)
+	std::vector<uint64_t> syndrome;
+	std::vector<uint64_t> batch_syndromes;
+	std::vector<float>    batch_metrics;
+
+public:
+	Decoder_chase_fast(const int K, const int N, Encoder<B> &encoder, const uint32_t max_flips = 3,
+	                   const bool hamming = false, std::shared_ptr<Decoder_HIHO<B>> inner_decoder = nullptr,
+	                   const int n_frames = 1);
+	virtual ~Decoder_chase_fast();
+
+protected:
+	void _decode_siho   (const R *Y_N,  B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N,  B *V_N, const int frame_id);
+
+	void _decode_siho_cw_syndrome(const R *Y_N, B *V_N);
+	void _decode_siho_cw_inner   (const R *Y_N, B *V_N);
+
+private:
+	void  build_syndrome_cols(                               );
+	void  compute_syndrome   (const B *X_N, uint64_t *syn    ) const;
+	float flip_metric        (const R *Y_N, const uint32_t n) const;
+};
+}
+}
+
+#endif /* DECODER_CHASE_FAST_HPP_ */
@@ -0,0 +1,411 @@
+#include <map>
+#include <mutex>
+#include <limits>
+#include <random>
+#include <thread>
+#include <sstream>
+#include <utility>
+#include <algorithm>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/hard_decision.h"
+
+#include "Decoder_maximum_likelihood_fast.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+namespace
+{
+inline uint32_t popcount64(const uint64_t x)
+{
+#ifdef _MSC_VER
+	return (uint32_t)__popcnt64(x);
+#else
+	return (uint32_t)__builtin_popcountll(x);
+#endif
+}
+
+// codebooks shared by all the decoders of the process, identified by N and the generator rows
+std::mutex                                                                                 codebooks_mutex;
+std::map<std::pair<int,std::vector<uint64_t>>, std::weak_ptr<const std::vector<uint64_t>>> codebooks;
+
+std::shared_ptr<const std::vector<uint64_t>> get_codebook(const int K, const int N, const std::vector<uint64_t> &rows)
+{
+	const auto n_words = (N + 63) / 64;
+	const auto n_cw    = (uint64_t)1 << K;
+	const auto key     = std::make_pair(N, rows);
+
+	// the lock is kept during the construction: the other decoders wait for the codebook instead of building it again
+	std::lock_guard<std::mutex> lock(codebooks_mutex);
+
+	auto codebook = codebooks[key].lock();
+	if (codebook == nullptr)
+	{
+		auto cb = std::make_shared<std::vector<uint64_t>>(n_cw * n_words, 0);
+
+		// Gray-code enumeration: the codeword 'g' differs from the codeword 'g -1' by the row of the lowest set bit of 'g'
+		auto cw = cb->data();
+		for (uint64_t g = 1; g < n_cw; g++)
+		{
+			auto k = 0;
+			while (!((g >> k) & 1))
+				k++;
+
+			for (auto w = 0; w < n_words; w++)
+				cw[g * n_words + w] = cw[(g -1) * n_words + w] ^ rows[k * n_words + w];
+		}
+
+		codebook = cb;
+
+		// remove the codebooks that are not used anymore
+		for (auto it = codebooks.begin(); it != codebooks.end();)
+			if (it->second.expired()) it = codebooks.erase(it);
+			else                      it++;
+
+		codebooks[key] = codebook;
+	}
+
+	return codebook;
+}
+}
+
+template <typename B, typename R>
+Decoder_maximum_likelihood_fast<B,R>
+::Decoder_maximum_likelihood_fast(const int K, const int N, Encoder<B> &encoder, const bool hamming,
+                                  const int n_threads, const int n_frames)
+: Decoder                        (K, N,          n_frames, 1),
+  Decoder_maximum_likelihood<B,R>(K, N, encoder, n_frames   ),
+  hamming(hamming),
+  n_threads(n_threads),
+  n_words((N + 63) / 64),
+  n_bytes((N +  7) /  8),
+  packed_Y_N(n_words),
+  byte_corr(n_bytes * 256),
+  best_idx(0),
+  generation(0),
+  n_pending(0),
+  stop_pool(false),
+  hamming_job(hamming)
+{
+	const std::string name = "Decoder_maximum_likelihood_fast";
+	this->set_name(name);
+
+	if (K > 24)
+	{
+		std::stringstream message;
+		message << "'K' has to be smaller or equal to 24 ('K' = " << K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->build_codebook();
+
+	// the search is not split for the small codebooks (the synchronization would cost more than the search)
+	const auto n_parts = (n_threads > 1 && K >= 14) ? n_threads : 1;
+	this->part_idx .resize(n_parts);
+	this->part_dist.resize(n_parts);
+	this->part_corr.resize(n_parts);
+	for (auto t = 1; t < n_parts; t++)
+		this->workers.push_back(std::thread(&Decoder_maximum_likelihood_fast<B,R>::worker, this, t));
+}
+
+template <typename B, typename R>
+Decoder_maximum_likelihood_fast<B,R>
+::~Decoder_maximum_likelihood_fast()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mutex_pool);
+		this->stop_pool = true;
+	}
+	this->cond_work.notify_all();
+
+	for (auto &w : this->workers)
+		w.join();
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::build_codebook()
+{
+	auto pack = [&](const std::vector<B> &X_N, uint64_t *packed)
+	{
+		std::fill(packed, packed + this->n_words, (uint64_t)0);
+		for (auto n = 0; n < this->N; n++)
+			if (X_N[n])
+				packed[n >> 6] |= (uint64_t)1 << (n & 63);
+	};
+
+	// the generator rows are the codewords of the unit information words
+	std::vector<uint64_t> rows(this->K * this->n_words);
+	for (auto k = 0; k < this->K; k++)
+	{
+		std::fill(this->U_K.begin(), this->U_K.end(), (B)0);
+		this->U_K[k] = (B)1;
+		this->encoder.encode(this->U_K.data(), this->X_N.data(), 0);
+		pack(this->X_N, rows.data() + k * this->n_words);
+	}
+
+	// the Gray-code enumeration is valid only if the code is linear: check it on some information words
+	std::mt19937 rd_engine(0);
+	std::bernoulli_distribution dist;
+	std::vector<uint64_t> cw(this->n_words), sum(this->n_words);
+	for (auto t = 0; t < 32; t++)
+	{
+		std::fill(sum.begin(), sum.end(), (uint64_t)0);
+		for (auto k = 0; k < this->K; k++)
+		{
+			this->U_K[k] = (t == 0) ? (B)0 : (B)dist(rd_engine);
+			if (this->U_K[k])
+				for (auto w = 0; w < this->n_words; w++)
+					sum[w] ^= rows[k * this->n_words + w];
+		}
+
+		this->encoder.encode(this->U_K.data(), this->X_N.data(), 0);
+		pack(this->X_N, cw.data());
+
+		if (cw != sum)
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The code has to be linear.");
+	}
+
+	this->codebook = get_codebook(this->K, this->N, rows);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::search_hamming(const uint64_t first, const uint64_t last, uint64_t &idx, uint32_t &dist) const
+{
+	const auto cb = this->codebook->data();
+	const auto y  = this->packed_Y_N.data();
+
+	idx  = first;
+	dist = std::numeric_limits<uint32_t>::max();
+	for (auto g = first; g < last; g++)
+	{
+		// compute the Hamming distance between the input bits and the current codeword
+		uint32_t cur_dist = 0;
+		for (auto w = 0; w < this->n_words; w++)
+			cur_dist += popcount64(cb[g * this->n_words + w] ^ y[w]);
+
+		if (cur_dist < dist)
+		{
+			dist = cur_dist;
+			idx  = g;
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::search_euclidean(const uint64_t first, const uint64_t last, uint64_t &idx, float &corr) const
+{
+	const auto cb = this->codebook->data();
+	const auto bc = this->byte_corr.data();
+
+	idx  = first;
+	corr = std::numeric_limits<float>::max();
+	for (auto g = first; g < last; g++)
+	{
+		// sum of the LLRs of the bits set in the current codeword: the smaller, the closer to the input LLRs
+		const auto cw = cb + g * this->n_words;
+		auto cur_corr = 0.f;
+		for (auto b = 0; b < this->n_bytes; b++)
+			cur_corr += bc[b * 256 + ((cw[b >> 3] >> ((b & 7) << 3)) & 0xFF)];
+
+		if (cur_corr < corr)
+		{
+			corr = cur_corr;
+			idx  = g;
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::search_part(const int t, const bool hamming_dist)
+{
+	const auto n_cw    = (uint64_t)1 << this->K;
+	const auto n_parts = (uint64_t)this->part_idx.size();
+	const auto first   = (n_cw * (t +0)) / n_parts;
+	const auto last    = (n_cw * (t +1)) / n_parts;
+
+	if (hamming_dist) this->search_hamming  (first, last, this->part_idx[t], this->part_dist[t]);
+	else              this->search_euclidean(first, last, this->part_idx[t], this->part_corr[t]);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::worker(const int t)
+{
+	unsigned long long cur_generation = 0;
+	while (true)
+	{
+		bool hamming_dist;
+		{
+			std::unique_lock<std::mutex> lock(this->mutex_pool);
+			this->cond_work.wait(lock, [&](){ return this->stop_pool || this->generation != cur_generation; });
+			if (this->stop_pool)
+				return;
+
+			cur_generation = this->generation;
+			hamming_dist   = this->hamming_job;
+		}
+
+		this->search_part(t, hamming_dist);
+
+		std::lock_guard<std::mutex> lock(this->mutex_pool);
+		if (--this->n_pending == 0)
+			this->cond_done.notify_one();
+	}
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::search(const bool hamming_dist)
+{
+	const auto n_parts = (int)this->part_idx.size();
+
+	if (!this->workers.empty())
+	{
+		// the inputs prepared by the calling thread are published by the lock
+		{
+			std::lock_guard<std::mutex> lock(this->mutex_pool);
+			this->hamming_job = hamming_dist;
+			this->n_pending   = (int)this->workers.size();
+			this->generation++;
+		}
+		this->cond_work.notify_all();
+	}
+
+	this->search_part(0, hamming_dist);
+
+	if (!this->workers.empty())
+	{
+		std::unique_lock<std::mutex> lock(this->mutex_pool);
+		this->cond_done.wait(lock, [&](){ return this->n_pending == 0; });
+	}
+
+	// the ties are broken by the smallest index, whatever the number of threads
+	auto best = 0;
+	for (auto t = 1; t < n_parts; t++)
+		if (( hamming_dist && this->part_dist[t] < this->part_dist[best]) ||
+		    (!hamming_dist && this->part_corr[t] < this->part_corr[best]))
+			best = t;
+
+	this->best_idx = this->part_idx[best];
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::store_best_U_K(B *V_K) const
+{
+	// the information word of the codeword 'g' is its Gray code
+	const auto u = this->best_idx ^ (this->best_idx >> 1);
+	for (auto k = 0; k < this->K; k++)
+		V_K[k] = (B)((u >> k) & 1);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::store_best_X_N(B *V_N) const
+{
+	const auto cw = this->codebook->data() + this->best_idx * this->n_words;
+	for (auto n = 0; n < this->N; n++)
+		V_N[n] = (B)((cw[n >> 6] >> (n & 63)) & 1);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::prepare_siho(const R *Y_N)
+{
+	if (this->hamming)
+	{
+		tools::hard_decide(Y_N, this->hard_Y_N.data(), this->N);
+		this->prepare_hiho(this->hard_Y_N.data());
+	}
+	else
+	{
+		// byte_corr[b * 256 + v] is the sum of the LLRs of the bits of the byte 'b' set in 'v'
+		for (auto b = 0; b < this->n_bytes; b++)
+		{
+			auto bc = this->byte_corr.data() + b * 256;
+			bc[0] = 0.f;
+			for (auto v = 1; v < 256; v++)
+			{
+				auto l = 0;
+				while (!((v >> l) & 1))
+					l++;
+
+				const auto n = b * 8 + l;
+				bc[v] = bc[v & (v -1)] + ((n < this->N) ? (float)Y_N[n] : 0.f);
+			}
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::prepare_hiho(const B *Y_N)
+{
+	std::fill(this->packed_Y_N.begin(), this->packed_Y_N.end(), (uint64_t)0);
+	for (auto n = 0; n < this->N; n++)
+		if (Y_N[n])
+			this->packed_Y_N[n >> 6] |= (uint64_t)1 << (n & 63);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->prepare_siho(Y_N);
+	this->search(this->hamming);
+	this->store_best_U_K(V_K);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	this->prepare_siho(Y_N);
+	this->search(this->hamming);
+	this->store_best_X_N(V_N);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+{
+	this->prepare_hiho(Y_N);
+	this->search(true);
+	this->store_best_U_K(V_K);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+{
+	this->prepare_hiho(Y_N);
+	this->search(true);
+	this->store_best_X_N(V_N);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B_8,Q_8>;
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B_16,Q_16>;
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B_32,Q_32>;
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
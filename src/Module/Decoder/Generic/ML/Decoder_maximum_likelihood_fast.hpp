@@ -0,0 +1,80 @@
+#ifndef DECODER_MAXIMUM_LIKELIHOOD_FAST_HPP_
+#define DECODER_MAXIMUM_LIKELIHOOD_FAST_HPP_
+
+#include <mutex>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+
+#include "Decoder_maximum_likelihood.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Exhaustive ML decoder for the linear codes: the 2^K codewords are computed once in the Gray-code order of the
+ * information words (one generator row XOR per codeword) and stored bit-packed. The codebook is shared by all the
+ * decoders of the process with the same generator rows. The Hamming distance is computed with popcounts and the
+ * Euclidean distance with tables of partial correlations (one table per byte of the codeword). The search can be split
+ * across threads: the workers are created with the decoder and wait for the frames to search.
+ */
+template <typename B = int, typename R = float>
+class Decoder_maximum_likelihood_fast : public Decoder_maximum_likelihood<B,R>
+{
+protected:
+	const bool hamming;
+	const int  n_threads;
+	const int  n_words; // number of 64-bit words per codeword
+	const int  n_bytes; // number of bytes per codeword
+
+	std::shared_ptr<const std::vector<uint64_t>> codebook; // the 2^K codewords, in Gray-code order
+
+	std::vector<uint64_t> packed_Y_N; // hard decided input, bit-packed
+	std::vector<float>    byte_corr;  // partial correlations, 256 values per byte of the codeword
+	uint64_t              best_idx;   // index of the best codeword in the codebook
+
+	// persistent workers, each one searches a part of the codebook for each frame
+	std::vector<std::thread> workers;
+	std::mutex               mutex_pool;
+	std::condition_variable  cond_work;
+	std::condition_variable  cond_done;
+	unsigned long long       generation;   // incremented for each frame to search
+	int                      n_pending;    // number of workers still searching the current frame
+	bool                     stop_pool;
+	bool                     hamming_job;  // distance used for the current frame
+	std::vector<uint64_t>    part_idx;     // best index of each part of the codebook
+	std::vector<uint32_t>    part_dist;
+	std::vector<float   >    part_corr;
+
+public:
+	Decoder_maximum_likelihood_fast(const int K, const int N, Encoder<B> &encoder, const bool hamming = false,
+	                                const int n_threads = 1, const int n_frames = 1);
+	virtual ~Decoder_maximum_likelihood_fast();
+
+protected:
+	void _decode_siho   (const R *Y_N,  B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N,  B *V_N, const int frame_id);
+	void _decode_hiho   (const B *Y_N,  B *V_K, const int frame_id);
+	void _decode_hiho_cw(const B *Y_N,  B *V_N, const int frame_id);
+
+private:
+	void build_codebook  (                                                                           );
+	void prepare_siho    (const R *Y_N                                                               );
+	void prepare_hiho    (const B *Y_N                                                               );
+	void search_hamming  (const uint64_t first, const uint64_t last, uint64_t &idx, uint32_t &dist) const;
+	void search_euclidean(const uint64_t first, const uint64_t last, uint64_t &idx, float    &corr) const;
+	void search_part     (const int t, const bool hamming_dist                                       );
+	void search          (const bool hamming_dist                                                    );
+	void worker          (const int t                                                                );
+	void store_best_U_K  (B *V_K                                                                     ) const;
+	void store_best_X_N  (B *V_N                                                                     ) const;
+};
+
+template <typename B = int, typename R = float>
+using Decoder_ML_fast = Decoder_maximum_likelihood_fast<B,R>;
+}
+}
+
+#endif /* DECODER_MAXIMUM_LIKELIHOOD_FAST_HPP_ */
@@ -25,6 +25,9 @@ Decoder_LDPC_BP<B,R>
   Decoder_SISO_SIHO<B,R>(K, N, n_frames, simd_inter_frame_level),
   n_ite                 (n_ite                                 ),
   H                     (H                                     ),
+  H_flat_16             (tools::Sparse_matrix_flat<uint16_t>::is_indexable(H) ?
+                         new tools::Sparse_matrix_flat<uint16_t>(H) : nullptr),
+  H_flat_32             (H_flat_16 == nullptr ? new tools::Sparse_matrix_flat<uint32_t>(H) : nullptr),
   enable_syndrome       (enable_syndrome                       ),
   syndrome_depth        (syndrome_depth                        ),
   cur_syndrome_depth    (0                                     )
@@ -1,7 +1,10 @@
 #ifndef DECODER_LDPC_BP_HPP_
 #define DECODER_LDPC_BP_HPP_
 
+#include <memory>
+
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix_flat.hpp"
 
 #include "../../Decoder_SISO_SIHO.hpp"
 
@@ -15,6 +18,12 @@ class Decoder_LDPC_BP : public Decoder_SISO_SIHO<B,R>
 protected:
 	const int                   n_ite;
 	const tools::Sparse_matrix &H;
+
+	// contiguous copy of H (H_flat->get_rows_from_col(i) == H[i]), with 16-bit indexes when the dimensions of H allow
+	// it (then 'H_flat_32' is null) and with 32-bit indexes otherwise (then 'H_flat_16' is null)
+	std::unique_ptr<const tools::Sparse_matrix_flat<uint16_t>> H_flat_16;
+	std::unique_ptr<const tools::Sparse_matrix_flat<uint32_t>> H_flat_32;
+
 	const bool                  enable_syndrome;
 	const int                   syndrome_depth;
 
@@ -36,24 +45,24 @@ public:
 	{
 		if (this->enable_syndrome)
 		{
-			auto syndrome = false;
+			const auto syndrome = this->H_flat_16 != nullptr ? this->compute_syndrome_soft(*this->H_flat_16, Y_N)
+			                                                 : this->compute_syndrome_soft(*this->H_flat_32, Y_N);
 
-			const auto n_CN = (int)this->H.get_n_cols();
-			for (auto i = 0; i < n_CN; i++)
-			{
-				auto sign = 0;
+			this->cur_syndrome_depth = (syndrome == 0) ? (this->cur_syndrome_depth +1) % this->syndrome_depth : 0;
 
-				const auto n_VN = (int)this->H[i].size();
-				for (auto j = 0; j < n_VN; j++)
-				{
-					const auto value = Y_N[this->H[i][j]];
-					const auto tmp_sign = std::signbit((float)value) ? -1 : 0;
+			return (syndrome == 0) && (this->cur_syndrome_depth == 0);
+		}
 
-					sign ^= tmp_sign;
-				}
+		return false;
+	}
 
-				syndrome = syndrome || sign;
-			}
+	template <typename T>
+	bool check_syndrome_hard(const T* V_N)
+	{
+		if (this->enable_syndrome)
+		{
+			const auto syndrome = this->H_flat_16 != nullptr ? this->compute_syndrome_hard(*this->H_flat_16, V_N)
+			                                                 : this->compute_syndrome_hard(*this->H_flat_32, V_N);
 
 			this->cur_syndrome_depth = (syndrome == 0) ? (this->cur_syndrome_depth +1) % this->syndrome_depth : 0;
 
@@ -63,36 +72,76 @@ public:
 		return false;
 	}
 
-	template <typename T>
-	bool check_syndrome_hard(const T* V_N)
+protected:
+	inline unsigned get_VN_degree(const size_t VN_index) const
 	{
-		if (this->enable_syndrome)
+		return this->H_flat_16 != nullptr ? this->H_flat_16->get_row_degree(VN_index)
+		                                  : this->H_flat_32->get_row_degree(VN_index);
+	}
+
+	inline unsigned get_CN_degree(const size_t CN_index) const
+	{
+		return this->H_flat_16 != nullptr ? this->H_flat_16->get_col_degree(CN_index)
+		                                  : this->H_flat_32->get_col_degree(CN_index);
+	}
+
+	// the branches are numbered in the order of the variable nodes, gives their numbers in the order of the check nodes
+	std::vector<uint32_t> get_CN_to_VN_branches() const
+	{
+		return this->H_flat_16 != nullptr ? this->H_flat_16->get_csc_to_csr() : this->H_flat_32->get_csc_to_csr();
+	}
+
+private:
+	template <typename I, typename T>
+	static bool compute_syndrome_soft(const tools::Sparse_matrix_flat<I> &H_flat, const T* Y_N)
+	{
+		auto syndrome = false;
+
+		const auto n_CN = (int)H_flat.get_n_cols();
+		for (auto i = 0; i < n_CN; i++)
 		{
-			auto syndrome = false;
+			auto sign = 0;
 
-			const auto n_CN = (int)this->H.get_n_cols();
-			for (auto i = 0; i < n_CN; i++)
+			const auto n_VN = (int)H_flat.get_col_degree(i);
+			const auto VN   = H_flat.get_rows_from_col(i);
+			for (auto j = 0; j < n_VN; j++)
 			{
-				auto sign = 0;
+				const auto value = Y_N[VN[j]];
+				const auto tmp_sign = std::signbit((float)value) ? -1 : 0;
 
-				const auto n_VN = (int)this->H[i].size();
-				for (auto j = 0; j < n_VN; j++)
-				{
-					const auto bit = V_N[this->H[i][j]];
-					const auto tmp_sign = bit ? -1 : 0;
+				sign ^= tmp_sign;
+			}
 
-					sign ^= tmp_sign;
-				}
+			syndrome = syndrome || sign;
+		}
 
-				syndrome = syndrome || sign;
-			}
+		return syndrome;
+	}
 
-			this->cur_syndrome_depth = (syndrome == 0) ? (this->cur_syndrome_depth +1) % this->syndrome_depth : 0;
+	template <typename I, typename T>
+	static bool compute_syndrome_hard(const tools::Sparse_matrix_flat<I> &H_flat, const T* V_N)
+	{
+		auto syndrome = false;
 
-			return (syndrome == 0) && (this->cur_syndrome_depth == 0);
+		const auto n_CN = (int)H_flat.get_n_cols();
+		for (auto i = 0; i < n_CN; i++)
+		{
+			auto sign = 0;
+
+			const auto n_VN = (int)H_flat.get_col_degree(i);
+			const auto VN   = H_flat.get_rows_from_col(i);
+			for (auto j = 0; j < n_VN; j++)
+			{
+				const auto bit = V_N[VN[j]];
+				const auto tmp_sign = bit ? -1 : 0;
+
+				sign ^= tmp_sign;
+			}
+
+			syndrome = syndrome || sign;
 		}
 
-		return false;
+		return syndrome;
 	}
 };
 }
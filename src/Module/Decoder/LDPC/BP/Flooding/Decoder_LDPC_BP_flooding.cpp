@@ -5,6 +5,7 @@
 #include "Tools/Perf/hard_decision.h"
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Math/utils.h"
+#include "Tools/Perf/Timer/Sub_task_timer.hpp"
 
 #include "Decoder_LDPC_BP_flooding.hpp"
 
@@ -35,46 +36,15 @@ Decoder_LDPC_BP_flooding<B,R>
 	const std::string name = "Decoder_LDPC_BP_flooding";
 	this->set_name(name);
 	
-	transpose.resize(this->n_branches);
-	mipp::vector<unsigned char> connections(H.get_n_rows(), 0);
-
-	const auto &CN_to_VN = H.get_col_to_rows();
-	const auto &VN_to_CN = H.get_row_to_cols();
-
-	auto k = 0;
-	for (auto i = 0; i < (int)CN_to_VN.size(); i++)
-	{
-		for (auto j = 0; j < (int)CN_to_VN[i].size(); j++)
-		{
-			auto id_V = CN_to_VN[i][j];
-
-			auto branch_id = 0;
-			for (auto ii = 0; ii < (int)id_V; ii++)
-				branch_id += (int)VN_to_CN[ii].size();
-			branch_id += connections[id_V];
-			connections[id_V]++;
-
-			if (connections[id_V] > (int)VN_to_CN[id_V].size())
-			{
-				std::stringstream message;
-				message << "'connections[id_V]' has to be equal or smaller than 'VN_to_CN[id_V].size()' ('id_V' = "
-				        << id_V << ", 'connections[id_V]' = " << connections[id_V] << ", 'VN_to_CN[id_V].size()' = "
-				        << VN_to_CN[id_V].size() << ").";
-				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-			}
-
-			transpose[k] = branch_id;
-			k++;
-		}
-	}
+	transpose = this->get_CN_to_VN_branches();
 
 	n_variables_per_parity.resize(H.get_n_cols());
 	for (auto i = 0; i < (int)H.get_n_cols(); i++)
-		n_variables_per_parity[i] = (unsigned char)CN_to_VN[i].size();
+		n_variables_per_parity[i] = (unsigned char)this->get_CN_degree(i);
 
 	n_parities_per_variable.resize(H.get_n_rows());
 	for (auto i = 0; i < (int)H.get_n_rows(); i++)
-		n_parities_per_variable[i] = (unsigned char)VN_to_CN[i].size();
+		n_parities_per_variable[i] = (unsigned char)this->get_VN_degree(i);
 }
 
 template <typename B, typename R>
@@ -117,7 +87,7 @@ template <typename B, typename R>
 void Decoder_LDPC_BP_flooding<B,R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho]);
 	// memory zones initialization
 	if (this->init_flag)
 	{
@@ -126,32 +96,26 @@ void Decoder_LDPC_BP_flooding<B,R>
 		if (frame_id == Decoder_SIHO<B,R>::n_frames -1)
 			this->init_flag = false;
 	}
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	// actual decoding
 	this->BP_decode(Y_N, frame_id);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	// take the hard decision
 	for (auto i = 0; i < this->K; i++)
 	{
 		const auto k = this->info_bits_pos[i];
 		V_K[i] = !(this->Lp_N[k] >= 0);
 	}
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	timer.lap(dec::tm::decode_siho::store);
 }
 
 template <typename B, typename R>
 void Decoder_LDPC_BP_flooding<B,R>
 ::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho_cw]);
 	// memory zones initialization
 	if (this->init_flag)
 	{
@@ -160,20 +124,14 @@ void Decoder_LDPC_BP_flooding<B,R>
 		if (frame_id == Decoder_SIHO<B,R>::n_frames -1)
 			this->init_flag = false;
 	}
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho_cw::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	// actual decoding
 	this->BP_decode(Y_N, frame_id);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho_cw::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	tools::hard_decide(this->Lp_N.data(), V_N, this->N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+	timer.lap(dec::tm::decode_siho_cw::store);
 }
 
 // BP algorithm
@@ -27,7 +27,7 @@ protected:
 
 	std::vector<unsigned char> n_variables_per_parity;
 	std::vector<unsigned char> n_parities_per_variable;
-	std::vector<unsigned int > transpose;
+	std::vector<uint32_t     > transpose;
 
 	// data structures for iterative decoding
 	            std::vector<R>  Lp_N;   // a posteriori information
@@ -4,6 +4,7 @@
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Math/utils.h"
+#include "Tools/Perf/Timer/Sub_task_timer.hpp"
 
 #include "Decoder_LDPC_BP_flooding_Gallager_A.hpp"
 
@@ -27,38 +28,7 @@ Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_A";
 	this->set_name(name);
 	
-	transpose.resize(H.get_n_connections());
-	std::vector<unsigned char> connections(H.get_n_rows(), 0);
-
-	const auto &CN_to_VN = H.get_col_to_rows();
-	const auto &VN_to_CN = H.get_row_to_cols();
-
-	auto k = 0;
-	for (auto i = 0; i < (int)CN_to_VN.size(); i++)
-	{
-		for (auto j = 0; j < (int)CN_to_VN[i].size(); j++)
-		{
-			auto id_V = CN_to_VN[i][j];
-
-			auto branch_id = 0;
-			for (auto ii = 0; ii < (int)id_V; ii++)
-				branch_id += (int)VN_to_CN[ii].size();
-			branch_id += connections[id_V];
-			connections[id_V]++;
-
-			if (connections[id_V] > (int)VN_to_CN[id_V].size())
-			{
-				std::stringstream message;
-				message << "'connections[id_V]' has to be equal or smaller than 'VN_to_CN[id_V].size()' "
-				        << "('id_V' = " << id_V << ", 'connections[id_V]' = " << connections[id_V]
-				        << ", 'VN_to_CN[id_V].size()' = " << VN_to_CN[id_V].size() << ")'.";
-				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-			}
-
-			transpose[k] = branch_id;
-			k++;
-		}
-	}
+	transpose = this->get_CN_to_VN_branches();
 }
 
 template <typename B, typename R>
@@ -79,7 +49,7 @@ void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 		// V -> C (for each variable nodes)
 		for (auto i = 0; i < (int)this->H.get_n_rows(); i++)
 		{
-			const auto node_degree = (int)this->H.get_row_to_cols()[i].size();
+			const auto node_degree = (int)this->get_VN_degree(i);
 
 			for (auto j = 0; j < node_degree; j++)
 			{
@@ -105,7 +75,7 @@ void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 		auto transpose_ptr = this->transpose.data();
 		for (auto i = 0; i < (int)this->H.get_n_cols(); i++)
 		{
-			const auto node_degree = (int)this->H.get_col_to_rows()[i].size();
+			const auto node_degree = (int)this->get_CN_degree(i);
 
 			// accumulate the incoming information in CN
 			auto acc = 0;
@@ -125,7 +95,7 @@ void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 			// for the K variable nodes (make a majority vote with the entering messages)
 			for (auto i = 0; i < this->N; i++)
 			{
-				const auto node_degree = (int)this->H.get_row_to_cols()[i].size();
+				const auto node_degree = (int)this->get_VN_degree(i);
 				auto count = 0;
 
 				for (auto j = 0; j < node_degree; j++)
@@ -149,7 +119,7 @@ void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 	// for the K variable nodes (make a majority vote with the entering messages)
 	for (auto i = 0; i < this->N; i++)
 	{
-		const auto node_degree = (int)this->H.get_row_to_cols()[i].size();
+		const auto node_degree = (int)this->get_VN_degree(i);
 		auto count = 0;
 
 		for (auto j = 0; j < node_degree; j++)
@@ -169,76 +139,56 @@ template <typename B, typename R>
 void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 ::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_hiho]);
 	this->_decode(Y_N);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_hiho::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	for (auto i = 0; i < this->K; i++)
 		V_K[i] = (B)this->V_N[this->info_bits_pos[i]];
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::decode, d_decod);
-//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::store,  d_store);
+	timer.lap(dec::tm::decode_hiho::store);
 }
 
 template <typename B, typename R>
 void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 ::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_hiho_cw]);
 	this->_decode(Y_N);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_hiho_cw::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	std::copy(this->V_N.begin(), this->V_N.begin() + this->N, V_N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::store,  d_store);
+	timer.lap(dec::tm::decode_hiho_cw::store);
 }
 
 template <typename B, typename R>
 void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho]);
 	hard_decision.decode_siho(Y_N, HY_N.data());
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	this->_decode(HY_N.data());
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	for (auto i = 0; i < this->K; i++)
 		V_K[i] = (B)this->V_N[this->info_bits_pos[i]];
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	timer.lap(dec::tm::decode_siho::store);
 }
 
 template <typename B, typename R>
 void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 ::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho_cw]);
 	hard_decision.decode_siho(Y_N, HY_N.data());
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho_cw::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	this->_decode(HY_N.data());
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho_cw::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	std::copy(this->V_N.begin(), this->V_N.begin() + this->N, V_N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+	timer.lap(dec::tm::decode_siho_cw::store);
 }
 
 // ==================================================================================== explicit template instantiation 
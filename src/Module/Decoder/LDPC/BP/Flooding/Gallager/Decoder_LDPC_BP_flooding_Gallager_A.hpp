@@ -25,7 +25,7 @@ protected:
 	std::vector<int8_t>          V_N;             // decoded bits
 	std::vector<int8_t>          C_to_V_messages; // check    nodes to variable nodes messages
 	std::vector<int8_t>          V_to_C_messages; // variable nodes to check    nodes messages
-	std::vector<unsigned>        transpose;
+	std::vector<uint32_t>        transpose;
 
 public:
 	Decoder_LDPC_BP_flooding_Gallager_A(const int K, const int N, const int n_ite, const tools::Sparse_matrix &H,
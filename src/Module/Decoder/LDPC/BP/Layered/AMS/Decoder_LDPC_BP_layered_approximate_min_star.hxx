@@ -40,6 +40,15 @@ Decoder_LDPC_BP_layered_approximate_min_star<B,R,MIN>
 template <typename B, typename R, tools::proto_min<R> MIN>
 void Decoder_LDPC_BP_layered_approximate_min_star<B,R,MIN>
 ::BP_process(std::vector<R> &var_nodes, std::vector<R> &branches)
+{
+	if (this->H_flat_16 != nullptr) this->_BP_process(*this->H_flat_16, var_nodes, branches);
+	else                            this->_BP_process(*this->H_flat_32, var_nodes, branches);
+}
+
+template <typename B, typename R, tools::proto_min<R> MIN>
+template <typename I>
+void Decoder_LDPC_BP_layered_approximate_min_star<B,R,MIN>
+::_BP_process(const tools::Sparse_matrix_flat<I> &H_flat, std::vector<R> &var_nodes, std::vector<R> &branches)
 {
 	auto kr = 0;
 	auto kw = 0;
@@ -49,10 +58,11 @@ void Decoder_LDPC_BP_layered_approximate_min_star<B,R,MIN>
 		auto min      = std::numeric_limits<R>::max();
 		auto deltaMin = std::numeric_limits<R>::max();
 
-		const auto n_VN = (int)this->H[i].size();
+		const auto n_VN = (int)H_flat.get_col_degree(i);
+		const auto VN   = H_flat.get_rows_from_col(i);
 		for (auto j = 0; j < n_VN; j++)
 		{
-			contributions[j]  = var_nodes[this->H[i][j]] - branches[kr++];
+			contributions[j]  = var_nodes[VN[j]] - branches[kr++];
 			const auto v_abs  = (R)std::abs(contributions[j]);
 			const auto c_sign = std::signbit((float)contributions[j]) ? -1 : 0;
 			const auto v_temp = min;
@@ -75,7 +85,7 @@ void Decoder_LDPC_BP_layered_approximate_min_star<B,R,MIN>
 			           v_res = (R)std::copysign(v_res, v_sig);               // magnitude of v_res, sign of v_sig
 
 			branches[kw++] = v_res;
-			var_nodes[this->H[i][j]] = contributions[j] + v_res;
+			var_nodes[VN[j]] = contributions[j] + v_res;
 		}
 	}
 }
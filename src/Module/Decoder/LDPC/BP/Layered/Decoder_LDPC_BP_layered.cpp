@@ -5,6 +5,7 @@
 
 #include "Tools/Perf/hard_decision.h"
 #include "Tools/Math/utils.h"
+#include "Tools/Perf/Timer/Sub_task_timer.hpp"
 
 #include "Decoder_LDPC_BP_layered.hpp"
 
@@ -84,49 +85,37 @@ template <typename B, typename R>
 void Decoder_LDPC_BP_layered<B,R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho]);
 	this->_load(Y_N, frame_id);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	// actual decoding
 	this->BP_decode(frame_id);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	// take the hard decision
 	for (auto i = 0; i < this->K; i++)
 	{
 		const auto k = this->info_bits_pos[i];
 		V_K[i] = !(this->var_nodes[frame_id][k] >= 0);
 	}
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	timer.lap(dec::tm::decode_siho::store);
 }
 
 template <typename B, typename R>
 void Decoder_LDPC_BP_layered<B,R>
 ::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho_cw]);
 	this->_load(Y_N, frame_id);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho_cw::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	// actual decoding
 	this->BP_decode(frame_id);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho_cw::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	tools::hard_decide(this->var_nodes[frame_id].data(), V_N, this->N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+	timer.lap(dec::tm::decode_siho_cw::store);
 }
 
 // BP algorithm
@@ -25,6 +25,9 @@ public:
 
 protected:
 	void BP_process(std::vector<R> &var_nodes, std::vector<R> &branches);
+
+	template <typename I>
+	void _BP_process(const tools::Sparse_matrix_flat<I> &H_flat, std::vector<R> &var_nodes, std::vector<R> &branches);
 };
 
 template <typename B = int, typename R = float>
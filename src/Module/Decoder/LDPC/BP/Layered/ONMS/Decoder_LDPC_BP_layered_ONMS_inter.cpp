@@ -7,6 +7,7 @@
 #include "Tools/Math/utils.h"
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Perf/Timer/Sub_task_timer.hpp"
 
 #include "Decoder_LDPC_BP_layered_ONMS_inter.hpp"
 
@@ -134,11 +135,10 @@ template <typename B, typename R>
 void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho]);
 	this->_load(Y_N, frame_id);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	// actual decoding
 	if (typeid(R) == typeid(short) || typeid(R) == typeid(signed char))
 	{
@@ -163,9 +163,8 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 		if (normalize_factor == 1.000f) this->BP_decode<8>(frame_id);
 		else                            this->BP_decode<0>(frame_id);
 	}
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	// take the hard decision
 	const auto cur_wave = frame_id / this->simd_inter_frame_level;
 	const auto zero = mipp::Reg<R>((R)0);
@@ -178,22 +177,17 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 	std::vector<B*> frames(mipp::nElReg<R>());
 	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = V_K + f * this->K;
 	tools::Reorderer_static<B,mipp::nElReg<R>()>::apply_rev((B*)V_reorderered.data(), frames, this->K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	timer.lap(dec::tm::decode_siho::store);
 }
 
 template <typename B, typename R>
 void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 ::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho_cw]);
 	this->_load(Y_N, frame_id);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho_cw::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	// actual decoding
 	if (typeid(R) == typeid(short) || typeid(R) == typeid(signed char))
 	{
@@ -218,9 +212,8 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 		if (normalize_factor == 1.000f) this->BP_decode<8>(frame_id);
 		else                            this->BP_decode<0>(frame_id);
 	}
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho_cw::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	// take the hard decision
 	const auto cur_wave = frame_id / this->simd_inter_frame_level;
 	const auto zero = mipp::Reg<R>((R)0);
@@ -230,11 +223,7 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 	std::vector<B*> frames(mipp::nElReg<R>());
 	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = V_N + f * this->N;
 	tools::Reorderer_static<B,mipp::nElReg<R>()>::apply_rev((B*)V_reorderered.data(), frames, this->N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+	timer.lap(dec::tm::decode_siho_cw::store);
 }
 
 // BP algorithm
@@ -266,6 +255,15 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 template <typename B, typename R>
 bool Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 ::check_syndrome(const int frame_id)
+{
+	if (this->H_flat_16 != nullptr) return this->_check_syndrome(*this->H_flat_16, frame_id);
+	else                            return this->_check_syndrome(*this->H_flat_32, frame_id);
+}
+
+template <typename B, typename R>
+template <typename I>
+bool Decoder_LDPC_BP_layered_ONMS_inter<B,R>
+::_check_syndrome(const tools::Sparse_matrix_flat<I> &H_flat, const int frame_id)
 {
 	const auto cur_wave = frame_id / this->simd_inter_frame_level;
 	const auto zero = mipp::Msk<mipp::N<B>()>(false);
@@ -276,10 +274,11 @@ bool Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 	{
 		auto sign = zero;
 
-		const auto n_VN = (int)this->H[i].size();
+		const auto n_VN = (int)H_flat.get_col_degree(i);
+		const auto VN   = H_flat.get_rows_from_col(i);
 		for (auto j = 0; j < n_VN; j++)
 		{
-			const auto value = this->var_nodes[cur_wave][this->H[i][j]];// - this->branches[cur_wave][k++];
+			const auto value = this->var_nodes[cur_wave][VN[j]];// - this->branches[cur_wave][k++];
 			sign ^= mipp::sign(value);
 		}
 
@@ -328,6 +327,16 @@ template <typename B, typename R>
 template <int F>
 void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 ::BP_process(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &branches)
+{
+	if (this->H_flat_16 != nullptr) this->template _BP_process<F>(*this->H_flat_16, var_nodes, branches);
+	else                            this->template _BP_process<F>(*this->H_flat_32, var_nodes, branches);
+}
+
+template <typename B, typename R>
+template <int F, typename I>
+void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
+::_BP_process(const tools::Sparse_matrix_flat<I> &H_flat,
+              mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &branches)
 {
 	auto kr = 0;
 	auto kw = 0;
@@ -340,10 +349,11 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 		auto min1 = mipp::Reg<R>(std::numeric_limits<R>::max());
 		auto min2 = mipp::Reg<R>(std::numeric_limits<R>::max());
 
-		const auto n_VN = (int)this->H[i].size();
+		const auto n_VN = (int)H_flat.get_col_degree(i);
+		const auto VN   = H_flat.get_rows_from_col(i);
 		for (auto j = 0; j < n_VN; j++)
 		{
-			contributions[j]  = var_nodes[this->H[i][j]] - branches[kr++];
+			contributions[j]  = var_nodes[VN[j]] - branches[kr++];
 			const auto v_abs  = mipp::abs (contributions[j]);
 			const auto c_sign = mipp::sign(contributions[j]);
 			const auto v_temp = min1;
@@ -368,7 +378,7 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 			           v_res = mipp::copysign(v_res, v_sig);
 
 			branches[kw++] = v_res;
-			var_nodes[this->H[i][j]] = contributions[j] + v_res;
+			var_nodes[VN[j]] = contributions[j] + v_res;
 		}
 	}
 }
@@ -60,8 +60,15 @@ protected:
 
 	bool check_syndrome(const int frame_id);
 
+	template <typename I>
+	bool _check_syndrome(const tools::Sparse_matrix_flat<I> &H_flat, const int frame_id);
+
 	template <int F = 1>
 	void BP_process(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &branches);
+
+	template <int F, typename I>
+	void _BP_process(const tools::Sparse_matrix_flat<I> &H_flat,
+	                 mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &branches);
 };
 }
 }
@@ -0,0 +1,353 @@
+#include <limits>
+#include <sstream>
+#include <algorithm>
+#include <type_traits>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/hard_decision.h"
+
+#include "Decoder_LDPC_BP_layered_ONMS_intra.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename R>
+inline R init_c_saturation()
+{
+	return std::is_integral<R>::value ? (R)(std::numeric_limits<R>::max() / 4) : std::numeric_limits<R>::max();
+}
+
+template <typename R>
+inline R init_v_saturation()
+{
+	return std::is_integral<R>::value ? (R)(std::numeric_limits<R>::max() - init_c_saturation<R>())
+	                                  : std::numeric_limits<R>::max();
+}
+
+template <typename T, typename R>
+inline R scalar_sat(const T val, const R saturation)
+{
+	// 'T' is a type larger than 'R' in fixed-point ('R' is promoted to int in the arithmetic operations)
+	return (R)std::min(std::max(val, (T)-saturation), (T)saturation);
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::Decoder_LDPC_BP_layered_ONMS_intra(const int K, const int N, const int n_ite,
+                                     const tools::Sparse_matrix &H,
+                                     const std::vector<unsigned> &info_bits_pos,
+                                     const float normalize_factor,
+                                     const R offset,
+                                     const bool enable_syndrome,
+                                     const int syndrome_depth,
+                                     const int n_frames)
+: Decoder               (K, N,                                            n_frames, 1),
+  Decoder_LDPC_BP<B,R>  (K, N, n_ite, H, enable_syndrome, syndrome_depth, n_frames, 1),
+  normalize_factor      (normalize_factor                                            ),
+  offset                (offset                                                      ),
+  c_saturation          (init_c_saturation<R>()                                      ),
+  v_saturation          (init_v_saturation<R>()                                      ),
+  Z                     (H.get_qc_descriptor().Z                                     ),
+  Z_pad                 (((Z + mipp::nElReg<R>() -1) / mipp::nElReg<R>()) * mipp::nElReg<R>()),
+  init_flag             (true                                                        ),
+  info_bits_pos         (info_bits_pos                                               ),
+  var_nodes             (n_frames, mipp::vector<R>(N)                                )
+{
+	const std::string name = "Decoder_LDPC_BP_layered_ONMS_intra";
+	this->set_name(name);
+
+	if (!H.is_qc())
+	{
+		std::stringstream message;
+		message << "This decoder requires a quasi-cyclic H matrix (QC formated file without CNs reordering).";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// H is stored with the variable nodes in the rows and the check nodes in the columns: the block (i,j) of shift 's'
+	// connects the variable node 'i * Z + k' to the check node 'j * Z + (k + s) % Z'
+	const auto &qc = H.get_qc_descriptor();
+	unsigned max_layer_degree = 0;
+	layers_offset.push_back(0);
+	for (unsigned j = 0; j < qc.n_block_cols; j++)
+	{
+		for (unsigned i = 0; i < qc.n_block_rows; i++)
+		{
+			const auto s = qc.shifts[i * qc.n_block_cols + j];
+			if (s != -1)
+			{
+				blocks_VN .push_back(i);
+				blocks_rot.push_back((Z - (unsigned)s) % Z);
+			}
+		}
+		layers_offset.push_back((unsigned)blocks_VN.size());
+		max_layer_degree = std::max(max_layer_degree, layers_offset[j +1] - layers_offset[j]);
+	}
+
+	branches     .resize(n_frames, mipp::vector<R>(blocks_VN.size() * Z_pad));
+	contributions.resize(max_layer_degree * Z_pad, (R)0);
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::~Decoder_LDPC_BP_layered_ONMS_intra()
+{
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::reset()
+{
+	this->init_flag = true;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::_load(const R *Y_N, const int frame_id)
+{
+	// memory zones initialization
+	if (this->init_flag)
+	{
+		std::fill(this->branches [frame_id].begin(), this->branches [frame_id].end(), (R)0);
+		std::fill(this->var_nodes[frame_id].begin(), this->var_nodes[frame_id].end(), (R)0);
+
+		if (frame_id == Decoder_SIHO<B,R>::n_frames -1)
+			this->init_flag = false;
+	}
+
+	// var_nodes contain previous extrinsic information
+	for (auto i = 0; i < this->N; i++)
+		this->var_nodes[frame_id][i] = scalar_sat(this->var_nodes[frame_id][i] + Y_N[i], v_saturation);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::_decode_siso(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	// memory zones initialization
+	this->_load(Y_N1, frame_id);
+
+	// actual decoding
+	this->BP_decode(frame_id);
+
+	// prepare for next round by processing extrinsic information
+	for (auto i = 0; i < this->N; i++)
+		Y_N2[i] = scalar_sat(this->var_nodes[frame_id][i] - Y_N1[i], v_saturation);
+
+	// copy extrinsic information into var_nodes for next TURBO iteration
+	std::copy(Y_N2, Y_N2 + this->N, this->var_nodes[frame_id].begin());
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_load(Y_N, frame_id);
+
+	// actual decoding
+	this->BP_decode(frame_id);
+
+	// take the hard decision
+	for (auto i = 0; i < this->K; i++)
+	{
+		const auto k = this->info_bits_pos[i];
+		V_K[i] = !(this->var_nodes[frame_id][k] >= 0);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	this->_load(Y_N, frame_id);
+
+	// actual decoding
+	this->BP_decode(frame_id);
+
+	tools::hard_decide(this->var_nodes[frame_id].data(), V_N, this->N);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::BP_decode(const int frame_id)
+{
+	if (std::is_integral<R>::value)
+	{
+		     if (normalize_factor == 0.125f) this->_BP_decode<1>(frame_id);
+		else if (normalize_factor == 0.250f) this->_BP_decode<2>(frame_id);
+		else if (normalize_factor == 0.375f) this->_BP_decode<3>(frame_id);
+		else if (normalize_factor == 0.500f) this->_BP_decode<4>(frame_id);
+		else if (normalize_factor == 0.625f) this->_BP_decode<5>(frame_id);
+		else if (normalize_factor == 0.750f) this->_BP_decode<6>(frame_id);
+		else if (normalize_factor == 0.875f) this->_BP_decode<7>(frame_id);
+		else if (normalize_factor == 1.000f) this->_BP_decode<8>(frame_id);
+		else
+		{
+			std::stringstream message;
+			message << "'normalize_factor' can only be 0.125f, 0.250f, 0.375f, 0.500f, 0.625f, 0.750f, 0.875f or 1.000f"
+			        << " ('normalize_factor' = " << normalize_factor << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+	else // float or double
+	{
+		if (normalize_factor == 1.000f) this->_BP_decode<8>(frame_id);
+		else                            this->_BP_decode<0>(frame_id);
+	}
+}
+
+// BP algorithm
+template <typename B, typename R>
+template <int F>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::_BP_decode(const int frame_id)
+{
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		this->BP_process<F>(this->var_nodes[frame_id], this->branches[frame_id]);
+
+		if (this->check_syndrome_soft(this->var_nodes[frame_id].data()))
+			break;
+	}
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
+
+//                                                                                                           saturation
+template <typename R>
+inline mipp::Reg<R> simd_sat_intra(const mipp::Reg<R> v, const R s, std::true_type /* fixed-point */)
+{
+	return mipp::sat(v, (R)-s, (R)+s);
+}
+template <typename R>
+inline mipp::Reg<R> simd_sat_intra(const mipp::Reg<R> v, const R s, std::false_type /* floating-point */)
+{
+	return v;
+}
+template <typename R>
+inline mipp::Reg<R> simd_sat_intra(const mipp::Reg<R> v, const R s)
+{
+	return simd_sat_intra<R>(v, s, std::is_integral<R>());
+}
+
+//                                                                                                        normalization
+template <typename R, int F>
+inline mipp::Reg<R> simd_normalize_intra(const mipp::Reg<R> v, const float f, std::true_type /* fixed-point */)
+{
+	// 'F' is the normalization factor in eighths: v * F / 8
+	if (F == 8) return v;
+	auto res = mipp::Reg<R>((R)0);
+	if (F & 1) res += v >> 3;
+	if (F & 2) res += v >> 2;
+	if (F & 4) res += v >> 1;
+	return res;
+}
+template <typename R, int F>
+inline mipp::Reg<R> simd_normalize_intra(const mipp::Reg<R> v, const float f, std::false_type /* floating-point */)
+{
+	return F == 8 ? v : v * mipp::Reg<R>((R)f);
+}
+template <typename R, int F>
+inline mipp::Reg<R> simd_normalize_intra(const mipp::Reg<R> v, const float f)
+{
+	return simd_normalize_intra<R,F>(v, f, std::is_integral<R>());
+}
+
+// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename B, typename R>
+template <int F>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::BP_process(mipp::vector<R> &var_nodes, mipp::vector<R> &branches)
+{
+	const auto zero = mipp::Reg<R>((R)0);
+	const auto n_layers = (unsigned)this->layers_offset.size() -1;
+
+	auto kb = 0u; // offset of the branches of the current layer
+	for (unsigned l = 0; l < n_layers; l++)
+	{
+		const auto first    = this->layers_offset[l];
+		const auto n_blocks = this->layers_offset[l +1] - first;
+
+		// cyclic shift of the variable nodes of each circulant block: the k-th lane is the k-th CN of the layer
+		for (unsigned b = 0; b < n_blocks; b++)
+		{
+			const auto VN  = var_nodes.data() + this->blocks_VN[first + b] * Z;
+			const auto rot = this->blocks_rot[first + b];
+			const auto C   = this->contributions.data() + b * Z_pad;
+
+			std::copy(VN + rot, VN + Z,   C          );
+			std::copy(VN,       VN + rot, C + Z - rot);
+			std::fill(C + Z,    C + Z_pad, (R)0      );
+		}
+
+		// all the CNs of the layer are independent: min-sum over the Z SIMD lanes
+		for (unsigned k = 0; k < Z_pad; k += mipp::nElReg<R>())
+		{
+			auto sign = mipp::Msk<mipp::N<R>()>(false);
+			auto min1 = mipp::Reg<R>(std::numeric_limits<R>::max());
+			auto min2 = mipp::Reg<R>(std::numeric_limits<R>::max());
+
+			for (unsigned b = 0; b < n_blocks; b++)
+			{
+				const auto C = this->contributions.data() + b * Z_pad + k;
+				const auto contrib = simd_sat_intra<R>(mipp::Reg<R>(C) - mipp::Reg<R>(&branches[kb + b * Z_pad + k]),
+				                                       v_saturation);
+				contrib.store(C);
+
+				const auto v_abs  = mipp::abs (contrib);
+				const auto c_sign = mipp::sign(contrib);
+				const auto v_temp = min1;
+
+				sign ^= c_sign;
+				min1  = mipp::min(min1,           v_abs         );
+				min2  = mipp::min(min2, mipp::max(v_abs, v_temp));
+			}
+
+			auto cste1 = simd_sat_intra<R>(simd_normalize_intra<R,F>(min2 - offset, normalize_factor), c_saturation);
+			auto cste2 = simd_sat_intra<R>(simd_normalize_intra<R,F>(min1 - offset, normalize_factor), c_saturation);
+
+			cste1 = mipp::blend(zero, cste1, zero > cste1);
+			cste2 = mipp::blend(zero, cste2, zero > cste2);
+
+			for (unsigned b = 0; b < n_blocks; b++)
+			{
+				const auto C = this->contributions.data() + b * Z_pad + k;
+				const auto value = mipp::Reg<R>(C);
+				const auto v_abs = mipp::abs(value);
+				      auto v_res = mipp::blend(cste1, cste2, v_abs == min1);
+				const auto v_sig = sign ^ mipp::sign(value);
+				           v_res = mipp::copysign(v_res, v_sig);
+
+				v_res.store(&branches[kb + b * Z_pad + k]);
+				simd_sat_intra<R>(value + v_res, v_saturation).store(C);
+			}
+		}
+
+		// inverse cyclic shift
+		for (unsigned b = 0; b < n_blocks; b++)
+		{
+			const auto VN  = var_nodes.data() + this->blocks_VN[first + b] * Z;
+			const auto rot = this->blocks_rot[first + b];
+			const auto C   = this->contributions.data() + b * Z_pad;
+
+			std::copy(C,           C + Z - rot, VN + rot);
+			std::copy(C + Z - rot, C + Z,       VN      );
+		}
+
+		kb += n_blocks * Z_pad;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_layered_ONMS_intra<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_layered_ONMS_intra<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_layered_ONMS_intra<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_layered_ONMS_intra<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_layered_ONMS_intra<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,81 @@
+#ifndef DECODER_LDPC_BP_LAYERED_ONMS_INTRA_HPP_
+#define DECODER_LDPC_BP_LAYERED_ONMS_INTRA_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+#include "../../Decoder_LDPC_BP.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Layered offset normalized min-sum decoder for the quasi-cyclic LDPC codes. A layer is made of the Z check nodes of a
+ * block column of H, the Z check nodes are processed at the same time in the SIMD lanes (intra-frame SIMD): the LLRs of
+ * each circulant block are cyclically shifted into a contiguous buffer before the update and shifted back after. In
+ * fixed-point (8-bit and 16-bit) the messages are saturated so the computations never overflow.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_layered_ONMS_intra : public Decoder_LDPC_BP<B,R>
+{
+private:
+	const float normalize_factor;
+	const R offset;
+
+protected:
+	const R c_saturation; // saturation of the check to variable messages
+	const R v_saturation; // saturation of the variable nodes
+	const unsigned Z;     // size of the circulant blocks
+	const unsigned Z_pad; // size of the circulant blocks rounded up to a multiple of the SIMD width
+
+	// reset so C_to_V and V_to_C structures can be cleared only at the beginning of the loop in iterative decoding
+	bool init_flag;
+
+	const std::vector<unsigned> &info_bits_pos;
+
+	// for the layer 'l', the circulant blocks are in [layers_offset[l], layers_offset[l +1]), the k-th check node of
+	// the layer is connected to the variable node 'blocks_VN[b] * Z + (k + blocks_rot[b]) % Z'
+	std::vector<unsigned> layers_offset;
+	std::vector<unsigned> blocks_VN;
+	std::vector<unsigned> blocks_rot;
+
+	// data structures for iterative decoding
+	std::vector<mipp::vector<R>> var_nodes;
+	std::vector<mipp::vector<R>> branches;
+	mipp::vector<R>              contributions;
+
+public:
+	Decoder_LDPC_BP_layered_ONMS_intra(const int K, const int N, const int n_ite,
+	                                   const tools::Sparse_matrix &H,
+	                                   const std::vector<unsigned> &info_bits_pos,
+	                                   const float normalize_factor = 1.f,
+	                                   const R offset = (R)0,
+	                                   const bool enable_syndrome = true,
+	                                   const int syndrome_depth = 1,
+	                                   const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_layered_ONMS_intra();
+
+	void reset();
+
+protected:
+	void _load          (const R *Y_N,           const int frame_id);
+	void _decode_siso   (const R *Y_N1, R *Y_N2, const int frame_id);
+	void _decode_siho   (const R *Y_N,  B *V_K,  const int frame_id);
+	void _decode_siho_cw(const R *Y_N,  B *V_N,  const int frame_id);
+
+	// BP functions for decoding
+	void BP_decode(const int frame_id);
+
+	template <int F = 1>
+	void _BP_decode(const int frame_id);
+
+	template <int F = 1>
+	void BP_process(mipp::vector<R> &var_nodes, mipp::vector<R> &branches);
+};
+}
+}
+
+#endif /* DECODER_LDPC_BP_LAYERED_ONMS_INTRA_HPP_ */
@@ -1,6 +1,7 @@
 #include <chrono>
 
 #include "Tools/Perf/hard_decision.h"
+#include "Tools/Perf/Timer/Sub_task_timer.hpp"
 
 #include "Decoder_NO.hpp"
 
@@ -41,22 +42,18 @@ template <typename B, typename R>
 void Decoder_NO<B,R>
 ::_decode_siho(const R *Y_K, B *V_K, const int frame_id)
 {
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho]);
 	tools::hard_decide(Y_K, V_K, this->K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store, d_store);
+	timer.lap(dec::tm::decode_siho::store);
 }
 
 template <typename B, typename R>
 void Decoder_NO<B,R>
 ::_decode_siho_cw(const R *Y_K, B *V_K, const int frame_id)
 {
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho_cw]);
 	tools::hard_decide(Y_K, V_K, this->K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store, d_store);
+	timer.lap(dec::tm::decode_siho_cw::store);
 }
 
 // ==================================================================================== explicit template instantiation 
@@ -1,5 +1,7 @@
 #include <chrono>
 
+#include "Tools/Perf/Timer/Sub_task_timer.hpp"
+
 #include "Decoder_polar_ASCL_MEM_fast_CA_sys.hpp"
 
 namespace aff3ct
@@ -85,36 +87,28 @@ template <typename B, typename R, class API_polar>
 void Decoder_polar_ASCL_MEM_fast_CA_sys<B,R,API_polar>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_decod = std::chrono::steady_clock::now();
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho]);
 	this->_decode(Y_N, V_K, frame_id);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho::decode);
 
-//	auto t_store = std::chrono::steady_clock::now();
 	if (this->L > 1)
 		Decoder_polar_SCL_MEM_fast_CA_sys<B,R,API_polar>::_store(V_K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	timer.lap(dec::tm::decode_siho::store);
 }
 
 template <typename B, typename R, class API_polar>
 void Decoder_polar_ASCL_MEM_fast_CA_sys<B,R,API_polar>
 ::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_decod = std::chrono::steady_clock::now();
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho_cw]);
 	this->_decode(Y_N, V_N, frame_id);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho_cw::decode);
 
-//	auto t_store = std::chrono::steady_clock::now();
 	if (this->L > 1)
 		Decoder_polar_SCL_MEM_fast_CA_sys<B,R,API_polar>::_store_cw(V_N);
 	else
 		sc_decoder._store_cw(V_N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+	timer.lap(dec::tm::decode_siho_cw::store);
 }
 }
 }
@@ -0,0 +1,75 @@
+#ifndef DECODER_POLAR_ASCL_INTER_SYS_CA
+#define DECODER_POLAR_ASCL_INTER_SYS_CA
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/API/API_polar_dynamic_inter.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+
+#include "../SC/Decoder_polar_SC_fast_sys.hpp"
+#include "../SCL/CRC/Decoder_polar_SCL_fast_CA_sys.hpp"
+
+#include "Module/CRC/CRC.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Two-stage adaptive SCL decoder. The whole batch of frames is first decoded with an inter-frame SIMD SC decoder, then
+ * only the frames which do not verify the CRC are put in a queue. The queue is drained by the list decoder with
+ * L = 2, 4, ..., L_max (full adaptive mode) or directly with L = L_max (partial adaptive mode): the frames which still
+ * fail are kept for the next list size. The results are written back at the position of their frames. The frames of a
+ * batch do not wait for each other to be list decoded and each frame is decoded at most log2(L_max) times.
+ */
+template <typename B = int, typename R = float,
+          class API_polar_inter = tools::API_polar_dynamic_inter<B,R>,
+          class API_polar       = tools::API_polar_dynamic_seq<B, R, tools::f_LLR <  R>,
+                                                                     tools::g_LLR <B,R>,
+                                                                     tools::g0_LLR<  R>,
+                                                                     tools::h_LLR <B,R>,
+                                                                     tools::xo_STD<B  >>>
+class Decoder_polar_ASCL_inter_CA_sys : public Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
+{
+private:
+	Decoder_polar_SC_fast_sys<B,R,API_polar_inter> sc_decoder;
+	const int L_max;
+	const bool is_full_adaptive;
+
+	std::vector<int> queue;      // frames to list decode with the current list size
+	std::vector<int> queue_next; // frames to list decode with the next list size
+	mipp::vector<B>  U_K;        // information bits of a codeword (to check the CRC after 'decode_siho_cw')
+
+public:
+	Decoder_polar_ASCL_inter_CA_sys(const int& K, const int& N, const int& max_L, const std::vector<bool>& frozen_bits,
+	                                CRC<B>& crc, const bool is_full_adaptive = true, const int n_frames = 1);
+
+	Decoder_polar_ASCL_inter_CA_sys(const int& K, const int& N, const int& max_L, const std::vector<bool>& frozen_bits,
+	                                const std::vector<tools::Pattern_polar_i*>& polar_patterns,
+	                                const int idx_r0, const int idx_r1,
+	                                CRC<B>& crc, const bool is_full_adaptive = true, const int n_frames = 1);
+
+	virtual ~Decoder_polar_ASCL_inter_CA_sys(){};
+
+	virtual void notify_frozenbits_update();
+
+	using Decoder_SIHO<B,R>::decode_siho;
+	using Decoder_SIHO<B,R>::decode_siho_cw;
+
+	virtual void decode_siho   (const R *Y_N, B *V_K, const int frame_id = -1);
+	virtual void decode_siho_cw(const R *Y_N, B *V_N, const int frame_id = -1);
+
+private:
+	void list_decode(const R *Y_N, B *V, const int V_size, const bool cw);
+
+	// the SC and the list decoders release their patterns: each one receives its own copy
+	static std::vector<tools::Pattern_polar_i*> clone(const std::vector<tools::Pattern_polar_i*>& polar_patterns);
+};
+}
+}
+
+#include "Decoder_polar_ASCL_inter_CA_sys.hxx"
+
+#endif /* DECODER_POLAR_ASCL_INTER_SYS_CA */
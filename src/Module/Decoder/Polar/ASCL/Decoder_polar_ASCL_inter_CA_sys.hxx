@@ -0,0 +1,140 @@
+#include <utility>
+#include <algorithm>
+
+#include "Decoder_polar_ASCL_inter_CA_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar_inter, class API_polar>
+Decoder_polar_ASCL_inter_CA_sys<B,R,API_polar_inter,API_polar>
+::Decoder_polar_ASCL_inter_CA_sys(const int& K, const int& N, const int& L_max, const std::vector<bool>& frozen_bits,
+                                  CRC<B>& crc, const bool is_full_adaptive, const int n_frames)
+: Decoder(K, N, n_frames, 1),
+  Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>(K, N, L_max, frozen_bits, crc, n_frames),
+  sc_decoder                                  (K, N       , frozen_bits,      n_frames),
+  L_max(L_max), is_full_adaptive(is_full_adaptive),
+  U_K(K)
+{
+	const std::string name = "Decoder_polar_ASCL_inter_CA_sys";
+	this->set_name(name);
+
+	queue     .reserve(this->n_frames);
+	queue_next.reserve(this->n_frames);
+}
+
+template <typename B, typename R, class API_polar_inter, class API_polar>
+Decoder_polar_ASCL_inter_CA_sys<B,R,API_polar_inter,API_polar>
+::Decoder_polar_ASCL_inter_CA_sys(const int& K, const int& N, const int& L_max, const std::vector<bool>& frozen_bits,
+                                  const std::vector<tools::Pattern_polar_i*>& polar_patterns,
+                                  const int idx_r0, const int idx_r1,
+                                  CRC<B>& crc, const bool is_full_adaptive, const int n_frames)
+: Decoder(K, N, n_frames, 1),
+  Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>(K, N, L_max, frozen_bits,        polar_patterns , idx_r0, idx_r1, crc, n_frames),
+  sc_decoder                                  (K, N,        frozen_bits, clone(polar_patterns), idx_r0, idx_r1,      n_frames),
+  L_max(L_max), is_full_adaptive(is_full_adaptive),
+  U_K(K)
+{
+	const std::string name = "Decoder_polar_ASCL_inter_CA_sys";
+	this->set_name(name);
+
+	queue     .reserve(this->n_frames);
+	queue_next.reserve(this->n_frames);
+}
+
+template <typename B, typename R, class API_polar_inter, class API_polar>
+std::vector<tools::Pattern_polar_i*> Decoder_polar_ASCL_inter_CA_sys<B,R,API_polar_inter,API_polar>
+::clone(const std::vector<tools::Pattern_polar_i*>& polar_patterns)
+{
+	std::vector<tools::Pattern_polar_i*> copies;
+	for (auto p : polar_patterns)
+		copies.push_back(p->clone());
+	return copies;
+}
+
+template <typename B, typename R, class API_polar_inter, class API_polar>
+void Decoder_polar_ASCL_inter_CA_sys<B,R,API_polar_inter,API_polar>
+::notify_frozenbits_update()
+{
+	Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>::notify_frozenbits_update();
+	sc_decoder.notify_frozenbits_update();
+}
+
+template <typename B, typename R, class API_polar_inter, class API_polar>
+void Decoder_polar_ASCL_inter_CA_sys<B,R,API_polar_inter,API_polar>
+::decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+	const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+	// first stage: SC decoding of the whole batch, the frames are processed in the SIMD lanes
+	sc_decoder.decode_siho(Y_N, V_K, frame_id);
+
+	queue.clear();
+	for (auto f = f_start; f < f_stop; f++)
+		if (!this->crc.check(V_K + f * this->K, 1))
+			queue.push_back(f);
+
+	// second stage: list decoding of the frames which do not verify the CRC
+	this->list_decode(Y_N, V_K, this->K, false);
+}
+
+template <typename B, typename R, class API_polar_inter, class API_polar>
+void Decoder_polar_ASCL_inter_CA_sys<B,R,API_polar_inter,API_polar>
+::decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+	const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+	sc_decoder.decode_siho_cw(Y_N, V_N, frame_id);
+
+	// the code is systematic: the information bits are the non-frozen bits of the codeword
+	queue.clear();
+	for (auto f = f_start; f < f_stop; f++)
+	{
+		auto k = 0;
+		for (auto i = 0; i < this->N; i++)
+			if (!this->frozen_bits[i])
+				U_K[k++] = V_N[f * this->N +i];
+
+		if (!this->crc.check(U_K, 1))
+			queue.push_back(f);
+	}
+
+	this->list_decode(Y_N, V_N, this->N, true);
+}
+
+template <typename B, typename R, class API_polar_inter, class API_polar>
+void Decoder_polar_ASCL_inter_CA_sys<B,R,API_polar_inter,API_polar>
+::list_decode(const R *Y_N, B *V, const int V_size, const bool cw)
+{
+	if (L_max <= 1)
+		return;
+
+	this->L = is_full_adaptive ? 2 : L_max;
+	while (!queue.empty())
+	{
+		queue_next.clear();
+		for (auto f : queue)
+		{
+			int first_node_id = 0, off_l = 0, off_s = 0;
+
+			this->init_buffers();
+			this->recursive_decode(Y_N + f * this->N, off_l, off_s, this->m, first_node_id);
+
+			// the frame is kept for the next list size if no path verifies the CRC
+			if (!this->select_best_path() && this->L < L_max)
+				queue_next.push_back(f);
+			else if (cw)
+				Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>::_store_cw(V + f * V_size);
+			else
+				Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>::_store   (V + f * V_size);
+		}
+
+		std::swap(queue, queue_next);
+		this->L = std::min(this->L << 1, L_max);
+	}
+}
+}
+}
@@ -18,6 +18,7 @@
 #include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
 
 #include "Tools/Code/Polar/fb_extract.h"
+#include "Tools/Perf/Timer/Sub_task_timer.hpp"
 
 #include "Decoder_polar_SC_fast_sys.hpp"
 
@@ -42,7 +43,8 @@ struct Decoder_polar_SC_fast_sys_static
 		const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
 		                                 (node_type == tools::polar_node_t::RATE_1) ||
 		                                 (node_type == tools::polar_node_t::REP)    ||
-		                                 (node_type == tools::polar_node_t::SPC);
+		                                 (node_type == tools::polar_node_t::SPC)    ||
+		                                 tools::is_generalized_node(node_type);
 
 		if (!is_terminal_pattern && reverse_depth)
 		{
@@ -91,6 +93,15 @@ struct Decoder_polar_SC_fast_sys_static
 				case tools::RATE_1: API_polar::template h  <n_elmts>(s, l, off_l, off_s, n_elmts); break;
 				case tools::REP:    API_polar::template rep<n_elmts>(s, l, off_l, off_s, n_elmts); break;
 				case tools::SPC:    API_polar::template spc<n_elmts>(s, l, off_l, off_s, n_elmts); break;
+				case tools::TYPE_1: API_polar::template grep    <n_elmts>(s, l, off_l, off_s, n_elmts, 2); break;
+				case tools::TYPE_2: API_polar::template grep_spc<n_elmts>(s, l, off_l, off_s, n_elmts   ); break;
+				case tools::TYPE_3: API_polar::template gpc     <n_elmts>(s, l, off_l, off_s, n_elmts, 2); break;
+				case tools::TYPE_4: API_polar::template gpc_rep <n_elmts>(s, l, off_l, off_s, n_elmts   ); break;
+				case tools::TYPE_5: API_polar::template grep_rm <n_elmts>(s, l, off_l, off_s, n_elmts   ); break;
+				case tools::G_REP:  API_polar::template grep    <n_elmts>(s, l, off_l, off_s, n_elmts,
+				                                                          polar_patterns.get_node_period(node_id)); break;
+				case tools::G_PC:   API_polar::template gpc     <n_elmts>(s, l, off_l, off_s, n_elmts,
+				                                                          polar_patterns.get_node_period(node_id)); break;
 				default:
 					break;
 			}
@@ -258,6 +269,8 @@ template <typename B, typename R, class API_polar>
 void Decoder_polar_SC_fast_sys<B,R,API_polar>
 ::_decode()
 {
+	this->polar_patterns.update();
+
 	if (m < static_level)
 	{
 		std::stringstream message;
@@ -280,22 +293,17 @@ void Decoder_polar_SC_fast_sys<B,R,API_polar>
 	if (!API_polar::isAligned(V_K))
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'V_K' is misaligned memory.");
 
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho]);
 	this->_load(Y_N);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	this->_decode();
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	this->_store(V_K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
+	timer.lap(dec::tm::decode_siho::store);
 
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::total,  d_load + d_decod + d_store);
+	timer.total(dec::tm::decode_siho::total);
 }
 
 template <typename B, typename R, class API_polar>
@@ -308,22 +316,17 @@ void Decoder_polar_SC_fast_sys<B,R,API_polar>
 	if (!API_polar::isAligned(V_N))
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'V_N' is misaligned memory.");
 
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho_cw]);
 	this->_load(Y_N);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho_cw::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	this->_decode();
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho_cw::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	this->_store_cw(V_N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
+	timer.lap(dec::tm::decode_siho_cw::store);
 
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::total,  d_load + d_decod + d_store);
+	timer.total(dec::tm::decode_siho_cw::total);
 }
 
 template <typename B, typename R, class API_polar>
@@ -345,7 +348,8 @@ void Decoder_polar_SC_fast_sys<B,R,API_polar>
 		const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
 		                                 (node_type == tools::polar_node_t::RATE_1) ||
 		                                 (node_type == tools::polar_node_t::REP)    ||
-		                                 (node_type == tools::polar_node_t::SPC);
+		                                 (node_type == tools::polar_node_t::SPC)    ||
+		                                 tools::is_generalized_node(node_type);
 
 		if (!is_terminal_pattern && reverse_depth)
 		{
@@ -392,6 +396,15 @@ void Decoder_polar_SC_fast_sys<B,R,API_polar>
 				case tools::RATE_1: API_polar::h  (s, l, off_l, off_s, n_elmts); break;
 				case tools::REP:    API_polar::rep(s, l, off_l, off_s, n_elmts); break;
 				case tools::SPC:    API_polar::spc(s, l, off_l, off_s, n_elmts); break;
+				case tools::TYPE_1: API_polar::grep    (s, l, off_l, off_s, n_elmts, 2); break;
+				case tools::TYPE_2: API_polar::grep_spc(s, l, off_l, off_s, n_elmts   ); break;
+				case tools::TYPE_3: API_polar::gpc     (s, l, off_l, off_s, n_elmts, 2); break;
+				case tools::TYPE_4: API_polar::gpc_rep (s, l, off_l, off_s, n_elmts   ); break;
+				case tools::TYPE_5: API_polar::grep_rm (s, l, off_l, off_s, n_elmts   ); break;
+				case tools::G_REP:  API_polar::grep    (s, l, off_l, off_s, n_elmts, polar_patterns.get_node_period(node_id));
+				                    break;
+				case tools::G_PC:   API_polar::gpc     (s, l, off_l, off_s, n_elmts, polar_patterns.get_node_period(node_id));
+				                    break;
 				default:
 					break;
 			}
@@ -0,0 +1,84 @@
+#ifndef DECODER_POLAR_SC_SPEC_SYS_
+#define DECODER_POLAR_SC_SPEC_SYS_
+
+#include <memory>
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/Polar_program.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_i.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Code/Polar/Frozenbits_notifier.hpp"
+
+#include "../../Decoder_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * SC fast decoder specialized at runtime: the tree of patterns is flattened into a program (see tools::Polar_program)
+ * and each instruction is linked to a kernel of the API instantiated for its size (up to 2^spec_static_level elements,
+ * the dynamic kernels are used above). The decoding is a loop over the instructions, so for any frozen bits the
+ * decoder is close to the generated decoders (see Decoder_polar_gen) without generating and compiling them.
+ * The programs are cached by frozen bits (see tools::Polar_program_cache).
+ */
+template <typename B = int, typename R = float,
+          class API_polar = tools::API_polar_dynamic_seq<B, R, tools::f_LLR <  R>,
+                                                               tools::g_LLR <B,R>,
+                                                               tools::g0_LLR<  R>,
+                                                               tools::h_LLR <B,R>,
+                                                               tools::xo_STD<B  >>>
+class Decoder_polar_SC_spec_sys : public Decoder_SIHO<B,R>, public tools::Frozenbits_notifier
+{
+public:
+	using kernel_t = void (*)(mipp::vector<B>&, mipp::vector<R>&, const tools::Polar_instr&);
+
+protected:
+	const int                                   m;            // graph depth
+	      mipp::vector<R   >                    l;            // lambda, LR or LLR
+	      mipp::vector<B   >                    s;            // bits, partial sums
+	      mipp::vector<B   >                    s_bis;        // bits, partial sums
+	const  std::vector<bool>                   &frozen_bits;  // frozen bits
+	const  std::vector<tools::Pattern_polar_i*> polar_patterns;
+	const int                                   idx_r0;
+	const int                                   idx_r1;
+
+	std::shared_ptr<const tools::Polar_program> program;
+	std::vector<kernel_t>                       code;         // kernel of each instruction of the program
+	bool                                        outdated;     // true if the frozen bits have been notified since the last link
+
+public:
+	Decoder_polar_SC_spec_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits, const int n_frames = 1);
+
+	Decoder_polar_SC_spec_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+	                          const std::vector<tools::Pattern_polar_i*> &polar_patterns,
+	                          const int idx_r0, const int idx_r1, const int n_frames = 1);
+
+	virtual ~Decoder_polar_SC_spec_sys();
+
+	virtual void notify_frozenbits_update();
+
+	static kernel_t get_kernel(const tools::polar_op_t op, const int rev_depth);
+
+protected:
+	        void _load          (const R *Y_N                            );
+	virtual void _decode        (                                        );
+	        void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	        void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+	        void _store         (              B *V_K                    );
+	        void _store_cw      (              B *V_N                    );
+
+	void update(); // fetches the program and links it if the frozen bits have been notified
+	void link();
+
+private:
+	void check_parameters();
+};
+}
+}
+
+#include "Decoder_polar_SC_spec_sys.hxx"
+
+#endif /* DECODER_POLAR_SC_SPEC_SYS_ */
@@ -0,0 +1,486 @@
+#include <algorithm>
+#include <sstream>
+
+#include "Tools/Math/utils.h"
+#include "Tools/Algo/Bit_packer.hpp"
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Perf/Transpose/transpose_selector.h"
+
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_spc.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+
+#include "Tools/Code/Polar/Polar_program_cache.hpp"
+#include "Tools/Code/Polar/fb_extract.h"
+
+#include "Decoder_polar_SC_spec_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+constexpr int spec_static_level = 10; // 2^10 = 1024
+
+// the kernels of the instructions, 'N_ELMTS' is the size of the kernel (0 for the dynamic kernels)
+template <typename B, typename R, class API_polar, int N_ELMTS>
+struct Decoder_polar_SC_spec_sys_kernels
+{
+	static inline int size(const tools::Polar_instr &i) { return N_ELMTS ? N_ELMTS : 1 << i.rev_depth; }
+
+	static void f(mipp::vector<B> &s, mipp::vector<R> &l, const tools::Polar_instr &i)
+	{
+		const auto n = size(i);
+		API_polar::template f<N_ELMTS>(l, i.off_l, i.off_l + n, i.off_l + 2 * n, n);
+	}
+
+	static void g(mipp::vector<B> &s, mipp::vector<R> &l, const tools::Polar_instr &i)
+	{
+		const auto n = size(i);
+		API_polar::template g<N_ELMTS>(s, l, i.off_l, i.off_l + n, i.off_s, i.off_l + 2 * n, n);
+	}
+
+	static void g0(mipp::vector<B> &s, mipp::vector<R> &l, const tools::Polar_instr &i)
+	{
+		const auto n = size(i);
+		API_polar::template g0<N_ELMTS>(l, i.off_l, i.off_l + n, i.off_l + 2 * n, n);
+	}
+
+	static void gr(mipp::vector<B> &s, mipp::vector<R> &l, const tools::Polar_instr &i)
+	{
+		const auto n = size(i);
+		API_polar::template gr<N_ELMTS>(s, l, i.off_l, i.off_l + n, i.off_s, i.off_l + 2 * n, n);
+	}
+
+	static void xo(mipp::vector<B> &s, mipp::vector<R> &l, const tools::Polar_instr &i)
+	{
+		const auto n = size(i);
+		API_polar::template xo<N_ELMTS>(s, i.off_s, i.off_s + n, i.off_s, n);
+	}
+
+	static void xo0(mipp::vector<B> &s, mipp::vector<R> &l, const tools::Polar_instr &i)
+	{
+		const auto n = size(i);
+		API_polar::template xo0<N_ELMTS>(s, i.off_s + n, i.off_s, n);
+	}
+
+	static void h0(mipp::vector<B> &s, mipp::vector<R> &l, const tools::Polar_instr &i)
+	{
+		API_polar::template h0<N_ELMTS>(s, i.off_s, size(i));
+	}
+
+	static void h(mipp::vector<B> &s, mipp::vector<R> &l, const tools::Polar_instr &i)
+	{
+		API_polar::template h<N_ELMTS>(s, l, i.off_l, i.off_s, size(i));
+	}
+
+	static void rep(mipp::vector<B> &s, mipp::vector<R> &l, const tools::Polar_instr &i)
+	{
+		API_polar::template rep<N_ELMTS>(s, l, i.off_l, i.off_s, size(i));
+	}
+
+	static void spc(mipp::vector<B> &s, mipp::vector<R> &l, const tools::Polar_instr &i)
+	{
+		API_polar::template spc<N_ELMTS>(s, l, i.off_l, i.off_s, size(i));
+	}
+
+	static void grep(mipp::vector<B> &s, mipp::vector<R> &l, const tools::Polar_instr &i)
+	{
+		API_polar::template grep<N_ELMTS>(s, l, i.off_l, i.off_s, size(i), i.param);
+	}
+
+	static void grep_spc(mipp::vector<B> &s, mipp::vector<R> &l, const tools::Polar_instr &i)
+	{
+		API_polar::template grep_spc<N_ELMTS>(s, l, i.off_l, i.off_s, size(i));
+	}
+
+	static void grep_rm(mipp::vector<B> &s, mipp::vector<R> &l, const tools::Polar_instr &i)
+	{
+		API_polar::template grep_rm<N_ELMTS>(s, l, i.off_l, i.off_s, size(i));
+	}
+
+	static void gpc(mipp::vector<B> &s, mipp::vector<R> &l, const tools::Polar_instr &i)
+	{
+		API_polar::template gpc<N_ELMTS>(s, l, i.off_l, i.off_s, size(i), i.param);
+	}
+
+	static void gpc_rep(mipp::vector<B> &s, mipp::vector<R> &l, const tools::Polar_instr &i)
+	{
+		API_polar::template gpc_rep<N_ELMTS>(s, l, i.off_l, i.off_s, size(i));
+	}
+
+	static typename Decoder_polar_SC_spec_sys<B,R,API_polar>::kernel_t get(const tools::polar_op_t op)
+	{
+		switch (op)
+		{
+			case tools::OP_F:        return f;
+			case tools::OP_G:        return g;
+			case tools::OP_G0:       return g0;
+			case tools::OP_GR:       return gr;
+			case tools::OP_XO:       return xo;
+			case tools::OP_XO0:      return xo0;
+			case tools::OP_H0:       return h0;
+			case tools::OP_H:        return h;
+			case tools::OP_REP:      return rep;
+			case tools::OP_SPC:      return spc;
+			case tools::OP_GREP:     return grep;
+			case tools::OP_GREP_SPC: return grep_spc;
+			case tools::OP_GREP_RM:  return grep_rm;
+			case tools::OP_GPC:      return gpc;
+			case tools::OP_GPC_REP:  return gpc_rep;
+			default:
+				return nullptr;
+		}
+	}
+};
+
+// a leaf of 1 element is a rate 0 or a rate 1 node
+template <typename B, typename R, class API_polar>
+struct Decoder_polar_SC_spec_sys_kernels_1 : Decoder_polar_SC_spec_sys_kernels<B,R,API_polar,1>
+{
+	using K = Decoder_polar_SC_spec_sys_kernels<B,R,API_polar,1>;
+
+	static typename Decoder_polar_SC_spec_sys<B,R,API_polar>::kernel_t get(const tools::polar_op_t op)
+	{
+		switch (op)
+		{
+			case tools::OP_F:   return K::f;
+			case tools::OP_G:   return K::g;
+			case tools::OP_G0:  return K::g0;
+			case tools::OP_GR:  return K::gr;
+			case tools::OP_XO:  return K::xo;
+			case tools::OP_XO0: return K::xo0;
+			case tools::OP_H0:  return K::h0;
+			case tools::OP_H:   return K::h;
+			default:
+				return nullptr;
+		}
+	}
+};
+
+template <typename B, typename R, class API_polar, int REV_D>
+struct Decoder_polar_SC_spec_sys_linker
+{
+	static typename Decoder_polar_SC_spec_sys<B,R,API_polar>::kernel_t get(const tools::polar_op_t op,
+	                                                                      const int rev_depth)
+	{
+		if (rev_depth == REV_D)
+			return Decoder_polar_SC_spec_sys_kernels<B,R,API_polar,1 << REV_D>::get(op);
+		else
+			return Decoder_polar_SC_spec_sys_linker<B,R,API_polar,REV_D -1>::get(op, rev_depth);
+	}
+};
+
+template <typename B, typename R, class API_polar>
+struct Decoder_polar_SC_spec_sys_linker<B,R,API_polar,0>
+{
+	static typename Decoder_polar_SC_spec_sys<B,R,API_polar>::kernel_t get(const tools::polar_op_t op,
+	                                                                      const int rev_depth)
+	{
+		return Decoder_polar_SC_spec_sys_kernels_1<B,R,API_polar>::get(op);
+	}
+};
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SC_spec_sys<B,R,API_polar>
+::Decoder_polar_SC_spec_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits, const int n_frames)
+: Decoder          (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_SIHO<B,R>(K, N, n_frames, API_polar::get_n_frames()),
+  m                ((int)std::log2(N)),
+  l                (2 * N * this->simd_inter_frame_level + mipp::nElReg<R>()   ),
+  s                (1 * N * this->simd_inter_frame_level + mipp::nElReg<B>(), 0),
+  s_bis            (1 * N * this->simd_inter_frame_level + mipp::nElReg<B>()   ),
+  frozen_bits      (frozen_bits),
+  polar_patterns   ({new tools::Pattern_polar_std,
+                     new tools::Pattern_polar_r0_left,
+                     new tools::Pattern_polar_r0,
+                     new tools::Pattern_polar_r1,
+                     new tools::Pattern_polar_rep_left,
+                     new tools::Pattern_polar_rep,
+                     new tools::Pattern_polar_spc}),
+  idx_r0           (2),
+  idx_r1           (3),
+  outdated         (true)
+{
+	const std::string name = "Decoder_polar_SC_spec_sys";
+	this->set_name(name);
+
+	this->check_parameters();
+	this->notify_frozenbits_update();
+	this->update();
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SC_spec_sys<B,R,API_polar>
+::Decoder_polar_SC_spec_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+                            const std::vector<tools::Pattern_polar_i*>& polar_patterns,
+                            const int idx_r0, const int idx_r1, const int n_frames)
+: Decoder          (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_SIHO<B,R>(K, N, n_frames, API_polar::get_n_frames()),
+  m                ((int)std::log2(N)),
+  l                (2 * N * this->simd_inter_frame_level + mipp::nElReg<R>()   ),
+  s                (1 * N * this->simd_inter_frame_level + mipp::nElReg<B>(), 0),
+  s_bis            (1 * N * this->simd_inter_frame_level + mipp::nElReg<B>()   ),
+  frozen_bits      (frozen_bits),
+  polar_patterns   (polar_patterns),
+  idx_r0           (idx_r0),
+  idx_r1           (idx_r1),
+  outdated         (true)
+{
+	const std::string name = "Decoder_polar_SC_spec_sys";
+	this->set_name(name);
+
+	this->check_parameters();
+	this->notify_frozenbits_update();
+	this->update();
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SC_spec_sys<B,R,API_polar>
+::~Decoder_polar_SC_spec_sys()
+{
+	for (auto p : polar_patterns)
+		delete p;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_spec_sys<B,R,API_polar>
+::check_parameters()
+{
+	static_assert(sizeof(B) == sizeof(R), "");
+
+	if (!tools::is_power_of_2(this->N))
+	{
+		std::stringstream message;
+		message << "'N' has to be a power of 2 ('N' = " << this->N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->N != (int)frozen_bits.size())
+	{
+		std::stringstream message;
+		message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+		        << ", 'N' = " << this->N << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto k = 0; for (auto i = 0; i < this->N; i++) if (frozen_bits[i] == 0) k++;
+	if (this->K != k)
+	{
+		std::stringstream message;
+		message << "The number of information bits in the frozen_bits is invalid ('K' = " << this->K << ", 'k' = "
+		        << k << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R, class API_polar>
+typename Decoder_polar_SC_spec_sys<B,R,API_polar>::kernel_t Decoder_polar_SC_spec_sys<B,R,API_polar>
+::get_kernel(const tools::polar_op_t op, const int rev_depth)
+{
+	if (rev_depth > spec_static_level)
+		return Decoder_polar_SC_spec_sys_kernels<B,R,API_polar,0>::get(op);
+	else
+		return Decoder_polar_SC_spec_sys_linker<B,R,API_polar,spec_static_level>::get(op, rev_depth);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_spec_sys<B,R,API_polar>
+::notify_frozenbits_update()
+{
+	this->outdated = true;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_spec_sys<B,R,API_polar>
+::update()
+{
+	if (this->outdated)
+	{
+		this->outdated = false;
+		this->program = tools::Polar_program_cache::get(frozen_bits, polar_patterns, idx_r0, idx_r1);
+		this->link();
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_spec_sys<B,R,API_polar>
+::link()
+{
+	const auto &instrs = this->program->get_instructions();
+
+	this->code.resize(instrs.size());
+	for (size_t i = 0; i < instrs.size(); i++)
+	{
+		this->code[i] = get_kernel((tools::polar_op_t)instrs[i].op, instrs[i].rev_depth);
+
+		if (this->code[i] == nullptr)
+		{
+			std::stringstream message;
+			message << "No kernel for this instruction ('op' = " << (int)instrs[i].op << ", 'rev_depth' = "
+			        << (int)instrs[i].rev_depth << ").";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_spec_sys<B,R,API_polar>
+::_load(const R *Y_N)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	if (n_frames == 1)
+		std::copy(Y_N, Y_N + this->N, l.begin());
+	else
+	{
+		bool fast_interleave = false;
+		if (typeid(B) == typeid(signed char))
+			fast_interleave = tools::char_transpose((signed char*)Y_N, (signed char*)l.data(), (int)this->N);
+
+		if (!fast_interleave)
+		{
+			std::vector<const R*> frames(n_frames);
+			for (auto f = 0; f < n_frames; f++)
+				frames[f] = Y_N + f*this->N;
+			tools::Reorderer_static<R,n_frames>::apply(frames, l.data(), this->N);
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_spec_sys<B,R,API_polar>
+::_decode()
+{
+	this->update();
+
+	const auto &instrs = this->program->get_instructions();
+	const auto n_instrs = (int)instrs.size();
+
+	for (auto i = 0; i < n_instrs; i++)
+		this->code[i](this->s, this->l, instrs[i]);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_spec_sys<B,R,API_polar>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	if (!API_polar::isAligned(Y_N))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N' is misaligned memory.");
+
+	if (!API_polar::isAligned(V_K))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'V_K' is misaligned memory.");
+
+	this->_load(Y_N);
+	this->_decode();
+	this->_store(V_K);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_spec_sys<B,R,API_polar>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	if (!API_polar::isAligned(Y_N))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N' is misaligned memory.");
+
+	if (!API_polar::isAligned(V_N))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'V_N' is misaligned memory.");
+
+	this->_load(Y_N);
+	this->_decode();
+	this->_store_cw(V_N);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_spec_sys<B,R,API_polar>
+::_store(B *V_K)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	const auto &leaves_pattern_types = this->program->get_leaves_pattern_types();
+
+	if (n_frames == 1)
+		tools::fb_extract(leaves_pattern_types, this->s.data(), V_K);
+	else
+	{
+		bool fast_deinterleave = false;
+#if defined(ENABLE_BIT_PACKING)
+		if (typeid(B) == typeid(signed char))
+		{
+			fast_deinterleave = tools::char_itranspose((signed char*)s.data(),
+			                                           (signed char*)s_bis.data(),
+			                                           (int)this->N);
+			if (!fast_deinterleave)
+			{
+				std::stringstream message;
+				message << "Inverse transposition only supports NEON, SSE4.1 and AVX2 instruction sets and the "
+				           "frame size 'N' has to be greater than 128 for NEON/SSE4.1 and greater than 256 for AVX2 "
+				           "('N' = " << this->N << "). "
+				           "To ensure the portability please do not compile with the -DENABLE_BIT_PACKING definition.";
+				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+
+			tools::Bit_packer<B>::unpack(this->s_bis.data(), this->s.data(), this->N, n_frames);
+		}
+#endif
+		if (!fast_deinterleave)
+		{
+			tools::fb_extract<B,n_frames>(leaves_pattern_types, this->s.data(), this->s_bis.data());
+
+			// transpose without bit packing (vectorized)
+			std::vector<B*> frames(n_frames);
+			for (auto f = 0; f < n_frames; f++)
+				frames[f] = (B*)(V_K + f*this->K);
+			tools::Reorderer_static<B,n_frames>::apply_rev(s_bis.data(), frames, this->K);
+		}
+		else
+			for (auto f = 0; f < n_frames; f++)
+				tools::fb_extract(leaves_pattern_types, this->s.data() + f * this->N, V_K + f * this->K);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_spec_sys<B,R,API_polar>
+::_store_cw(B *V_N)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	if (n_frames == 1)
+		std::copy(this->s.begin(), this->s.begin() + this->N, V_N);
+	else
+	{
+		bool fast_deinterleave = false;
+#if defined(ENABLE_BIT_PACKING)
+		if (typeid(B) == typeid(signed char))
+		{
+			fast_deinterleave = tools::char_itranspose((signed char*)s.data(),
+			                                           (signed char*)s_bis.data(),
+			                                           (int)this->N);
+			if (!fast_deinterleave)
+			{
+				std::stringstream message;
+				message << "Inverse transposition only supports NEON, SSE4.1 and AVX2 instruction sets and the "
+				           "frame size 'N' has to be greater than 128 for NEON/SSE4.1 and greater than 256 for AVX2 "
+				           "('N' = " << this->N << "). "
+				           "To ensure the portability please do not compile with the -DENABLE_BIT_PACKING definition.";
+				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+			tools::Bit_packer<B>::unpack(this->s_bis.data(), V_N, this->N, n_frames);
+		}
+#endif
+		if (!fast_deinterleave)
+		{
+			// transpose without bit packing (vectorized)
+			std::vector<B*> frames(n_frames);
+			for (auto f = 0; f < n_frames; f++)
+				frames[f] = (B*)(V_N + f*this->N);
+			tools::Reorderer_static<B,n_frames>::apply_rev(this->s.data(), frames, this->N);
+		}
+	}
+}
+}
+}
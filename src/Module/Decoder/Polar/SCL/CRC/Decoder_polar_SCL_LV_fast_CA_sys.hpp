@@ -0,0 +1,46 @@
+#ifndef DECODER_POLAR_SCL_LV_FAST_CA_SYS
+#define DECODER_POLAR_SCL_LV_FAST_CA_SYS
+
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Code/Polar/API/API_polar_dynamic_intra.hpp"
+#include "Module/CRC/CRC.hpp"
+
+#include "../Decoder_polar_SCL_LV_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B = int, typename R = float, class API_polar = tools::API_polar_dynamic_intra<B,R>>
+class Decoder_polar_SCL_LV_fast_CA_sys : public Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+{
+private:
+	bool fast_store;
+
+protected:
+	CRC<B>& crc;
+	mipp::vector<B> U_test;
+
+public:
+	Decoder_polar_SCL_LV_fast_CA_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+	                                 CRC<B>& crc, const int n_frames = 1);
+
+	Decoder_polar_SCL_LV_fast_CA_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+	                                 const std::vector<tools::Pattern_polar_i*>& polar_patterns,
+	                                 const int idx_r0, const int idx_r1, CRC<B>& crc, const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCL_LV_fast_CA_sys(){};
+
+protected:
+	        bool crc_check       (mipp::vector<B> &s);
+	virtual int  select_best_path(                  );
+
+	virtual void init_buffers();
+	virtual void _store(B *V_K) const;
+};
+}
+}
+
+#include "Decoder_polar_SCL_LV_fast_CA_sys.hxx"
+
+#endif /* DECODER_POLAR_SCL_LV_FAST_CA_SYS */
@@ -0,0 +1,128 @@
+#ifndef DECODER_POLAR_SCL_LV_FAST_SYS
+#define DECODER_POLAR_SCL_LV_FAST_SYS
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_intra.hpp"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Code/Polar/Frozenbits_notifier.hpp"
+
+#include "../../Decoder_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * List-vectorized SCL decoder (LV): the L paths are interleaved in the LLRs and in the partial sums (the value 'i' of
+ * the path 'p' is stored at 'i * L + p'), so a f, g, h or xor of a node is a single contiguous SIMD kernel for all the
+ * paths and its cost scales with the SIMD width instead of L. The penalties, the parities and the least reliable bits
+ * of the specialized nodes are computed in the SIMD lanes of the paths, and the L best candidates are selected by a
+ * SIMD ranking of their metrics.
+ *
+ * After a sort, the new path 'p' comes from the old path 'src[p]': this permutation is not applied to the data of the
+ * upper depths right away but composed with the pending permutation of each depth: the LLRs of a depth are permuted
+ * only when they are read again (for the g) and its left partial sums only when they are read again (for the xor), so a
+ * path is duplicated lazily and only the lanes that changed are copied.
+ * The paths are kept sorted by metric, the first 'n_active_paths' lanes are the active paths.
+ */
+template <typename B = int, typename R = float, class API_polar = tools::API_polar_dynamic_intra<B,R>>
+class Decoder_polar_SCL_LV_fast_sys : public Decoder_SIHO<B,R>, public tools::Frozenbits_notifier
+{
+protected:
+	const int                         m;              // graph depth
+	const int                         L;              // maximum paths number
+	const std::vector<bool>&          frozen_bits;
+	      tools::Pattern_polar_parser polar_patterns;
+
+	std::vector<mipp::vector<R>>      l;              // llrs of the current node of each depth (interleaved paths)
+	            mipp::vector<B>       s;              // partial sums (interleaved paths)
+	std::vector<std::vector<int>>     perm;           // pending permutation of the paths of each depth
+	            std::vector<bool>     perm_pending;
+	            std::vector<int>      perm_tmp;
+	std::vector<std::pair<int,int>>   moves;          // lanes to copy when a permutation is applied
+
+	            std::vector<R>        metrics;        // path metrics
+	            mipp::vector<R>       cands;          // candidate metrics to be sorted (padded to the SIMD width)
+	            mipp::vector<R>       cnt;            // counters of the SIMD ranking
+	            std::vector<int>      sel;            // selected candidates, sorted by metric
+	            std::vector<int>      src;            // old path of each new path
+	            std::vector<int>      dup;            // candidate of the old path chosen by each new path
+	            std::vector<int>      bit_flips;      // 4 least reliable bits (or the moves of a generalized node) per path
+	            std::vector<R>        pens;           // their absolute LLRs
+	            std::vector<R>        pen0;           // penalty of the path if the node is all 0s
+	            std::vector<R>        pen1;           // penalty of the path if the node is all 1s
+	            std::vector<int>      is_odd;         // parity of the hard decisions of the path (SPC nodes)
+	            mipp::vector<R>       fold_v;         // SIMD accumulators stored before their reduction per path
+	            mipp::vector<R>       fold_i;
+	            mipp::vector<R>       row_r;
+	            mipp::vector<B>       row_b;
+	            mipp::vector<B>       s_best;         // partial sums of the best path (de-interleaved)
+
+	int                               best_path;
+	int                               n_active_paths;
+
+public:
+	Decoder_polar_SCL_LV_fast_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+	                              const int n_frames = 1);
+
+	Decoder_polar_SCL_LV_fast_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+	                              const std::vector<tools::Pattern_polar_i*>& polar_patterns,
+	                              const int idx_r0, const int idx_r1, const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCL_LV_fast_sys();
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	virtual void _decode        (const R *Y_N                            );
+	        void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	        void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+	virtual void _store         (              B *V_K                    ) const;
+	virtual void _store_cw      (              B *V_N                    ) const;
+
+	void recursive_decode(const int off_s, const int rev_depth, int &node_id);
+
+	void update_paths_r0 (const int rev_depth, const int off_s);
+	void update_paths_r1 (const int rev_depth, const int off_s);
+	void update_paths_rep(const int rev_depth, const int off_s);
+	void update_paths_spc(const int rev_depth, const int off_s);
+	void update_paths_gen(const int rev_depth, const int off_s, const int period, const bool is_rep); // G-Rep or G-PC
+
+	virtual void init_buffers    (                         );
+	virtual int  select_best_path(                         );
+	        void extract_path    (const int path, B *s_path) const; // de-interleave the partial sums of a path
+
+private:
+	void check_parameters();
+
+	// penalties of the paths if the node is all 0s ('pen0') or all 1s ('pen1')
+	void lanes_penalties(const R *l_node, const int n_elmts);
+	// parity of the hard decisions of the paths
+	void lanes_parity   (const R *l_node, const int n_elmts);
+	// the 'K' least reliable bits of the paths
+	template <int K>
+	void lanes_min_abs  (const R *l_node, const int n_elmts);
+
+	// select the 'n_keep' best candidates in 'cands' (sorted in 'sel')
+	void select_candidates(const int n_cands, const int n_keep);
+	// keep the 'n_list' selected candidates as the new paths
+	void update_paths     (const int n_cands, const int n_list, const int rev_depth);
+
+	void apply_perm  (const int rev_depth, const int off_s, const bool on_llrs);
+	void update_moves(const std::vector<int> &map);
+	template <typename T>
+	void permute_rows(T *data, const int n_rows, T *tmp);
+
+	void hard_decide   (const int rev_depth, const int off_s);
+	void move_decisions(const int rev_depth, const int off_s); // the decisions of the old paths follow the new paths
+	void flip_bit      (const int off_s, const int bit, const int path);
+};
+}
+}
+
+#include "Decoder_polar_SCL_LV_fast_sys.hxx"
+
+#endif /* DECODER_POLAR_SCL_LV_FAST_SYS */
@@ -0,0 +1,868 @@
+#include <algorithm>
+#include <sstream>
+#include <numeric>
+#include <limits>
+#include <cmath>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/utils.h"
+
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_spc.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+
+#include "Tools/Code/Polar/fb_extract.h"
+
+#include "Decoder_polar_SCL_fast_sys.hpp" // sat_m and normalize_scl_metrics
+#include "Decoder_polar_SCL_LV_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename R>
+inline mipp::Reg<R> lv_adds(const mipp::Reg<R> a, const mipp::Reg<R> b) { return a + b; }
+template <>
+inline mipp::Reg<signed char> lv_adds(const mipp::Reg<signed char> a, const mipp::Reg<signed char> b)
+{
+	return mipp::adds(a, b);
+}
+
+// greatest row index which can be exactly represented in a SIMD register of 'R'
+template <typename R>
+inline long long lv_max_index()
+{
+	return (long long)std::min((double)std::numeric_limits<R>::max(), 16777216.);
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::Decoder_polar_SCL_LV_fast_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+                                const int n_frames)
+: Decoder          (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_SIHO<B,R>(K, N, n_frames, API_polar::get_n_frames()),
+  m                ((int)std::log2(N)),
+  L                (L),
+  frozen_bits      (frozen_bits),
+  polar_patterns   (N,
+                    frozen_bits,
+                    {new tools::Pattern_polar_std,
+                     new tools::Pattern_polar_r0,
+                     new tools::Pattern_polar_r1,
+                     new tools::Pattern_polar_r0_left,
+                     new tools::Pattern_polar_rep_left,
+                     new tools::Pattern_polar_rep,
+                     new tools::Pattern_polar_spc(2,2)},
+                    1,
+                    2),
+  best_path        (0),
+  n_active_paths   (1)
+{
+	const std::string name = "Decoder_polar_SCL_LV_fast_sys";
+	this->set_name(name);
+
+	this->check_parameters();
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::Decoder_polar_SCL_LV_fast_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+                                const std::vector<tools::Pattern_polar_i*>& polar_patterns,
+                                const int idx_r0, const int idx_r1, const int n_frames)
+: Decoder          (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_SIHO<B,R>(K, N, n_frames, API_polar::get_n_frames()),
+  m                ((int)std::log2(N)),
+  L                (L),
+  frozen_bits      (frozen_bits),
+  polar_patterns   (N, frozen_bits, polar_patterns, idx_r0, idx_r1),
+  best_path        (0),
+  n_active_paths   (1)
+{
+	const std::string name = "Decoder_polar_SCL_LV_fast_sys";
+	this->set_name(name);
+
+	this->check_parameters();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::check_parameters()
+{
+	static_assert(sizeof(B) == sizeof(R), "Sizes of the bits and reals have to be identical.");
+
+	if (API_polar::get_n_frames() != 1)
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The inter-frame API_polar is not supported.");
+
+	if (this->polar_patterns.exist_node_type(tools::polar_node_t::TYPE_2) ||
+	    this->polar_patterns.exist_node_type(tools::polar_node_t::TYPE_4) ||
+	    this->polar_patterns.exist_node_type(tools::polar_node_t::TYPE_5))
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The Type-II, Type-IV and Type-V nodes are not "
+		                                                            "supported by the SCL decoders.");
+
+	if (!tools::is_power_of_2(this->N))
+	{
+		std::stringstream message;
+		message << "'N' has to be a power of 2 ('N' = " << this->N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->N != (int)frozen_bits.size())
+	{
+		std::stringstream message;
+		message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+		        << ", 'N' = " << this->N << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->L <= 0 || !tools::is_power_of_2(this->L))
+	{
+		std::stringstream message;
+		message << "'L' has to be a positive power of 2 ('L' = " << this->L << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto k = 0; for (auto i = 0; i < this->N; i++) if (frozen_bits[i] == 0) k++;
+	if (this->K != k)
+	{
+		std::stringstream message;
+		message << "The number of information bits in the frozen_bits is invalid ('K' = " << this->K << ", 'k' = "
+		        << k << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto W = mipp::nElReg<R>();
+	const auto C = std::max(L, W);
+
+	l.resize(m +1);
+	for (auto r = 0; r <= m; r++)
+		l[r].resize((1 << r) * L);
+	s        .resize(this->N * L);
+	perm     .resize(m +1, std::vector<int>(L));
+	perm_pending.resize(m +1, false);
+	perm_tmp .resize(L);
+	moves    .reserve(L);
+	metrics  .resize(L);
+	cands    .resize(16 * L + W);
+	cnt      .resize(W);
+	sel      .resize(L);
+	src      .resize(L);
+	dup      .resize(L);
+	bit_flips.resize(8 * L);
+	pens     .resize(4 * L);
+	pen0     .resize(L);
+	pen1     .resize(L);
+	is_odd   .resize(L);
+	fold_v   .resize(4 * C);
+	fold_i   .resize(4 * C);
+	row_r    .resize(C);
+	row_b    .resize(L);
+	s_best   .resize(this->N + mipp::nElReg<B>());
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::~Decoder_polar_SCL_LV_fast_sys()
+{
+	polar_patterns.release_patterns();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::notify_frozenbits_update()
+{
+	polar_patterns.notify_frozenbits_update();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::init_buffers()
+{
+	this->polar_patterns.update();
+
+	metrics[0] = std::numeric_limits<R>::min();
+	n_active_paths = 1;
+	std::fill(perm_pending.begin(), perm_pending.end(), false);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::_decode(const R *Y_N)
+{
+	// the root LLRs are the same for all the paths
+	auto root = l[m].data();
+	for (auto i = 0; i < this->N; i++)
+		std::fill(root + i * L, root + (i +1) * L, Y_N[i]);
+
+	int first_node_id = 0, off_s = 0;
+	recursive_decode(off_s, m, first_node_id);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	if (!API_polar::isAligned(Y_N))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N' is misaligned memory.");
+
+	if (!API_polar::isAligned(V_K))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'V_K' is misaligned memory.");
+
+	this->init_buffers();
+	this->_decode(Y_N);
+	this->select_best_path();
+	this->_store(V_K);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	if (!API_polar::isAligned(Y_N))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N' is misaligned memory.");
+
+	if (!API_polar::isAligned(V_N))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'V_N' is misaligned memory.");
+
+	this->init_buffers();
+	this->_decode(Y_N);
+	this->select_best_path();
+	this->_store_cw(V_N);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::recursive_decode(const int off_s, const int rev_depth, int &node_id)
+{
+	const int n_elmts = 1 << rev_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC)    ||
+	                                 (node_type == tools::polar_node_t::TYPE_1) ||
+	                                 (node_type == tools::polar_node_t::TYPE_3) ||
+	                                 (node_type == tools::polar_node_t::G_REP)  ||
+	                                 (node_type == tools::polar_node_t::G_PC);
+
+	if (!is_terminal_pattern && rev_depth) // not a leaf
+	{
+		const auto n_vals = n_elm_2 * L;
+		const auto parent = l[rev_depth   ].data();
+		const auto child  = l[rev_depth -1].data();
+		const auto s_left = s.data() + off_s * L;
+
+		// f (the LLRs of a rate 0 left child are only read to update the metrics of several paths)
+		if (node_type != tools::RATE_0_LEFT || n_active_paths > 1)
+			API_polar::f(parent, parent + n_vals, child, n_vals);
+		perm_pending[rev_depth -1] = false;
+
+		recursive_decode(off_s, rev_depth -1, ++node_id); // recursive call left
+
+		// the parent LLRs follow the paths selected in the left child (the left partial sums already do)
+		apply_perm(rev_depth, off_s, true);
+
+		// g (no 'gr' for the REP_LEFT nodes: the repeated bit is not the same for all the paths)
+		if (node_type == tools::RATE_0_LEFT)
+			API_polar::g0(parent, parent + n_vals,         child, n_vals);
+		else
+			API_polar::g (parent, parent + n_vals, s_left, child, n_vals);
+		perm_pending[rev_depth -1] = false;
+
+		recursive_decode(off_s + n_elm_2, rev_depth -1, ++node_id); // recursive call right
+
+		// the left partial sums follow the paths selected in the right child
+		apply_perm(rev_depth, off_s, false);
+
+		// xor
+		if (node_type == tools::RATE_0_LEFT)
+			API_polar::xo0(s,                (off_s + n_elm_2) * L, off_s * L, n_vals);
+		else
+			API_polar::xo (s, off_s * L,     (off_s + n_elm_2) * L, off_s * L, n_vals);
+	}
+	else // leaf node
+	{
+		switch (node_type)
+		{
+			case tools::RATE_0: update_paths_r0 (rev_depth, off_s); break;
+			case tools::REP:    update_paths_rep(rev_depth, off_s); break;
+			case tools::RATE_1: update_paths_r1 (rev_depth, off_s); break;
+			case tools::SPC:    update_paths_spc(rev_depth, off_s); break;
+			case tools::TYPE_1: update_paths_gen(rev_depth, off_s, 2, true ); break;
+			case tools::TYPE_3: update_paths_gen(rev_depth, off_s, 2, false); break;
+			case tools::G_REP:  update_paths_gen(rev_depth, off_s, polar_patterns.get_node_period(node_id), true ); break;
+			case tools::G_PC:   update_paths_gen(rev_depth, off_s, polar_patterns.get_node_period(node_id), false); break;
+			default:
+				break;
+		}
+
+		normalize_scl_metrics<R>(this->metrics, n_active_paths);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::_store(B *V_K) const
+{
+	tools::fb_extract(this->polar_patterns.get_leaves_pattern_types(), this->s_best.data(), V_K);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::_store_cw(B *V_N) const
+{
+	std::copy(this->s_best.data(), this->s_best.data() + this->N, V_N);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::update_paths_r0(const int rev_depth, const int off_s)
+{
+	const auto n_elmts = 1 << rev_depth;
+
+	if (n_active_paths > 1)
+	{
+		lanes_penalties(l[rev_depth].data(), n_elmts);
+		for (auto p = 0; p < n_active_paths; p++)
+			metrics[p] = sat_m<R>(metrics[p] + pen0[p]); // add a penalty to the current path metric
+	}
+
+	std::fill(s.begin() + off_s * L, s.begin() + (off_s + n_elmts) * L, (B)0);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::update_paths_rep(const int rev_depth, const int off_s)
+{
+	constexpr B b = tools::bit_init<B>();
+	const auto n_elmts = 1 << rev_depth;
+
+	// generate the two possible candidates
+	lanes_penalties(l[rev_depth].data(), n_elmts);
+	for (auto p = 0; p < n_active_paths; p++)
+	{
+		cands[2 * p +0] = sat_m<R>(metrics[p] + pen0[p]);
+		cands[2 * p +1] = sat_m<R>(metrics[p] + pen1[p]);
+	}
+	std::fill(cands.begin() + 2 * n_active_paths, cands.begin() + 2 * L, std::numeric_limits<R>::max());
+
+	const auto n_list = std::min(L, n_active_paths * 2);
+	select_candidates(2, n_list);
+	update_paths(2, n_list, rev_depth);
+
+	for (auto p = 0; p < L; p++)
+		row_b[p] = (p < n_list && dup[p]) ? b : (B)0;
+	for (auto i = 0; i < n_elmts; i++)
+		std::copy(row_b.begin(), row_b.end(), s.begin() + (off_s + i) * L);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::update_paths_r1(const int rev_depth, const int off_s)
+{
+	if (rev_depth == 0)
+	{
+		update_paths_rep(rev_depth, off_s);
+		return;
+	}
+
+	// generate the candidates with the Chase-II algorithm
+	lanes_min_abs<2>(l[rev_depth].data(), 1 << rev_depth);
+	for (auto p = 0; p < n_active_paths; p++)
+	{
+		const auto pen_a = pens[4 * p +0];
+		const auto pen_b = pens[4 * p +1];
+
+		cands[4 * p +0] =          metrics[p];
+		cands[4 * p +1] = sat_m<R>(metrics[p] + pen_a);
+		cands[4 * p +2] = sat_m<R>(metrics[p] + pen_b);
+		cands[4 * p +3] = sat_m<R>(cands[4 * p +1] + pen_b);
+	}
+	std::fill(cands.begin() + 4 * n_active_paths, cands.begin() + 4 * L, std::numeric_limits<R>::max());
+
+	const auto n_list = std::min(L, n_active_paths * 4);
+	select_candidates(4, n_list);
+	update_paths(4, n_list, rev_depth);
+
+	hard_decide(rev_depth, off_s);
+	for (auto p = 0; p < n_list; p++)
+	{
+		const auto old = src[p];
+		if (dup[p] & 1) flip_bit(off_s, bit_flips[4 * old +0], p);
+		if (dup[p] & 2) flip_bit(off_s, bit_flips[4 * old +1], p);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::update_paths_spc(const int rev_depth, const int off_s)
+{
+	// the number of candidates to generate per list
+	const auto n_cands = L <= 2 ? 4 : 8;
+	const auto n_elmts = 1 << rev_depth;
+
+	// generate the candidates with the Chase-II algorithm
+	lanes_min_abs<4>(l[rev_depth].data(), n_elmts);
+	lanes_parity    (l[rev_depth].data(), n_elmts);
+	for (auto p = 0; p < n_active_paths; p++)
+	{
+		const auto is_even = !is_odd[p];
+		const auto pen_0 = pens[4 * p +0];
+		const auto pen_1 = pens[4 * p +1];
+		const auto pen_2 = pens[4 * p +2];
+		const auto pen_3 = pens[4 * p +3];
+		auto c = cands.data() + n_cands * p;
+
+		c[0] =          sat_m<R>(metrics[p] + (!is_even ? pen_0 : (R)0));
+		c[1] = sat_m<R>(sat_m<R>(metrics[p] + ( is_even ? pen_0 : (R)0)) + pen_1);
+		c[2] = sat_m<R>(sat_m<R>(metrics[p] + ( is_even ? pen_0 : (R)0)) + pen_2);
+		c[3] = sat_m<R>(sat_m<R>(metrics[p] + ( is_even ? pen_0 : (R)0)) + pen_3);
+
+		if (L > 2)
+		{
+			c[4] = sat_m<R>(sat_m<R>(c[0] + pen_1) + pen_2);
+			c[5] = sat_m<R>(sat_m<R>(c[0] + pen_1) + pen_3);
+			c[6] = sat_m<R>(sat_m<R>(c[0] + pen_2) + pen_3);
+			c[7] = sat_m<R>(sat_m<R>(c[1] + pen_2) + pen_3);
+		}
+	}
+	std::fill(cands.begin() + n_cands * n_active_paths, cands.begin() + n_cands * L, std::numeric_limits<R>::max());
+
+	const auto n_list = std::min(L, n_active_paths * n_cands);
+	select_candidates(n_cands, n_list);
+	update_paths(n_cands, n_list, rev_depth);
+
+	// for each candidate: is the least reliable bit flipped when the parity is odd (or even), and the other flips
+	static const bool flip_0_if_odd[8] = {true, false, false, false, true, true, true, false};
+	static const int  flips_123    [8] = {0x0,  0x1,   0x2,   0x4,   0x3,  0x5,  0x6,  0x7  };
+
+	hard_decide(rev_depth, off_s);
+	for (auto p = 0; p < n_list; p++)
+	{
+		const auto old = src[p];
+		const auto d   = dup[p];
+
+		if (flip_0_if_odd[d] == (bool)is_odd[old])
+			flip_bit(off_s, bit_flips[4 * old +0], p);
+		for (auto j = 1; j < 4; j++)
+			if ((flips_123[d] >> (j -1)) & 1)
+				flip_bit(off_s, bit_flips[4 * old +j], p);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::update_paths_gen(const int rev_depth, const int off_s, const int period, const bool is_rep)
+{
+	const auto n_elmts = 1 << rev_depth;
+
+	// the number of moves (flips of a sub-code for the G-Rep, flips of 2 bits of a sub-code for the G-PC) per list grows
+	// with L (up to 4), all the combinations of the moves are generated
+	const auto n_moves = std::min(is_rep ? period : 4, std::min((int)std::log2(L) +1, 4));
+	const auto n_cands = 1 << n_moves;
+
+	// take the ML decisions of the node in the lanes of the old paths and generate the candidates with the Chase-II
+	// algorithm (path per path: the sub-codes are interleaved in the rows of the node)
+	for (auto p = 0; p < n_active_paths; p++)
+	{
+		R pens[16];
+		const auto l_p = l[rev_depth].data() + p;
+		const auto s_p = s.data() + off_s * L + p;
+		const auto pen_ml = is_rep ?
+		    scl_ml_grep<B,R>(l_p, s_p, n_elmts, period, L, n_moves, bit_flips.data() + 8 * p, pens) :
+		    scl_ml_gpc <B,R>(l_p, s_p, n_elmts, period, L, n_moves, bit_flips.data() + 8 * p, pens);
+
+		const auto metric = sat_m<R>(metrics[p] + pen_ml);
+		for (auto c = 0; c < n_cands; c++)
+			cands[n_cands * p +c] = (pens[c] == std::numeric_limits<R>::max()) ?
+			                        std::numeric_limits<R>::max() : sat_m<R>(metric + pens[c]);
+	}
+	std::fill(cands.begin() + n_cands * n_active_paths, cands.begin() + n_cands * L, std::numeric_limits<R>::max());
+
+	const auto n_list = std::min(L, n_active_paths * n_cands);
+	select_candidates(n_cands, n_list);
+	update_paths(n_cands, n_list, rev_depth);
+
+	// the moves of a G-PC node can share a bit: the bits are flipped in place
+	move_decisions(rev_depth, off_s);
+	for (auto p = 0; p < n_list; p++)
+	{
+		const auto old = src[p];
+		for (auto k = 0; (dup[p] >> k) > 0; k++)
+			if ((dup[p] >> k) & 1)
+			{
+				if (is_rep) // flip all the bits of the sub-code
+					for (auto i = bit_flips[8 * old +k]; i < n_elmts; i += period)
+						flip_bit(off_s, i, p);
+				else // flip the 2 bits of the move
+				{
+					flip_bit(off_s, bit_flips[8 * old + 2 * k +0], p);
+					flip_bit(off_s, bit_flips[8 * old + 2 * k +1], p);
+				}
+			}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::lanes_penalties(const R *l_node, const int n_elmts)
+{
+	constexpr auto W = mipp::nElReg<R>();
+	const auto n_vals = n_elmts * L;
+
+	std::fill(pen0.begin(), pen0.end(), (R)0);
+	std::fill(pen1.begin(), pen1.end(), (R)0);
+
+	if (n_vals >= W)
+	{
+		// a chunk holds an integer number of rows and of registers, the lane 'k' of a chunk is the path 'k % L'
+		const auto C        = std::max(L, W);
+		const auto n_blocks = C / W;
+		const auto n_chunks = n_vals / C;
+		const auto zero     = mipp::Reg<R>((R)0);
+
+		for (auto b = 0; b < n_blocks; b++)
+		{
+			auto acc0 = zero, acc1 = zero;
+			for (auto c = 0; c < n_chunks; c++)
+			{
+				const auto v = mipp::Reg<R>(l_node + c * C + b * W);
+				acc0 = lv_adds<R>(acc0, mipp::max(zero - v, zero));
+				acc1 = lv_adds<R>(acc1, mipp::max(v,        zero));
+			}
+			acc0.store(fold_v.data() + b * W);
+			acc1.store(fold_i.data() + b * W);
+		}
+
+		for (auto k = 0; k < C; k++)
+		{
+			pen0[k % L] = sat_m<R>(pen0[k % L] + fold_v[k]);
+			pen1[k % L] = sat_m<R>(pen1[k % L] + fold_i[k]);
+		}
+	}
+	else
+	{
+		for (auto i = 0; i < n_elmts; i++)
+			for (auto p = 0; p < n_active_paths; p++)
+			{
+				const auto v = l_node[i * L + p];
+				pen0[p] = sat_m<R>(pen0[p] + sat_m<R>(-std::min(v, (R)0)));
+				pen1[p] = sat_m<R>(pen1[p] + sat_m<R>(+std::max(v, (R)0)));
+			}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::lanes_parity(const R *l_node, const int n_elmts)
+{
+	constexpr auto W = mipp::nElReg<R>();
+	const auto n_vals = n_elmts * L;
+
+	std::fill(is_odd.begin(), is_odd.end(), 0);
+
+	if (n_vals >= W)
+	{
+		const auto C        = std::max(L, W);
+		const auto n_blocks = C / W;
+		const auto n_chunks = n_vals / C;
+		const auto zero     = mipp::Reg<R>((R)0);
+		const auto one      = mipp::Reg<R>((R)1);
+
+		for (auto b = 0; b < n_blocks; b++)
+		{
+			auto acc = zero;
+			for (auto c = 0; c < n_chunks; c++)
+			{
+				const auto v = mipp::Reg<R>(l_node + c * C + b * W);
+				acc = mipp::blend(one - acc, acc, v < zero);
+			}
+			acc.store(fold_v.data() + b * W);
+		}
+
+		for (auto k = 0; k < C; k++)
+			is_odd[k % L] ^= (fold_v[k] != (R)0);
+	}
+	else
+	{
+		for (auto i = 0; i < n_elmts; i++)
+			for (auto p = 0; p < n_active_paths; p++)
+				is_odd[p] ^= (l_node[i * L + p] < 0);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+template <int K>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::lanes_min_abs(const R *l_node, const int n_elmts)
+{
+	constexpr auto W = mipp::nElReg<R>();
+	const auto n_vals = n_elmts * L;
+
+	// insertion of the value 'v' of the row 'i' in the 'K' sorted best values of a path (the first row wins the ties)
+	auto insert = [](R *best_v, int *best_i, R v, int i)
+	{
+		for (auto j = 0; j < K; j++)
+			if (v < best_v[j] || (v == best_v[j] && i < best_i[j]))
+			{
+				std::swap(v, best_v[j]);
+				std::swap(i, best_i[j]);
+			}
+	};
+
+	R   best_v[K];
+	int best_i[K];
+
+	if (n_vals >= W && (long long)(n_elmts -1) <= lv_max_index<R>())
+	{
+		const auto C        = std::max(L, W);
+		const auto n_blocks = C / W;
+		const auto n_chunks = n_vals / C;
+		const auto step     = mipp::Reg<R>((R)(C / L));
+
+		for (auto b = 0; b < n_blocks; b++)
+		{
+			mipp::Reg<R> min_v[K], min_i[K];
+			for (auto j = 0; j < K; j++)
+			{
+				min_v[j] = mipp::Reg<R>(std::numeric_limits<R>::max());
+				min_i[j] = mipp::Reg<R>((R)0);
+			}
+
+			// the row index of each lane, stored as a 'R' so the index follows the value in the same blend
+			for (auto k = 0; k < W; k++)
+				row_r[k] = (R)((b * W + k) / L);
+			auto idx = mipp::Reg<R>(row_r.data());
+
+			for (auto c = 0; c < n_chunks; c++)
+			{
+				auto v = mipp::abs(mipp::Reg<R>(l_node + c * C + b * W));
+				auto i = idx;
+				for (auto j = 0; j < K; j++)
+				{
+					const auto msk = v < min_v[j];
+					const auto nv  = mipp::blend(v, min_v[j], msk);
+					const auto ni  = mipp::blend(i, min_i[j], msk);
+					v        = mipp::blend(min_v[j], v, msk);
+					i        = mipp::blend(min_i[j], i, msk);
+					min_v[j] = nv;
+					min_i[j] = ni;
+				}
+				idx = idx + step;
+			}
+
+			for (auto j = 0; j < K; j++)
+			{
+				min_v[j].store(fold_v.data() + j * C + b * W);
+				min_i[j].store(fold_i.data() + j * C + b * W);
+			}
+		}
+
+		for (auto p = 0; p < n_active_paths; p++)
+		{
+			std::fill(best_v, best_v + K, std::numeric_limits<R>::max());
+			std::fill(best_i, best_i + K, std::numeric_limits<int>::max());
+			for (auto k = p; k < C; k += L)
+				for (auto j = 0; j < K; j++)
+					insert(best_v, best_i, fold_v[j * C + k], (int)fold_i[j * C + k]);
+
+			for (auto j = 0; j < K; j++)
+			{
+				bit_flips[4 * p +j] = best_i[j];
+				pens     [4 * p +j] = sat_m<R>(best_v[j]);
+			}
+		}
+	}
+	else
+	{
+		for (auto p = 0; p < n_active_paths; p++)
+		{
+			std::fill(best_v, best_v + K, std::numeric_limits<R>::max());
+			std::fill(best_i, best_i + K, std::numeric_limits<int>::max());
+			for (auto i = 0; i < n_elmts; i++)
+				insert(best_v, best_i, (R)std::abs(l_node[i * L + p]), i);
+
+			for (auto j = 0; j < K; j++)
+			{
+				bit_flips[4 * p +j] = best_i[j];
+				pens     [4 * p +j] = sat_m<R>(best_v[j]);
+			}
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::select_candidates(const int n_cands, const int n_keep)
+{
+	constexpr auto W = mipp::nElReg<R>();
+	const auto n_vals   = n_cands * L;
+	const auto n_blocks = (n_vals + W -1) / W;
+	std::fill(cands.begin() + n_vals, cands.begin() + n_blocks * W, std::numeric_limits<R>::max());
+
+	const auto zero = mipp::Reg<R>((R)0);
+	const auto one  = mipp::Reg<R>((R)1);
+
+	// the rank of a candidate is the number of candidates before it in the order (metric, index)
+	for (auto c = 0; c < n_active_paths * n_cands; c++)
+	{
+		const auto vc = cands[c];
+		if (vc == std::numeric_limits<R>::max())
+			continue;
+
+		const auto v  = mipp::Reg<R>(vc);
+		const auto cb = c / W;
+
+		auto acc = zero;
+		for (auto b = 0; b < cb; b++)
+			acc += mipp::blend(one, zero, mipp::Reg<R>(cands.data() + b * W) <= v);
+		for (auto b = cb; b < n_blocks; b++)
+			acc += mipp::blend(one, zero, mipp::Reg<R>(cands.data() + b * W) <  v);
+		acc.store(cnt.data());
+
+		auto rank = 0;
+		for (auto k = 0; k < W; k++)
+			rank += (int)cnt[k];
+		for (auto j = cb * W; j < c; j++)
+			rank += (cands[j] == vc);
+
+		if (rank < n_keep)
+			sel[rank] = c;
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::update_paths(const int n_cands, const int n_list, const int rev_depth)
+{
+	for (auto p = 0; p < n_list; p++)
+	{
+		src    [p] = sel[p] / n_cands;
+		dup    [p] = sel[p] % n_cands;
+		metrics[p] = cands[sel[p]];
+	}
+	for (auto p = n_list; p < L; p++)
+	{
+		src[p] = p;
+		dup[p] = 0;
+	}
+	n_active_paths = n_list;
+
+	// compose the new permutation with the pending permutations of the upper depths
+	for (auto r = rev_depth +1; r <= m; r++)
+	{
+		if (perm_pending[r])
+		{
+			for (auto p = 0; p < L; p++)
+				perm_tmp[p] = perm[r][src[p]];
+			std::swap(perm[r], perm_tmp);
+		}
+		else
+		{
+			perm[r] = src;
+			perm_pending[r] = true;
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::update_moves(const std::vector<int> &map)
+{
+	moves.clear();
+	for (auto p = 0; p < L; p++)
+		if (map[p] != p)
+			moves.push_back(std::make_pair(p, map[p]));
+}
+
+template <typename B, typename R, class API_polar>
+template <typename T>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::permute_rows(T *data, const int n_rows, T *tmp)
+{
+	const auto n_moves = (int)moves.size();
+	for (auto i = 0; i < n_rows; i++)
+	{
+		auto row = data + i * L;
+		for (auto k = 0; k < n_moves; k++) tmp[k] = row[moves[k].second];
+		for (auto k = 0; k < n_moves; k++) row[moves[k].first] = tmp[k];
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::apply_perm(const int rev_depth, const int off_s, const bool on_llrs)
+{
+	if (!perm_pending[rev_depth])
+		return;
+
+	update_moves(perm[rev_depth]);
+	if (!moves.empty())
+	{
+		const auto n_elmts = 1 << rev_depth;
+		if (!on_llrs)
+			permute_rows(s.data() + off_s * L, n_elmts >> 1, row_b.data());
+		else if (rev_depth < m) // the root LLRs are the same for all the paths
+			permute_rows(l[rev_depth].data(), n_elmts, row_r.data());
+	}
+	perm_pending[rev_depth] = false;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::hard_decide(const int rev_depth, const int off_s)
+{
+	// the hard decisions are taken on the LLRs of the old paths then moved to the new paths
+	const auto n_elmts = 1 << rev_depth;
+	API_polar::h(l[rev_depth].data(), s.data() + off_s * L, n_elmts * L);
+
+	move_decisions(rev_depth, off_s);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::move_decisions(const int rev_depth, const int off_s)
+{
+	update_moves(src);
+	if (!moves.empty())
+		permute_rows(s.data() + off_s * L, 1 << rev_depth, row_b.data());
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::flip_bit(const int off_s, const int bit, const int path)
+{
+	constexpr B b = tools::bit_init<B>();
+	auto &s_bit = s[(off_s + bit) * L + path];
+	s_bit = s_bit ? (B)0 : b;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::extract_path(const int path, B *s_path) const
+{
+	for (auto i = 0; i < this->N; i++)
+		s_path[i] = s[i * L + path];
+}
+
+template <typename B, typename R, class API_polar>
+int Decoder_polar_SCL_LV_fast_sys<B,R,API_polar>
+::select_best_path()
+{
+	best_path = 0;
+	for (auto p = 1; p < n_active_paths; p++)
+		if (metrics[p] < metrics[best_path])
+			best_path = p;
+
+	extract_path(best_path, s_best.data());
+
+	return n_active_paths;
+}
+}
+}
@@ -83,6 +83,8 @@ protected:
 	inline void update_paths_r1 (const int rev_depth, const int off_l, const int off_s, const int n_elmts);
 	inline void update_paths_rep(const int rev_depth, const int off_l, const int off_s, const int n_elmts);
 	inline void update_paths_spc(const int rev_depth, const int off_l, const int off_s, const int n_elmts);
+	inline void update_paths_gen(const int rev_depth, const int off_l, const int off_s, const int n_elmts,
+	                             const int period, const bool is_rep); // G-Rep (is_rep) or G-PC node
 
 	// those methods are used by the generated SCL decoders
 	template <int REV_D, int N_ELMTS> inline void update_paths_r0 (const int off_l, const int off_s);
@@ -104,6 +106,8 @@ private:
 	inline void flip_bits_r1 (const int old_path, const int new_path, const int dup, const int off_s, const int n_elmts);
 	inline void flip_bits_rep(const int old_path, const int new_path,                const int off_s, const int n_elmts);
 	inline void flip_bits_spc(const int old_path, const int new_path, const int dup, const int off_s, const int n_elmts);
+	inline void flip_bits_gen(const int old_path, const int new_path, const int dup, const int off_s, const int n_elmts,
+	                          const int period, const bool is_rep);
 };
 }
 }
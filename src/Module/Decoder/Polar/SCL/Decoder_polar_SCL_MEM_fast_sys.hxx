@@ -22,6 +22,7 @@
 
 #include "Tools/Code/Polar/Pattern_polar_parser.hpp"
 #include "Tools/Code/Polar/fb_extract.h"
+#include "Tools/Perf/Timer/Sub_task_timer.hpp"
 
 #include "Decoder_polar_SCL_fast_sys.hpp"
 #include "Decoder_polar_SCL_MEM_fast_sys.hpp"
@@ -57,7 +58,7 @@ Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
   s2               (L, mipp::vector<B>(N + mipp::nElReg<B>())),
   metrics_vec      (3, std::vector<R>()),
   dup_count        (L, 0),
-  bit_flips        (4 * L),
+  bit_flips        (8 * L), // 4 bits of a SPC node or 4 moves of 2 bits of a G-PC node per path
   is_even          (L),
   best_path        (0),
   n_active_paths   (1),
@@ -67,7 +68,7 @@ Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
   path_2_array_s   (L, std::vector<int>(m)),
   sorter           (N),
 //sorter_simd      (N),
-  best_idx         (L),
+  best_idx         (std::max(L, 4)), // at least the 4 least reliable bits of a SPC node
   l_tmp            (N)
 {
 	const std::string name = "Decoder_polar_SCL_MEM_fast_sys";
@@ -120,7 +121,7 @@ Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 
 	metrics_vec[0].resize(L * 2);
 	metrics_vec[1].resize(L * 4);
-	metrics_vec[2].resize((L <= 2 ? 4 : 8) * L);
+	metrics_vec[2].resize(16 * L); // up to 16 candidates per path for the generalized nodes
 }
 
 template <typename B, typename R, class API_polar>
@@ -142,7 +143,7 @@ Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
   s2               (L, mipp::vector<B>(N + mipp::nElReg<B>())),
   metrics_vec      (3, std::vector<R>()),
   dup_count        (L, 0),
-  bit_flips        (4 * L),
+  bit_flips        (8 * L), // 4 bits of a SPC node or 4 moves of 2 bits of a G-PC node per path
   is_even          (L),
   best_path        (0),
   n_active_paths   (1),
@@ -152,7 +153,7 @@ Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
   path_2_array_s     (L, std::vector<int>(m)),
   sorter           (N),
 //sorter_simd      (N),
-  best_idx         (L),
+  best_idx         (std::max(L, 4)), // at least the 4 least reliable bits of a SPC node
   l_tmp            (N)
 {
 	const std::string name = "Decoder_polar_SCL_MEM_fast_sys";
@@ -164,6 +165,12 @@ Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 	if (API_polar::get_n_frames() != 1)
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The inter-frame API_polar is not supported.");
 
+	if (this->polar_patterns.exist_node_type(tools::polar_node_t::TYPE_2) ||
+	    this->polar_patterns.exist_node_type(tools::polar_node_t::TYPE_4) ||
+	    this->polar_patterns.exist_node_type(tools::polar_node_t::TYPE_5))
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The Type-II, Type-IV and Type-V nodes are not "
+		                                                            "supported by the SCL decoders.");
+
 	if (!tools::is_power_of_2(this->N))
 	{
 		std::stringstream message;
@@ -205,7 +212,7 @@ Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 
 	metrics_vec[0].resize(L * 2);
 	metrics_vec[1].resize(L * 4);
-	metrics_vec[2].resize((L <= 2 ? 4 : 8) * L);
+	metrics_vec[2].resize(16 * L); // up to 16 candidates per path for the generalized nodes
 }
 
 template <typename B, typename R, class API_polar>
@@ -226,6 +233,8 @@ template <typename B, typename R, class API_polar>
 void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 ::init_buffers()
 {
+	this->polar_patterns.update();
+
 	metrics[0] = std::numeric_limits<R>::min();
 	std::iota(paths.begin(), paths.begin() + L, 0);
 	n_active_paths = 1;
@@ -262,22 +271,16 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 	if (!API_polar::isAligned(V_K))
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'V_K' is misaligned memory.");
 
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho]);
 	this->init_buffers();
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	this->_decode(Y_N);
 	this->select_best_path();
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	this->_store(V_K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	timer.lap(dec::tm::decode_siho::store);
 }
 
 template <typename B, typename R, class API_polar>
@@ -290,22 +293,16 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 	if (!API_polar::isAligned(V_N))
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'V_N' is misaligned memory.");
 
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho_cw]);
 	this->init_buffers();
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho_cw::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	this->_decode(Y_N);
 	this->select_best_path();
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho_cw::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	this->_store_cw(V_N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+	timer.lap(dec::tm::decode_siho_cw::store);
 }
 
 template <typename B, typename R, class API_polar>
@@ -319,7 +316,11 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
 	                                 (node_type == tools::polar_node_t::RATE_1) ||
 	                                 (node_type == tools::polar_node_t::REP)    ||
-	                                 (node_type == tools::polar_node_t::SPC);
+	                                 (node_type == tools::polar_node_t::SPC)    ||
+	                                 (node_type == tools::polar_node_t::TYPE_1) ||
+	                                 (node_type == tools::polar_node_t::TYPE_3) ||
+	                                 (node_type == tools::polar_node_t::G_REP)  ||
+	                                 (node_type == tools::polar_node_t::G_PC);
 
 	// root node
 	if (rev_depth == m)
@@ -568,6 +569,14 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 			case tools::REP:    update_paths_rep(rev_depth, off_l, off_s, n_elmts); break;
 			case tools::RATE_1: update_paths_r1 (rev_depth, off_l, off_s, n_elmts); break;
 			case tools::SPC:    update_paths_spc(rev_depth, off_l, off_s, n_elmts); break;
+			case tools::TYPE_1: update_paths_gen(rev_depth, off_l, off_s, n_elmts, 2, true ); break;
+			case tools::TYPE_3: update_paths_gen(rev_depth, off_l, off_s, n_elmts, 2, false); break;
+			case tools::G_REP:
+				update_paths_gen(rev_depth, off_l, off_s, n_elmts, polar_patterns.get_node_period(node_id), true );
+				break;
+			case tools::G_PC:
+				update_paths_gen(rev_depth, off_l, off_s, n_elmts, polar_patterns.get_node_period(node_id), false);
+				break;
 			default:
 				break;
 		}
@@ -993,8 +1002,9 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 	// the number of candidates to generate per list
 	const auto n_cands = L <= 2 ? 4 : 8;
 
-	// generate the candidates with the Chase-II algorithm
-	if (n_elmts == 4)
+	// generate the candidates with the Chase-II algorithm (with 8 candidates, all the flips of a 4-bit node are
+	// generated and its bits do not have to be sorted by reliability)
+	if (n_elmts == 4 && n_cands == 8)
 	{
 		for (auto i = 0; i < n_active_paths; i++)
 		{
@@ -1105,8 +1115,9 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 	// the number of candidates to generate per list
 	const auto n_cands = L <= 2 ? 4 : 8;
 
-	// generate the candidates with the Chase-II algorithm
-	if (N_ELMTS == 4)
+	// generate the candidates with the Chase-II algorithm (with 8 candidates, all the flips of a 4-bit node are
+	// generated and its bits do not have to be sorted by reliability)
+	if (N_ELMTS == 4 && n_cands == 8)
 	{
 		for (auto i = 0; i < n_active_paths; i++)
 		{
@@ -1267,6 +1278,85 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 	}
 }
 
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
+::update_paths_gen(const int r_d, const int off_l, const int off_s, const int n_elmts, const int period,
+                   const bool is_rep)
+{
+	// the number of moves (flips of a sub-code for the G-Rep, flips of 2 bits of a sub-code for the G-PC) per list grows
+	// with L (up to 4), all the combinations of the moves are generated
+	const auto n_moves = std::min(is_rep ? period : 4, std::min((int)std::log2(L) +1, 4));
+	const auto n_cands = 1 << n_moves;
+
+	// take the ML decisions of the node on each path and generate the candidates with the Chase-II algorithm
+	for (auto i = 0; i < n_active_paths; i++)
+	{
+		const auto path  = paths[i];
+		const auto array = path_2_array_l[path][r_d];
+
+		R pens[16];
+		const auto l_a = l[array].data() + off_l;
+		const auto s_a = s[path].data() + off_s;
+		const auto pen_ml = is_rep ?
+		    scl_ml_grep<B,R>(l_a, s_a, n_elmts, period, 1, n_moves, bit_flips.data() + 8 * path, pens) :
+		    scl_ml_gpc <B,R>(l_a, s_a, n_elmts, period, 1, n_moves, bit_flips.data() + 8 * path, pens);
+
+		const auto metric = sat_m<R>(metrics[path] + pen_ml);
+		for (auto c = 0; c < n_cands; c++)
+			metrics_vec[2][n_cands * path +c] = (pens[c] == std::numeric_limits<R>::max()) ?
+			                                    std::numeric_limits<R>::max() : sat_m<R>(metric + pens[c]);
+	}
+	for (auto i = n_active_paths; i < L; i++)
+		for (auto c = 0; c < n_cands; c++)
+			metrics_vec[2][n_cands * paths[i] +c] = std::numeric_limits<R>::max();
+
+	// L first of the lists are the L best paths
+	const auto n_list = (n_active_paths * n_cands >= L) ? L : n_active_paths * n_cands;
+	sorter.partial_sort(metrics_vec[2].data(), best_idx, L * n_cands, n_list);
+
+	// count the number of duplications per path
+	for (auto i = 0; i < n_list; i++)
+		dup_count[best_idx[i] / n_cands]++;
+
+	// erase bad paths
+	erase_bad_paths(r_d);
+
+	for (auto i = 0; i < n_list; i++)
+	{
+		const auto path = best_idx[i] / n_cands;
+		const auto dup  = best_idx[i] % n_cands;
+
+		const auto new_path = (dup_count[path] > 1) ? duplicate_tree(path, off_l, off_s, r_d) : path;
+		flip_bits_gen(path, new_path, dup, off_s, n_elmts, period, is_rep);
+		metrics[new_path] = metrics_vec[2][best_idx[i]];
+
+		dup_count[path]--;
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
+::flip_bits_gen(const int old_path, const int new_path, const int dup, const int off_s, const int n_elmts,
+                const int period, const bool is_rep)
+{
+	constexpr B b = tools::bit_init<B>();
+
+	// the new path is a copy of the old path, the moves of a G-PC node can share a bit: the bits are flipped in place
+	for (auto k = 0; (dup >> k) > 0; k++)
+		if ((dup >> k) & 1)
+		{
+			if (is_rep) // flip all the bits of the sub-code
+				for (auto i = off_s + bit_flips[8 * old_path +k]; i < off_s + n_elmts; i += period)
+					s[new_path][i] = s[new_path][i] ? 0 : b;
+			else // flip the 2 bits of the move
+				for (auto j = 2 * k; j < 2 * k +2; j++)
+				{
+					const auto bit = off_s + bit_flips[8 * old_path +j];
+					s[new_path][bit] = s[new_path][bit] ? 0 : b;
+				}
+		}
+}
+
 template <typename B, typename R, class API_polar>
 int Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 ::duplicate_tree(const int old_path, const int off_l, const int off_s, const int r_d)
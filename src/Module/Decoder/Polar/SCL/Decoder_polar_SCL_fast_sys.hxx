@@ -23,6 +23,7 @@
 
 #include "Tools/Code/Polar/Pattern_polar_parser.hpp"
 #include "Tools/Code/Polar/fb_extract.h"
+#include "Tools/Perf/Timer/Sub_task_timer.hpp"
 
 #include "Decoder_polar_SCL_fast_sys.hpp"
 
@@ -60,6 +61,161 @@ inline void normalize_scl_metrics(std::vector<signed char> &metrics, const int L
 		metrics[i] += norm;
 }
 
+// G-Rep node: takes the ML decisions of the 'period' repeated sub-codes (the LLRs and the bits are read every 'stride'
+// elements) and returns their penalty. The 'n_moves' (<= 'period') sub-codes which are the cheapest to flip are stored
+// in 'moves' and 'pens[c]' is the additional penalty of the candidate which flips the sub-codes of the moves set in 'c'
+template <typename B, typename R>
+inline R scl_ml_grep(const R *l_a, B *s_a, const int n_elmts, const int period, const int stride, const int n_moves,
+                     int *moves, R *pens)
+{
+	constexpr B b = tools::bit_init<B>();
+
+	R costs[4];
+	auto n_found = 0;
+	auto pen_ml = (R)0;
+	for (auto j = 0; j < period; j++)
+	{
+		auto pen0 = (R)0;
+		auto pen1 = (R)0;
+		for (auto i = j; i < n_elmts; i += period)
+		{
+			pen0 = sat_m<R>(pen0 + sat_m<R>(-std::min(l_a[i * stride], (R)0)));
+			pen1 = sat_m<R>(pen1 + sat_m<R>(+std::max(l_a[i * stride], (R)0)));
+		}
+
+		const auto r = (pen0 > pen1) ? b : (B)0;
+		for (auto i = j; i < n_elmts; i += period)
+			s_a[i * stride] = r;
+
+		pen_ml = sat_m<R>(pen_ml + std::min(pen0, pen1));
+
+		// insertion in the sorted cheapest moves (the first sub-code wins the ties)
+		auto cost = sat_m<R>(std::max(pen0, pen1) - std::min(pen0, pen1));
+		auto move = j;
+		for (auto k = 0; k < n_moves; k++)
+			if (k == n_found)
+			{
+				costs[k] = cost;
+				moves[k] = move;
+				n_found++;
+				break;
+			}
+			else if (cost < costs[k])
+			{
+				std::swap(cost, costs[k]);
+				std::swap(move, moves[k]);
+			}
+	}
+
+	for (auto c = 0; c < (1 << n_moves); c++)
+	{
+		pens[c] = (R)0;
+		for (auto k = 0; k < n_moves; k++)
+			if ((c >> k) & 1)
+				pens[c] = sat_m<R>(pens[c] + costs[k]);
+	}
+
+	return pen_ml;
+}
+
+// G-PC node: takes the ML decisions of the 'period' interleaved SPC sub-codes (the LLRs and the bits are read every
+// 'stride' elements) and returns their penalty. A move flips 2 bits of a sub-code: its least reliable bit and its
+// second (or third) least reliable bit. The 'n_moves' cheapest moves are stored in 'flips' (2 bits per move) and
+// 'pens[c]' is the additional penalty of the candidate which flips the bits of the moves set in 'c' (the maximal value
+// if there are not enough moves)
+template <typename B, typename R>
+inline R scl_ml_gpc(const R *l_a, B *s_a, const int n_elmts, const int period, const int stride, const int n_moves,
+                    int *flips, R *pens)
+{
+	constexpr B b = tools::bit_init<B>();
+
+	// penalties of the 2 bits of the moves, the first bit is the least reliable bit of a sub-code
+	R costs[4] = {}, pen_a[4] = {}, pen_b[4] = {};
+	auto n_found = 0;
+	auto pen_ml = (R)0;
+	for (auto j = 0; j < period; j++)
+	{
+		// hard decisions, parity and the 3 least reliable bits of the sub-code
+		auto parity = false;
+		R   min_v[3] = {std::numeric_limits<R>::max(), std::numeric_limits<R>::max(), std::numeric_limits<R>::max()};
+		int min_i[3] = {j, j, j};
+		for (auto i = j; i < n_elmts; i += period)
+		{
+			const auto v = l_a[i * stride];
+			s_a[i * stride] = (v < 0) ? b : (B)0;
+			parity ^= (v < 0);
+
+			auto a = sat_m<R>(std::abs(v));
+			auto p = i;
+			for (auto k = 0; k < 3; k++)
+				if (a < min_v[k])
+				{
+					std::swap(a, min_v[k]);
+					std::swap(p, min_i[k]);
+				}
+		}
+
+		// the ML decisions of an odd sub-code flip its least reliable bit
+		if (parity)
+		{
+			s_a[min_i[0] * stride] = s_a[min_i[0] * stride] ? (B)0 : b;
+			pen_ml = sat_m<R>(pen_ml + min_v[0]);
+		}
+
+		const auto pen_0 = parity ? (R)-min_v[0] : min_v[0];
+		const auto n_sub = (n_elmts / period > 2) ? 2 : 1;
+		for (auto m = 1; m <= n_sub; m++)
+		{
+			// insertion in the sorted cheapest moves (the first move wins the ties)
+			R   move_v[3] = {sat_m<R>(pen_0 + min_v[m]), pen_0,    min_v[m]};
+			int move_i[2] = {min_i[0],                   min_i[m]          };
+			for (auto k = 0; k < n_moves; k++)
+				if (k == n_found || move_v[0] < costs[k])
+				{
+					std::swap(move_v[0], costs[k]);
+					std::swap(move_v[1], pen_a[k]);
+					std::swap(move_v[2], pen_b[k]);
+					std::swap(move_i[0], flips[2 * k +0]);
+					std::swap(move_i[1], flips[2 * k +1]);
+					if (k == n_found)
+					{
+						n_found++;
+						break;
+					}
+				}
+		}
+	}
+
+	// the moves of a same sub-code share their first bit, it is flipped only if it is flipped an odd number of times
+	for (auto c = 0; c < (1 << n_moves); c++)
+	{
+		if (c >> n_found)
+		{
+			pens[c] = std::numeric_limits<R>::max();
+			continue;
+		}
+
+		pens[c] = (R)0;
+		for (auto k = 0; k < n_moves; k++)
+			if ((c >> k) & 1)
+			{
+				pens[c] = sat_m<R>(pens[c] + pen_b[k]);
+
+				auto n_shared = 0, first = k;
+				for (auto k2 = 0; k2 < n_moves; k2++)
+					if (((c >> k2) & 1) && flips[2 * k2] == flips[2 * k])
+					{
+						n_shared++;
+						first = std::min(first, k2);
+					}
+				if (first == k && (n_shared & 1))
+					pens[c] = sat_m<R>(pens[c] + pen_a[k]);
+			}
+	}
+
+	return pen_ml;
+}
+
 template <typename B, typename R, class API_polar>
 Decoder_polar_SCL_fast_sys<B,R,API_polar>
 ::Decoder_polar_SCL_fast_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
@@ -86,7 +242,7 @@ Decoder_polar_SCL_fast_sys<B,R,API_polar>
   s                (L, mipp::vector<B>(N + mipp::nElReg<B>())),
   metrics_vec      (3, std::vector<R>()),
   dup_count        (L, 0),
-  bit_flips        (4 * L),
+  bit_flips        (8 * L), // 4 bits of a SPC node or 4 moves of 2 bits of a G-PC node per path
   is_even          (L),
   best_path        (0),
   n_active_paths   (1),
@@ -94,7 +250,7 @@ Decoder_polar_SCL_fast_sys<B,R,API_polar>
   path_2_array     (L, std::vector<int>(m)),
   sorter           (N),
 //sorter_simd      (N),
-  best_idx         (L),
+  best_idx         (std::max(L, 4)), // at least the 4 least reliable bits of a SPC node
   l_tmp            (N)
 {
 	const std::string name = "Decoder_polar_SCL_fast_sys";
@@ -147,7 +303,7 @@ Decoder_polar_SCL_fast_sys<B,R,API_polar>
 
 	metrics_vec[0].resize(L * 2);
 	metrics_vec[1].resize(L * 4);
-	metrics_vec[2].resize((L <= 2 ? 4 : 8) * L);
+	metrics_vec[2].resize(16 * L); // up to 16 candidates per path for the generalized nodes
 }
 
 template <typename B, typename R, class API_polar>
@@ -167,7 +323,7 @@ Decoder_polar_SCL_fast_sys<B,R,API_polar>
   s                (L, mipp::vector<B>(N + mipp::nElReg<B>())),
   metrics_vec      (3, std::vector<R>()),
   dup_count        (L, 0),
-  bit_flips        (4 * L),
+  bit_flips        (8 * L), // 4 bits of a SPC node or 4 moves of 2 bits of a G-PC node per path
   is_even          (L),
   best_path        (0),
   n_active_paths   (1),
@@ -175,7 +331,7 @@ Decoder_polar_SCL_fast_sys<B,R,API_polar>
   path_2_array     (L, std::vector<int>(m)),
   sorter           (N),
 //sorter_simd      (N),
-  best_idx         (L),
+  best_idx         (std::max(L, 4)), // at least the 4 least reliable bits of a SPC node
   l_tmp            (N)
 {
 	const std::string name = "Decoder_polar_SCL_fast_sys";
@@ -187,6 +343,12 @@ Decoder_polar_SCL_fast_sys<B,R,API_polar>
 	if (API_polar::get_n_frames() != 1)
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The inter-frame API_polar is not supported.");
 
+	if (this->polar_patterns.exist_node_type(tools::polar_node_t::TYPE_2) ||
+	    this->polar_patterns.exist_node_type(tools::polar_node_t::TYPE_4) ||
+	    this->polar_patterns.exist_node_type(tools::polar_node_t::TYPE_5))
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The Type-II, Type-IV and Type-V nodes are not "
+		                                                            "supported by the SCL decoders.");
+
 	if (!tools::is_power_of_2(this->N))
 	{
 		std::stringstream message;
@@ -228,7 +390,7 @@ Decoder_polar_SCL_fast_sys<B,R,API_polar>
 
 	metrics_vec[0].resize(L * 2);
 	metrics_vec[1].resize(L * 4);
-	metrics_vec[2].resize((L <= 2 ? 4 : 8) * L);
+	metrics_vec[2].resize(16 * L); // up to 16 candidates per path for the generalized nodes
 }
 
 template <typename B, typename R, class API_polar>
@@ -249,6 +411,8 @@ template <typename B, typename R, class API_polar>
 void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 ::init_buffers()
 {
+	this->polar_patterns.update();
+
 	metrics[0] = std::numeric_limits<R>::min();
 	std::iota(paths.begin(), paths.begin() + L, 0);
 
@@ -280,22 +444,16 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 	if (!API_polar::isAligned(V_K))
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'V_K' is misaligned memory.");
 
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho]);
 	this->init_buffers();
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	this->_decode(Y_N);
 	this->select_best_path();
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	this->_store(V_K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	timer.lap(dec::tm::decode_siho::store);
 }
 
 template <typename B, typename R, class API_polar>
@@ -308,22 +466,16 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 	if (!API_polar::isAligned(V_N))
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'V_N' is misaligned memory.");
 
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho_cw]);
 	this->init_buffers();
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho_cw::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	this->_decode(Y_N);
 	this->select_best_path();
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho_cw::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	this->_store_cw(V_N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+	timer.lap(dec::tm::decode_siho_cw::store);
 }
 
 template <typename B, typename R, class API_polar>
@@ -337,7 +489,11 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
 	                                 (node_type == tools::polar_node_t::RATE_1) ||
 	                                 (node_type == tools::polar_node_t::REP)    ||
-	                                 (node_type == tools::polar_node_t::SPC);
+	                                 (node_type == tools::polar_node_t::SPC)    ||
+	                                 (node_type == tools::polar_node_t::TYPE_1) ||
+	                                 (node_type == tools::polar_node_t::TYPE_3) ||
+	                                 (node_type == tools::polar_node_t::G_REP)  ||
+	                                 (node_type == tools::polar_node_t::G_PC);
 
 	// root node
 	if (rev_depth == m)
@@ -511,6 +667,14 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 			case tools::REP:    update_paths_rep(rev_depth, off_l, off_s, n_elmts); break;
 			case tools::RATE_1: update_paths_r1 (rev_depth, off_l, off_s, n_elmts); break;
 			case tools::SPC:    update_paths_spc(rev_depth, off_l, off_s, n_elmts); break;
+			case tools::TYPE_1: update_paths_gen(rev_depth, off_l, off_s, n_elmts, 2, true ); break;
+			case tools::TYPE_3: update_paths_gen(rev_depth, off_l, off_s, n_elmts, 2, false); break;
+			case tools::G_REP:
+				update_paths_gen(rev_depth, off_l, off_s, n_elmts, polar_patterns.get_node_period(node_id), true );
+				break;
+			case tools::G_PC:
+				update_paths_gen(rev_depth, off_l, off_s, n_elmts, polar_patterns.get_node_period(node_id), false);
+				break;
 			default:
 				break;
 		}
@@ -928,8 +1092,9 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 	// the number of candidates to generate per list
 	const auto n_cands = L <= 2 ? 4 : 8;
 
-	// generate the candidates with the Chase-II algorithm
-	if (n_elmts == 4)
+	// generate the candidates with the Chase-II algorithm (with 8 candidates, all the flips of a 4-bit node are
+	// generated and its bits do not have to be sorted by reliability)
+	if (n_elmts == 4 && n_cands == 8)
 	{
 		for (auto i = 0; i < n_active_paths; i++)
 		{
@@ -1040,8 +1205,9 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 	// the number of candidates to generate per list
 	const auto n_cands = L <= 2 ? 4 : 8;
 
-	// generate the candidates with the Chase-II algorithm
-	if (N_ELMTS == 4)
+	// generate the candidates with the Chase-II algorithm (with 8 candidates, all the flips of a 4-bit node are
+	// generated and its bits do not have to be sorted by reliability)
+	if (N_ELMTS == 4 && n_cands == 8)
 	{
 		for (auto i = 0; i < n_active_paths; i++)
 		{
@@ -1202,6 +1368,85 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 	}
 }
 
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::update_paths_gen(const int r_d, const int off_l, const int off_s, const int n_elmts, const int period,
+                   const bool is_rep)
+{
+	// the number of moves (flips of a sub-code for the G-Rep, flips of 2 bits of a sub-code for the G-PC) per list grows
+	// with L (up to 4), all the combinations of the moves are generated
+	const auto n_moves = std::min(is_rep ? period : 4, std::min((int)std::log2(L) +1, 4));
+	const auto n_cands = 1 << n_moves;
+
+	// take the ML decisions of the node on each path and generate the candidates with the Chase-II algorithm
+	for (auto i = 0; i < n_active_paths; i++)
+	{
+		const auto path  = paths[i];
+		const auto array = path_2_array[path][r_d];
+
+		R pens[16];
+		const auto l_a = l[array].data() + off_l;
+		const auto s_a = s[path].data() + off_s;
+		const auto pen_ml = is_rep ?
+		    scl_ml_grep<B,R>(l_a, s_a, n_elmts, period, 1, n_moves, bit_flips.data() + 8 * path, pens) :
+		    scl_ml_gpc <B,R>(l_a, s_a, n_elmts, period, 1, n_moves, bit_flips.data() + 8 * path, pens);
+
+		const auto metric = sat_m<R>(metrics[path] + pen_ml);
+		for (auto c = 0; c < n_cands; c++)
+			metrics_vec[2][n_cands * path +c] = (pens[c] == std::numeric_limits<R>::max()) ?
+			                                    std::numeric_limits<R>::max() : sat_m<R>(metric + pens[c]);
+	}
+	for (auto i = n_active_paths; i < L; i++)
+		for (auto c = 0; c < n_cands; c++)
+			metrics_vec[2][n_cands * paths[i] +c] = std::numeric_limits<R>::max();
+
+	// L first of the lists are the L best paths
+	const auto n_list = (n_active_paths * n_cands >= L) ? L : n_active_paths * n_cands;
+	sorter.partial_sort(metrics_vec[2].data(), best_idx, L * n_cands, n_list);
+
+	// count the number of duplications per path
+	for (auto i = 0; i < n_list; i++)
+		dup_count[best_idx[i] / n_cands]++;
+
+	// erase bad paths
+	erase_bad_paths();
+
+	for (auto i = 0; i < n_list; i++)
+	{
+		const auto path = best_idx[i] / n_cands;
+		const auto dup  = best_idx[i] % n_cands;
+
+		const auto new_path = (dup_count[path] > 1) ? duplicate_tree(path, off_l, off_s, n_elmts) : path;
+		flip_bits_gen(path, new_path, dup, off_s, n_elmts, period, is_rep);
+		metrics[new_path] = metrics_vec[2][best_idx[i]];
+
+		dup_count[path]--;
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::flip_bits_gen(const int old_path, const int new_path, const int dup, const int off_s, const int n_elmts,
+                const int period, const bool is_rep)
+{
+	constexpr B b = tools::bit_init<B>();
+
+	// the new path is a copy of the old path, the moves of a G-PC node can share a bit: the bits are flipped in place
+	for (auto k = 0; (dup >> k) > 0; k++)
+		if ((dup >> k) & 1)
+		{
+			if (is_rep) // flip all the bits of the sub-code
+				for (auto i = off_s + bit_flips[8 * old_path +k]; i < off_s + n_elmts; i += period)
+					s[new_path][i] = s[new_path][i] ? 0 : b;
+			else // flip the 2 bits of the move
+				for (auto j = 2 * k; j < 2 * k +2; j++)
+				{
+					const auto bit = off_s + bit_flips[8 * old_path +j];
+					s[new_path][bit] = s[new_path][bit] ? 0 : b;
+				}
+		}
+}
+
 template <typename B, typename R, class API_polar>
 void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 ::delete_path(int path_id)
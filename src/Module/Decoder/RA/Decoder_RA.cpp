@@ -5,6 +5,7 @@
 
 #include "Tools/Perf/hard_decision.h"
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Timer/Sub_task_timer.hpp"
 
 #include "Decoder_RA.hpp"
 
@@ -70,7 +71,7 @@ template <typename B, typename R>
 void Decoder_RA<B, R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho]);
 	//set F, B and Td at 0
 	for (auto i = 0; i < this->N; i++)
 	{
@@ -78,9 +79,8 @@ void Decoder_RA<B, R>
 		Bw[i] = 0;
 		Td[i] = 0;
 	}
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	for (auto iter = 0; iter < max_iter; iter++)
 	{
 		///////////////////
@@ -122,15 +122,10 @@ void Decoder_RA<B, R>
 		// Interleaving
 		interleaver.interleave(Wd.data(), Td.data(), frame_id);
 	}
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	tools::hard_decide(U.data(), V_K, this->K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	timer.lap(dec::tm::decode_siho::store);
 }
 
 template <typename B, typename R>
@@ -5,6 +5,7 @@
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Perf/Timer/Sub_task_timer.hpp"
 
 #include "Decoder_RSC_BCJR.hpp"
 
@@ -95,15 +96,13 @@ template <typename B, typename R>
 void Decoder_RSC_BCJR<B,R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho]);
 	_load(Y_N);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho::load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	this->_decode_siso(sys.data(), par.data(), ext.data(), frame_id);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	// take the hard decision
 	for (auto i = 0; i < this->K * this->simd_inter_frame_level; i += mipp::nElReg<R>())
 	{
@@ -116,12 +115,9 @@ void Decoder_RSC_BCJR<B,R>
 	}
 
 	_store(V_K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
+	timer.lap(dec::tm::decode_siho::store);
 
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::total,  d_load + d_decod + d_store);
+	timer.total(dec::tm::decode_siho::total);
 }
 
 template <typename B, typename R>
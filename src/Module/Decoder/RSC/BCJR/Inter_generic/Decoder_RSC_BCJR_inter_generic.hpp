@@ -0,0 +1,60 @@
+#ifndef DECODER_RSC_BCJR_INTER_GENERIC_HPP_
+#define DECODER_RSC_BCJR_INTER_GENERIC_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+#include "../Decoder_RSC_BCJR.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * BCJR for any RSC trellis (any polynomials and any memory), the frames are decoded in the SIMD lanes at once
+ * (mipp::nElReg<R>() frames). The trellis is decomposed in radix-2 butterflies at construction: two source states
+ * linked to the same two destination states. The recursions and the extrinsic computation run over the butterflies, the
+ * two source metrics are loaded once and each branch metric is picked in a table of the four possible values.
+ */
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_BCJR_inter_generic : public Decoder_RSC_BCJR<B,R>
+{
+protected:
+	struct butterfly
+	{
+		int src[2];    // source states
+		int dst[2];    // destination states
+		int bm [2][2]; // branch metric of the edge src[s] -> dst[d] (0: +g0, 1: +g1, 2: -g0, 3: -g1)
+		int bit[2][2]; // systematic bit of the edge src[s] -> dst[d]
+	};
+
+	std::vector<butterfly> butterflies; // schedule of the butterflies
+
+	mipp::vector<R> alpha;     // node metric (left to right), n_states registers per trellis section
+	mipp::vector<R> beta_prev; // node metric (right to left) of the next trellis section
+	mipp::vector<R> beta_cur;  // node metric (right to left) of the current trellis section
+	mipp::vector<R> gamma[2];  // edge metric
+
+public:
+	Decoder_RSC_BCJR_inter_generic(const int &K,
+	                               const std::vector<std::vector<int>> &trellis,
+	                               const bool buffered_encoding = true,
+	                               const int n_frames = 1);
+	virtual ~Decoder_RSC_BCJR_inter_generic();
+
+protected:
+	void _decode_siso(const R *sys, const R *par, R *ext, const int frame_id);
+
+	void build_butterflies(                          );
+	void compute_gamma    (const R *sys, const R *par);
+	void compute_alpha    (                          );
+	void compute_beta_ext (const R *sys,       R *ext);
+};
+}
+}
+
+#include "Decoder_RSC_BCJR_inter_generic.hxx"
+
+#endif /* DECODER_RSC_BCJR_INTER_GENERIC_HPP_ */
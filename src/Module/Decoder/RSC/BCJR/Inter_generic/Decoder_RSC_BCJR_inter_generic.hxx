@@ -0,0 +1,330 @@
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <utility>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/utils.h"
+
+#include "../Inter/Decoder_RSC_BCJR_inter.hpp"
+
+#include "Decoder_RSC_BCJR_inter_generic.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename R>
+struct RSC_BCJR_inter_generic_init
+{
+	static R value()
+	{
+		return -std::numeric_limits<R>::max();
+	}
+};
+
+template <>
+struct RSC_BCJR_inter_generic_init <short>
+{
+	static short value()
+	{
+		return -(1 << (sizeof(short) * 8 -2));
+	}
+};
+
+template <>
+struct RSC_BCJR_inter_generic_init <signed char>
+{
+	static signed char value()
+	{
+		return -63;
+	}
+};
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_inter_generic<B,R,MAX>
+::Decoder_RSC_BCJR_inter_generic(const int &K,
+                                 const std::vector<std::vector<int>> &trellis,
+                                 const bool buffered_encoding,
+                                 const int n_frames)
+: Decoder(K, 2*(K + (int)std::log2(trellis[0].size())), n_frames, mipp::N<R>()),
+  Decoder_RSC_BCJR<B,R>(K, trellis, buffered_encoding, n_frames, mipp::nElmtsPerRegister<R>()),
+  alpha    (K * trellis[0].size() * mipp::nElmtsPerRegister<R>()),
+  beta_prev(    trellis[0].size() * mipp::nElmtsPerRegister<R>()),
+  beta_cur (    trellis[0].size() * mipp::nElmtsPerRegister<R>())
+{
+	const std::string name = "Decoder_RSC_BCJR_inter_generic";
+	this->set_name(name);
+
+	for (auto i = 0; i < 2; i++) gamma[i].resize((K + this->n_ff) * mipp::nElmtsPerRegister<R>());
+
+	this->build_butterflies();
+
+	// init alpha values: the initial state is 0
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+	std::fill(alpha.begin(), alpha.begin() + this->n_states * stride, RSC_BCJR_inter_generic_init<R>::value());
+	std::fill(alpha.begin(), alpha.begin() +                  stride, (R)0);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_inter_generic<B,R,MAX>
+::~Decoder_RSC_BCJR_inter_generic()
+{
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_generic<B,R,MAX>
+::build_butterflies()
+{
+	const auto &trellis = this->trellis;
+
+	if (trellis.size() < 10)
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Unsupported trellis.");
+
+	// the edge j -> trellis[6][j] carries the systematic bit 0 and the branch metric +gamma[trellis[7][j]], the edge
+	// j -> trellis[8][j] carries the systematic bit 1 and the branch metric -gamma[trellis[9][j]]
+	std::vector<bool> used_src(this->n_states, false);
+	std::vector<bool> used_dst(this->n_states, false);
+	for (auto p = 0; p < this->n_states; p++)
+	{
+		if (used_src[p])
+			continue;
+
+		const auto d0 = trellis[6][p];
+		const auto d1 = trellis[8][p];
+
+		// look for the other source state linked to the same destination states
+		auto q = p +1;
+		while (q < this->n_states && (used_src[q] ||
+		                              !((trellis[6][q] == d0 && trellis[8][q] == d1) ||
+		                                (trellis[6][q] == d1 && trellis[8][q] == d0))))
+			q++;
+
+		if (d0 == d1 || q == this->n_states || used_dst[d0] || used_dst[d1])
+		{
+			std::stringstream message;
+			message << "Unsupported trellis: the state " << p << " is not part of a radix-2 butterfly.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		used_src[p] = used_src[q] = true;
+		used_dst[d0] = used_dst[d1] = true;
+
+		butterfly b;
+		b.src[0] = p;
+		b.src[1] = q;
+		b.dst[0] = d0;
+		b.dst[1] = d1;
+
+		for (auto s = 0; s < 2; s++)
+		{
+			const auto j  = b.src[s];
+			const auto d  = (trellis[6][j] == d0) ? 0 : 1; // destination reached with the systematic bit 0
+			b.bm [s][d   ] = trellis[7][j];
+			b.bit[s][d   ] = 0;
+			b.bm [s][d ^1] = trellis[9][j] +2;
+			b.bit[s][d ^1] = 1;
+		}
+
+		butterflies.push_back(b);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_generic<B,R,MAX>
+::compute_gamma(const R *sys, const R *par)
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+	for (auto i = 0; i < (this->K + this->n_ff) * stride; i += stride)
+	{
+		const auto r_sys = mipp::Reg<R>(&sys[i]);
+		const auto r_par = mipp::Reg<R>(&par[i]);
+
+		// there is a big loss of precision here in fixed point
+		const auto r_g0 = RSC_BCJR_inter_div_or_not<R>::apply(r_sys + r_par);
+		const auto r_g1 = RSC_BCJR_inter_div_or_not<R>::apply(r_sys - r_par);
+
+		r_g0.store(&this->gamma[0][i]);
+		r_g1.store(&this->gamma[1][i]);
+	}
+}
+
+template <typename R>
+struct RSC_BCJR_inter_generic_normalize
+{
+	static void apply(R *metrics, const int &i, const int &n_states)
+	{
+		// no need to do something
+	}
+};
+
+template <>
+struct RSC_BCJR_inter_generic_normalize <short>
+{
+	static void apply(short *metrics, const int &i, const int &n_states)
+	{
+		constexpr auto stride = mipp::nElmtsPerRegister<short>();
+
+		// normalization
+		if (i % 8 == 0)
+		{
+			const auto r_norm_val = mipp::Reg<short>(&metrics[0]);
+			for (auto j = 0; j < n_states * stride; j += stride)
+			{
+				auto r_m = mipp::Reg<short>(&metrics[j]);
+				r_m -= r_norm_val;
+				r_m.store(&metrics[j]);
+			}
+		}
+	}
+};
+
+template <>
+struct RSC_BCJR_inter_generic_normalize <signed char>
+{
+	static void apply(signed char *metrics, const int &i, const int &n_states)
+	{
+		constexpr auto stride = mipp::nElmtsPerRegister<signed char>();
+
+		// normalization & saturation
+		const auto r_norm_val = mipp::Reg<signed char>(&metrics[0]);
+		for (auto j = 0; j < n_states * stride; j += stride)
+		{
+			const auto r_m = mipp::Reg<signed char>(&metrics[j]) - r_norm_val;
+			r_m.sat(-63, 63).store(&metrics[j]);
+		}
+	}
+};
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_generic<B,R,MAX>
+::compute_alpha()
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+	const     auto n_regs = this->n_states * stride;
+
+	// compute alpha values [trellis forward traversal ->]
+	for (auto i = 1; i < this->K; i++)
+	{
+		const auto r_g0 = mipp::Reg<R>(&this->gamma[0][(i -1) * stride]);
+		const auto r_g1 = mipp::Reg<R>(&this->gamma[1][(i -1) * stride]);
+		const mipp::Reg<R> r_bm[4] = {r_g0, r_g1, -r_g0, -r_g1};
+
+		const R* alpha_prev = this->alpha.data() + (i -1) * n_regs;
+		      R* alpha_cur  = this->alpha.data() + (i +0) * n_regs;
+
+		for (auto &b : this->butterflies)
+		{
+			const auto r_a0 = mipp::Reg<R>(&alpha_prev[b.src[0] * stride]);
+			const auto r_a1 = mipp::Reg<R>(&alpha_prev[b.src[1] * stride]);
+
+			MAX(r_a0 + r_bm[b.bm[0][0]], r_a1 + r_bm[b.bm[1][0]]).store(&alpha_cur[b.dst[0] * stride]);
+			MAX(r_a0 + r_bm[b.bm[0][1]], r_a1 + r_bm[b.bm[1][1]]).store(&alpha_cur[b.dst[1] * stride]);
+		}
+
+		RSC_BCJR_inter_generic_normalize<R>::apply(alpha_cur, i, this->n_states);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_generic<B,R,MAX>
+::compute_beta_ext(const R *sys, R *ext)
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+	const     auto n_regs = this->n_states * stride;
+
+	// init beta values: the final state is 0
+	std::fill(this->beta_prev.begin(), this->beta_prev.end(), RSC_BCJR_inter_generic_init<R>::value());
+	std::fill(this->beta_prev.begin(), this->beta_prev.begin() + stride, (R)0);
+
+	// compute the beta values of the tail [trellis backward traversal <-]
+	for (auto i = this->K + this->n_ff -1; i >= this->K; i--)
+	{
+		const auto r_g0 = mipp::Reg<R>(&this->gamma[0][i * stride]);
+		const auto r_g1 = mipp::Reg<R>(&this->gamma[1][i * stride]);
+		const mipp::Reg<R> r_bm[4] = {r_g0, r_g1, -r_g0, -r_g1};
+
+		for (auto &b : this->butterflies)
+		{
+			const auto r_b0 = mipp::Reg<R>(&this->beta_prev[b.dst[0] * stride]);
+			const auto r_b1 = mipp::Reg<R>(&this->beta_prev[b.dst[1] * stride]);
+
+			MAX(r_b0 + r_bm[b.bm[0][0]], r_b1 + r_bm[b.bm[0][1]]).store(&this->beta_cur[b.src[0] * stride]);
+			MAX(r_b0 + r_bm[b.bm[1][0]], r_b1 + r_bm[b.bm[1][1]]).store(&this->beta_cur[b.src[1] * stride]);
+		}
+
+		RSC_BCJR_inter_generic_normalize<R>::apply(this->beta_cur.data(), i, this->n_states);
+		std::swap(this->beta_prev, this->beta_cur);
+	}
+
+	// compute the beta values [trellis backward traversal <-] + compute extrinsic values
+	for (auto i = this->K -1; i >= 0; i--)
+	{
+		const auto r_g0 = mipp::Reg<R>(&this->gamma[0][i * stride]);
+		const auto r_g1 = mipp::Reg<R>(&this->gamma[1][i * stride]);
+		const mipp::Reg<R> r_bm[4] = {r_g0, r_g1, -r_g0, -r_g1};
+
+		const R* alpha_cur = this->alpha.data() + i * n_regs;
+
+		mipp::Reg<R> r_max[2]; // max per systematic bit
+		for (auto bf = 0; bf < (int)this->butterflies.size(); bf++)
+		{
+			const auto &b = this->butterflies[bf];
+
+			const auto r_b0 = mipp::Reg<R>(&this->beta_prev[b.dst[0] * stride]);
+			const auto r_b1 = mipp::Reg<R>(&this->beta_prev[b.dst[1] * stride]);
+
+			for (auto s = 0; s < 2; s++)
+			{
+				const auto r_a    = mipp::Reg<R>(&alpha_cur[b.src[s] * stride]);
+				const auto r_bg0  = r_b0 + r_bm[b.bm[s][0]];
+				const auto r_bg1  = r_b1 + r_bm[b.bm[s][1]];
+				const auto r_sum0 = r_a + r_bg0;
+				const auto r_sum1 = r_a + r_bg1;
+
+				MAX(r_bg0, r_bg1).store(&this->beta_cur[b.src[s] * stride]);
+
+				// the two edges of the first source state carry the two systematic bits
+				if (bf == 0 && s == 0)
+				{
+					r_max[b.bit[s][0]] = r_sum0;
+					r_max[b.bit[s][1]] = r_sum1;
+				}
+				else
+				{
+					r_max[b.bit[s][0]] = MAX(r_max[b.bit[s][0]], r_sum0);
+					r_max[b.bit[s][1]] = MAX(r_max[b.bit[s][1]], r_sum1);
+				}
+			}
+		}
+
+		const auto r_post = RSC_BCJR_inter_post<R>::compute(r_max[0] - r_max[1]);
+		const auto r_ext  = r_post - &sys[i * stride];
+		r_ext.store(&ext[i * stride]);
+
+		RSC_BCJR_inter_generic_normalize<R>::apply(this->beta_cur.data(), i, this->n_states);
+		std::swap(this->beta_prev, this->beta_cur);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_generic<B,R,MAX>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	if (!mipp::isAligned(sys))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'sys' is misaligned memory.");
+
+	if (!mipp::isAligned(par))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'par' is misaligned memory.");
+
+	if (!mipp::isAligned(ext))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'ext' is misaligned memory.");
+
+	this->compute_gamma   (sys, par);
+	this->compute_alpha   (        );
+	this->compute_beta_ext(sys, ext);
+}
+}
+}
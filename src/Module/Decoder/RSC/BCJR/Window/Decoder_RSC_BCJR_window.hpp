@@ -0,0 +1,65 @@
+#ifndef DECODER_RSC_BCJR_WINDOW_HPP_
+#define DECODER_RSC_BCJR_WINDOW_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+#include "../Decoder_RSC_BCJR.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Sliding window BCJR for a single frame: the frame is split in mipp::nElReg<R>() sub-blocks decoded in the SIMD
+ * lanes at once, and each sub-block is decoded window per window (the alpha metrics are stored only for the current
+ * window). The unknown metrics at the boundaries (first alpha of each sub-block and last beta of each window) are
+ * initialized with the metrics computed at the previous call on the same domain (Next Iteration Initialization).
+ * The boundary metrics are stored in the decoder: one instance is required per domain (a turbo decoder needs two
+ * instances, one for the natural domain and one for the interleaved domain) and the Decoder_RSC_BCJR_window::reset
+ * method has to be called before each new frame.
+ */
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_BCJR_window : public Decoder_RSC_BCJR<B,R>
+{
+protected:
+	const int n_sb;     // number of sub-blocks (one per SIMD lane)
+	const int sb_size;  // number of trellis sections in a sub-block
+	const int win_size; // number of trellis sections in a window
+	const int n_win;    // number of windows per sub-block
+
+	mipp::vector<R> sys_sb;       // systematic LLRs, sub-blocks interleaved
+	mipp::vector<R> ext_sb;       // extrinsic LLRs, sub-blocks interleaved
+	mipp::vector<R> gamma[2];     // edge metric, sub-blocks interleaved
+	mipp::vector<R> alpha[8];     // node metric (left to right) of the current window
+
+	mipp::vector<R> alpha_nii[8]; // first alpha of each sub-block (from the previous call)
+	mipp::vector<R> beta_nii [8]; // last beta of each window (from the previous call)
+	mipp::vector<R> bound    [8]; // boundary metrics before to be shifted to the neighbour lane
+
+public:
+	Decoder_RSC_BCJR_window(const int &K,
+	                        const std::vector<std::vector<int>> &trellis,
+	                        const int win_size = 32,
+	                        const bool buffered_encoding = true,
+	                        const int n_frames = 1);
+	virtual ~Decoder_RSC_BCJR_window();
+
+	virtual void reset();
+
+protected:
+	void _decode_siho(const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siso(const R *sys, const R *par, R *ext, const int frame_id);
+
+	void compute_gamma  (const R *sys, const R *par);
+	void compute_tail   (const R *sys, const R *par);
+	void compute_windows(                          );
+};
+}
+}
+
+#include "Decoder_RSC_BCJR_window.hxx"
+
+#endif /* DECODER_RSC_BCJR_WINDOW_HPP_ */
@@ -0,0 +1,404 @@
+#include <limits>
+#include <sstream>
+#include <algorithm>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
+#include "../Inter/Decoder_RSC_BCJR_inter.hpp"
+#include "../Inter/Decoder_RSC_BCJR_inter_fast.hpp"
+
+#include "Decoder_RSC_BCJR_window.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename R>
+struct RSC_BCJR_window_min
+{
+	static R value()
+	{
+		return -std::numeric_limits<R>::max();
+	}
+};
+
+template <>
+struct RSC_BCJR_window_min <short>
+{
+	static short value()
+	{
+		return -(1 << (sizeof(short) * 8 -2));
+	}
+};
+
+template <>
+struct RSC_BCJR_window_min <signed char>
+{
+	static signed char value()
+	{
+		return -127;
+	}
+};
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_window<B,R,MAX>
+::Decoder_RSC_BCJR_window(const int &K,
+                          const std::vector<std::vector<int>> &trellis,
+                          const int win_size,
+                          const bool buffered_encoding,
+                          const int n_frames)
+: Decoder(K, 2*(K + (int)std::log2(trellis[0].size())), n_frames, 1),
+  Decoder_RSC_BCJR<B,R>(K, trellis, buffered_encoding, n_frames, 1),
+  n_sb    (mipp::nElReg<R>()),
+  sb_size (K / mipp::nElReg<R>()),
+  win_size(std::max(1, std::min(win_size, K / mipp::nElReg<R>()))),
+  n_win   ((sb_size + this->win_size -1) / this->win_size),
+  sys_sb  (K + mipp::nElReg<R>()),
+  ext_sb  (K + mipp::nElReg<R>())
+{
+	const std::string name = "Decoder_RSC_BCJR_window";
+	this->set_name(name);
+
+	std::vector<std::vector<int>> req_trellis(10, std::vector<int>(8));
+	req_trellis[0] = { 0,  2,  4,  6,  0,  2,  4,  6};
+	req_trellis[1] = { 1, -1,  1, -1, -1,  1, -1,  1};
+	req_trellis[2] = { 0,  1,  1,  0,  0,  1,  1,  0};
+	req_trellis[3] = { 1,  3,  5,  7,  1,  3,  5,  7};
+	req_trellis[4] = {-1,  1, -1,  1,  1, -1,  1, -1};
+	req_trellis[5] = { 0,  1,  1,  0,  0,  1,  1,  0};
+	req_trellis[6] = { 0,  4,  5,  1,  2,  6,  7,  3};
+	req_trellis[7] = { 0,  0,  1,  1,  1,  1,  0,  0};
+	req_trellis[8] = { 4,  0,  1,  5,  6,  2,  3,  7};
+	req_trellis[9] = { 0,  0,  1,  1,  1,  1,  0,  0};
+
+	for (unsigned i = 0; i < req_trellis.size(); i++)
+		if (trellis[i] != req_trellis[i])
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Unsupported trellis.");
+
+	if (K % mipp::nElReg<R>())
+	{
+		std::stringstream message;
+		message << "'K' has to be divisible by 'mipp::nElReg<R>()' ('K' = " << K
+		        << ", 'mipp::nElReg<R>()' = " << mipp::nElReg<R>() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (win_size <= 0)
+	{
+		std::stringstream message;
+		message << "'win_size' has to be greater than 0 ('win_size' = " << win_size << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto i = 0; i < 2; i++) gamma[i].resize(K + mipp::nElReg<R>());
+	for (auto i = 0; i < 8; i++) alpha[i].resize(this->win_size * n_sb);
+	for (auto i = 0; i < 8; i++)
+	{
+		alpha_nii[i].resize(        n_sb);
+		beta_nii [i].resize(n_win * n_sb);
+	}
+	for (auto i = 0; i < 8; i++) bound[i].resize(2 * n_sb);
+
+	this->reset();
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_window<B,R,MAX>
+::~Decoder_RSC_BCJR_window()
+{
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window<B,R,MAX>
+::reset()
+{
+	// without previous iteration, all the states are equiprobable at the boundaries
+	for (auto i = 0; i < 8; i++)
+	{
+		std::fill(alpha_nii[i].begin(), alpha_nii[i].end(), (R)0);
+		std::fill(beta_nii [i].begin(), beta_nii [i].end(), (R)0);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window<B,R,MAX>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	// a RSC code alone is decoded in one call: there is no previous iteration to initialize the boundaries
+	this->reset();
+	Decoder_RSC_BCJR<B,R>::_decode_siho(Y_N, V_K, frame_id);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window<B,R,MAX>
+::compute_gamma(const R *sys, const R *par)
+{
+	constexpr auto stride = mipp::nElReg<R>();
+
+	// one sub-block per SIMD lane
+	std::vector<const R*> frames(stride);
+	for (auto f = 0; f < stride; f++)
+		frames[f] = sys + f * sb_size;
+	tools::Reorderer_static<R,stride>::apply(frames, sys_sb.data(), sb_size);
+
+	for (auto f = 0; f < stride; f++)
+		frames[f] = par + f * sb_size;
+	tools::Reorderer_static<R,stride>::apply(frames, gamma[1].data(), sb_size);
+
+	for (auto i = 0; i < this->K; i += stride)
+	{
+		const auto r_sys = mipp::Reg<R>(&sys_sb  [i]);
+		const auto r_par = mipp::Reg<R>(&gamma[1][i]);
+
+		const auto r_g0 = RSC_BCJR_inter_div_or_not<R>::apply(r_sys + r_par);
+		const auto r_g1 = RSC_BCJR_inter_div_or_not<R>::apply(r_sys - r_par);
+
+		r_g0.store(&gamma[0][i]);
+		r_g1.store(&gamma[1][i]);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window<B,R,MAX>
+::compute_tail(const R *sys, const R *par)
+{
+	constexpr auto stride = mipp::nElReg<R>();
+
+	// the trellis is closed in the state 0: the last beta of the last sub-block is known after the tail bits (the
+	// same values are computed in all the lanes)
+	auto r_b0_prev = mipp::Reg<R>((R)0);
+	auto r_b1_prev = mipp::Reg<R>(RSC_BCJR_window_min<R>::value());
+	auto r_b2_prev = r_b1_prev;
+	auto r_b3_prev = r_b1_prev;
+	auto r_b4_prev = r_b1_prev;
+	auto r_b5_prev = r_b1_prev;
+	auto r_b6_prev = r_b1_prev;
+	auto r_b7_prev = r_b1_prev;
+
+	for (auto i = this->K + this->n_ff -1; i >= this->K; i--)
+	{
+		const auto r_sys = mipp::Reg<R>(sys[i]);
+		const auto r_par = mipp::Reg<R>(par[i]);
+
+		const auto r_g0 = RSC_BCJR_inter_div_or_not<R>::apply(r_sys + r_par);
+		const auto r_g1 = RSC_BCJR_inter_div_or_not<R>::apply(r_sys - r_par);
+
+		auto r_b0 = MAX(r_b0_prev + r_g0, r_b4_prev - r_g0);
+		auto r_b1 = MAX(r_b4_prev + r_g0, r_b0_prev - r_g0);
+		auto r_b2 = MAX(r_b5_prev + r_g1, r_b1_prev - r_g1);
+		auto r_b3 = MAX(r_b1_prev + r_g1, r_b5_prev - r_g1);
+		auto r_b4 = MAX(r_b2_prev + r_g1, r_b6_prev - r_g1);
+		auto r_b5 = MAX(r_b6_prev + r_g1, r_b2_prev - r_g1);
+		auto r_b6 = MAX(r_b7_prev + r_g0, r_b3_prev - r_g0);
+		auto r_b7 = MAX(r_b3_prev + r_g0, r_b7_prev - r_g0);
+
+		RSC_BCJR_inter_fast_normalize<R>::apply(r_b0, r_b1, r_b2, r_b3, r_b4, r_b5, r_b6, r_b7, 0);
+
+		r_b0_prev = r_b0; r_b1_prev = r_b1; r_b2_prev = r_b2; r_b3_prev = r_b3;
+		r_b4_prev = r_b4; r_b5_prev = r_b5; r_b6_prev = r_b6; r_b7_prev = r_b7;
+	}
+
+	r_b0_prev.store(&bound[0][0]);
+	r_b1_prev.store(&bound[1][0]);
+	r_b2_prev.store(&bound[2][0]);
+	r_b3_prev.store(&bound[3][0]);
+	r_b4_prev.store(&bound[4][0]);
+	r_b5_prev.store(&bound[5][0]);
+	r_b6_prev.store(&bound[6][0]);
+	r_b7_prev.store(&bound[7][0]);
+
+	for (auto j = 0; j < 8; j++)
+		beta_nii[j][(n_win -1) * stride + stride -1] = bound[j][0];
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window<B,R,MAX>
+::compute_windows()
+{
+	constexpr auto stride = mipp::nElReg<R>();
+
+	auto &a_nii = this->alpha_nii;
+	auto &b_nii = this->beta_nii;
+
+	// the first sub-block starts in the state 0
+	a_nii[0][0] = (R)0;
+	for (auto j = 1; j < 8; j++)
+		a_nii[j][0] = RSC_BCJR_window_min<R>::value();
+
+	auto r_a0_prev = mipp::Reg<R>(&a_nii[0][0]);
+	auto r_a1_prev = mipp::Reg<R>(&a_nii[1][0]);
+	auto r_a2_prev = mipp::Reg<R>(&a_nii[2][0]);
+	auto r_a3_prev = mipp::Reg<R>(&a_nii[3][0]);
+	auto r_a4_prev = mipp::Reg<R>(&a_nii[4][0]);
+	auto r_a5_prev = mipp::Reg<R>(&a_nii[5][0]);
+	auto r_a6_prev = mipp::Reg<R>(&a_nii[6][0]);
+	auto r_a7_prev = mipp::Reg<R>(&a_nii[7][0]);
+
+	for (auto w = 0; w < n_win; w++)
+	{
+		const auto t0  = w * win_size;
+		const auto len = std::min(win_size, sb_size - t0);
+
+		// compute alpha values [trellis forward traversal ->]
+		for (auto t = 0; t < len; t++)
+		{
+			const auto i = (t0 + t) * stride;
+
+			r_a0_prev.store(&alpha[0][t * stride]);
+			r_a1_prev.store(&alpha[1][t * stride]);
+			r_a2_prev.store(&alpha[2][t * stride]);
+			r_a3_prev.store(&alpha[3][t * stride]);
+			r_a4_prev.store(&alpha[4][t * stride]);
+			r_a5_prev.store(&alpha[5][t * stride]);
+			r_a6_prev.store(&alpha[6][t * stride]);
+			r_a7_prev.store(&alpha[7][t * stride]);
+
+			const auto r_g0 = mipp::Reg<R>(&gamma[0][i]);
+			const auto r_g1 = mipp::Reg<R>(&gamma[1][i]);
+
+			auto r_a0 = MAX(r_a0_prev + r_g0, r_a1_prev - r_g0);
+			auto r_a1 = MAX(r_a3_prev + r_g1, r_a2_prev - r_g1);
+			auto r_a2 = MAX(r_a4_prev + r_g1, r_a5_prev - r_g1);
+			auto r_a3 = MAX(r_a7_prev + r_g0, r_a6_prev - r_g0);
+			auto r_a4 = MAX(r_a1_prev + r_g0, r_a0_prev - r_g0);
+			auto r_a5 = MAX(r_a2_prev + r_g1, r_a3_prev - r_g1);
+			auto r_a6 = MAX(r_a5_prev + r_g1, r_a4_prev - r_g1);
+			auto r_a7 = MAX(r_a6_prev + r_g0, r_a7_prev - r_g0);
+
+			RSC_BCJR_inter_fast_normalize<R>::apply(r_a0, r_a1, r_a2, r_a3, r_a4, r_a5, r_a6, r_a7, i);
+
+			r_a0_prev = r_a0; r_a1_prev = r_a1; r_a2_prev = r_a2; r_a3_prev = r_a3;
+			r_a4_prev = r_a4; r_a5_prev = r_a5; r_a6_prev = r_a6; r_a7_prev = r_a7;
+		}
+
+		// the last alpha of a sub-block initializes the first alpha of the next sub-block at the next call
+		if (w == n_win -1)
+		{
+			r_a0_prev.store(&bound[0][0]);
+			r_a1_prev.store(&bound[1][0]);
+			r_a2_prev.store(&bound[2][0]);
+			r_a3_prev.store(&bound[3][0]);
+			r_a4_prev.store(&bound[4][0]);
+			r_a5_prev.store(&bound[5][0]);
+			r_a6_prev.store(&bound[6][0]);
+			r_a7_prev.store(&bound[7][0]);
+
+			for (auto j = 0; j < 8; j++)
+				for (auto l = 1; l < stride; l++)
+					a_nii[j][l] = bound[j][l -1];
+		}
+
+		auto r_b0_prev = mipp::Reg<R>(&b_nii[0][w * stride]);
+		auto r_b1_prev = mipp::Reg<R>(&b_nii[1][w * stride]);
+		auto r_b2_prev = mipp::Reg<R>(&b_nii[2][w * stride]);
+		auto r_b3_prev = mipp::Reg<R>(&b_nii[3][w * stride]);
+		auto r_b4_prev = mipp::Reg<R>(&b_nii[4][w * stride]);
+		auto r_b5_prev = mipp::Reg<R>(&b_nii[5][w * stride]);
+		auto r_b6_prev = mipp::Reg<R>(&b_nii[6][w * stride]);
+		auto r_b7_prev = mipp::Reg<R>(&b_nii[7][w * stride]);
+
+		// compute beta values [trellis backward traversal <-] + compute extrinsic values
+		for (auto t = len -1; t >= 0; t--)
+		{
+			const auto i = (t0 + t) * stride;
+
+			const auto r_g0 = mipp::Reg<R>(&gamma[0][i]);
+			const auto r_g1 = mipp::Reg<R>(&gamma[1][i]);
+
+			const auto r_a0 = mipp::Reg<R>(&alpha[0][t * stride]);
+			const auto r_a1 = mipp::Reg<R>(&alpha[1][t * stride]);
+			const auto r_a2 = mipp::Reg<R>(&alpha[2][t * stride]);
+			const auto r_a3 = mipp::Reg<R>(&alpha[3][t * stride]);
+			const auto r_a4 = mipp::Reg<R>(&alpha[4][t * stride]);
+			const auto r_a5 = mipp::Reg<R>(&alpha[5][t * stride]);
+			const auto r_a6 = mipp::Reg<R>(&alpha[6][t * stride]);
+			const auto r_a7 = mipp::Reg<R>(&alpha[7][t * stride]);
+
+			const auto r_sum0_0 = r_a0 + r_b0_prev + r_g0; auto r_max0 = r_sum0_0;
+			const auto r_sum0_1 = r_a1 + r_b4_prev + r_g0;      r_max0 = MAX(r_max0, r_sum0_1);
+			const auto r_sum0_2 = r_a2 + r_b5_prev + r_g1;      r_max0 = MAX(r_max0, r_sum0_2);
+			const auto r_sum0_3 = r_a3 + r_b1_prev + r_g1;      r_max0 = MAX(r_max0, r_sum0_3);
+			const auto r_sum0_4 = r_a4 + r_b2_prev + r_g1;      r_max0 = MAX(r_max0, r_sum0_4);
+			const auto r_sum0_5 = r_a5 + r_b6_prev + r_g1;      r_max0 = MAX(r_max0, r_sum0_5);
+			const auto r_sum0_6 = r_a6 + r_b7_prev + r_g0;      r_max0 = MAX(r_max0, r_sum0_6);
+			const auto r_sum0_7 = r_a7 + r_b3_prev + r_g0;      r_max0 = MAX(r_max0, r_sum0_7);
+
+			const auto r_sum1_0 = r_a0 + r_b4_prev - r_g0; auto r_max1 = r_sum1_0;
+			const auto r_sum1_1 = r_a1 + r_b0_prev - r_g0;      r_max1 = MAX(r_max1, r_sum1_1);
+			const auto r_sum1_2 = r_a2 + r_b1_prev - r_g1;      r_max1 = MAX(r_max1, r_sum1_2);
+			const auto r_sum1_3 = r_a3 + r_b5_prev - r_g1;      r_max1 = MAX(r_max1, r_sum1_3);
+			const auto r_sum1_4 = r_a4 + r_b6_prev - r_g1;      r_max1 = MAX(r_max1, r_sum1_4);
+			const auto r_sum1_5 = r_a5 + r_b2_prev - r_g1;      r_max1 = MAX(r_max1, r_sum1_5);
+			const auto r_sum1_6 = r_a6 + r_b3_prev - r_g0;      r_max1 = MAX(r_max1, r_sum1_6);
+			const auto r_sum1_7 = r_a7 + r_b7_prev - r_g0;      r_max1 = MAX(r_max1, r_sum1_7);
+
+			const auto r_post = RSC_BCJR_inter_post<R>::compute(r_max0 - r_max1);
+			const auto r_ext  = r_post - mipp::Reg<R>(&sys_sb[i]);
+			r_ext.store(&ext_sb[i]);
+
+			// compute beta values
+			auto r_b0 = MAX(r_b0_prev + r_g0, r_b4_prev - r_g0);
+			auto r_b1 = MAX(r_b4_prev + r_g0, r_b0_prev - r_g0);
+			auto r_b2 = MAX(r_b5_prev + r_g1, r_b1_prev - r_g1);
+			auto r_b3 = MAX(r_b1_prev + r_g1, r_b5_prev - r_g1);
+			auto r_b4 = MAX(r_b2_prev + r_g1, r_b6_prev - r_g1);
+			auto r_b5 = MAX(r_b6_prev + r_g1, r_b2_prev - r_g1);
+			auto r_b6 = MAX(r_b7_prev + r_g0, r_b3_prev - r_g0);
+			auto r_b7 = MAX(r_b3_prev + r_g0, r_b7_prev - r_g0);
+
+			RSC_BCJR_inter_fast_normalize<R>::apply(r_b0, r_b1, r_b2, r_b3, r_b4, r_b5, r_b6, r_b7, i);
+
+			r_b0_prev = r_b0; r_b1_prev = r_b1; r_b2_prev = r_b2; r_b3_prev = r_b3;
+			r_b4_prev = r_b4; r_b5_prev = r_b5; r_b6_prev = r_b6; r_b7_prev = r_b7;
+		}
+
+		// the first beta of a window initializes the last beta of the previous window at the next call
+		if (w > 0)
+		{
+			r_b0_prev.store(&b_nii[0][(w -1) * stride]);
+			r_b1_prev.store(&b_nii[1][(w -1) * stride]);
+			r_b2_prev.store(&b_nii[2][(w -1) * stride]);
+			r_b3_prev.store(&b_nii[3][(w -1) * stride]);
+			r_b4_prev.store(&b_nii[4][(w -1) * stride]);
+			r_b5_prev.store(&b_nii[5][(w -1) * stride]);
+			r_b6_prev.store(&b_nii[6][(w -1) * stride]);
+			r_b7_prev.store(&b_nii[7][(w -1) * stride]);
+		}
+		else // the previous window is the last window of the previous sub-block (read later by the last window)
+		{
+			r_b0_prev.store(&bound[0][stride]);
+			r_b1_prev.store(&bound[1][stride]);
+			r_b2_prev.store(&bound[2][stride]);
+			r_b3_prev.store(&bound[3][stride]);
+			r_b4_prev.store(&bound[4][stride]);
+			r_b5_prev.store(&bound[5][stride]);
+			r_b6_prev.store(&bound[6][stride]);
+			r_b7_prev.store(&bound[7][stride]);
+		}
+	}
+
+	// the last lane is initialized by the tail bits (see Decoder_RSC_BCJR_window::compute_tail)
+	for (auto j = 0; j < 8; j++)
+		for (auto l = 0; l < stride -1; l++)
+			b_nii[j][(n_win -1) * stride + l] = bound[j][stride + l +1];
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_window<B,R,MAX>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	constexpr auto stride = mipp::nElReg<R>();
+
+	this->compute_gamma  (sys, par);
+	this->compute_tail   (sys, par);
+	this->compute_windows(        );
+
+	std::vector<R*> frames(stride);
+	for (auto f = 0; f < stride; f++)
+		frames[f] = ext + f * sb_size;
+	tools::Reorderer_static<R,stride>::apply_rev(ext_sb.data(), frames, sb_size);
+}
+}
+}
@@ -6,6 +6,7 @@
 
 #include "Tools/Perf/hard_decision.h"
 #include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Perf/Timer/Sub_task_timer.hpp"
 
 #include "Decoder_turbo_fast.hpp"
 
@@ -100,11 +101,15 @@ template <typename B, typename R>
 void Decoder_turbo_fast<B,R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	tools::Sub_task_timer timer((*this)[dec::tsk::decode_siho]);
 	this->_load(Y_N, frame_id);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	timer.lap(dec::tm::decode_siho::load);
+
+	// new frame: the SISO decoders have to forget the previous one (e.g. the boundary metrics of the windowed BCJR)
+	this->siso_n.reset();
+	if (&this->siso_i != &this->siso_n)
+		this->siso_i.reset();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	const auto n_frames = this->get_simd_inter_frame_level();
 	const auto tail_n_2 = this->siso_n.tail_length() / 2;
 	const auto tail_i_2 = this->siso_i.tail_length() / 2;
@@ -179,16 +184,12 @@ void Decoder_turbo_fast<B,R>
 
 	for (auto cb : this->callbacks_end)
 		cb(ite -1);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	timer.lap(dec::tm::decode_siho::decode);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
 	this->_store(V_K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
+	timer.lap(dec::tm::decode_siho::store);
 
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::total,  d_load + d_decod + d_store);
+	timer.total(dec::tm::decode_siho::total);
 }
 
 template <typename B, typename R>
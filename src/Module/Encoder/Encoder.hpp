@@ -15,6 +15,7 @@
 #include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
 
 #include "Module/Module.hpp"
 
@@ -26,12 +27,13 @@ namespace module
 	{
 		namespace tsk
 		{
-			enum list { encode, SIZE };
+			enum list { encode, encode_packed, SIZE };
 		}
 
 		namespace sck
 		{
-			namespace encode { enum list { U_K, X_N, SIZE }; }
+			namespace encode        { enum list { U_K, X_N, SIZE }; }
+			namespace encode_packed { enum list { U_K, X_N, SIZE }; }
 		}
 	}
 
@@ -58,6 +60,8 @@ protected:
 	std::vector<std::vector<B>> U_K_mem;
 	std::vector<std::vector<B>> X_N_mem;
 
+	std::vector<B> buff_unpacked; // unpacked frames for the default implementation of the packed encoding
+
 public:
 	/*!
 	 * \brief Constructor.
@@ -102,13 +106,24 @@ public:
 			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 		}
 
-		auto &p = this->create_task("encode");
-		auto &ps_U_K = this->template create_socket_in <B>(p, "U_K", this->K * this->n_frames);
-		auto &ps_X_N = this->template create_socket_out<B>(p, "X_N", this->N * this->n_frames);
-		this->create_codelet(p, [this, &ps_U_K, &ps_X_N]() -> int
+		auto &p1 = this->create_task("encode");
+		auto &p1s_U_K = this->template create_socket_in <B>(p1, "U_K", this->K * this->n_frames);
+		auto &p1s_X_N = this->template create_socket_out<B>(p1, "X_N", this->N * this->n_frames);
+		this->create_codelet(p1, [this, &p1s_U_K, &p1s_X_N]() -> int
 		{
-			this->encode(static_cast<B*>(ps_U_K.get_dataptr()),
-			             static_cast<B*>(ps_X_N.get_dataptr()));
+			this->encode(static_cast<B*>(p1s_U_K.get_dataptr()),
+			             static_cast<B*>(p1s_X_N.get_dataptr()));
+
+			return 0;
+		});
+
+		auto &p2 = this->create_task("encode_packed");
+		auto &p2s_U_K = this->template create_socket_in <B>(p2, "U_K", this->K * this->n_frames);
+		auto &p2s_X_N = this->template create_socket_out<B>(p2, "X_N", this->N * this->n_frames);
+		this->create_codelet(p2, [this, &p2s_U_K, &p2s_X_N]() -> int
+		{
+			this->encode_packed(static_cast<B*>(p2s_U_K.get_dataptr()),
+			                    static_cast<B*>(p2s_X_N.get_dataptr()));
 
 			return 0;
 		});
@@ -238,6 +253,65 @@ public:
 				          X_N_mem[f].begin());
 	}
 
+	/*!
+	 * \brief Encodes a vector of packed information bits (a message).
+	 *
+	 * \param U_K: a vector of packed information bits (a message).
+	 * \param X_N: a packed encoded frame with redundancy added (parity bits).
+	 *
+	 * The frames keep the stride of the unpacked frames, their bits are packed in their first bytes. The memorized
+	 * frames are unpacked.
+	 */
+	template <class A = std::allocator<B>>
+	void encode_packed(const std::vector<B,A>& U_K, std::vector<B,A>& X_N, const int frame_id = -1)
+	{
+		if (this->K * this->n_frames != (int)U_K.size())
+		{
+			std::stringstream message;
+			message << "'U_K.size()' has to be equal to 'K' * 'n_frames' ('U_K.size()' = " << U_K.size()
+			        << ", 'K' = " << this->K
+			        << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->N * this->n_frames != (int)X_N.size())
+		{
+			std::stringstream message;
+			message << "'X_N.size()' has to be equal to 'N' * 'n_frames' ('X_N.size()' = " << X_N.size()
+			        << ", 'N' = " << this->N << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (frame_id != -1 && frame_id >= this->n_frames)
+		{
+			std::stringstream message;
+			message << "'frame_id' has to be equal to '-1' or to be smaller than 'n_frames' ('frame_id' = " 
+			        << frame_id << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->encode_packed(U_K.data(), X_N.data(), frame_id);
+	}
+
+	void encode_packed(const B *U_K, B *X_N, const int frame_id = -1)
+	{
+		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+		if (this->is_memorizing())
+			for (auto f = f_start; f < f_stop; f++)
+				tools::Bit_packer<B>::unpack(U_K + f * this->K, U_K_mem[f].data(), this->K);
+
+		for (auto f = f_start; f < f_stop; f++)
+			this->_encode_packed(U_K + f * this->K,
+			                     X_N + f * this->N,
+			                     f);
+
+		if (this->is_memorizing())
+			for (auto f = f_start; f < f_stop; f++)
+				tools::Bit_packer<B>::unpack(X_N + f * this->N, X_N_mem[f].data(), this->N);
+	}
+
 	template <class A = std::allocator<B>>
 	bool is_codeword(const std::vector<B,A>& X_N)
 	{
@@ -278,6 +352,17 @@ protected:
 		throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
 	}
 
+	virtual void _encode_packed(const B *U_K, B *X_N, const int frame_id)
+	{
+		this->buff_unpacked.resize(this->K + this->N);
+		const auto U_K_unpacked = this->buff_unpacked.data();
+		const auto X_N_unpacked = this->buff_unpacked.data() + this->K;
+
+		tools::Bit_packer<B>::unpack(U_K, U_K_unpacked, this->K);
+		this->_encode(U_K_unpacked, X_N_unpacked, frame_id);
+		tools::Bit_packer<B>::pack(X_N_unpacked, X_N, this->N);
+	}
+
 	void set_sys(const bool sys)
 	{
 		this->sys = sys;
@@ -1,10 +1,12 @@
+#include <cstring>
 #include <numeric>
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/bash_tools.h"
-#include "Tools/Math/matrix.h"
+#include "Tools/Algo/Bit_matrix/Bit_matrix.hpp"
 
 #include "Encoder_LDPC.hpp"
 
@@ -22,8 +24,8 @@ Encoder_LDPC<B>
 
 template <typename B>
 Encoder_LDPC<B>
-::Encoder_LDPC(const int K, const int N, const tools::Sparse_matrix &G, const int n_frames)
-: Encoder<B>(K, N, n_frames), tG(N * K, 0)
+::Encoder_LDPC(const int K, const int N, const tools::Sparse_matrix &G, const int n_frames, const size_t m4r_budget)
+: Encoder<B>(K, N, n_frames)
 {
 	const std::string name = "Encoder_LDPC";
 	this->set_name(name);
@@ -44,14 +46,7 @@ Encoder_LDPC<B>
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	auto CN_to_VN = G.get_col_to_rows();
-
-	std::vector<B> full_G(K * N,0);
-	for (auto i = 0; i < K; i++)
-		for (size_t j = 0; j < CN_to_VN[i].size(); ++j)
-			full_G[i * N + CN_to_VN[i][j]] = 1;
-
-	tools::real_transpose(K, N, full_G, tG); // transposed for computation matter
+	this->init_G(G, m4r_budget);
 }
 
 template <typename B>
@@ -60,15 +55,56 @@ Encoder_LDPC<B>
 {
 }
 
+template <typename B>
+void Encoder_LDPC<B>
+::init_G(const tools::Sparse_matrix &G, const size_t m4r_budget)
+{
+	// the biggest Four Russians tables which fit in the budget
+	this->G_M4R = tools::Bit_matrix_M4R::get_shared(tools::Bit_matrix(G, true), m4r_budget);
+	this->U_K_packed.resize(tools::Bit_matrix::n_words_for(this->K));
+	this->X_N_packed.resize(tools::Bit_matrix::n_words_for(this->N));
+}
+
 template <typename B>
 void Encoder_LDPC<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
 {
-	// Real General Matrix Multiplication
-	tools::rgemm(1, this->N, this->K, U_K, tG.data(), X_N);
+	// X_N = U_K.G in GF(2) on packed bits
+	tools::Bit_matrix::pack(U_K, this->U_K_packed.data(), this->K);
+	this->G_M4R->mul(this->U_K_packed.data(), this->X_N_packed.data());
+	tools::Bit_matrix::unpack(this->X_N_packed.data(), X_N, this->N);
+}
+
+template <typename B>
+void Encoder_LDPC<B>
+::_encode_packed(const B *U_K, B *X_N, const int frame_id)
+{
+	// the encoders which do not use G (e.g. DVB-S2, QC) unpack the bits
+	if (this->G_M4R == nullptr)
+	{
+		Encoder<B>::_encode_packed(U_K, X_N, frame_id);
+		return;
+	}
+
+#if __BYTE_ORDER != __LITTLE_ENDIAN
+	throw tools::runtime_error(__FILE__, __LINE__, __func__, "The packed LDPC encoder works only on little endian CPUs.");
+#endif
+
+	// the packed frames are directly the packed vectors of the product (LSB first)
+	const auto n_bytes_K = (this->K + 7) / 8;
+	const auto n_bytes_N = (this->N + 7) / 8;
+
+	auto bytes_U_K = (unsigned char*)this->U_K_packed.data();
+	std::fill(this->U_K_packed.begin(), this->U_K_packed.end(), (uint64_t)0);
+	std::memcpy(bytes_U_K, (const void*)U_K, n_bytes_K);
+	if (this->K % 8)
+		bytes_U_K[n_bytes_K -1] &= (unsigned char)((1 << (this->K % 8)) -1);
+
+	this->G_M4R->mul(this->U_K_packed.data(), this->X_N_packed.data());
 
-	for (auto j = 0; j < this->N; ++j)
-		X_N[j] %= 2;
+	std::memcpy((void*)X_N, (const void*)this->X_N_packed.data(), n_bytes_N);
+	if (this->N % 8)
+		((unsigned char*)X_N)[n_bytes_N -1] &= (unsigned char)((1 << (this->N % 8)) -1);
 }
 
 template <typename B>
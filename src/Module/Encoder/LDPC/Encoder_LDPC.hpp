@@ -1,9 +1,12 @@
 #ifndef ENCODER_LDPC_HPP_
 #define ENCODER_LDPC_HPP_
 
+#include <memory>
 #include <vector>
+#include <mipp.h>
 
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/Bit_matrix/Bit_matrix_M4R.hpp"
 
 #include "../Encoder.hpp"
 
@@ -16,20 +19,29 @@ template <typename B = int>
 class Encoder_LDPC : public Encoder<B>
 {
 protected:
-	std::vector<B> tG; // the generator matrix
+	// the bit-packed generator matrix (K x N) with its Four Russians tables (shared by the encoders of the same matrix)
+	std::shared_ptr<const tools::Bit_matrix_M4R> G_M4R;
+	mipp::vector<uint64_t>                       U_K_packed;
+	mipp::vector<uint64_t>                       X_N_packed;
 
 protected:
 	Encoder_LDPC(const int K, const int N, const int n_frames = 1);
 
 public:
-	Encoder_LDPC(const int K, const int N, const tools::Sparse_matrix &G, const int n_frames = 1);
+	Encoder_LDPC(const int K, const int N, const tools::Sparse_matrix &G, const int n_frames = 1,
+	             const size_t m4r_budget = (size_t)64 << 20);
 	virtual ~Encoder_LDPC();
 
 	virtual const std::vector<uint32_t>& get_info_bits_pos();
 	virtual bool is_sys() const;
 
 protected:
-	virtual void _encode(const B *U_K, B *X_N, const int frame_id);
+	virtual void _encode       (const B *U_K, B *X_N, const int frame_id);
+	virtual void _encode_packed(const B *U_K, B *X_N, const int frame_id);
+
+	// G is the transposed generator matrix (N x K) as returned by LDPC_matrix_handler::transform_H_to_G, 'm4r_budget'
+	// is the memory budget of the Four Russians tables in bytes
+	void init_G(const tools::Sparse_matrix &G, const size_t m4r_budget);
 };
 
 }
@@ -6,7 +6,6 @@
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/bash_tools.h"
-#include "Tools/Math/matrix.h"
 
 #include "Encoder_LDPC_from_H.hpp"
 
@@ -15,8 +14,12 @@ using namespace aff3ct::module;
 
 template <typename B>
 Encoder_LDPC_from_H<B>
-::Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames)
-: Encoder_LDPC<B>(K, N, n_frames), G(tools::LDPC_matrix_handler::transform_H_to_G(H, this->info_bits_pos)), H(H)
+::Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames,
+                      const std::string &G_cache_dir, const size_t m4r_budget)
+: Encoder_LDPC<B>(K, N, n_frames),
+  G_entry(tools::LDPC_matrix_cache::transform_H_to_G(H, G_cache_dir)),
+  G(G_entry->G),
+  H(H)
 {
 	const std::string name = "Encoder_LDPC_from_H";
 	this->set_name(name);
@@ -37,6 +40,10 @@ Encoder_LDPC_from_H<B>
 		        << ", 'G.get_n_rows()' = " << G.get_n_rows() << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	this->info_bits_pos.assign(G_entry->info_bits_pos.begin(), G_entry->info_bits_pos.end());
+
+	this->init_G(G, m4r_budget);
 }
 
 template <typename B>
@@ -45,19 +52,6 @@ Encoder_LDPC_from_H<B>
 {
 }
 
-template <typename B>
-void Encoder_LDPC_from_H<B>
-::_encode(const B *U_K, B *X_N, const int frame_id)
-{
-	for (unsigned i = 0; i < G.get_n_rows(); i++)
-	{
-		X_N[i] = 0;
-		for (unsigned j = 0; j < G.get_cols_from_row(i).size(); j++)
-			X_N[i] += U_K[ G.get_cols_from_row(i)[j] ];
-		X_N[i] %= 2;
-	}
-}
-
 template <typename B>
 bool Encoder_LDPC_from_H<B>
 ::is_codeword(const B *X_N)
@@ -2,11 +2,14 @@
 #define ENCODER_LDPC_FROM_H_HPP_
 
 #include <vector>
+#include <string>
+#include <memory>
 
 #include "../Encoder_LDPC.hpp"
 
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
 #include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
+#include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_cache.hpp"
 
 namespace aff3ct
 {
@@ -17,11 +20,13 @@ template <typename B = int>
 class Encoder_LDPC_from_H : public Encoder_LDPC<B>
 {
 protected:
-	tools::Sparse_matrix G; // position of ones by column
+	std::shared_ptr<const tools::LDPC_matrix_cache::Entry> G_entry; // shared by the encoders built from the same H
+	const tools::Sparse_matrix &G; // position of ones by column
 	tools::Sparse_matrix H;
 
 public:
-	Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1);
+	Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1,
+	                    const std::string &G_cache_dir = "", const size_t m4r_budget = (size_t)64 << 20);
 	virtual ~Encoder_LDPC_from_H();
 
 	bool is_codeword(const B *X_N);
@@ -29,9 +34,6 @@ public:
 	const std::vector<uint32_t>& get_info_bits_pos();
 
 	bool is_sys() const;
-
-protected:
-	void _encode(const B *U_K, B *X_N, const int frame_id);
 };
 
 }
@@ -2,11 +2,11 @@
 #include <vector>
 #include <numeric>
 #include <functional>
+#include <algorithm>
 #include <sstream>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/bash_tools.h"
-#include "Tools/Math/matrix.h"
 
 #include "Encoder_LDPC_from_QC.hpp"
 
@@ -17,8 +17,7 @@ template <typename B>
 Encoder_LDPC_from_QC<B>
 ::Encoder_LDPC_from_QC(const int K, const int N, const tools::Sparse_matrix &_H, const int n_frames)
 : Encoder_LDPC<B>(K, N, n_frames),
-  H((_H.get_n_rows() > _H.get_n_cols())?_H.transpose():_H),
-  invH2(tools::LDPC_matrix_handler::invert_H2(_H))
+  H((_H.get_n_rows() > _H.get_n_cols())?_H.transpose():_H)
 {
 	const std::string name = "Encoder_LDPC_from_QC";
 	this->set_name(name);
@@ -38,6 +37,8 @@ Encoder_LDPC_from_QC<B>
 		        << ", 'H.get_n_cols()' = " << H.get_n_cols() << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	this->build_schedule();
 }
 
 template <typename B>
@@ -48,30 +49,162 @@ Encoder_LDPC_from_QC<B>
 
 template <typename B>
 void Encoder_LDPC_from_QC<B>
-::_encode(const B *U_K, B *X_N, const int frame_id)
+::build_schedule()
 {
-	unsigned M = this->N - this->K;
+	const auto K = (unsigned)this->K;
+	const auto M = (unsigned)(this->N - this->K);
 
-	//Systematic part
-	std::copy_n(U_K, this->K, X_N);
+	// number of unknown parity bits per check
+	std::vector<unsigned> n_unknowns(M, 0);
+	for (unsigned i = 0; i < M; i++)
+		for (auto c : H.get_cols_from_row(i))
+			if (c >= K)
+				n_unknowns[i]++;
 
-	//Calculate parity part
-	mipp::vector<int8_t> tableauCalcul(M, 0);
+	std::vector<bool>     known(M, false), used(M, false);
+	std::vector<uint32_t> core_bit, queue;
 	for (unsigned i = 0; i < M; i++)
+		if (n_unknowns[i] == 1)
+			queue.push_back(i);
+
+	const auto set_known = [&](const unsigned p)
+	{
+		known[p] = true;
+		for (auto i : H.get_rows_from_col(K + p))
+			if (--n_unknowns[i] == 1 && !used[i])
+				queue.push_back(i);
+	};
+
+	unsigned n_known = 0;
+	while (n_known < M)
 	{
-		for (unsigned j = 0; j < H.get_cols_from_row(i).size(); j++)
-			if (H.get_cols_from_row(i)[j] < (unsigned)this->K)
-				tableauCalcul[i] ^= U_K[ H.get_cols_from_row(i)[j] ];
-			else
+		// back-substitution: a check with a single unknown parity bit gives its value
+		while (!queue.empty())
+		{
+			const auto i = queue.back();
+			queue.pop_back();
+			if (used[i] || n_unknowns[i] != 1)
+				continue;
+
+			unsigned p = 0;
+			for (auto c : H.get_cols_from_row(i))
+				if (c >= K && !known[c - K])
+					p = c - K;
+
+			used[i] = true;
+			steps_CN .push_back(i);
+			steps_bit.push_back(K + p);
+			set_known(p);
+			n_known++;
+		}
+
+		if (n_known == M)
+			break;
+
+		// stuck: an unknown parity bit of the check with the fewest unknowns becomes a core bit
+		unsigned best = M;
+		for (unsigned i = 0; i < M; i++)
+			if (!used[i] && n_unknowns[i] > 1 && (best == M || n_unknowns[i] < n_unknowns[best]))
+				best = i;
+
+		if (best == M)
+		{
+			std::stringstream message;
+			message << "Matrix H2 (H = [H1 H2]) is not invertible";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		for (auto c : H.get_cols_from_row(best))
+			if (c >= K && !known[c - K])
+			{
+				core_bit.push_back(c - K);
+				set_known(c - K);
+				n_known++;
 				break;
+			}
 	}
 
 	for (unsigned i = 0; i < M; i++)
+		if (!used[i])
+			core_CN.push_back(i);
+
+	const auto g = (unsigned)core_bit.size();
+	if (g == 0)
+		return;
+
+	if (core_CN.size() != g)
 	{
-		X_N[this->K + i] = 0;
-		for (unsigned j = 0; j < M; j++)
-			X_N[this->K + i] += tableauCalcul[j] & invH2[i][j];
-		X_N[this->K + i] %= 2;
+		std::stringstream message;
+		message << "Matrix H2 (H = [H1 H2]) is not invertible";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// dependency of each parity bit to the core bits (symbolic back-substitution)
+	tools::Bit_matrix dep(M, g);
+	for (unsigned k = 0; k < g; k++)
+		dep.set(core_bit[k], k);
+
+	for (size_t s = 0; s < steps_CN.size(); s++)
+	{
+		const auto p = steps_bit[s] - K;
+		for (auto c : H.get_cols_from_row(steps_CN[s]))
+			if (c >= K && c != steps_bit[s])
+				tools::Bit_matrix::xor_words(dep[p], dep[c - K], dep.get_n_words());
+	}
+
+	// the remaining checks give a g x g system on the core bits
+	tools::Bit_matrix A(g, g);
+	for (unsigned r = 0; r < g; r++)
+		for (auto c : H.get_cols_from_row(core_CN[r]))
+			if (c >= K)
+				tools::Bit_matrix::xor_words(A[r], dep[c - K], A.get_n_words());
+
+	// core bits (row vector) = syndrome (row vector) . inv(A)^T
+	this->inv_A = A.transpose().inverse();
+	this->T     = dep.transpose();
+
+	this->core_synd .resize(tools::Bit_matrix::n_words_for(g), 0);
+	this->core_bits .resize(tools::Bit_matrix::n_words_for(g), 0);
+	this->parity_fix.resize(tools::Bit_matrix::n_words_for(M), 0);
+}
+
+template <typename B>
+void Encoder_LDPC_from_QC<B>
+::_encode(const B *U_K, B *X_N, const int frame_id)
+{
+	// systematic part
+	std::copy_n(U_K, this->K, X_N);
+	std::fill(X_N + this->K, X_N + this->N, (B)0);
+
+	// parity part, back-substitution (the core bits are 0 at this point)
+	for (size_t s = 0; s < steps_CN.size(); s++)
+	{
+		B bit = 0;
+		for (auto c : H.get_cols_from_row(steps_CN[s]))
+			bit ^= X_N[c];
+		X_N[steps_bit[s]] = bit; // X_N[steps_bit[s]] was 0
+	}
+
+	// solve the core bits and add their contribution
+	if (!core_CN.empty())
+	{
+		const auto g = (unsigned)core_CN.size();
+		std::fill(core_synd.begin(), core_synd.end(), (uint64_t)0);
+		for (unsigned r = 0; r < g; r++)
+		{
+			B bit = 0;
+			for (auto c : H.get_cols_from_row(core_CN[r]))
+				bit ^= X_N[c];
+			if (bit)
+				core_synd[r >> 6] |= (uint64_t)1 << (r & 63);
+		}
+
+		inv_A.mul(core_synd.data(), core_bits .data());
+		T    .mul(core_bits.data(), parity_fix.data());
+
+		B* parity = X_N + this->K;
+		for (auto i = 0; i < this->N - this->K; i++)
+			parity[i] ^= (B)tools::Bit_matrix::get_bit(parity_fix.data(), i);
 	}
 }
 
@@ -81,16 +214,18 @@ bool Encoder_LDPC_from_QC<B>
 {
 	auto syndrome = false;
 
-	const auto n_CN = (int)this->H.get_n_cols();
+	// H is stored with one row per check node (see the constructor)
+	const auto n_CN = (int)this->H.get_n_rows();
 	auto i = 0;
 	while (i < n_CN && !syndrome)
 	{
 		auto sign = 0;
 
-		const auto n_VN = (int)this->H[i].size();
+		const auto &VNs = this->H.get_cols_from_row(i);
+		const auto n_VN = (int)VNs.size();
 		for (auto j = 0; j < n_VN; j++)
 		{
-			const auto bit = X_N[this->H[i][j]];
+			const auto bit = X_N[VNs[j]];
 			const auto tmp_sign = bit ? -1 : 0;
 
 			sign ^= tmp_sign;
@@ -6,7 +6,7 @@
 #include "../Encoder_LDPC.hpp"
 
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
-#include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
+#include "Tools/Algo/Bit_matrix/Bit_matrix.hpp"
 
 namespace aff3ct
 {
@@ -18,7 +18,21 @@ class Encoder_LDPC_from_QC : public Encoder_LDPC<B>
 {
 protected:
 	tools::Sparse_matrix H;
-	tools::LDPC_matrix_handler::QCFull_matrix invH2;
+
+	// back-substitution schedule: the parity bit 'steps_bit[s]' is the XOR of the other bits of the check
+	// 'steps_CN[s]', the steps are in the computation order
+	std::vector<uint32_t>  steps_CN;
+	std::vector<uint32_t>  steps_bit;
+
+	// when H2 (H = [H1 H2]) is not triangular, the 'g' core parity bits (the gap) can not be back-substituted: they
+	// are solved from the 'g' remaining checks with a dense g x g inverse, then their contribution is added to the
+	// other parity bits
+	std::vector<uint32_t>  core_CN;
+	tools::Bit_matrix      inv_A; // g x g, core bits = syndrome of the remaining checks . inv_A
+	tools::Bit_matrix      T;     // g x M, the parity bits depending on each core bit
+	mipp::vector<uint64_t> core_synd;
+	mipp::vector<uint64_t> core_bits;
+	mipp::vector<uint64_t> parity_fix;
 
 public:
 	Encoder_LDPC_from_QC(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1);
@@ -32,6 +46,9 @@ public:
 
 protected:
 	void _encode(const B *U_K, B *X_N, const int frame_id);
+
+private:
+	void build_schedule();
 };
 
 }
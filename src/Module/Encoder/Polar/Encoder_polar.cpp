@@ -1,6 +1,8 @@
 #include <vector>
 #include <cmath>
+#include <cstring>
 #include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 
@@ -11,7 +13,8 @@ using namespace aff3ct::module;
 template <typename B>
 Encoder_polar<B>
 ::Encoder_polar(const int& K, const int& N, const std::vector<bool>& frozen_bits, const int n_frames)
-: Encoder<B>(K, N, n_frames), m((int)std::log2(N)), frozen_bits(frozen_bits), X_N_tmp(this->N)
+: Encoder<B>(K, N, n_frames), m((int)std::log2(N)), frozen_bits(frozen_bits), X_N_tmp(this->N),
+  X_N_words((this->N + 63) / 64), info_words((this->N + 63) / 64)
 {
 	const std::string name = "Encoder_polar";
 	this->set_name(name);
@@ -55,6 +58,61 @@ void Encoder_polar<B>
 				bits[j + i] = bits[j + i] ^ bits[k + j + i];
 }
 
+template <typename B>
+void Encoder_polar<B>
+::_encode_packed(const B *U_K, B *X_N, const int frame_id)
+{
+	this->convert_packed(U_K, this->X_N_words.data());
+	this->light_encode_packed(this->X_N_words.data());
+	this->store_packed(this->X_N_words.data(), X_N);
+}
+
+template <typename B>
+void Encoder_polar<B>
+::light_encode_packed(uint64_t *words)
+{
+	// the butterflies of the stages with k >= 64 XOR whole words
+	const auto n_words = (int)this->X_N_words.size();
+	for (auto k = (n_words >> 1); k > 0; k >>= 1)
+		for (auto j = 0; j < n_words; j += 2 * k)
+			for (auto i = 0; i < k; i++)
+				words[j + i] ^= words[k + j + i];
+
+	// the butterflies of the stages with k < 64 are inside the words: the bits 'p' with the bit 'k' of 'p' at 0 are
+	// XORed with the bits 'p + k'
+	static const uint64_t masks[6] = {0x5555555555555555ULL, 0x3333333333333333ULL, 0x0F0F0F0F0F0F0F0FULL,
+	                                  0x00FF00FF00FF00FFULL, 0x0000FFFF0000FFFFULL, 0x00000000FFFFFFFFULL};
+	for (auto l = std::min(this->m, 6) -1; l >= 0; l--)
+		for (auto w = 0; w < n_words; w++)
+			words[w] ^= (words[w] >> (1 << l)) & masks[l];
+}
+
+template <typename B>
+void Encoder_polar<B>
+::convert_packed(const B *U_K, uint64_t *U_N)
+{
+	const auto bytes = (const unsigned char*)U_K;
+
+	std::fill(U_N, U_N + this->X_N_words.size(), (uint64_t)0);
+	for (auto k = 0; k < this->K; k++)
+	{
+		const auto n = this->info_bits_pos[k];
+		U_N[n >> 6] |= (uint64_t)((bytes[k >> 3] >> (k & 7)) & 1) << (n & 63);
+	}
+}
+
+template <typename B>
+void Encoder_polar<B>
+::store_packed(const uint64_t *words, B *X_N)
+{
+#if __BYTE_ORDER != __LITTLE_ENDIAN
+	throw tools::runtime_error(__FILE__, __LINE__, __func__, "The packed polar encoder works only on little endian CPUs.");
+#endif
+
+	// 'N' is a power of 2: the packed frame has no padding bits (or they are all 0 when 'N' < 8)
+	std::memcpy((void*)X_N, (const void*)words, (this->N + 7) / 8);
+}
+
 template <typename B>
 void Encoder_polar<B>
 ::convert(const B *U_K, B *U_N)
@@ -103,6 +161,11 @@ void Encoder_polar<B>
 	for (auto n = 0; n < this->N; n++)
 		if (!frozen_bits[n])
 			this->info_bits_pos[k++] = n;
+
+	std::fill(this->info_words.begin(), this->info_words.end(), (uint64_t)0);
+	for (auto n = 0; n < this->N; n++)
+		if (!frozen_bits[n])
+			this->info_words[n >> 6] |= (uint64_t)1 << (n & 63);
 }
 
 // ==================================================================================== explicit template instantiation 
@@ -2,6 +2,7 @@
 #define ENCODER_POLAR_HPP_
 
 #include <vector>
+#include <cstdint>
 
 #include "Tools/Code/Polar/Frozenbits_notifier.hpp"
 
@@ -18,6 +19,8 @@ protected:
 	const int                m;           // log_2 of code length
 	const std::vector<bool>& frozen_bits; // true means frozen, false means set to 0/1
 	      std::vector<B>     X_N_tmp; 
+	std::vector<uint64_t>    X_N_words;  // packed frame (64 bits per word)
+	std::vector<uint64_t>    info_words; // packed mask of the information bits
 
 public:
 	Encoder_polar(const int& K, const int& N, const std::vector<bool>& frozen_bits, const int n_frames = 1);
@@ -30,8 +33,13 @@ public:
 	virtual void notify_frozenbits_update();
 
 protected:
-	virtual void _encode(const B *U_K, B *X_N, const int frame_id);
+	virtual void _encode       (const B *U_K, B *X_N, const int frame_id);
+	virtual void _encode_packed(const B *U_K, B *X_N, const int frame_id);
 	void convert(const B *U_K, B *U_N);
+
+	void convert_packed     (const B *U_K, uint64_t *U_N  );
+	void light_encode_packed(                uint64_t *words);
+	void store_packed       (const uint64_t *words, B *X_N);
 };
 }
 }
@@ -32,6 +32,25 @@ void Encoder_polar_sys<B>
 	this->light_encode(X_N);
 }
 
+template <typename B>
+void Encoder_polar_sys<B>
+::_encode_packed(const B *U_K, B *X_N, const int frame_id)
+{
+	auto words = this->X_N_words.data();
+	this->convert_packed(U_K, words);
+
+	// first time encode
+	this->light_encode_packed(words);
+
+	for (auto w = 0; w < (int)this->X_N_words.size(); w++)
+		words[w] &= this->info_words[w];
+
+	// second time encode because of systematic encoder
+	this->light_encode_packed(words);
+
+	this->store_packed(words, X_N);
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
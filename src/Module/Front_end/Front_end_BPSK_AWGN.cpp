@@ -0,0 +1,177 @@
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+
+#include "Tools/Math/utils.h"
+
+#include "Front_end_BPSK_AWGN.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R, typename Q>
+Front_end_BPSK_AWGN<B,R,Q>
+::Front_end_BPSK_AWGN(const int N, tools::Gaussian_noise_generator<R> *noise_generator, const int fixed_point_pos,
+                      const int saturation_pos, const bool disable_sig2, const R sigma, const int n_frames)
+: Module(n_frames),
+  N(N),
+  noise_generator(noise_generator),
+  disable_sig2(disable_sig2),
+  factor (std::is_floating_point<Q>::value ? (R)1 : (R)(1 << fixed_point_pos)),
+  val_max(std::is_floating_point<Q>::value ? std::numeric_limits<R>::max()
+                                           : (R)((1 << (saturation_pos -2)) + ((1 << (saturation_pos -2)) -1))),
+  sigma((R)0),
+  scale((R)0),
+  X_blk(block_size),
+  Y_blk(block_size)
+{
+	const std::string name = "Front_end_BPSK_AWGN";
+	this->set_name(name);
+	this->set_short_name(name);
+
+	if (N <= 0)
+	{
+		std::stringstream message;
+		message << "'N' has to be greater than 0 ('N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (noise_generator == nullptr)
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'noise_generator' can't be NULL.");
+
+	if (!std::is_floating_point<Q>::value)
+	{
+		if (saturation_pos < 2 || saturation_pos > (int)sizeof(Q) * 8)
+		{
+			std::stringstream message;
+			message << "'saturation_pos' has to be greater than 1 and smaller or equal to 'sizeof(Q)' * 8 "
+			        << "('saturation_pos' = " << saturation_pos << ", 'sizeof(Q)' = " << sizeof(Q) << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (fixed_point_pos < 0 || fixed_point_pos > saturation_pos)
+		{
+			std::stringstream message;
+			message << "'fixed_point_pos' has to be positive and smaller or equal to 'saturation_pos' "
+			        << "('fixed_point_pos' = " << fixed_point_pos << ", 'saturation_pos' = " << saturation_pos << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	this->set_sigma(sigma);
+
+	auto &p = this->create_task("process");
+	auto &ps_X_N = this->template create_socket_in <B>(p, "X_N", this->N * this->n_frames);
+	auto &ps_Y_N = this->template create_socket_out<Q>(p, "Y_N", this->N * this->n_frames);
+	this->create_codelet(p, [this, &ps_X_N, &ps_Y_N]() -> int
+	{
+		this->process(static_cast<B*>(ps_X_N.get_dataptr()),
+		              static_cast<Q*>(ps_Y_N.get_dataptr()));
+
+		return 0;
+	});
+}
+
+template <typename B, typename R, typename Q>
+Front_end_BPSK_AWGN<B,R,Q>
+::~Front_end_BPSK_AWGN()
+{
+	delete noise_generator;
+}
+
+template <typename B, typename R, typename Q>
+int Front_end_BPSK_AWGN<B,R,Q>
+::get_N() const
+{
+	return this->N;
+}
+
+template <typename B, typename R, typename Q>
+R Front_end_BPSK_AWGN<B,R,Q>
+::get_sigma() const
+{
+	return this->sigma;
+}
+
+template <typename B, typename R, typename Q>
+void Front_end_BPSK_AWGN<B,R,Q>
+::set_sigma(const R sigma)
+{
+	this->sigma = sigma;
+	this->scale = this->disable_sig2 ? this->factor : (R)2 / (sigma * sigma) * this->factor;
+}
+
+template <typename B, typename R, typename Q>
+void Front_end_BPSK_AWGN<B,R,Q>
+::process(const B *X_N, Q *Y_N, const int frame_id)
+{
+	// the frames are contiguous: they are processed as a single stream of samples
+	const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+	const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+	this->_process(X_N + f_start * this->N,
+	               Y_N + f_start * this->N,
+	               (f_stop - f_start) * this->N);
+}
+
+template <typename B, typename R, typename Q>
+void Front_end_BPSK_AWGN<B,R,Q>
+::_process(const B *X_N, Q *Y_N, const int n_samples)
+{
+	const auto quantize = !std::is_floating_point<Q>::value;
+	const auto r_scale  = mipp::Reg<R>( this->scale  );
+	const auto r_max    = mipp::Reg<R>( this->val_max);
+	const auto r_min    = mipp::Reg<R>(-this->val_max);
+
+	auto X_blk = this->X_blk.data();
+	auto Y_blk = this->Y_blk.data();
+
+	for (auto i0 = 0; i0 < n_samples; i0 += block_size)
+	{
+		const auto n = std::min(block_size, n_samples - i0);
+
+		this->noise_generator->generate(Y_blk, (unsigned)n, this->sigma);
+
+		for (auto i = 0; i < n; i++)
+			X_blk[i] = X_N[i0 + i] ? (R)-1 : (R)1; // (X_N[i] == 1) ? -1 : +1
+
+		const auto vec_loop_size = (n / mipp::nElReg<R>()) * mipp::nElReg<R>();
+		if (quantize)
+		{
+			for (auto i = 0; i < vec_loop_size; i += mipp::nElReg<R>())
+			{
+				const auto y = (mipp::Reg<R>(&X_blk[i]) + mipp::Reg<R>(&Y_blk[i])) * r_scale;
+				mipp::min(mipp::max(y.round(), r_min), r_max).store(&Y_blk[i]);
+			}
+			for (auto i = vec_loop_size; i < n; i++)
+				Y_blk[i] = tools::saturate((R)std::round((X_blk[i] + Y_blk[i]) * this->scale), -this->val_max,
+				                           this->val_max);
+		}
+		else
+		{
+			for (auto i = 0; i < vec_loop_size; i += mipp::nElReg<R>())
+			{
+				const auto y = (mipp::Reg<R>(&X_blk[i]) + mipp::Reg<R>(&Y_blk[i])) * r_scale;
+				y.store(&Y_blk[i]);
+			}
+			for (auto i = vec_loop_size; i < n; i++)
+				Y_blk[i] = (X_blk[i] + Y_blk[i]) * this->scale;
+		}
+
+		// the values are already rounded and saturated: the conversion to Q is exact
+		std::copy(Y_blk, Y_blk + n, Y_N + i0);
+	}
+}
+
+// ==================================================================================== explicit template instantiation 
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Front_end_BPSK_AWGN<B_8,R_8,Q_8>;
+template class aff3ct::module::Front_end_BPSK_AWGN<B_16,R_16,Q_16>;
+template class aff3ct::module::Front_end_BPSK_AWGN<B_32,R_32,Q_32>;
+template class aff3ct::module::Front_end_BPSK_AWGN<B_64,R_64,Q_64>;
+#else
+template class aff3ct::module::Front_end_BPSK_AWGN<B,R,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
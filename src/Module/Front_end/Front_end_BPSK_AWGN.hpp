@@ -0,0 +1,138 @@
+/*!
+ * \file
+ * \brief Fused BPSK modulation, AWGN channel, demodulation and quantization.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef FRONT_END_BPSK_AWGN_HPP_
+#define FRONT_END_BPSK_AWGN_HPP_
+
+#include <vector>
+#include <sstream>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Gaussian_noise_generator/Gaussian_noise_generator.hpp"
+
+#include "Module/Module.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+	namespace fe
+	{
+		namespace tsk
+		{
+			enum list { process, SIZE };
+		}
+
+		namespace sck
+		{
+			namespace process { enum list { X_N, Y_N, SIZE }; }
+		}
+	}
+
+/*!
+ * \class Front_end_BPSK_AWGN
+ *
+ * \brief Fused BPSK modulation, AWGN channel, demodulation and quantization.
+ *
+ * \tparam B: type of the bits.
+ * \tparam R: type of the reals (floating-point representation) of the channel.
+ * \tparam Q: type of the LLRs (floating-point or fixed-point representation) given to the decoder.
+ *
+ * Computes Y_N = Q(((1 - 2 * X_N) + noise) * 2 / sigma^2) in one pass: the samples are processed by small blocks which
+ * stay in the L1 cache (the noise of a block is generated, then the block is mapped, demodulated and quantized in the
+ * SIMD registers). It replaces the sequence Modem_BPSK(_fast)::modulate, Channel_AWGN_LLR::add_noise,
+ * Modem_BPSK(_fast)::demodulate and Quantizer_standard/fast::process (or Quantizer_NO when Q is a floating-point
+ * representation).
+ */
+template <typename B = int, typename R = float, typename Q = R>
+class Front_end_BPSK_AWGN : public Module
+{
+protected:
+	static constexpr int block_size = 512; /*!< Number of samples per block */
+
+	const int                           N;               /*!< Size of one frame */
+	tools::Gaussian_noise_generator<R> *noise_generator; /*!< Owned by the front-end */
+	const bool                          disable_sig2;    /*!< If true, the LLRs are not scaled by 2 / sigma^2 */
+	const R                             factor;          /*!< Quantization factor (2^fixed_point_pos) */
+	const R                             val_max;         /*!< Quantization saturation */
+	      R                             sigma;
+	      R                             scale;           /*!< 2 / sigma^2 * factor */
+
+	mipp::vector<R> X_blk; // BPSK symbols of a block
+	mipp::vector<R> Y_blk; // noise then LLRs of a block
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param N:               size of one frame.
+	 * \param noise_generator: the Gaussian noise generator (deleted by the front-end).
+	 * \param fixed_point_pos: position of the fixed point in the quantized LLRs (ignored if Q is a floating-point
+	 *                         representation).
+	 * \param saturation_pos:  number of bits of the quantized LLRs (ignored if Q is a floating-point representation).
+	 * \param disable_sig2:    do not scale the LLRs by 2 / sigma^2.
+	 * \param sigma:           the noise standard deviation.
+	 * \param n_frames:        number of frames to process in the front-end.
+	 */
+	Front_end_BPSK_AWGN(const int N, tools::Gaussian_noise_generator<R> *noise_generator,
+	                    const int fixed_point_pos = 3, const int saturation_pos = 8, const bool disable_sig2 = false,
+	                    const R sigma = (R)1, const int n_frames = 1);
+
+	virtual ~Front_end_BPSK_AWGN();
+
+	int get_N() const;
+
+	R get_sigma() const;
+
+	void set_sigma(const R sigma);
+
+	/*!
+	 * \brief Modulates, adds the noise, demodulates and quantizes.
+	 *
+	 * \param X_N: a vector of bits (the codewords).
+	 * \param Y_N: a vector of LLRs (quantized if Q is a fixed-point representation).
+	 */
+	template <class AB = std::allocator<B>, class AQ = std::allocator<Q>>
+	void process(const std::vector<B,AB>& X_N, std::vector<Q,AQ>& Y_N, const int frame_id = -1)
+	{
+		if (this->N * this->n_frames != (int)X_N.size())
+		{
+			std::stringstream message;
+			message << "'X_N.size()' has to be equal to 'N' * 'n_frames' ('X_N.size()' = " << X_N.size()
+			        << ", 'N' = " << this->N << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->N * this->n_frames != (int)Y_N.size())
+		{
+			std::stringstream message;
+			message << "'Y_N.size()' has to be equal to 'N' * 'n_frames' ('Y_N.size()' = " << Y_N.size()
+			        << ", 'N' = " << this->N << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (frame_id != -1 && frame_id >= this->n_frames)
+		{
+			std::stringstream message;
+			message << "'frame_id' has to be equal to '-1' or to be smaller than 'n_frames' ('frame_id' = " 
+			        << frame_id << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->process(X_N.data(), Y_N.data(), frame_id);
+	}
+
+	virtual void process(const B *X_N, Q *Y_N, const int frame_id = -1);
+
+protected:
+	void _process(const B *X_N, Q *Y_N, const int n_samples);
+};
+}
+}
+
+#endif /* FRONT_END_BPSK_AWGN_HPP_ */
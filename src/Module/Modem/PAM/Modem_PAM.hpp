@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "Tools/Math/max.h"
+#include "Tools/Algo/Demapper/Demapper_PAM.hpp"
 
 #include "../Modem.hpp"
 
@@ -19,11 +20,13 @@ private:
 	const int nbr_symbols;
 	const R sqrt_es;
 	const bool disable_sig2;
+	const bool fast; // demodulation with the Demapper_PAM instead of the search for each bit
 	std::vector<R> constellation;
+	tools::Demapper_PAM<R> demapper;
 
 public:
 	Modem_PAM(const int N, const R sigma = (R)1, const int bits_per_symbol = 1, const bool disable_sig2 = false,
-	          const int n_frames = 1);
+	          const int n_frames = 1, const bool fast = false);
 	virtual ~Modem_PAM();
 
 	static int size_mod(const int N, const int bps)
@@ -47,6 +50,8 @@ protected:
 
 private:
 	inline R bits_to_symbol(const B* bits) const;
+	std::vector<R> get_points() const;
+	void demodulate_symbs(const R *H_N, const R *Y_N1, const R *La_N, R *Y_N2, const R inv_sigma2);
 };
 }
 }
@@ -15,7 +15,8 @@ namespace module
  */
 template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
 Modem_PAM<B,R,Q,MAX>
-::Modem_PAM(const int N, const R sigma, const int bits_per_symbol, const bool disable_sig2, const int n_frames)
+::Modem_PAM(const int N, const R sigma, const int bits_per_symbol, const bool disable_sig2, const int n_frames,
+            const bool fast)
 : Modem<B,R,Q>(N,
                (int)std::ceil((float)N / (float)bits_per_symbol),
                sigma,
@@ -24,7 +25,9 @@ Modem_PAM<B,R,Q,MAX>
   nbr_symbols    (1 << bits_per_symbol),
   sqrt_es        ((R)std::sqrt((this->nbr_symbols * this->nbr_symbols - 1.0) / 3.0)),
   disable_sig2   (disable_sig2),
-  constellation  (nbr_symbols)
+  fast           (fast),
+  constellation  (nbr_symbols),
+  demapper       (get_points(), tools::get_max_type<Q,MAX>())
 {
 	const std::string name = "Modem_PAM";
 	this->set_name(name);
@@ -113,6 +116,35 @@ void Modem_PAM<B,R,Q,MAX>
 /*
  * Demodulator
  */
+template <typename B,typename R, typename Q, tools::proto_max<Q> MAX>
+std::vector<R> Modem_PAM<B,R,Q,MAX>
+::get_points() const
+{
+	std::vector<B> bits(this->bits_per_symbol);
+	std::vector<R> points(this->nbr_symbols);
+
+	for (auto j = 0; j < this->nbr_symbols; j++)
+	{
+		for (auto l = 0; l < this->bits_per_symbol; l++)
+			bits[l] = (j >> l) & 1;
+
+		points[j] = this->bits_to_symbol(&bits[0]);
+	}
+
+	return points;
+}
+
+template <typename B,typename R, typename Q, tools::proto_max<Q> MAX>
+void Modem_PAM<B,R,Q,MAX>
+::demodulate_symbs(const R *H_N, const R *Y_N1, const R *La_N, R *Y_N2, const R inv_sigma2)
+{
+	const auto bps     = this->bits_per_symbol;
+	const auto n_symbs = (this->N + bps -1) / bps;
+	const auto n_last  = this->N - (n_symbs -1) * bps; // number of bits in the last symbol
+
+	this->demapper.demodulate(Y_N1, 1, Y_N2, bps, n_symbs, inv_sigma2, H_N, nullptr, La_N, n_last);
+}
+
 template <typename B,typename R, typename Q, tools::proto_max<Q> MAX>
 void Modem_PAM<B,R,Q,MAX>
 ::_demodulate(const Q *Y_N1, Q *Y_N2, const int frame_id)
@@ -123,6 +155,14 @@ void Modem_PAM<B,R,Q,MAX>
 	if (typeid(Q) != typeid(float) && typeid(Q) != typeid(double))
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'Q' has to be float or double.");
 
+	if (this->fast)
+	{
+		auto inv_sigma2 = disable_sig2 ? (R)1.0 : (R)(1.0 / (2 * this->sigma * this->sigma));
+
+		this->demodulate_symbs(nullptr, (const R*)Y_N1, nullptr, (R*)Y_N2, inv_sigma2);
+		return;
+	}
+
 	auto size       = this->N;
 	auto inv_sigma2 = disable_sig2 ? (Q)1.0 : (Q)(1.0 / (2 * this->sigma * this->sigma));
 
@@ -158,6 +198,14 @@ void Modem_PAM<B,R,Q,MAX>
 	if (typeid(Q) != typeid(float) && typeid(Q) != typeid(double))
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'Q' has to be float or double.");
 
+	if (this->fast)
+	{
+		auto inv_sigma2 = disable_sig2 ? (R)1.0 : (R)(1.0 / (2 * this->sigma * this->sigma));
+
+		this->demodulate_symbs(H_N, (const R*)Y_N1, nullptr, (R*)Y_N2, inv_sigma2);
+		return;
+	}
+
 	auto size       = this->N;
 	auto inv_sigma2 = disable_sig2 ? (Q)1.0 : (Q)(1.0 / (2 * this->sigma * this->sigma));
 
@@ -190,6 +238,14 @@ void Modem_PAM<B,R,Q,MAX>
 	if (typeid(Q) != typeid(float) && typeid(Q) != typeid(double))
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'Q' has to be float or double.");
 
+	if (this->fast)
+	{
+		auto inv_sigma2 = disable_sig2 ? (R)1.0 : (R)(1.0 / (2 * this->sigma * this->sigma));
+
+		this->demodulate_symbs(nullptr, (const R*)Y_N1, (const R*)Y_N2, (R*)Y_N3, inv_sigma2);
+		return;
+	}
+
 	auto size       = this->N;
 	auto inv_sigma2 = disable_sig2 ? (Q)1.0 : (Q)1.0 / (2 * this->sigma * this->sigma);
 
@@ -241,6 +297,14 @@ void Modem_PAM<B,R,Q,MAX>
 	if (typeid(Q) != typeid(float) && typeid(Q) != typeid(double))
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'Q' has to be float or double.");
 
+	if (this->fast)
+	{
+		auto inv_sigma2 = disable_sig2 ? (R)1.0 : (R)(1.0 / (2 * this->sigma * this->sigma));
+
+		this->demodulate_symbs(H_N, (const R*)Y_N1, (const R*)Y_N2, (R*)Y_N3, inv_sigma2);
+		return;
+	}
+
 	auto size       = this->N;
 	auto inv_sigma2 = disable_sig2 ? (Q)1.0 : (Q)1.0 / (2 * this->sigma * this->sigma);
 
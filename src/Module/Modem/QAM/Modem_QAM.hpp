@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "Tools/Math/max.h"
+#include "Tools/Algo/Demapper/Demapper_PAM.hpp"
 
 #include "../Modem.hpp"
 
@@ -20,11 +21,15 @@ private:
 	const int nbr_symbols;
 	const R sqrt_es;
 	const bool disable_sig2;
+	const bool fast;                       // separable demodulation instead of the search over the whole constellation
 	std::vector<std::complex<R>> constellation;
+	tools::Demapper_PAM<R>       demapper; // the I and Q dimensions are demodulated separately (if 'fast')
+	std::vector<R>               Y_eq;     // equalized symbols (demodulation with gains)
+	std::vector<R>               S_eq;     // squared modulus of the gains
 
 public:
 	Modem_QAM(const int N, const R sigma = (R)1, const int bits_per_symbol = 2, const bool disable_sig2 = false,
-	          const int n_frames = 1);
+	          const int n_frames = 1, const bool fast = false);
 	virtual ~Modem_QAM();
 
 	static int size_mod(const int N, const int bps)
@@ -48,6 +53,9 @@ protected:
 
 private:
 	inline std::complex<R> bits_to_symbol(const B* bits) const;
+	std::vector<R> get_dimension_points() const;
+	void demodulate_IQ(const R *Y_N1, const R *S_N, const R *La_N, R *Y_N2, const R inv_sigma2);
+	void equalize(const R *H_N, const R *Y_N1);
 };
 }
 }
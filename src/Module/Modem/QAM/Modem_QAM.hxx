@@ -1,4 +1,5 @@
 #include <cmath>
+#include <algorithm>
 #include <complex>
 #include <limits>
 #include <sstream>
@@ -16,7 +17,8 @@ namespace module
  */
 template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
 Modem_QAM<B,R,Q,MAX>
-::Modem_QAM(const int N, const R sigma, const int bits_per_symbol, const bool disable_sig2, const int n_frames)
+::Modem_QAM(const int N, const R sigma, const int bits_per_symbol, const bool disable_sig2, const int n_frames,
+            const bool fast)
 : Modem<B,R,Q>(N,
                (int)std::ceil((float)N / (float)bits_per_symbol) * 2,
                sigma,
@@ -25,7 +27,11 @@ Modem_QAM<B,R,Q,MAX>
   nbr_symbols    (1 << bits_per_symbol),
   sqrt_es        ((R)std::sqrt(2.0 * (this->nbr_symbols -1) / 3.0)),
   disable_sig2   (disable_sig2),
-  constellation  (nbr_symbols)
+  fast           (fast),
+  constellation  (nbr_symbols),
+  demapper       (get_dimension_points(), tools::get_max_type<Q,MAX>()),
+  Y_eq           (this->N_fil),
+  S_eq           (this->N_fil)
 {
 	const std::string name = "Modem_QAM";
 	this->set_name(name);
@@ -128,6 +134,65 @@ void Modem_QAM<B,R,Q,MAX>
 /*
  * Demodulator
  */
+template <typename B,typename R, typename Q, tools::proto_max<Q> MAX>
+std::vector<R> Modem_QAM<B,R,Q,MAX>
+::get_dimension_points() const
+{
+	// the real part of a symbol only depends on the first half of its bits
+	std::vector<B> bits(this->bits_per_symbol, (B)0);
+	std::vector<R> points(1 << (this->bits_per_symbol / 2));
+
+	for (auto j = 0; j < (int)points.size(); j++)
+	{
+		for (auto l = 0; l < this->bits_per_symbol / 2; l++)
+			bits[l] = (j >> l) & 1;
+
+		points[j] = this->bits_to_symbol(&bits[0]).real();
+	}
+
+	return points;
+}
+
+template <typename B,typename R, typename Q, tools::proto_max<Q> MAX>
+void Modem_QAM<B,R,Q,MAX>
+::demodulate_IQ(const R *Y_N1, const R *S_N, const R *La_N, R *Y_N2, const R inv_sigma2)
+{
+	const auto bps     = this->bits_per_symbol;
+	const auto bpd     = this->bits_per_symbol / 2; // bits per dimension
+	const auto n_symbs = (this->N + bps -1) / bps;
+	const auto n_last  = this->N - (n_symbs -1) * bps; // number of bits in the last symbol
+
+	// I dimension: the first half of the bits of each symbol
+	this->demapper.demodulate(Y_N1, 2, Y_N2, bps, n_symbs, inv_sigma2, nullptr, S_N, La_N, std::min(n_last, bpd));
+
+	// Q dimension: the second half of the bits of each symbol
+	const auto S_N_Q  = S_N  ? S_N  +1   : nullptr;
+	const auto La_N_Q = La_N ? La_N + bpd : nullptr;
+	if (n_last > bpd)
+		this->demapper.demodulate(Y_N1 +1, 2, Y_N2 + bpd, bps, n_symbs,    inv_sigma2, nullptr, S_N_Q, La_N_Q,
+		                          n_last - bpd);
+	else if (n_symbs > 1)
+		this->demapper.demodulate(Y_N1 +1, 2, Y_N2 + bpd, bps, n_symbs -1, inv_sigma2, nullptr, S_N_Q, La_N_Q);
+}
+
+template <typename B,typename R, typename Q, tools::proto_max<Q> MAX>
+void Modem_QAM<B,R,Q,MAX>
+::equalize(const R *H_N, const R *Y_N1)
+{
+	// |y - h * s|^2 = |h|^2 * |y * conj(h) / |h|^2 - s|^2
+	for (auto k = 0; k < this->N_fil / 2; k++)
+	{
+		const auto h2 = H_N[2*k] * H_N[2*k] + H_N[2*k+1] * H_N[2*k+1];
+		const auto yr = Y_N1[2*k] * H_N[2*k   ] + Y_N1[2*k+1] * H_N[2*k+1];
+		const auto yi = Y_N1[2*k+1] * H_N[2*k] - Y_N1[2*k  ] * H_N[2*k+1];
+
+		this->Y_eq[2*k   ] = (h2 != (R)0) ? yr / h2 : (R)0;
+		this->Y_eq[2*k +1] = (h2 != (R)0) ? yi / h2 : (R)0;
+		this->S_eq[2*k   ] = h2;
+		this->S_eq[2*k +1] = h2;
+	}
+}
+
 template <typename B,typename R, typename Q, tools::proto_max<Q> MAX>
 void Modem_QAM<B,R,Q,MAX>
 ::_demodulate(const Q *Y_N1, Q *Y_N2, const int frame_id)
@@ -138,6 +203,14 @@ void Modem_QAM<B,R,Q,MAX>
 	if (typeid(Q) != typeid(float) && typeid(Q) != typeid(double))
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'Q' has to be float or double.");
 
+	if (this->fast)
+	{
+		auto inv_sigma2 = disable_sig2 ? (R)1.0 : (R)((R)1.0 / (this->sigma * this->sigma));
+
+		this->demodulate_IQ((const R*)Y_N1, nullptr, nullptr, (R*)Y_N2, inv_sigma2);
+		return;
+	}
+
 	auto size       = this->N;
 	auto inv_sigma2 = disable_sig2 ? (Q)1.0 : (Q)((Q)1.0 / (this->sigma * this->sigma));
 
@@ -162,9 +235,6 @@ void Modem_QAM<B,R,Q,MAX>
 	}
 }
 
-/*
- * Demodulator
- */
 template <typename B,typename R, typename Q, tools::proto_max<Q> MAX>
 void Modem_QAM<B,R,Q,MAX>
 ::_demodulate_wg(const R *H_N, const Q *Y_N1, Q *Y_N2, const int frame_id)
@@ -175,6 +245,15 @@ void Modem_QAM<B,R,Q,MAX>
 	if (typeid(Q) != typeid(float) && typeid(Q) != typeid(double))
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'Q' has to be float or double.");
 
+	if (this->fast)
+	{
+		auto inv_sigma2 = disable_sig2 ? (R)1.0 : (R)((R)1.0 / (this->sigma * this->sigma));
+
+		this->equalize(H_N, (const R*)Y_N1);
+		this->demodulate_IQ(this->Y_eq.data(), this->S_eq.data(), nullptr, (R*)Y_N2, inv_sigma2);
+		return;
+	}
+
 	auto size       = this->N;
 	auto inv_sigma2 = disable_sig2 ? (Q)1.0 : (Q)((Q)1.0 / (this->sigma * this->sigma));
 
@@ -212,6 +291,14 @@ void Modem_QAM<B,R,Q,MAX>
 	if (typeid(Q) != typeid(float) && typeid(Q) != typeid(double))
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'Q' has to be float or double.");
 
+	if (this->fast)
+	{
+		auto inv_sigma2 = disable_sig2 ? (R)1.0 : (R)1.0 / (this->sigma * this->sigma);
+
+		this->demodulate_IQ((const R*)Y_N1, nullptr, (const R*)Y_N2, (R*)Y_N3, inv_sigma2);
+		return;
+	}
+
 	auto size       = this->N;
 	auto inv_sigma2 = disable_sig2 ? (Q)1.0 : (Q)1.0 / (this->sigma * this->sigma);
 
@@ -265,6 +352,15 @@ void Modem_QAM<B,R,Q,MAX>
 	if (typeid(Q) != typeid(float) && typeid(Q) != typeid(double))
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'Q' has to be float or double.");
 
+	if (this->fast)
+	{
+		auto inv_sigma2 = disable_sig2 ? (R)1.0 : (R)1.0 / (this->sigma * this->sigma);
+
+		this->equalize(H_N, (const R*)Y_N1);
+		this->demodulate_IQ(this->Y_eq.data(), this->S_eq.data(), (const R*)Y_N2, (R*)Y_N3, inv_sigma2);
+		return;
+	}
+
 	auto size       = this->N;
 	auto inv_sigma2 = disable_sig2 ? (Q)1.0 : (Q)1.0 / (this->sigma * this->sigma);
 
@@ -308,6 +404,7 @@ void Modem_QAM<B,R,Q,MAX>
 		Y_N3[n] = (L0 - L1);
 	}
 }
+
 /*
 * \brief Soft Mapper
 */
@@ -1,11 +1,26 @@
 #include <string>
 #include <vector>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
 #include <stdexcept>
 
 #include "Monitor_BFER.hpp"
 
 using namespace aff3ct::module;
 
+namespace
+{
+inline int popcount64(const uint64_t x)
+{
+#ifdef _MSC_VER
+	return (int)__popcnt64(x);
+#else
+	return __builtin_popcountll(x);
+#endif
+}
+}
+
 template <typename B>
 Monitor_BFER<B>
 ::Monitor_BFER(const int size, const unsigned max_fe, const int n_frames)
@@ -13,18 +28,29 @@ Monitor_BFER<B>
   max_fe(max_fe),
   n_bit_errors(0),
   n_frame_errors(0),
-  n_analyzed_frames(0)
+  n_analyzed_frames(0),
+  n_fe_shared(nullptr),
+  fe_limit_flag(nullptr)
 {
 	const std::string name = "Monitor_BFER";
 	this->set_name(name);
 	
-	auto &p = this->create_task("check_errors", mnt::tsk::check_errors);
-	auto &ps_U = this->template create_socket_in<B>(p, "U", this->size * this->n_frames);
-	auto &ps_V = this->template create_socket_in<B>(p, "V", this->size * this->n_frames);
-	this->create_codelet(p, [this, &ps_U, &ps_V]() -> int
+	auto &p1 = this->create_task("check_errors", mnt::tsk::check_errors);
+	auto &p1s_U = this->template create_socket_in<B>(p1, "U", this->size * this->n_frames);
+	auto &p1s_V = this->template create_socket_in<B>(p1, "V", this->size * this->n_frames);
+	this->create_codelet(p1, [this, &p1s_U, &p1s_V]() -> int
 	{
-		return this->check_errors(static_cast<B*>(ps_U.get_dataptr()),
-		                          static_cast<B*>(ps_V.get_dataptr()));
+		return this->check_errors(static_cast<B*>(p1s_U.get_dataptr()),
+		                          static_cast<B*>(p1s_V.get_dataptr()));
+	});
+
+	auto &p2 = this->create_task("check_errors_packed", mnt::tsk::check_errors_packed);
+	auto &p2s_U = this->template create_socket_in<B>(p2, "U", this->size * this->n_frames);
+	auto &p2s_V = this->template create_socket_in<B>(p2, "V", this->size * this->n_frames);
+	this->create_codelet(p2, [this, &p2s_U, &p2s_V]() -> int
+	{
+		return this->check_errors_packed(static_cast<B*>(p2s_U.get_dataptr()),
+		                                 static_cast<B*>(p2s_V.get_dataptr()));
 	});
 }
 
@@ -52,10 +78,70 @@ int Monitor_BFER<B>
 	for (auto b = 0; b < this->size; b++)
 		bit_errors_count += !U[b] != !V[b];
 
+	this->update_counters(bit_errors_count, frame_id);
+
+	return bit_errors_count;
+}
+
+template <typename B>
+int Monitor_BFER<B>
+::check_errors_packed(const B *U, const B *V, const int frame_id)
+{
+	const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+	const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+	int n_be = 0;
+	for (auto f = f_start; f < f_stop; f++)
+		n_be += this->_check_errors_packed(U + f * this->size,
+		                                   V + f * this->size,
+		                                   f);
+
+	return n_be;
+}
+
+template <typename B>
+int Monitor_BFER<B>
+::_check_errors_packed(const B *U, const B *V, const int frame_id)
+{
+	const auto bytes_U = (const unsigned char*)U;
+	const auto bytes_V = (const unsigned char*)V;
+	const auto n_bytes = (this->size + 7) / 8;
+
+	// the bit errors are counted 64 by 64 with a XOR and a popcount
+	auto bit_errors_count = 0;
+	auto i = 0;
+	for (; i + 8 <= n_bytes; i += 8)
+	{
+		uint64_t u, v;
+		std::memcpy(&u, bytes_U + i, sizeof(uint64_t));
+		std::memcpy(&v, bytes_V + i, sizeof(uint64_t));
+		bit_errors_count += popcount64(u ^ v);
+	}
+	for (; i < n_bytes; i++)
+	{
+		// the bits after the last bit of the frame are ignored
+		const auto n_bits = std::min(8, this->size - i * 8);
+		const auto mask   = (unsigned)((1 << n_bits) -1);
+		bit_errors_count += popcount64((bytes_U[i] ^ bytes_V[i]) & mask);
+	}
+
+	this->update_counters(bit_errors_count, frame_id);
+
+	return bit_errors_count;
+}
+
+template <typename B>
+void Monitor_BFER<B>
+::update_counters(const int bit_errors_count, const int frame_id)
+{
+	// relaxed atomics are enough here: this thread is the only writer of the counters
 	if (bit_errors_count)
 	{
-		n_bit_errors += bit_errors_count;
-		n_frame_errors++;
+		n_bit_errors  .store(n_bit_errors  .load(std::memory_order_relaxed) + bit_errors_count, std::memory_order_relaxed);
+		n_frame_errors.store(n_frame_errors.load(std::memory_order_relaxed) + 1,                std::memory_order_relaxed);
+
+		if (n_fe_shared != nullptr && n_fe_shared->fetch_add(1, std::memory_order_relaxed) +1 == (unsigned long long)max_fe)
+			fe_limit_flag->store(true, std::memory_order_relaxed);
 
 		for (auto c : this->callbacks_fe)
 			c(bit_errors_count, frame_id);
@@ -65,13 +151,11 @@ int Monitor_BFER<B>
 				c();
 	}
 
-	n_analyzed_frames++;
+	n_analyzed_frames.store(n_analyzed_frames.load(std::memory_order_relaxed) +1, std::memory_order_relaxed);
 
 	if (frame_id == this->n_frames -1)
 		for (auto c : this->callbacks_check)
 			c();
-
-	return bit_errors_count;
 }
 
 template <typename B>
@@ -92,21 +176,21 @@ template <typename B>
 unsigned long long Monitor_BFER<B>
 ::get_n_analyzed_fra() const
 {
-	return n_analyzed_frames;
+	return n_analyzed_frames.load(std::memory_order_relaxed);
 }
 
 template <typename B>
 unsigned long long Monitor_BFER<B>
 ::get_n_fe() const
 {
-	return n_frame_errors;
+	return n_frame_errors.load(std::memory_order_relaxed);
 }
 
 template <typename B>
 unsigned long long Monitor_BFER<B>
 ::get_n_be() const
 {
-	return n_bit_errors;
+	return n_bit_errors.load(std::memory_order_relaxed);
 }
 
 template <typename B>
@@ -135,6 +219,21 @@ float Monitor_BFER<B>
 	return t_ber;
 }
 
+template <typename B>
+void Monitor_BFER<B>
+::share_fe_counter(std::atomic<unsigned long long> *n_fe_shared, std::atomic<bool> *fe_limit_flag)
+{
+	if (n_fe_shared != nullptr && fe_limit_flag == nullptr)
+	{
+		std::stringstream message;
+		message << "'fe_limit_flag' can't be null when 'n_fe_shared' is not null.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->n_fe_shared   = n_fe_shared;
+	this->fe_limit_flag = fe_limit_flag;
+}
+
 template <typename B>
 void Monitor_BFER<B>
 ::add_handler_fe(std::function<void(unsigned, int)> callback)
@@ -1,6 +1,7 @@
 #ifndef MONITOR_STD_HPP_
 #define MONITOR_STD_HPP_
 
+#include <atomic>
 #include <chrono>
 #include <vector>
 #include <functional>
@@ -15,11 +16,20 @@ template <typename B = int>
 class Monitor_BFER : public Monitor
 {
 protected:
+	static constexpr size_t cache_line_size = 64;
+
 	const unsigned max_fe;
 
-	unsigned long long n_bit_errors;
-	unsigned long long n_frame_errors;
-	unsigned long long n_analyzed_frames;
+	// the counters are only written by the thread which owns the monitor but they can be read at any time by the
+	// other threads: they are isolated on their own cache line to avoid false sharing with the other attributes
+	char pad_front[cache_line_size];
+	std::atomic<unsigned long long> n_bit_errors;
+	std::atomic<unsigned long long> n_frame_errors;
+	std::atomic<unsigned long long> n_analyzed_frames;
+	char pad_back[cache_line_size - 3 * sizeof(std::atomic<unsigned long long>)];
+
+	std::atomic<unsigned long long> *n_fe_shared;   // frame errors counter shared by several monitors (can be null)
+	std::atomic<bool>               *fe_limit_flag; // raised when 'n_fe_shared' reaches the frame errors limit
 
 	std::vector<std::function<void(unsigned, int )>> callbacks_fe;
 	std::vector<std::function<void(          void)>> callbacks_check;
@@ -69,6 +79,46 @@ public:
 
 	virtual int check_errors(const B *U, const B *V, const int frame_id = -1);
 
+	/*!
+	 * \brief Compares two messages of packed bits and counts the number of frame errors and bit errors.
+	 *
+	 * The frames keep the stride of the unpacked frames, their bits are packed in their first bytes.
+	 *
+	 * \param U: the original message (from the Source or the CRC).
+	 * \param V: the decoded message (from the Decoder).
+	 */
+	template <class A = std::allocator<B>>
+	int check_errors_packed(const std::vector<B,A>& U, const std::vector<B,A>& V, const int frame_id = -1)
+	{
+		if ((int)U.size() != this->size * this->n_frames)
+		{
+			std::stringstream message;
+			message << "'U.size()' has to be equal to 'size' * 'n_frames' ('U.size()' = " << U.size()
+			        << ", 'size' = " << this->size << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if ((int)V.size() != this->size * this->n_frames)
+		{
+			std::stringstream message;
+			message << "'V.size()' has to be equal to 'size' * 'n_frames' ('V.size()' = " << V.size()
+			        << ", 'size' = " << this->size << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (frame_id != -1 && frame_id >= this->n_frames)
+		{
+			std::stringstream message;
+			message << "'frame_id' has to be equal to '-1' or to be smaller than 'n_frames' ('frame_id' = " 
+			        << frame_id << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		return this->check_errors_packed(U.data(), V.data(), frame_id);
+	}
+
+	virtual int check_errors_packed(const B *U, const B *V, const int frame_id = -1);
+
 	virtual bool fe_limit_achieved();
 	unsigned get_fe_limit() const;
 
@@ -79,6 +129,18 @@ public:
 	float get_fer() const;
 	float get_ber() const;
 
+	/*!
+	 * \brief Shares a frame errors counter between several monitors.
+	 *
+	 * Each time a frame error is detected the shared counter is incremented, the monitor which makes the counter
+	 * reach the frame errors limit raises the flag. This way, the other threads can check if the limit is achieved
+	 * without reading the counters of all the monitors.
+	 *
+	 * \param n_fe_shared:   the frame errors counter shared by the monitors (nullptr to disable the sharing).
+	 * \param fe_limit_flag: the flag raised when the frame errors limit is achieved.
+	 */
+	void share_fe_counter(std::atomic<unsigned long long> *n_fe_shared, std::atomic<bool> *fe_limit_flag);
+
 	virtual void add_handler_fe               (std::function<void(unsigned, int )> callback);
 	virtual void add_handler_check            (std::function<void(          void)> callback);
 	virtual void add_handler_fe_limit_achieved(std::function<void(          void)> callback);
@@ -87,7 +149,10 @@ public:
 	virtual void clear_callbacks();
 
 protected:
-	virtual int _check_errors(const B *U, const B *V, const int frame_id);
+	virtual int _check_errors       (const B *U, const B *V, const int frame_id);
+	virtual int _check_errors_packed(const B *U, const B *V, const int frame_id);
+
+	void update_counters(const int bit_errors_count, const int frame_id);
 };
 }
 }
@@ -18,7 +18,9 @@ Monitor_BFER_reduction<B>
                   (monitors.size() && monitors[0]) ? monitors[0]->get_fe_limit() : 1,
                   (monitors.size() && monitors[0]) ? monitors[0]->get_n_frames() : 1),
   n_analyzed_frames_historic(0),
-  monitors(monitors)
+  monitors(monitors),
+  n_fe_total(0),
+  fe_limit(this->get_fe_limit() == 0)
 {
 	const std::string name = "Monitor_BFER_reduction";
 	this->set_name(name);
@@ -66,19 +68,24 @@ Monitor_BFER_reduction<B>
 			throw tools::logic_error(__FILE__, __LINE__, __func__, message.str());
 		}
 	}
+
+	for (auto m : monitors)
+		m->share_fe_counter(&this->n_fe_total, &this->fe_limit);
 }
 
 template <typename B>
 Monitor_BFER_reduction<B>
 ::~Monitor_BFER_reduction()
 {
+	for (auto m : monitors)
+		m->share_fe_counter(nullptr, nullptr);
 }
 
 template <typename B>
 unsigned long long Monitor_BFER_reduction<B>
 ::get_n_analyzed_fra() const
 {
-	unsigned long long cur_fra = this->n_analyzed_frames;
+	unsigned long long cur_fra = this->n_analyzed_frames.load(std::memory_order_relaxed);
 	for (unsigned i = 0; i < monitors.size(); i++)
 		cur_fra += monitors[i]->get_n_analyzed_fra();
 
@@ -96,24 +103,38 @@ template <typename B>
 unsigned long long Monitor_BFER_reduction<B>
 ::get_n_fe() const
 {
-	auto cur_fe = this->n_frame_errors;
+	auto cur_fe = this->n_frame_errors.load(std::memory_order_relaxed);
 	for (unsigned i = 0; i < monitors.size(); i++)
 		cur_fe += monitors[i]->get_n_fe();
 
 	return cur_fe;
 }
 
+template <typename B>
+unsigned long long Monitor_BFER_reduction<B>
+::get_n_fe_total() const
+{
+	return this->n_fe_total.load(std::memory_order_relaxed);
+}
+
 template <typename B>
 unsigned long long Monitor_BFER_reduction<B>
 ::get_n_be() const
 {
-	auto cur_be = this->n_bit_errors;
+	auto cur_be = this->n_bit_errors.load(std::memory_order_relaxed);
 	for (unsigned i = 0; i < monitors.size(); i++)
 		cur_be += monitors[i]->get_n_be();
 
 	return cur_be;
 }
 
+template <typename B>
+bool Monitor_BFER_reduction<B>
+::fe_limit_achieved()
+{
+	return this->fe_limit.load(std::memory_order_relaxed) || Monitor::interrupt;
+}
+
 template <typename B>
 void Monitor_BFER_reduction<B>
 ::reset()
@@ -122,6 +143,9 @@ void Monitor_BFER_reduction<B>
 	Monitor_BFER<B>::reset();
 	for (auto m : monitors)
 		m->reset();
+
+	this->n_fe_total = 0;
+	this->fe_limit   = this->get_fe_limit() == 0;
 }
 
 template <typename B>
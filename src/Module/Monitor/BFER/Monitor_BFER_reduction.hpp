@@ -1,6 +1,7 @@
 #ifndef MONITOR_REDUCTION_HPP_
 #define MONITOR_REDUCTION_HPP_
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -17,6 +18,13 @@ private:
 	unsigned long long n_analyzed_frames_historic;
 	std::vector<Monitor_BFER<B>*> monitors;
 
+	// frame errors of all the monitors and the flag raised when the limit is achieved (on their own cache lines)
+	char pad_front[Monitor_BFER<B>::cache_line_size];
+	std::atomic<unsigned long long> n_fe_total;
+	char pad_middle[Monitor_BFER<B>::cache_line_size - sizeof(std::atomic<unsigned long long>)];
+	std::atomic<bool> fe_limit;
+	char pad_back[Monitor_BFER<B>::cache_line_size - sizeof(std::atomic<bool>)];
+
 public:
 	Monitor_BFER_reduction(const std::vector<Monitor_BFER<B>*> &monitors);
 	virtual ~Monitor_BFER_reduction();
@@ -26,6 +34,19 @@ public:
 	unsigned long long get_n_fe                   () const;
 	unsigned long long get_n_be                   () const;
 
+	/*!
+	 * \brief Gives the frame errors of the monitors from their shared counter (constant time, unlike 'get_n_fe' which
+	 *        reduces the counters of all the monitors).
+	 */
+	unsigned long long get_n_fe_total() const;
+
+	/*!
+	 * \brief Tells if the frame errors limit is achieved by the sum of the monitors (constant time).
+	 *
+	 * \return true if the limit is achieved or if the simulation has been interrupted.
+	 */
+	virtual bool fe_limit_achieved();
+
 	virtual void reset();
 	virtual void clear_callbacks();
 };
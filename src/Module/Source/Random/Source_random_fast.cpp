@@ -1,4 +1,6 @@
 #include <cstdlib>
+#include <cstring>
+#include <algorithm>
 #include <mipp.h>
 
 #include "Source_random_fast.hpp"
@@ -67,6 +69,32 @@ void Source_random_fast<B>
 	}
 }
 
+template <typename B>
+void Source_random_fast<B>
+::_generate_packed(B *U_K, const int frame_id)
+{
+	// the random words are directly the packed bits
+	const auto n_bytes = (unsigned)((this->K + 7) / 8);
+	auto bytes = (unsigned char*)U_K;
+
+	// vectorized loop
+	const auto period = (unsigned)(mipp::nElReg<int>() * sizeof(int));
+	const auto vec_loop_size = (n_bytes / period) * period;
+	for (unsigned i = 0; i < vec_loop_size; i += period)
+		mt19937_simd.rand_s32().storeu((int*)(bytes + i));
+
+	// remaining scalar operations
+	for (unsigned i = vec_loop_size; i < n_bytes; i += sizeof(int))
+	{
+		const auto randoms = mt19937.rand_u32();
+		std::memcpy(bytes + i, &randoms, std::min((unsigned)sizeof(int), n_bytes - i));
+	}
+
+	// the bits after the last information bit are set to 0
+	if (this->K % 8)
+		bytes[n_bytes -1] &= (unsigned char)((1 << (this->K % 8)) -1);
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
@@ -14,6 +14,7 @@
 #include <iostream>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
 
 #include "Module/Module.hpp"
 
@@ -25,12 +26,13 @@ namespace module
 	{
 		namespace tsk
 		{
-			enum list { generate, SIZE };
+			enum list { generate, generate_packed, SIZE };
 		}
 
 		namespace sck
 		{
-			namespace generate { enum list { U_K, SIZE }; }
+			namespace generate        { enum list { U_K, SIZE }; }
+			namespace generate_packed { enum list { U_K, SIZE }; }
 		}
 	}
 
@@ -71,11 +73,20 @@ public:
 			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 		}
 
-		auto &p = this->create_task("generate");
-		auto &ps_U_K = this->template create_socket_out<B>(p, "U_K", this->K * this->n_frames);
-		this->create_codelet(p, [this, &ps_U_K]() -> int
+		auto &p1 = this->create_task("generate");
+		auto &p1s_U_K = this->template create_socket_out<B>(p1, "U_K", this->K * this->n_frames);
+		this->create_codelet(p1, [this, &p1s_U_K]() -> int
 		{
-			this->generate(static_cast<B*>(ps_U_K.get_dataptr()));
+			this->generate(static_cast<B*>(p1s_U_K.get_dataptr()));
+
+			return 0;
+		});
+
+		auto &p2 = this->create_task("generate_packed");
+		auto &p2s_U_K = this->template create_socket_out<B>(p2, "U_K", this->K * this->n_frames);
+		this->create_codelet(p2, [this, &p2s_U_K]() -> int
+		{
+			this->generate_packed(static_cast<B*>(p2s_U_K.get_dataptr()));
 
 			return 0;
 		});
@@ -121,11 +132,46 @@ public:
 			this->_generate(U_K + f * this->K, f);
 	}
 
+	/*!
+	 * \brief Fulfills a vector with packed bits.
+	 *
+	 * \param U_K: a vector of packed bits to fill (the frames keep the stride of the unpacked frames, the 'K' bits of a
+	 *             frame are packed in its first ceil('K' / 8) bytes and the other bits of the last byte are set to 0).
+	 */
+	template <class A = std::allocator<B>>
+	void generate_packed(std::vector<B,A>& U_K, const int frame_id = -1)
+	{
+		if (this->K * this->n_frames != (int)U_K.size())
+		{
+			std::stringstream message;
+			message << "'U_K.size()' has to be equal to 'K' * 'n_frames' ('U_K.size()' = " << U_K.size()
+			        << ", 'K' = " << this->K << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->generate_packed(U_K.data(), frame_id);
+	}
+
+	virtual void generate_packed(B *U_K, const int frame_id = -1)
+	{
+		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+		for (auto f = f_start; f < f_stop; f++)
+			this->_generate_packed(U_K + f * this->K, f);
+	}
+
 protected:
 	virtual void _generate(B *U_K, const int frame_id)
 	{
 		throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
 	}
+
+	virtual void _generate_packed(B *U_K, const int frame_id)
+	{
+		this->_generate(U_K, frame_id);
+		tools::Bit_packer<B>::pack(U_K, this->K);
+	}
 };
 }
 }
@@ -4,6 +4,7 @@
 
 #include "Tools/Display/bash_tools.h"
 #include "Tools/Display/Frame_trace/Frame_trace.hpp"
+#include "Tools/Perf/Timer/Cycle_counter.hpp"
 
 #include "Module.hpp"
 #include "Socket.hpp"
@@ -12,6 +13,8 @@
 using namespace aff3ct;
 using namespace aff3ct::module;
 
+constexpr int Task::n_timer_bins;
+
 Task::Task(const Module &module, const std::string &name, const bool autoalloc, const bool autoexec,
            const bool stats, const bool fast, const bool debug)
 : module(module),
@@ -78,7 +81,13 @@ void Task::set_stats(const bool stats)
 	this->stats = stats;
 
 	if (this->stats)
+	{
 		this->set_fast(false);
+#ifdef ENABLE_SUBTASK_TIMERS
+		// calibrate the cycle counter now rather than during the first measure of a sub-task
+		tools::Cycle_counter::get_ns_per_tick();
+#endif
+	}
 }
 
 void Task::set_fast(const bool fast)
@@ -429,6 +438,11 @@ const std::vector<std::chrono::nanoseconds>& Task::get_timers_max() const
 	return this->timers_max;
 }
 
+const std::vector<std::vector<uint32_t>>& Task::get_timers_hist() const
+{
+	return this->timers_hist;
+}
+
 Socket_type Task::get_socket_type(const Socket &s) const
 {
 	for (size_t i = 0; i < sockets.size(); i++)
@@ -448,6 +462,7 @@ void Task::register_timer(const std::string &name)
 	this->timers_total  .push_back(std::chrono::nanoseconds(0));
 	this->timers_max    .push_back(std::chrono::nanoseconds(0));
 	this->timers_min    .push_back(std::chrono::nanoseconds(0));
+	this->timers_hist   .push_back(std::vector<uint32_t>(Task::n_timer_bins, 0));
 }
 
 void Task::reset_stats()
@@ -461,6 +476,7 @@ void Task::reset_stats()
 	for (auto &x : this->timers_total  ) x = std::chrono::nanoseconds(0);
 	for (auto &x : this->timers_min    ) x = std::chrono::nanoseconds(0);
 	for (auto &x : this->timers_max    ) x = std::chrono::nanoseconds(0);
+	for (auto &x : this->timers_hist   ) std::fill(x.begin(), x.end(), 0);
 }
 
 // ==================================================================================== explicit template instantiation
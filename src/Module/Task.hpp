@@ -61,11 +61,14 @@ protected:
 	std::vector<std::chrono::nanoseconds> timers_total;
 	std::vector<std::chrono::nanoseconds> timers_min;
 	std::vector<std::chrono::nanoseconds> timers_max;
+	std::vector<std::vector<uint32_t>   > timers_hist; // bin 'b' counts the durations in [2^(b-1), 2^b[ ns
 
 	Socket* last_input_socket;
 	std::vector<Socket_type> socket_type;
 
 public:
+	static constexpr int n_timer_bins = 65; // number of bins in the histograms of the timers
+
 	std::vector<Socket*> sockets;
 
 	Task(const Module &module,
@@ -113,6 +116,7 @@ public:
 	const std::vector<std::chrono::nanoseconds>& get_timers_total  () const;
 	const std::vector<std::chrono::nanoseconds>& get_timers_min    () const;
 	const std::vector<std::chrono::nanoseconds>& get_timers_max    () const;
+	const std::vector<std::vector<uint32_t>>   & get_timers_hist   () const;
 
 	int exec();
 
@@ -127,7 +131,7 @@ public:
 		{
 			this->timers_n_calls[id]++;
 			this->timers_total[id] += duration;
-			if (this->n_calls)
+			if (this->timers_n_calls[id] > 1)
 			{
 				this->timers_max[id] = std::max(this->timers_max[id], duration);
 				this->timers_min[id] = std::min(this->timers_min[id], duration);
@@ -137,6 +141,11 @@ public:
 				this->timers_max[id] = duration;
 				this->timers_min[id] = duration;
 			}
+
+			auto ns  = (uint64_t)std::max(duration.count(), (std::chrono::nanoseconds::rep)0);
+			auto bin = 0;
+			while (ns) { ns >>= 1; bin++; }
+			this->timers_hist[id][bin]++;
 		}
 	}
 
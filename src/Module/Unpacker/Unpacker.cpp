@@ -0,0 +1,70 @@
+#include "Tools/Algo/Bit_packer.hpp"
+
+#include "Unpacker.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B>
+Unpacker<B>
+::Unpacker(const int N, const int n_frames)
+: Module(n_frames), N(N)
+{
+	const std::string name = "Unpacker";
+	this->set_name(name);
+	this->set_short_name(name);
+
+	if (N <= 0)
+	{
+		std::stringstream message;
+		message << "'N' has to be greater than 0 ('N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto &p = this->create_task("unpack");
+	auto &ps_X_N1 = this->template create_socket_in <B>(p, "X_N1", this->N * this->n_frames);
+	auto &ps_X_N2 = this->template create_socket_out<B>(p, "X_N2", this->N * this->n_frames);
+	this->create_codelet(p, [this, &ps_X_N1, &ps_X_N2]() -> int
+	{
+		this->unpack(static_cast<B*>(ps_X_N1.get_dataptr()),
+		             static_cast<B*>(ps_X_N2.get_dataptr()));
+
+		return 0;
+	});
+}
+
+template <typename B>
+Unpacker<B>
+::~Unpacker()
+{
+}
+
+template <typename B>
+int Unpacker<B>
+::get_N() const
+{
+	return this->N;
+}
+
+template <typename B>
+void Unpacker<B>
+::unpack(const B *X_N1, B *X_N2, const int frame_id)
+{
+	const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+	const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+	for (auto f = f_start; f < f_stop; f++)
+		tools::Bit_packer<B>::unpack(X_N1 + f * this->N, X_N2 + f * this->N, this->N);
+}
+
+// ==================================================================================== explicit template instantiation 
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Unpacker<B_8>;
+template class aff3ct::module::Unpacker<B_16>;
+template class aff3ct::module::Unpacker<B_32>;
+template class aff3ct::module::Unpacker<B_64>;
+#else
+template class aff3ct::module::Unpacker<B>;
+#endif
+// ==================================================================================== explicit template instantiation
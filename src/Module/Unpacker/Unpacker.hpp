@@ -0,0 +1,106 @@
+/*!
+ * \file
+ * \brief Unpacks the frames of packed bits.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef UNPACKER_HPP_
+#define UNPACKER_HPP_
+
+#include <vector>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Module/Module.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+	namespace upk
+	{
+		namespace tsk
+		{
+			enum list { unpack, SIZE };
+		}
+
+		namespace sck
+		{
+			namespace unpack { enum list { X_N1, X_N2, SIZE }; }
+		}
+	}
+
+/*!
+ * \class Unpacker
+ *
+ * \brief Unpacks the frames of packed bits.
+ *
+ * \tparam B: type of the bits.
+ *
+ * The packed frames keep the stride of the unpacked frames: the 'N' bits of a frame are packed in its first
+ * ceil('N' / 8) bytes (LSB first). It links the packed sockets of the Source, the CRC and the Encoder
+ * ('generate_packed', 'build_packed' and 'encode_packed') to the modules which consume one bit per element.
+ */
+template <typename B = int>
+class Unpacker : public Module
+{
+protected:
+	const int N; /*!< Number of bits in one frame */
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param N:        number of bits in one frame.
+	 * \param n_frames: number of frames to process in the Unpacker.
+	 */
+	Unpacker(const int N, const int n_frames = 1);
+
+	virtual ~Unpacker();
+
+	int get_N() const;
+
+	/*!
+	 * \brief Unpacks the bits.
+	 *
+	 * \param X_N1: a vector of packed bits.
+	 * \param X_N2: a vector of unpacked bits (one bit per element).
+	 */
+	template <class A = std::allocator<B>>
+	void unpack(const std::vector<B,A>& X_N1, std::vector<B,A>& X_N2, const int frame_id = -1)
+	{
+		if (this->N * this->n_frames != (int)X_N1.size())
+		{
+			std::stringstream message;
+			message << "'X_N1.size()' has to be equal to 'N' * 'n_frames' ('X_N1.size()' = " << X_N1.size()
+			        << ", 'N' = " << this->N << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->N * this->n_frames != (int)X_N2.size())
+		{
+			std::stringstream message;
+			message << "'X_N2.size()' has to be equal to 'N' * 'n_frames' ('X_N2.size()' = " << X_N2.size()
+			        << ", 'N' = " << this->N << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (frame_id != -1 && frame_id >= this->n_frames)
+		{
+			std::stringstream message;
+			message << "'frame_id' has to be equal to '-1' or to be smaller than 'n_frames' ('frame_id' = " 
+			        << frame_id << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->unpack(X_N1.data(), X_N2.data(), frame_id);
+	}
+
+	virtual void unpack(const B *X_N1, B *X_N2, const int frame_id = -1);
+};
+}
+}
+
+#endif /* UNPACKER_HPP_ */
@@ -1,4 +1,5 @@
 #include <cmath>
+#include <limits>
 #include <thread>
 #include <string>
 #include <sstream>
@@ -6,6 +7,7 @@
 #include <functional>
 
 #include "Tools/general_utils.h"
+#include "Tools/Algo/SNR_sweep/SNR_sweep.hpp"
 #include "Tools/system_functions.h"
 #include "Tools/Display/bash_tools.h"
 #include "Tools/Exception/exception.hpp"
@@ -26,7 +28,7 @@ using namespace aff3ct::simulation;
 
 template <typename B, typename R, typename Q>
 BFER<B,R,Q>
-::BFER(const factory::BFER::parameters& params_BFER)
+::BFER(const factory::BFER::parameters& params_BFER, const int n_groups)
 : Simulation(params_BFER),
   params_BFER(params_BFER),
 
@@ -41,11 +43,16 @@ BFER<B,R,Q>
 
   max_fra(0),
 
-  monitor    (params_BFER.n_threads, nullptr),
-  monitor_red(                       nullptr),
-  dumper     (params_BFER.n_threads, nullptr),
-  dumper_red (                       nullptr),
-  terminal   (                       nullptr)
+  monitor        (params_BFER.n_threads,              nullptr),
+  monitor_red    (                                   nullptr),
+  n_groups       (n_groups                                  ),
+  thread_group   (params_BFER.n_threads,              0      ),
+  monitor_red_grp(n_groups > 1 ? n_groups : 0,        nullptr),
+  sigma_grp      (n_groups > 1 ? n_groups : 0,        0.f    ),
+  dumper       (params_BFER.n_threads, nullptr),
+  dumper_writer(                       nullptr),
+  terminal     (                       nullptr),
+  terminal_rec (                       nullptr)
 {
 	if (params_BFER.n_threads < 1)
 	{
@@ -54,16 +61,58 @@ BFER<B,R,Q>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	if (params_BFER.snr_adapt > 0.f &&
+	    (params_BFER.snr_step_min <= 0.f || params_BFER.snr_step_min > params_BFER.snr_step))
+	{
+		std::stringstream message;
+		message << "'snr_step_min' has to be greater than 0 and smaller or equal to 'snr_step' ('snr_step_min' = "
+		        << params_BFER.snr_step_min << ", 'snr_step' = " << params_BFER.snr_step << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_groups < 1 || n_groups > params_BFER.n_threads)
+	{
+		std::stringstream message;
+		message << "'n_groups' has to be between 1 and 'n_threads' ('n_groups' = " << n_groups
+		        << ", 'n_threads' = " << params_BFER.n_threads << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_groups > 1)
+	{
+#ifdef ENABLE_MPI
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The parallel SNR points are not supported with "
+		                                                            "MPI.");
+#endif
+		// the dumpers, the records, the statistics and the debug mode are all bound to a single SNR point
+		if (params_BFER.err_track_enable || params_BFER.err_track_revert || params_BFER.debug ||
+		    params_BFER.statistics || !params_BFER.ter->rec_path.empty())
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The parallel SNR points do not support the "
+			                                                            "tracking of the bad frames, the records, the "
+			                                                            "statistics and the debug mode.");
+	}
+
+	for (auto tid = 0; tid < params_BFER.n_threads; tid++)
+		this->thread_group[tid] = tid * n_groups / params_BFER.n_threads;
+
+	for (auto g = 0; g < n_groups; g++)
+	{
+		this->points.push_back(new Point_state());
+		this->points[g]->n_threads = (int)std::count(this->thread_group.begin(), this->thread_group.end(), g);
+		this->reset_point(g, true);
+	}
+
 	if (params_BFER.err_track_enable)
 	{
 		for (auto tid = 0; tid < params_BFER.n_threads; tid++)
-			dumper[tid] = new tools::Dumper();
+			dumper[tid] = new tools::Dumper_stream();
 
-		std::vector<tools::Dumper*> dumpers;
+		std::vector<tools::Dumper_stream*> dumpers;
 		for (auto tid = 0; tid < params_BFER.n_threads; tid++)
 			dumpers.push_back(dumper[tid]);
 
-		dumper_red = new tools::Dumper_reduction(dumpers);
+		// the erroneous frames are written while the simulation is running
+		dumper_writer = new tools::Dumper_stream_writer(dumpers);
 	}
 
 	modules["monitor"] = std::vector<module::Module*>(params_BFER.n_threads, nullptr);
@@ -82,6 +131,17 @@ BFER<B,R,Q>
 	// build a monitor to compute BER/FER (reduce the other monitors)
 	this->monitor_red = new module::Monitor_BFER_reduction<B>(this->monitor);
 #endif
+
+	// build a monitor per group of threads (the frame errors counters are then shared in the groups only)
+	for (auto g = 0; g < (int)this->monitor_red_grp.size(); g++)
+	{
+		std::vector<module::Monitor_BFER<B>*> monitors;
+		for (auto tid = 0; tid < params_BFER.n_threads; tid++)
+			if (this->thread_group[tid] == g)
+				monitors.push_back(this->monitor[tid]);
+
+		this->monitor_red_grp[g] = new module::Monitor_BFER_reduction<B>(monitors);
+	}
 }
 
 template <typename B, typename R, typename Q>
@@ -90,8 +150,13 @@ BFER<B,R,Q>
 {
 	release_objects();
 
-	if (monitor_red != nullptr) { delete monitor_red; monitor_red = nullptr; }
-	if (dumper_red  != nullptr) { delete dumper_red;  dumper_red  = nullptr; }
+	for (auto &m : monitor_red_grp)
+		if (m != nullptr) { delete m; m = nullptr; }
+	for (auto &p : points)
+		if (p != nullptr) { delete p; p = nullptr; }
+
+	if (monitor_red   != nullptr) { delete monitor_red;   monitor_red   = nullptr; }
+	if (dumper_writer != nullptr) { delete dumper_writer; dumper_writer = nullptr; }
 
 	for (auto tid = 0; tid < params_BFER.n_threads; tid++)
 	{
@@ -99,7 +164,8 @@ BFER<B,R,Q>
 		if (dumper [tid] != nullptr) { delete dumper [tid]; dumper [tid] = nullptr; }
 	}
 
-	if (terminal != nullptr) { delete terminal; terminal = nullptr; }
+	if (terminal     != nullptr) { delete terminal;     terminal     = nullptr; }
+	if (terminal_rec != nullptr) { delete terminal_rec; terminal_rec = nullptr; }
 }
 
 template <typename B, typename R, typename Q>
@@ -124,6 +190,24 @@ void BFER<B,R,Q>
 {
 	this->terminal = this->build_terminal();
 
+#ifdef ENABLE_MPI
+	if (!params_BFER.ter->rec_path.empty() && params_BFER.mpi_rank == 0)
+#else
+	if (!params_BFER.ter->rec_path.empty())
+#endif
+	{
+		this->terminal_rec_file.open(params_BFER.ter->rec_path, std::ios::out);
+		if (!this->terminal_rec_file.is_open())
+		{
+			std::stringstream message;
+			message << "Impossible to open the records file ('rec_path' = " << params_BFER.ter->rec_path << ").";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->terminal_rec = this->build_terminal_record();
+		this->terminal_rec->legend(this->terminal_rec_file);
+	}
+
 	if (!this->params_BFER.err_track_revert)
 	{
 		this->build_communication_chain();
@@ -135,24 +219,31 @@ void BFER<B,R,Q>
 		}
 	}
 
+	tools::SNR_sweep sweep(params_BFER.snr_min, params_BFER.snr_max, params_BFER.snr_step, params_BFER.snr_step_min,
+	                       params_BFER.snr_adapt, params_BFER.stop_fer);
+
+	if (this->n_groups > 1)
+	{
+		this->launch_parallel_points(sweep);
+		this->release_objects();
+		return;
+	}
+
 	// for each SNR to be simulated
-	for (snr = params_BFER.snr_min; snr <= params_BFER.snr_max; snr += params_BFER.snr_step)
+	auto first_point = true;
+	while (sweep.next(snr))
 	{
-		if (params_BFER.snr_type == "EB")
-		{
-			snr_b = snr;
-			snr_s = tools::ebn0_to_esn0(snr_b, bit_rate, params_BFER.mdm->bps);
-		}
-		else // if (params_BFER.sim->snr_type == "ES")
-		{
-			snr_s = snr;
-			snr_b = tools::esn0_to_ebn0(snr_s, bit_rate, params_BFER.mdm->bps);
-		}
-		sigma = tools::esn0_to_sigma(snr_s, params_BFER.mdm->upf);
+		this->set_snr(snr);
 
 		this->terminal->set_esn0(snr_s);
 		this->terminal->set_ebn0(snr_b);
 
+		if (this->terminal_rec != nullptr)
+		{
+			this->terminal_rec->set_esn0(snr_s);
+			this->terminal_rec->set_ebn0(snr_b);
+		}
+
 		if (this->params_BFER.err_track_revert)
 		{
 			this->release_objects();
@@ -191,10 +282,10 @@ void BFER<B,R,Q>
 		}
 
 #ifdef ENABLE_MPI
-		if (((!params_BFER.ter->disabled && snr == params_BFER.snr_min && !params_BFER.debug) ||
+		if (((!params_BFER.ter->disabled && first_point && !params_BFER.debug) ||
 		    (params_BFER.statistics && !params_BFER.debug)) && params_BFER.mpi_rank == 0)
 #else
-		if (((!params_BFER.ter->disabled && snr == params_BFER.snr_min && !params_BFER.debug) ||
+		if (((!params_BFER.ter->disabled && first_point && !params_BFER.debug) ||
 		    (params_BFER.statistics && !params_BFER.debug)))
 #endif
 			terminal->legend(std::cout);
@@ -208,6 +299,21 @@ void BFER<B,R,Q>
 #endif
 			terminal->start_temp_report(params_BFER.ter->frequency);
 
+		// start the thread writing the erroneous frames in the files of this SNR point
+		if (this->dumper_writer != nullptr)
+		{
+			std::stringstream s_snr_b;
+			s_snr_b << std::setprecision(2) << std::fixed << snr_b;
+
+			this->dumper_writer->open(params_BFER.err_track_path + "_" + s_snr_b.str());
+		}
+
+		// start the thread writing the temporary records (it only reads the counters of the monitors)
+		if (this->terminal_rec != nullptr && params_BFER.ter->rec_freq != std::chrono::milliseconds(0))
+			this->terminal_rec->start_temp_report(this->terminal_rec_file, params_BFER.ter->rec_freq);
+
+		this->reset_point(0, true);
+
 		try
 		{
 			this->_launch();
@@ -221,6 +327,21 @@ void BFER<B,R,Q>
 			this->simu_error = true;
 		}
 
+		std::vector<std::vector<const module::Module*>> mod_vec;
+		for (auto &vm : modules)
+		{
+			std::vector<const module::Module*> sub_mod_vec;
+			for (auto *m : vm.second)
+				sub_mod_vec.push_back(m);
+			mod_vec.push_back(sub_mod_vec);
+		}
+
+		if (this->terminal_rec != nullptr)
+		{
+			this->terminal_rec->set_modules(mod_vec);
+			this->terminal_rec->final_report(this->terminal_rec_file);
+		}
+
 #ifdef ENABLE_MPI
 		if (!params_BFER.ter->disabled && terminal != nullptr && !this->simu_error && params_BFER.mpi_rank == 0)
 #else
@@ -234,35 +355,27 @@ void BFER<B,R,Q>
 
 			if (params_BFER.statistics)
 			{
-				std::vector<std::vector<const module::Module*>> mod_vec;
-				for (auto &vm : modules)
-				{
-					std::vector<const module::Module*> sub_mod_vec;
-					for (auto *m : vm.second)
-						sub_mod_vec.push_back(m);
-					mod_vec.push_back(sub_mod_vec);
-				}
-
 				std::cout << "#" << std::endl;
 				tools::Stats::show(mod_vec, true, std::cout);
 				std::cout << "#" << std::endl;
 			}
 		}
 
-		if (this->dumper_red != nullptr && !this->simu_error)
+		// the frames of a point that failed are not dumped
+		if (this->dumper_writer != nullptr)
 		{
-			std::stringstream s_snr_b;
-			s_snr_b << std::setprecision(2) << std::fixed << snr_b;
-
-			this->dumper_red->dump(params_BFER.err_track_path + "_" + s_snr_b.str());
-			this->dumper_red->clear();
+			if (!this->simu_error) this->dumper_writer->close  ();
+			else                   this->dumper_writer->discard();
 		}
 
 		if (!params_BFER.err_track_revert && !module::Monitor::is_interrupt() &&
 		    this->monitor_red->get_n_fe() < this->monitor_red->get_fe_limit() &&
-		    (max_fra == 0 || this->monitor_red->get_n_fe() < max_fra))
+		    (max_fra == 0 || this->monitor_red->get_n_fe() < max_fra) && !this->point_done())
 			module::Monitor::stop();
 
+		sweep.record(snr, this->monitor_red->get_n_analyzed_fra(), this->monitor_red->get_n_fe());
+		first_point = false;
+
 		this->monitor_red->reset();
 		for (auto &m : modules)
 			for (auto mm : m.second)
@@ -283,6 +396,164 @@ void BFER<B,R,Q>
 {
 }
 
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::launch_parallel_points(tools::SNR_sweep &sweep)
+{
+	if (!params_BFER.ter->disabled)
+		this->terminal->legend(std::cout);
+
+	std::vector<float> snrs;
+	while (!module::Monitor::is_over())
+	{
+		// take the next points of the sweep, the groups of threads get them by increasing SNR
+		snrs.clear();
+		while ((int)snrs.size() < this->n_groups && sweep.next(snr))
+			snrs.push_back(snr);
+		if (snrs.empty())
+			break;
+		std::sort(snrs.begin(), snrs.end());
+
+		std::vector<tools::Terminal_BFER<B>*> terminals(snrs.size(), nullptr);
+		for (auto g = 0; g < this->n_groups; g++)
+		{
+			const auto active = g < (int)snrs.size();
+			if (active)
+			{
+				this->set_snr(snrs[g]);
+				this->sigma_grp[g] = this->sigma;
+
+				terminals[g] = factory::Terminal_BFER::build<B>(*params_BFER.ter, *this->monitor_red_grp[g]);
+				terminals[g]->set_esn0(this->snr_s);
+				terminals[g]->set_ebn0(this->snr_b);
+			}
+			this->reset_point(g, active);
+		}
+
+		try
+		{
+			this->_launch();
+		}
+		catch (std::exception const& e)
+		{
+			module::Monitor::stop();
+
+			std::cerr << tools::apply_on_each_line(tools::addr2line(e.what()), &tools::format_error) << std::endl;
+			this->simu_error = true;
+		}
+
+		auto tid = 0;
+		for (auto g = 0; g < (int)snrs.size(); g++)
+		{
+			auto &mnt_red = *this->monitor_red_grp[g];
+
+			if (!params_BFER.ter->disabled && !this->simu_error)
+				terminals[g]->final_report(std::cout);
+
+			if (!module::Monitor::is_interrupt() && mnt_red.get_n_fe() < mnt_red.get_fe_limit() &&
+			    !this->point_done(tid))
+				module::Monitor::stop();
+
+			sweep.record(snrs[g], mnt_red.get_n_analyzed_fra(), mnt_red.get_n_fe());
+			tid += this->points[g]->n_threads;
+		}
+
+		this->monitor_red->reset();
+		for (auto *m : this->monitor_red_grp)
+			m->reset();
+		for (auto &m : modules)
+			for (auto mm : m.second)
+				if (mm != nullptr)
+					for (auto &t : mm->tasks)
+						t->reset_stats();
+
+		for (auto *t : terminals)
+			delete t;
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::set_snr(const float snr)
+{
+	this->snr = snr;
+
+	if (params_BFER.snr_type == "EB")
+	{
+		this->snr_b = snr;
+		this->snr_s = tools::ebn0_to_esn0(this->snr_b, bit_rate, params_BFER.mdm->bps);
+	}
+	else // if (params_BFER.sim->snr_type == "ES")
+	{
+		this->snr_s = snr;
+		this->snr_b = tools::esn0_to_ebn0(this->snr_s, bit_rate, params_BFER.mdm->bps);
+	}
+	this->sigma = tools::esn0_to_sigma(this->snr_s, params_BFER.mdm->upf);
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::reset_point(const int grp, const bool active)
+{
+	auto &point = *this->points[grp];
+
+	point.done        = false;
+	point.n_fra_floor = 0;
+	point.n_fe        = std::numeric_limits<unsigned long long>::max(); // the criteria are evaluated at the first call
+	point.active      = active;
+}
+
+template <typename B, typename R, typename Q>
+bool BFER<B,R,Q>
+::point_done(const int tid)
+{
+	auto &point = *this->points[this->thread_group[tid]];
+
+	if (!point.active)
+		return true;
+
+	if (params_BFER.stop_fer <= 0.f && params_BFER.stop_ci <= 0.f)
+		return false;
+
+	auto &mnt_red = this->get_monitor_red(tid);
+
+	const auto n_fe = mnt_red.get_n_fe_total();
+	if (n_fe != point.n_fe.load(std::memory_order_acquire))
+	{
+		const auto n_fe_red = mnt_red.get_n_fe();
+		point.done        = tools::SNR_sweep::is_point_done(mnt_red.get_n_analyzed_fra(), n_fe_red,
+		                                                    params_BFER.stop_ci, params_BFER.stop_fer);
+		point.n_fra_floor = tools::SNR_sweep::n_fra_floor(n_fe_red, params_BFER.stop_fer);
+		point.n_fe.store(n_fe, std::memory_order_release);
+	}
+
+	if (point.done)
+		return true;
+
+	// with the same number of frame errors, only the FER floor can be reached: the frames of the thread are extrapolated
+	// to its group before to reduce the monitors
+	const auto n_fra_floor = point.n_fra_floor.load();
+	if (n_fra_floor == 0 || this->monitor[tid]->get_n_analyzed_fra() * point.n_threads < n_fra_floor)
+		return false;
+
+	return point.done = tools::SNR_sweep::is_point_done(mnt_red.get_n_analyzed_fra(), mnt_red.get_n_fe(), 0.f,
+	                                                    params_BFER.stop_fer);
+}
+
+template <typename B, typename R, typename Q>
+module::Monitor_BFER_reduction<B>& BFER<B,R,Q>
+::get_monitor_red(const int tid)
+{
+	return this->n_groups > 1 ? *this->monitor_red_grp[this->thread_group[tid]] : *this->monitor_red;
+}
+
+template <typename B, typename R, typename Q>
+float BFER<B,R,Q>
+::get_sigma(const int tid) const
+{
+	return this->n_groups > 1 ? this->sigma_grp[this->thread_group[tid]] : this->sigma;
+}
+
 template <typename B, typename R, typename Q>
 module::Monitor_BFER<B>* BFER<B,R,Q>
 ::build_monitor(const int tid)
@@ -297,6 +568,13 @@ tools::Terminal_BFER<B>* BFER<B,R,Q>
 	return factory::Terminal_BFER::build<B>(*params_BFER.ter, *this->monitor_red);
 }
 
+template <typename B, typename R, typename Q>
+tools::Terminal_BFER_record<B>* BFER<B,R,Q>
+::build_terminal_record()
+{
+	return factory::Terminal_BFER::build_record<B>(*params_BFER.ter, *this->monitor_red);
+}
+
 template <typename B, typename R, typename Q>
 void BFER<B,R,Q>
 ::start_thread_build_comm_chain(BFER<B,R,Q> *simu, const int tid)
@@ -306,7 +584,7 @@ void BFER<B,R,Q>
 		simu->__build_communication_chain(tid);
 
 		if (simu->params_BFER.err_track_enable)
-			simu->monitor[tid]->add_handler_fe(std::bind(&tools::Dumper::add, simu->dumper[tid], std::placeholders::_1, std::placeholders::_2));
+			simu->monitor[tid]->add_handler_fe(std::bind(&tools::Dumper_stream::add, simu->dumper[tid], std::placeholders::_1, std::placeholders::_2));
 	}
 	catch (std::exception const& e)
 	{
@@ -2,13 +2,17 @@
 #define SIMULATION_BFER_HPP_
 
 #include <map>
+#include <atomic>
 #include <chrono>
 #include <vector>
+#include <fstream>
 
 #include "Tools/Threads/Barrier.hpp"
+#include "Tools/Algo/SNR_sweep/SNR_sweep.hpp"
 #include "Tools/Display/Terminal/BFER/Terminal_BFER.hpp"
-#include "Tools/Display/Dumper/Dumper.hpp"
-#include "Tools/Display/Dumper/Dumper_reduction.hpp"
+#include "Tools/Display/Terminal/BFER/Terminal_BFER_record.hpp"
+#include "Tools/Display/Dumper/Dumper_stream.hpp"
+#include "Tools/Display/Dumper/Dumper_stream_writer.hpp"
 
 #include "Module/Module.hpp"
 #include "Module/Monitor/Monitor.hpp"
@@ -29,6 +33,18 @@ private:
 	// parameters
 	const factory::BFER::parameters &params_BFER;
 
+	// state of the SNR point of a group of threads, the stop criteria are evaluated again only when the number of frame
+	// errors changes
+	struct Point_state
+	{
+		int                             n_threads;   // number of threads in the group
+		std::atomic<bool>               active;      // false if the group has no SNR point to simulate
+		std::atomic<unsigned long long> n_fe;        // number of frame errors when the criteria have been evaluated
+		std::atomic<bool>               done;
+		std::atomic<unsigned long long> n_fra_floor; // number of frames to reach the FER floor with 'n_fe' errors
+	};
+	std::vector<Point_state*> points;
+
 protected:
 	std::mutex               mutex_exception;
 	std::vector<std::string> prev_err_messages;
@@ -50,15 +66,26 @@ protected:
 	std::vector<module::Monitor_BFER          <B>*> monitor;
 	            module::Monitor_BFER_reduction<B>*  monitor_red;
 
+	// parallel SNR points: the threads are split in 'n_groups' groups, each group simulates its own SNR point (the
+	// reductions and the sigmas of the groups are only used when 'n_groups' > 1)
+	const int                                       n_groups;
+	std::vector<int                               > thread_group;
+	std::vector<module::Monitor_BFER_reduction<B>*> monitor_red_grp;
+	std::vector<float                             > sigma_grp;
+
 	// dump frames into files
-	std::vector<tools::Dumper          *> dumper;
-	            tools::Dumper_reduction*  dumper_red;
+	std::vector<tools::Dumper_stream       *> dumper;
+	            tools::Dumper_stream_writer*  dumper_writer;
 
 	// terminal (for the output of the code)
 	tools::Terminal_BFER<B> *terminal;
 
+	// machine-readable records of the simulation (nullptr if disabled)
+	tools::Terminal_BFER_record<B> *terminal_rec;
+	std::ofstream                   terminal_rec_file;
+
 public:
-	explicit BFER(const factory::BFER::parameters& params_BFER);
+	explicit BFER(const factory::BFER::parameters& params_BFER, const int n_groups = 1);
 	virtual ~BFER();
 	void launch();
 
@@ -68,10 +95,30 @@ protected:
 	virtual void release_objects();
 	virtual void _launch() = 0;
 
-	module::Monitor_BFER <B>* build_monitor (const int tid = 0);
-	tools ::Terminal_BFER<B>* build_terminal(                 );
+	/*!
+	 * \brief Tells if the current SNR point of a thread has reached its FER floor or its confidence interval criterion
+	 *        (see the '--sim-stop-fer' and '--sim-stop-ci' parameters), always false if both criteria are disabled.
+	 *        The monitors are only reduced when the number of frame errors changes (or when the frames of the thread
+	 *        let expect the FER floor).
+	 *
+	 * \param tid: the thread id.
+	 *
+	 * \return true if the point is done or if the group of the thread has no SNR point to simulate.
+	 */
+	bool point_done(const int tid = 0);
+
+	module::Monitor_BFER_reduction<B>& get_monitor_red(const int tid = 0);
+	float                              get_sigma      (const int tid = 0) const;
+
+	module::Monitor_BFER        <B>* build_monitor        (const int tid = 0);
+	tools ::Terminal_BFER       <B>* build_terminal       (                 );
+	tools ::Terminal_BFER_record<B>* build_terminal_record(                 );
 
 private:
+	void set_snr               (const float snr                   );
+	void reset_point           (const int grp, const bool active  );
+	void launch_parallel_points(tools::SNR_sweep &sweep           );
+
 	static void start_thread_build_comm_chain(BFER<B,R,Q> *simu, const int tid);
 };
 }
@@ -221,9 +221,14 @@ module::Channel<R>* BFER_ite<B,R,Q>
 	const auto seed_chn = rd_engine_seed[tid]();
 
 	auto params_chn = params_BFER_ite.chn->clone();
-	params_chn->seed = seed_chn;
-	auto c = params_chn->template build<R>();
+	// a counter-based generator has to be keyed in the same way for all the threads, the thread 'tid' then takes the
+	// frames tid, tid + n_threads, ... of the noise stream: the noise of the global frame g is the samples [g * N,
+	// (g +1) * N[ of the stream, whatever the thread which simulates it and the number of frames per call
+	params_chn->seed = params_chn->implem == "THREEFRY" ? params_BFER_ite.local_seed : seed_chn;
+	auto c = params_chn->template build<R>(params_BFER_ite.n_threads, tid);
 	delete params_chn;
+	// the noise is only read back to dump the erroneous frames
+	c->set_noise_storage(params_BFER_ite.err_track_enable);
 	return c;
 }
 
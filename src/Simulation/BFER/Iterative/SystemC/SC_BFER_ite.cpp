@@ -52,7 +52,7 @@ void SC_BFER_ite<B,R,Q>
 
 	this->monitor[tid]->add_handler_check([&]() -> void
 	{
-		if (this->monitor_red->fe_limit_achieved()) // will make the MPI communication
+		if (this->monitor_red->fe_limit_achieved() || this->point_done()) // will make the MPI communication
 			sc_core::sc_stop();
 	});
 }
@@ -328,7 +328,8 @@ void BFER_ite_threads<B,R,Q>
 	while ((!this->monitor_red->fe_limit_achieved()) && // while max frame error count has not been reached
 	        (this->params_BFER_ite.stop_time == seconds(0) || 
 	        (steady_clock::now() - t_snr) < this->params_BFER_ite.stop_time) &&
-	        (this->monitor_red->get_n_analyzed_fra() < this->max_fra || this->max_fra == 0))
+	        (this->max_fra == 0 || this->monitor_red->get_n_analyzed_fra() < this->max_fra) &&
+	        !this->point_done())
 	{
 		if (this->params_BFER_ite.debug)
 		{
@@ -10,7 +10,7 @@ using namespace aff3ct::simulation;
 template <typename B, typename R, typename Q>
 BFER_std<B,R,Q>
 ::BFER_std(const factory::BFER_std::parameters &params_BFER_std)
-: BFER<B,R,Q>(params_BFER_std),
+: BFER<B,R,Q>(params_BFER_std, params_BFER_std.snr_par),
   params_BFER_std(params_BFER_std),
 
   source    (params_BFER_std.n_threads, nullptr),
@@ -21,6 +21,8 @@ BFER_std<B,R,Q>
   quantizer (params_BFER_std.n_threads, nullptr),
   coset_real(params_BFER_std.n_threads, nullptr),
   coset_bit (params_BFER_std.n_threads, nullptr),
+  unpacker  (params_BFER_std.n_threads, nullptr),
+  front_end (params_BFER_std.n_threads, nullptr),
 
   rd_engine_seed(params_BFER_std.n_threads)
 {
@@ -37,6 +39,70 @@ BFER_std<B,R,Q>
 	this->modules["coset_real"] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
 	this->modules["decoder"   ] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
 	this->modules["coset_bit" ] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
+
+	if (params_BFER_std.packed)
+	{
+		// the cosets, the codewords monitoring and the bad frames tracking work on unpacked bits
+		if (params_BFER_std.coset)
+		{
+			std::stringstream message;
+			message << "The packed bits are not supported with the coset approach.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (params_BFER_std.coded_monitoring)
+		{
+			std::stringstream message;
+			message << "The packed bits are not supported with the coded monitoring.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (params_BFER_std.err_track_enable)
+		{
+			std::stringstream message;
+			message << "The packed bits do not support the tracking of the bad frames.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->modules["unpacker"] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
+	}
+
+	if (params_BFER_std.fused_fe)
+	{
+		if (params_BFER_std.mdm->type != "BPSK" && params_BFER_std.mdm->type != "BPSK_FAST")
+		{
+			std::stringstream message;
+			message << "The fused front-end requires a BPSK modem ('mdm->type' = " << params_BFER_std.mdm->type << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (params_BFER_std.chn->type != "AWGN" || params_BFER_std.chn->add_users)
+		{
+			std::stringstream message;
+			message << "The fused front-end requires an AWGN channel without users addition ('chn->type' = "
+			        << params_BFER_std.chn->type << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (params_BFER_std.qnt->type != "STD" && params_BFER_std.qnt->type != "STD_FAST" &&
+		    params_BFER_std.qnt->type != "NO")
+		{
+			std::stringstream message;
+			message << "The fused front-end requires a standard quantizer ('qnt->type' = "
+			        << params_BFER_std.qnt->type << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		// the noise is not stored by the fused front-end
+		if (params_BFER_std.err_track_enable)
+		{
+			std::stringstream message;
+			message << "The fused front-end does not support the tracking of the bad frames.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->modules["front_end"] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
+	}
 }
 
 template <typename B, typename R, typename Q>
@@ -70,6 +136,18 @@ void BFER_std<B,R,Q>
 	this->modules["decoder"   ][tid] = codec     [tid]->get_decoder_siho();
 	this->modules["coset_bit" ][tid] = coset_bit [tid];
 
+	if (this->params_BFER_std.packed)
+	{
+		unpacker[tid] = build_unpacker(tid);
+		this->modules["unpacker"][tid] = unpacker[tid];
+	}
+
+	if (this->params_BFER_std.fused_fe)
+	{
+		front_end[tid] = build_front_end(tid);
+		this->modules["front_end"][tid] = front_end[tid];
+	}
+
 	this->monitor[tid]->add_handler_check(std::bind(&module::Codec_SIHO<B,Q>::reset, codec[tid]));
 
 	try
@@ -111,12 +189,17 @@ template <typename B, typename R, typename Q>
 void BFER_std<B,R,Q>
 ::_launch()
 {
-	// set current sigma
+	// set current sigma (the threads can simulate different SNR points)
 	for (auto tid = 0; tid < this->params_BFER_std.n_threads; tid++)
 	{
-		this->channel[tid]->set_sigma(                                                                    this->sigma);
-		this->modem  [tid]->set_sigma(this->params_BFER_std.mdm->complex ? this->sigma * std::sqrt(2.f) : this->sigma);
-		this->codec  [tid]->set_sigma(                                                                    this->sigma);
+		const auto sigma = this->get_sigma(tid);
+
+		this->channel[tid]->set_sigma(                                                          sigma);
+		this->modem  [tid]->set_sigma(this->params_BFER_std.mdm->complex ? sigma * std::sqrt(2.f) : sigma);
+		this->codec  [tid]->set_sigma(                                                          sigma);
+
+		if (this->front_end[tid] != nullptr)
+			this->front_end[tid]->set_sigma(sigma);
 	}
 }
 
@@ -133,6 +216,8 @@ void BFER_std<B,R,Q>
 	for (auto i = 0; i < nthr; i++) if (quantizer [i] != nullptr) { delete quantizer [i]; quantizer [i] = nullptr; }
 	for (auto i = 0; i < nthr; i++) if (coset_real[i] != nullptr) { delete coset_real[i]; coset_real[i] = nullptr; }
 	for (auto i = 0; i < nthr; i++) if (coset_bit [i] != nullptr) { delete coset_bit [i]; coset_bit [i] = nullptr; }
+	for (auto i = 0; i < nthr; i++) if (unpacker  [i] != nullptr) { delete unpacker  [i]; unpacker  [i] = nullptr; }
+	for (auto i = 0; i < nthr; i++) if (front_end [i] != nullptr) { delete front_end [i]; front_end [i] = nullptr; }
 
 	BFER<B,R,Q>::release_objects();
 }
@@ -203,9 +288,14 @@ module::Channel<R>* BFER_std<B,R,Q>
 	const auto seed_chn = rd_engine_seed[tid]();
 
 	auto params_chn = this->params_BFER_std.chn->clone();
-	params_chn->seed = seed_chn;
-	auto c = params_chn->template build<R>();
+	// a counter-based generator has to be keyed in the same way for all the threads, the thread 'tid' then takes the
+	// frames tid, tid + n_threads, ... of the noise stream: the noise of the global frame g is the samples [g * N,
+	// (g +1) * N[ of the stream, whatever the thread which simulates it and the number of frames per call
+	params_chn->seed = params_chn->implem == "THREEFRY" ? this->params_BFER_std.local_seed : seed_chn;
+	auto c = params_chn->template build<R>(this->params_BFER_std.n_threads, tid);
 	delete params_chn;
+	// the noise is only read back to dump the erroneous frames
+	c->set_noise_storage(this->params_BFER_std.err_track_enable);
 	return c;
 }
 
@@ -236,6 +326,34 @@ module::Coset<B,B>* BFER_std<B,R,Q>
 	return cst_params.template build_bit<B,B>();
 }
 
+template <typename B, typename R, typename Q>
+module::Unpacker<B>* BFER_std<B,R,Q>
+::build_unpacker(const int tid)
+{
+	return new module::Unpacker<B>(params_BFER_std.cdc->N_cw, params_BFER_std.src->n_frames);
+}
+
+template <typename B, typename R, typename Q>
+module::Front_end_BPSK_AWGN<B,R,Q>* BFER_std<B,R,Q>
+::build_front_end(const int tid)
+{
+	const auto seed_chn = rd_engine_seed[tid]();
+
+	// the noise generator is keyed as in 'build_channel'
+	auto params_chn = this->params_BFER_std.chn->clone();
+	params_chn->seed = params_chn->implem == "THREEFRY" ? this->params_BFER_std.local_seed : seed_chn;
+	auto n = params_chn->template build_noise_generator<R>(this->params_BFER_std.n_threads, tid);
+	delete params_chn;
+
+	return new module::Front_end_BPSK_AWGN<B,R,Q>(params_BFER_std.mdm->N,
+	                                              n,
+	                                              params_BFER_std.qnt->n_decimals,
+	                                              params_BFER_std.qnt->n_bits,
+	                                              params_BFER_std.mdm->no_sig2,
+	                                              (R)this->sigma,
+	                                              params_BFER_std.src->n_frames);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef MULTI_PREC
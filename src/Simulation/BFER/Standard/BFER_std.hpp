@@ -12,6 +12,8 @@
 #include "Module/Channel/Channel.hpp"
 #include "Module/Quantizer/Quantizer.hpp"
 #include "Module/Coset/Coset.hpp"
+#include "Module/Unpacker/Unpacker.hpp"
+#include "Module/Front_end/Front_end_BPSK_AWGN.hpp"
 
 #include "Factory/Simulation/BFER/BFER_std.hpp"
 
@@ -37,6 +39,12 @@ protected:
 	std::vector<module::Coset     <B,Q  >*> coset_real;
 	std::vector<module::Coset     <B,B  >*> coset_bit;
 
+	// unpacks the packed codewords for the puncturer and the modem (only with '--sim-packed')
+	std::vector<module::Unpacker<B>*> unpacker;
+
+	// modulation, channel, demodulation and quantization fused in one module (only with '--sim-fused-fe')
+	std::vector<module::Front_end_BPSK_AWGN<B,R,Q>*> front_end;
+
 	// a vector of random generator to generate the seeds
 	std::vector<std::mt19937> rd_engine_seed;
 
@@ -57,6 +65,10 @@ protected:
 	module::Quantizer <R,Q  >* build_quantizer (const int tid = 0);
 	module::Coset     <B,Q  >* build_coset_real(const int tid = 0);
 	module::Coset     <B,B  >* build_coset_bit (const int tid = 0);
+
+	module::Unpacker<B>* build_unpacker(const int tid = 0);
+
+	module::Front_end_BPSK_AWGN<B,R,Q>* build_front_end(const int tid = 0);
 };
 }
 }
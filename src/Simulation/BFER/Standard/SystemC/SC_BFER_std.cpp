@@ -21,9 +21,17 @@ SC_BFER_std<B,R,Q>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "SystemC simulation does not support "
 		                                                            "multi-threading.");
 
+	if (params_BFER_std.packed)
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "SystemC simulation does not support the packed "
+		                                                            "bits.");
+
 	if (params_BFER_std.coded_monitoring)
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "SystemC simulation does not support the coded "
 		                                                            "monitoring.");
+
+	if (params_BFER_std.fused_fe)
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "SystemC simulation does not support the fused "
+		                                                            "front-end.");
 }
 
 template <typename B, typename R, typename Q>
@@ -40,7 +48,7 @@ void SC_BFER_std<B,R,Q>
 
 	this->monitor[tid]->add_handler_check([&]() -> void
 	{
-		if (this->monitor_red->fe_limit_achieved()) // will make the MPI communication
+		if (this->monitor_red->fe_limit_achieved() || this->point_done()) // will make the MPI communication
 			sc_core::sc_stop();
 	});
 }
@@ -1,10 +1,15 @@
 #include <cstring>
+#include <sstream>
 #include <string>
 #include <vector>
+#include <map>
 #include <chrono>
 #include <thread>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Threads/Thread_pinning.hpp"
+#include "Tools/Threads/Pipeline.hpp"
 #include "Tools/Display/Frame_trace/Frame_trace.hpp"
 #include "Tools/Display/bash_tools.h"
 
@@ -18,8 +23,20 @@ using namespace aff3ct::simulation;
 template <typename B, typename R, typename Q>
 BFER_std_threads<B,R,Q>
 ::BFER_std_threads(const factory::BFER_std::parameters &params_BFER_std)
-: BFER_std<B,R,Q>(params_BFER_std)
+: BFER_std<B,R,Q>(params_BFER_std),
+  sequences(params_BFER_std.n_threads),
+  stages_begin(params_BFER_std.n_threads),
+  chains(params_BFER_std.sched == "STEAL" ? params_BFER_std.n_threads : 0, nullptr),
+  queues(params_BFER_std.sched == "STEAL" ? std::max(params_BFER_std.n_workers, 1) : 0, nullptr),
+  n_active_chains(0),
+  n_jobs(0),
+  n_parked(0)
 {
+	for (auto &c : this->chains)
+		c = new Chain_state();
+	for (auto &q : this->queues)
+		q = new tools::Work_stealing_queue<Job>();
+
 	if (this->params_BFER_std.err_track_revert)
 	{
 		if (this->params_BFER_std.n_threads != 1)
@@ -27,12 +44,52 @@ BFER_std_threads<B,R,Q>
 			                                   "Each thread will play the same frames. Please run with one thread.")
 			          << std::endl;
 	}
+
+	if (this->params_BFER_std.sched == "PIPELINE" || this->params_BFER_std.sched == "STEAL")
+	{
+		// the pipelines rebind the sockets on their own buffers and several frame batches of a chain are in flight
+		if (this->params_BFER_std.err_track_enable)
+		{
+			std::stringstream message;
+			message << "The '" << this->params_BFER_std.sched << "' scheduler does not support the tracking of the "
+			        << "bad frames.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->params_BFER_std.cdc->itl != nullptr && this->params_BFER_std.cdc->itl->core->uniform)
+		{
+			std::stringstream message;
+			message << "The '" << this->params_BFER_std.sched << "' scheduler does not support the uniform "
+			        << "interleavers.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->params_BFER_std.debug)
+		{
+			std::stringstream message;
+			message << "The '" << this->params_BFER_std.sched << "' scheduler does not support the debug mode.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	// the threads of the other schedulers are not bound to a communication chain, hence to an SNR point
+	if (this->params_BFER_std.snr_par > 1 && this->params_BFER_std.sched != "CHAIN")
+	{
+		std::stringstream message;
+		message << "The parallel SNR points require the 'CHAIN' scheduler ('sched' = " << this->params_BFER_std.sched
+		        << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
 }
 
 template <typename B, typename R, typename Q>
 BFER_std_threads<B,R,Q>
 ::~BFER_std_threads()
 {
+	for (auto &c : this->chains)
+		if (c != nullptr) { delete c->pipeline; delete c; c = nullptr; }
+	for (auto &q : this->queues)
+		if (q != nullptr) { delete q; q = nullptr; }
 }
 
 template <typename B, typename R, typename Q>
@@ -41,20 +98,91 @@ void BFER_std_threads<B,R,Q>
 {
 	BFER_std<B,R,Q>::_launch();
 
+	this->t_snr = std::chrono::steady_clock::now();
+
+	if (this->params_BFER_std.sched == "STEAL")
+		this->_launch_work_stealing();
+	else if (this->params_BFER_std.sched == "PIPELINE")
+		this->_launch_chains(BFER_std_threads<B,R,Q>::start_thread_pipeline);
+	else
+		this->_launch_chains(BFER_std_threads<B,R,Q>::start_thread);
+
+	if (!this->prev_err_messages.empty())
+		throw std::runtime_error(this->prev_err_messages.back());
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::_launch_chains(void (*start)(BFER_std_threads<B,R,Q>*, const int))
+{
 	std::vector<std::thread> threads(this->params_BFER_std.n_threads -1);
 	// launch a group of slave threads (there is "n_threads -1" slave threads)
 	for (auto tid = 1; tid < this->params_BFER_std.n_threads; tid++)
-		threads[tid -1] = std::thread(BFER_std_threads<B,R,Q>::start_thread, this, tid);
+		threads[tid -1] = std::thread(start, this, tid);
 
 	// launch the master thread
-	BFER_std_threads<B,R,Q>::start_thread(this, 0);
+	start(this, 0);
 
 	// join the slave threads with the master thread
 	for (auto tid = 1; tid < this->params_BFER_std.n_threads; tid++)
 		threads[tid -1].join();
+}
 
-	if (!this->prev_err_messages.empty())
-		throw std::runtime_error(this->prev_err_messages.back());
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::_launch_work_stealing()
+{
+	const auto n_chains  = this->params_BFER_std.n_threads;
+	const auto n_workers = (int)this->queues.size();
+
+	// bind the sockets of all the communication chains and build their pipelines before starting the pool of threads
+	for (auto tid = 0; tid < n_chains; tid++)
+	{
+		this->sockets_binding(tid);
+		this->build_sequence (tid);
+
+		auto &chain = *this->chains[tid];
+		delete chain.pipeline;
+		chain.pipeline = new tools::Pipeline(this->get_stages(tid));
+
+		const auto n_stages = chain.pipeline->get_n_stages();
+		chain.n_ready.reset(new std::atomic<int>[n_stages]);
+		for (size_t s = 0; s < n_stages; s++)
+			chain.n_ready[s] = 0;
+		chain.n_ready[0]  = (int)chain.pipeline->get_n_slots(); // all the slots are free
+		chain.n_in_flight = 0;
+		chain.stopped     = false;
+		chain.retired     = false;
+	}
+
+	// spread the first stages of the communication chains over the local queues of the threads
+	for (auto *q : this->queues)
+		q->clear();
+	this->n_jobs   = 0;
+	this->n_parked = 0;
+	this->n_active_chains = n_chains;
+	for (auto tid = 0; tid < n_chains; tid++)
+		this->push_job(tid % n_workers, Job{tid, 0});
+
+	std::vector<std::thread> threads(n_workers -1);
+	// launch a group of slave threads (there is "n_workers -1" slave threads)
+	for (auto wid = 1; wid < n_workers; wid++)
+		threads[wid -1] = std::thread(BFER_std_threads<B,R,Q>::start_thread_work_stealing, this, wid);
+
+	// launch the master thread
+	BFER_std_threads<B,R,Q>::start_thread_work_stealing(this, 0);
+
+	// join the slave threads with the master thread
+	for (auto wid = 1; wid < n_workers; wid++)
+		threads[wid -1].join();
+
+	// restore the bindings of the sockets
+	for (auto *c : this->chains)
+	{
+		c->pipeline->reset();
+		delete c->pipeline;
+		c->pipeline = nullptr;
+	}
 }
 
 template <typename B, typename R, typename Q>
@@ -63,20 +191,68 @@ void BFER_std_threads<B,R,Q>
 {
 	try
 	{
+		if (simu->params_BFER_std.pinning)
+			tools::thread_pinning(tid);
+
 		simu->sockets_binding(tid);
+		simu->build_sequence (tid);
 		simu->simulation_loop(tid);
 	}
 	catch (std::exception const& e)
 	{
-		module::Monitor::stop();
+		BFER_std_threads<B,R,Q>::save_exception(simu, e);
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::start_thread_pipeline(BFER_std_threads<B,R,Q> *simu, const int tid)
+{
+	try
+	{
+		simu->sockets_binding(tid);
+		simu->build_sequence (tid);
+
+		tools::Pipeline pipeline(simu->get_stages(tid));
+
+		const auto first_puid = simu->params_BFER_std.pinning ? tid * (int)pipeline.get_n_stages() : -1;
+		pipeline.exec([simu]() -> bool { return simu->keep_looping(); }, first_puid);
+	}
+	catch (std::exception const& e)
+	{
+		BFER_std_threads<B,R,Q>::save_exception(simu, e);
+	}
+}
 
-		simu->mutex_exception.lock();
-		if (std::find(simu->prev_err_messages.begin(), simu->prev_err_messages.end(), e.what()) == simu->prev_err_messages.end())
-			simu->prev_err_messages.push_back(e.what());
-		simu->mutex_exception.unlock();
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::start_thread_work_stealing(BFER_std_threads<B,R,Q> *simu, const int wid)
+{
+	try
+	{
+		if (simu->params_BFER_std.pinning)
+			tools::thread_pinning(wid);
+
+		simu->work_stealing_loop(wid);
+	}
+	catch (std::exception const& e)
+	{
+		BFER_std_threads<B,R,Q>::save_exception(simu, e);
 	}
 }
 
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::save_exception(BFER_std_threads<B,R,Q> *simu, const std::exception &e)
+{
+	module::Monitor::stop();
+
+	simu->mutex_exception.lock();
+	if (std::find(simu->prev_err_messages.begin(), simu->prev_err_messages.end(), e.what()) == simu->prev_err_messages.end())
+		simu->prev_err_messages.push_back(e.what());
+	simu->mutex_exception.unlock();
+}
+
 template <typename B, typename R, typename Q>
 void BFER_std_threads<B,R,Q>
 ::sockets_binding(const int tid)
@@ -95,14 +271,20 @@ void BFER_std_threads<B,R,Q>
 	auto &csb = *this->coset_bit [tid];
 	auto &mnt = *this->monitor   [tid];
 
+	// with the packed bits, the source, the CRC, the encoder, the decoder and the monitor use their packed tasks and
+	// the codewords are unpacked before the puncturer
+	const auto packed = this->params_BFER_std.packed;
+	auto &src_U_K = packed ? src[src::tsk::generate_packed][src::sck::generate_packed::U_K]
+	                       : src[src::tsk::generate       ][src::sck::generate       ::U_K];
+
 	if (this->params_BFER_std.src->type == "AZCW")
 	{
-		auto src_data = (uint8_t*)(src[src::tsk::generate][src::sck::generate::U_K ].get_dataptr());
+		auto src_data = (uint8_t*)(src_U_K.get_dataptr());
 		auto crc_data = (uint8_t*)(crc[crc::tsk::build   ][crc::sck::build   ::U_K2].get_dataptr());
 		auto enc_data = (uint8_t*)(enc[enc::tsk::encode  ][enc::sck::encode  ::X_N ].get_dataptr());
 		auto pct_data = (uint8_t*)(pct[pct::tsk::puncture][pct::sck::puncture::X_N2].get_dataptr());
 
-		auto src_bytes = src[src::tsk::generate][src::sck::generate::U_K ].get_databytes();
+		auto src_bytes = src_U_K.get_databytes();
 		auto crc_bytes = crc[crc::tsk::build   ][crc::sck::build   ::U_K2].get_databytes();
 		auto enc_bytes = enc[enc::tsk::encode  ][enc::sck::encode  ::X_N ].get_databytes();
 		auto pct_bytes = pct[pct::tsk::puncture][pct::sck::puncture::X_N2].get_databytes();
@@ -118,20 +300,50 @@ void BFER_std_threads<B,R,Q>
 	}
 	else
 	{
-		if (this->params_BFER_std.crc->type == "NO")
-			crc[crc::tsk::build][crc::sck::build::U_K2](src[src::tsk::generate][src::sck::generate::U_K]);
-		if (this->params_BFER_std.cdc->enc->type == "NO")
-			enc[enc::tsk::encode][enc::sck::encode::X_N](crc[crc::tsk::build][crc::sck::build::U_K2]);
+		if (packed)
+		{
+			auto &upk = *this->unpacker[tid];
+
+			if (this->params_BFER_std.crc->type == "NO")
+				crc[crc::tsk::build_packed][crc::sck::build_packed::U_K2](src_U_K);
+			if (this->params_BFER_std.cdc->enc->type == "NO")
+				enc[enc::tsk::encode_packed][enc::sck::encode_packed::X_N](crc[crc::tsk::build_packed][crc::sck::build_packed::U_K2]);
+
+			crc[crc::tsk::build_packed ][crc::sck::build_packed ::U_K1](src_U_K);
+			enc[enc::tsk::encode_packed][enc::sck::encode_packed::U_K ](crc[crc::tsk::build_packed ][crc::sck::build_packed ::U_K2]);
+			upk[upk::tsk::unpack       ][upk::sck::unpack       ::X_N1](enc[enc::tsk::encode_packed][enc::sck::encode_packed::X_N ]);
+		}
+		else
+		{
+			if (this->params_BFER_std.crc->type == "NO")
+				crc[crc::tsk::build][crc::sck::build::U_K2](src_U_K);
+			if (this->params_BFER_std.cdc->enc->type == "NO")
+				enc[enc::tsk::encode][enc::sck::encode::X_N](crc[crc::tsk::build][crc::sck::build::U_K2]);
+
+			crc[crc::tsk::build ][crc::sck::build ::U_K1](src_U_K);
+			enc[enc::tsk::encode][enc::sck::encode::U_K ](crc[crc::tsk::build][crc::sck::build::U_K2]);
+		}
+
+		auto &enc_X_N = packed ? (*this->unpacker[tid])[upk::tsk::unpack][upk::sck::unpack::X_N2]
+		                       : enc[enc::tsk::encode][enc::sck::encode::X_N];
+
 		if (this->params_BFER_std.cdc->pct == nullptr || this->params_BFER_std.cdc->pct->type == "NO")
-			pct[pct::tsk::puncture][pct::sck::puncture::X_N2](enc[enc::tsk::encode][enc::sck::encode::X_N]);
+			pct[pct::tsk::puncture][pct::sck::puncture::X_N2](enc_X_N);
 
-		crc[crc::tsk::build   ][crc::sck::build   ::U_K1](src[src::tsk::generate][src::sck::generate::U_K ]);
-		enc[enc::tsk::encode  ][enc::sck::encode  ::U_K ](crc[crc::tsk::build   ][crc::sck::build   ::U_K2]);
-		pct[pct::tsk::puncture][pct::sck::puncture::X_N1](enc[enc::tsk::encode  ][enc::sck::encode  ::X_N ]);
+		pct[pct::tsk::puncture][pct::sck::puncture::X_N1](enc_X_N);
 		mdm[mdm::tsk::modulate][mdm::sck::modulate::X_N1](pct[pct::tsk::puncture][pct::sck::puncture::X_N2]);
 	}
 
-	if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
+	// the fused front-end replaces the modem, the channel and the quantizer between the puncturer and the depuncturer
+	auto &fe_Y_N = this->params_BFER_std.fused_fe
+	             ? (*this->front_end[tid])[fe::tsk::process][fe::sck::process::Y_N]
+	             : qnt[qnt::tsk::process][qnt::sck::process::Y_N2];
+
+	if (this->params_BFER_std.fused_fe)
+	{
+		(*this->front_end[tid])[fe::tsk::process][fe::sck::process::X_N](pct[pct::tsk::puncture][pct::sck::puncture::X_N2]);
+	}
+	else if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
 	{
 		if (this->params_BFER_std.chn->type == "NO")
 		{
@@ -171,9 +383,9 @@ void BFER_std_threads<B,R,Q>
 	}
 
 	if (this->params_BFER_std.cdc->pct == nullptr || this->params_BFER_std.cdc->pct->type == "NO")
-		pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N2](qnt[qnt::tsk::process][qnt::sck::process::Y_N2]);
+		pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N2](fe_Y_N);
 
-	pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N1](qnt[qnt::tsk::process][qnt::sck::process::Y_N2]);
+	pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N1](fe_Y_N);
 
 	if (this->params_BFER_std.coset)
 	{
@@ -203,6 +415,14 @@ void BFER_std_threads<B,R,Q>
 		{
 			dec[dec::tsk::decode_siho_cw][dec::sck::decode_siho_cw::Y_N](pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N2]);
 		}
+		else if (packed)
+		{
+			if (this->params_BFER_std.crc->type == "NO")
+				crc[crc::tsk::extract_packed][crc::sck::extract_packed::V_K2](dec[dec::tsk::decode_siho_packed][dec::sck::decode_siho_packed::V_K]);
+
+			dec[dec::tsk::decode_siho_packed][dec::sck::decode_siho_packed::Y_N ](pct[pct::tsk::depuncture        ][pct::sck::depuncture        ::Y_N2]);
+			crc[crc::tsk::extract_packed    ][crc::sck::extract_packed    ::V_K1](dec[dec::tsk::decode_siho_packed][dec::sck::decode_siho_packed::V_K ]);
+		}
 		else
 		{
 			if (this->params_BFER_std.crc->type == "NO")
@@ -226,16 +446,21 @@ void BFER_std_threads<B,R,Q>
 			mnt[mnt::tsk::check_errors][mnt::sck::check_errors::V](dec[dec::tsk::decode_siho_cw][dec::sck::decode_siho_cw::V_N]);
 		}
 	}
+	else if (packed)
+	{
+		mnt[mnt::tsk::check_errors_packed][mnt::sck::check_errors_packed::U](src_U_K);
+		mnt[mnt::tsk::check_errors_packed][mnt::sck::check_errors_packed::V](crc[crc::tsk::extract_packed][crc::sck::extract_packed::V_K2]);
+	}
 	else
 	{
-		mnt[mnt::tsk::check_errors][mnt::sck::check_errors::U](src[src::tsk::generate][src::sck::generate::U_K ]);
-		mnt[mnt::tsk::check_errors][mnt::sck::check_errors::V](crc[crc::tsk::extract ][crc::sck::extract ::V_K2]);
+		mnt[mnt::tsk::check_errors][mnt::sck::check_errors::U](src_U_K);
+		mnt[mnt::tsk::check_errors][mnt::sck::check_errors::V](crc[crc::tsk::extract][crc::sck::extract::V_K2]);
 	}
 }
 
 template <typename B, typename R, typename Q>
 void BFER_std_threads<B,R,Q>
-::simulation_loop(const int tid)
+::build_sequence(const int tid)
 {
 	auto &source     = *this->source    [tid];
 	auto &crc        = *this->crc       [tid];
@@ -250,96 +475,326 @@ void BFER_std_threads<B,R,Q>
 	auto &monitor    = *this->monitor   [tid];
 
 	using namespace module;
+
+	auto &seq = this->sequences[tid];
+	seq.clear();
+
+	// the pipeline stages are: transmitter, channel & receiver front-end, decoder and monitor (the stages which share
+	// a module are merged, see "get_stages")
+	auto &stg = this->stages_begin[tid];
+	stg.clear();
+	stg.push_back(0);
+
+	const auto packed = this->params_BFER_std.packed;
+
+	if (this->params_BFER_std.src->type != "AZCW")
+	{
+		seq.push_back(&source[packed ? src::tsk::generate_packed : src::tsk::generate]);
+		if (this->params_BFER_std.crc->type != "NO")
+			seq.push_back(&crc[packed ? crc::tsk::build_packed : crc::tsk::build]);
+		if (this->params_BFER_std.cdc->enc->type != "NO")
+			seq.push_back(&encoder[packed ? enc::tsk::encode_packed : enc::tsk::encode]);
+		if (packed)
+			seq.push_back(&(*this->unpacker[tid])[upk::tsk::unpack]);
+		if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
+			seq.push_back(&puncturer[pct::tsk::puncture]);
+		if (!this->params_BFER_std.fused_fe)
+			seq.push_back(&modem[mdm::tsk::modulate]);
+	}
+
+	stg.push_back(seq.size());
+
+	if (this->params_BFER_std.fused_fe)
+	{
+		seq.push_back(&(*this->front_end[tid])[fe::tsk::process]);
+	}
+	else if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
+	{
+		if (this->params_BFER_std.chn->type != "NO")
+			seq.push_back(&channel[chn::tsk::add_noise_wg]);
+		if (modem.is_filter())
+			seq.push_back(&modem[mdm::tsk::filter]);
+		if (modem.is_demodulator())
+			seq.push_back(&modem[mdm::tsk::demodulate_wg]);
+		if (this->params_BFER_std.qnt->type != "NO")
+			seq.push_back(&quantizer[qnt::tsk::process]);
+	}
+	else
+	{
+		if (this->params_BFER_std.chn->type != "NO")
+			seq.push_back(&channel[chn::tsk::add_noise]);
+		if (modem.is_filter())
+			seq.push_back(&modem[mdm::tsk::filter]);
+		if (modem.is_demodulator())
+			seq.push_back(&modem[mdm::tsk::demodulate]);
+		if (this->params_BFER_std.qnt->type != "NO")
+			seq.push_back(&quantizer[qnt::tsk::process]);
+	}
+
+	if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
+		seq.push_back(&puncturer[pct::tsk::depuncture]);
+
+	stg.push_back(seq.size());
+
+	if (this->params_BFER_std.coset)
+	{
+		seq.push_back(&coset_real[cst::tsk::apply]);
+
+		if (this->params_BFER_std.coded_monitoring)
+		{
+			seq.push_back(&decoder  [dec::tsk::decode_siho_cw]);
+			seq.push_back(&coset_bit[cst::tsk::apply         ]);
+		}
+		else
+		{
+			seq.push_back(&decoder  [dec::tsk::decode_siho]);
+			seq.push_back(&coset_bit[cst::tsk::apply      ]);
+			if (this->params_BFER_std.crc->type != "NO")
+				seq.push_back(&crc[crc::tsk::extract]);
+		}
+	}
+	else
+	{
+		if (this->params_BFER_std.coded_monitoring)
+		{
+			seq.push_back(&decoder[dec::tsk::decode_siho_cw]);
+		}
+		else
+		{
+			seq.push_back(&decoder[packed ? dec::tsk::decode_siho_packed : dec::tsk::decode_siho]);
+			if (this->params_BFER_std.crc->type != "NO")
+				seq.push_back(&crc[packed ? crc::tsk::extract_packed : crc::tsk::extract]);
+		}
+	}
+
+	stg.push_back(seq.size());
+	seq.push_back(&monitor[packed ? mnt::tsk::check_errors_packed : mnt::tsk::check_errors]);
+}
+
+template <typename B, typename R, typename Q>
+std::vector<std::vector<module::Task*>> BFER_std_threads<B,R,Q>
+::get_stages(const int tid) const
+{
+	const auto &seq = this->sequences   [tid];
+	const auto &stg = this->stages_begin[tid];
+
+	const auto n_stages = stg.size();
+	auto stage_begin = [&](const size_t s) { return stg[s]; };
+	auto stage_end   = [&](const size_t s) { return (s < n_stages -1) ? stg[s +1] : seq.size(); };
+
+	// the modules whose states and buffers are used by a task, the CRC-aided decoders use the CRC module of the chain
+	const module::Module* decoder = this->codec[tid]->get_decoder_siho();
+	const module::Module* crc     = this->crc[tid];
+	const auto use_crc = this->params_BFER_std.crc->type != "NO";
+	auto modules = [&](const module::Task *t) -> std::vector<const module::Module*>
+	{
+		if (use_crc && &t->get_module() == decoder)
+			return {decoder, crc};
+		return {&t->get_module()};
+	};
+
+	// the tasks of a same module can't be executed at the same time by two stages (the CRC built in the transmitter
+	// and checked by the decoder, the modulation and the demodulation, the puncturing and the depuncturing...): all
+	// the stages between the first and the last task of a module are merged in one stage
+	std::map<const module::Module*, size_t> last_stage;
+	for (size_t s = 0; s < n_stages; s++)
+		for (auto t = stage_begin(s); t < stage_end(s); t++)
+			for (auto m : modules(seq[t]))
+				last_stage[m] = s;
+
+	std::vector<std::vector<module::Task*>> stages;
+	for (size_t s = 0; s < n_stages;)
+	{
+		auto last = s;
+		for (auto k = s; k <= last; k++)
+			for (auto t = stage_begin(k); t < stage_end(k); t++)
+				for (auto m : modules(seq[t]))
+					last = std::max(last, last_stage[m]);
+
+		if (stage_begin(s) < stage_end(last)) // skip the empty stages
+			stages.push_back(std::vector<module::Task*>(seq.begin() + stage_begin(s), seq.begin() + stage_end(last)));
+
+		s = last +1;
+	}
+
+	return stages;
+}
+
+template <typename B, typename R, typename Q>
+bool BFER_std_threads<B,R,Q>
+::keep_looping(const int tid)
+{
 	using namespace std::chrono;
-	auto t_snr = steady_clock::now();
+
+	auto &monitor_red = this->get_monitor_red(tid);
+
+	return !monitor_red.fe_limit_achieved() && // while max frame error count has not been reached
+	       (this->params_BFER_std.stop_time == seconds(0) ||
+	       (steady_clock::now() - this->t_snr) < this->params_BFER_std.stop_time) &&
+	       (this->max_fra == 0 || monitor_red.get_n_analyzed_fra() < this->max_fra) &&
+	       !this->point_done(tid);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::simulation_loop(const int tid)
+{
+	auto &monitor = *this->monitor[tid];
+
+	using namespace module;
+
+	const auto mnt_tsk = this->params_BFER_std.packed ? mnt::tsk::check_errors_packed : mnt::tsk::check_errors;
 
 	// communication chain execution
-	while (!this->monitor_red->fe_limit_achieved() && // while max frame error count has not been reached
-	       (this->params_BFER_std.stop_time == seconds(0) || 
-	       (steady_clock::now() - t_snr) < this->params_BFER_std.stop_time) &&
-	       (this->monitor_red->get_n_analyzed_fra() < this->max_fra || this->max_fra == 0))
+	while (this->keep_looping(tid))
 	{
 		if (this->params_BFER_std.debug)
 		{
-			if (!monitor[mnt::tsk::check_errors].get_n_calls())
+			if (!monitor[mnt_tsk].get_n_calls())
 				std::cout << "#" << std::endl;
 
 			std::cout << "# -------------------------------" << std::endl;
-			std::cout << "# New communication (n°" << monitor[mnt::tsk::check_errors].get_n_calls() << ")" << std::endl;
+			std::cout << "# New communication (n°" << monitor[mnt_tsk].get_n_calls() << ")" << std::endl;
 			std::cout << "# -------------------------------" << std::endl;
 			std::cout << "#" << std::endl;
 		}
 
-		if (this->params_BFER_std.src->type != "AZCW")
-		{
-			source[src::tsk::generate].exec();
-			if (this->params_BFER_std.crc->type != "NO")
-				crc[crc::tsk::build].exec();
-			if (this->params_BFER_std.cdc->enc->type != "NO")
-				encoder[enc::tsk::encode].exec();
-			if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
-				puncturer[pct::tsk::puncture].exec();
-			modem[mdm::tsk::modulate].exec();
-		}
+		for (auto *task : this->sequences[tid])
+			task->exec();
+	}
+}
 
-		if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
+template <typename B, typename R, typename Q>
+bool BFER_std_threads<B,R,Q>
+::get_job(const int wid, Job &job)
+{
+	// first look for a job in the local queue, then try to steal a job in the queues of the other threads
+	auto found = this->queues[wid]->pop(job);
+
+	const auto n_workers = (int)this->queues.size();
+	for (auto w = 1; w < n_workers && !found; w++)
+		found = this->queues[(wid + w) % n_workers]->steal(job);
+
+	if (found)
+		this->n_jobs--;
+
+	return found;
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::push_job(const int wid, const Job &job)
+{
+	this->queues[wid]->push(job);
+	this->n_jobs++;
+
+	// wake up a thread waiting for a job (the lock ensures that the thread is waiting or has not checked 'n_jobs' yet)
+	if (this->n_parked > 0)
+	{
+		std::lock_guard<std::mutex> lock(this->mutex_parking);
+		this->cond_parking.notify_one();
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::wake_all()
+{
+	std::lock_guard<std::mutex> lock(this->mutex_parking);
+	this->cond_parking.notify_all();
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::retire_chain(const int tid)
+{
+	// the first stage and the last stage can both see that the chain is over
+	if (!this->chains[tid]->retired.exchange(true))
+		if (--this->n_active_chains <= 0)
+			this->wake_all();
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::run_job(const int wid, const Job &job)
+{
+	const auto tid = job.chain;
+	const auto s   = (size_t)job.stage;
+
+	auto &chain    = *this->chains[tid];
+	auto &pipeline = *chain.pipeline;
+	const auto n_stages = pipeline.get_n_stages();
+
+	// there is only one job per stage of a chain: the job processes the ready frame batches of the stage one by one
+	// and it is given back when there is none (a producer creates it again with the first ready frame batch)
+	do
+	{
+		if (s == 0)
 		{
-			if (this->params_BFER_std.chn->type != "NO")
-				channel[chn::tsk::add_noise_wg].exec();
-			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate_wg].exec();
-			if (this->params_BFER_std.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
+			// a new frame batch is about to be processed by this chain: check if the chain has to be retired
+			if (!this->keep_looping())
+			{
+				chain.stopped = true; // the job of the first stage is dropped, the frame batches in flight continue
+				if (chain.n_in_flight == 0)
+					this->retire_chain(tid);
+				return;
+			}
+			chain.n_in_flight++;
 		}
-		else
+
+		if (!pipeline.step(s))
 		{
-			if (this->params_BFER_std.chn->type != "NO")
-				channel[chn::tsk::add_noise].exec();
-			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate].exec();
-			if (this->params_BFER_std.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
+			std::stringstream message;
+			message << "The stage " << s << " of the chain " << tid << " has no frame batch to process.";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 		}
 
-		if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
-			puncturer[pct::tsk::depuncture].exec();
+		if (s == n_stages -1 && --chain.n_in_flight == 0 && chain.stopped)
+			this->retire_chain(tid);
 
-		if (this->params_BFER_std.coset)
+		// the next stage is pushed in the local queue to be executed while the data are still hot (the last stage
+		// gives the slot back to the first stage)
+		const auto next = (s +1) % n_stages;
+		if (chain.n_ready[next]++ == 0)
+			this->push_job(wid, Job{tid, (int)next});
+	}
+	while (--chain.n_ready[s] > 0);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::work_stealing_loop(const int wid)
+{
+	Job job;
+	while (this->n_active_chains > 0)
+	{
+		// spin a few times before to sleep, a job is usually about to be pushed by the other threads
+		auto found = false;
+		for (auto i = 0; i < 64 && !found && this->n_active_chains > 0; i++)
+			if (!(found = this->get_job(wid, job)))
+				std::this_thread::yield();
+
+		if (!found)
 		{
-			coset_real[cst::tsk::apply].exec();
+			std::unique_lock<std::mutex> lock(this->mutex_parking);
+			this->n_parked++;
+			while (this->n_jobs == 0 && this->n_active_chains > 0)
+				this->cond_parking.wait(lock);
+			this->n_parked--;
+			continue;
+		}
 
-			if (this->params_BFER_std.coded_monitoring)
-			{
-				decoder  [dec::tsk::decode_siho_cw].exec();
-				coset_bit[cst::tsk::apply         ].exec();
-			}
-			else
-			{
-				decoder  [dec::tsk::decode_siho].exec();
-				coset_bit[cst::tsk::apply      ].exec();
-				if (this->params_BFER_std.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
+		try
+		{
+			this->run_job(wid, job);
 		}
-		else
+		catch (...)
 		{
-			if (this->params_BFER_std.coded_monitoring)
-			{
-				decoder[dec::tsk::decode_siho_cw].exec();
-			}
-			else
-			{
-				decoder[dec::tsk::decode_siho].exec();
-				if (this->params_BFER_std.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
+			// stop all the threads
+			this->n_active_chains = 0;
+			this->wake_all();
+			throw;
 		}
-
-		monitor[mnt::tsk::check_errors].exec();
 	}
 }
 
@@ -1,6 +1,17 @@
 #ifndef SIMULATION_BFER_STD_THREADS_HPP_
 #define SIMULATION_BFER_STD_THREADS_HPP_
 
+#include <mutex>
+#include <chrono>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <condition_variable>
+
+#include "Tools/Threads/Pipeline.hpp"
+#include "Tools/Threads/Work_stealing_queue.hpp"
+
 #include "../BFER_std.hpp"
 
 namespace aff3ct
@@ -10,6 +21,37 @@ namespace simulation
 template <typename B = int, typename R = float, typename Q = R>
 class BFER_std_threads : public BFER_std<B,R,Q>
 {
+private:
+	// the tasks of each communication chain in execution order
+	std::vector<std::vector<module::Task*>> sequences;
+	// the positions in the sequences where the pipeline stages begin
+	std::vector<std::vector<size_t>> stages_begin;
+
+	// work-stealing scheduler: each chain is a pipeline with several frame batches in flight, a job is the execution of
+	// a stage of a chain on its ready frame batches
+	struct Job
+	{
+		int chain;
+		int stage;
+	};
+	struct Chain_state
+	{
+		tools::Pipeline                    *pipeline = nullptr;
+		std::unique_ptr<std::atomic<int>[]> n_ready;     // number of frame batches ready for each stage
+		std::atomic<int>                    n_in_flight; // number of frame batches between the first and the last stage
+		std::atomic<bool>                   stopped;     // true when the first stage does not start frame batches anymore
+		std::atomic<bool>                   retired;
+	};
+	std::vector<Chain_state*>                                       chains;
+	std::vector<tools::Work_stealing_queue<Job>*>                   queues;
+	std::atomic<int>                                                n_active_chains;
+	std::atomic<int>                                                n_jobs;   // number of jobs in the queues
+	std::atomic<int>                                                n_parked; // number of threads waiting for a job
+	std::mutex                                                      mutex_parking;
+	std::condition_variable                                         cond_parking;
+
+	std::chrono::time_point<std::chrono::steady_clock> t_snr;
+
 public:
 	explicit BFER_std_threads(const factory::BFER_std::parameters &params_BFER_std);
 	virtual ~BFER_std_threads();
@@ -18,10 +60,26 @@ protected:
 	virtual void _launch();
 
 private:
-	void sockets_binding(const int tid = 0);
-	void simulation_loop(const int tid = 0);
+	void sockets_binding   (const int tid = 0);
+	void build_sequence    (const int tid = 0);
+	void simulation_loop   (const int tid = 0);
+	void work_stealing_loop(const int wid = 0);
+	bool keep_looping      (const int tid = 0);
+	bool get_job           (const int wid,       Job &job);
+	void push_job          (const int wid, const Job &job);
+	void run_job           (const int wid, const Job &job);
+	void retire_chain      (const int tid);
+	void wake_all          (                 );
+
+	std::vector<std::vector<module::Task*>> get_stages(const int tid = 0) const;
+
+	void _launch_chains       (void (*start)(BFER_std_threads<B,R,Q>*, const int));
+	void _launch_work_stealing();
 
-	static void start_thread(BFER_std_threads<B,R,Q> *simu, const int tid = 0);
+	static void start_thread              (BFER_std_threads<B,R,Q> *simu, const int tid = 0);
+	static void start_thread_pipeline     (BFER_std_threads<B,R,Q> *simu, const int tid = 0);
+	static void start_thread_work_stealing(BFER_std_threads<B,R,Q> *simu, const int wid = 0);
+	static void save_exception            (BFER_std_threads<B,R,Q> *simu, const std::exception &e);
 };
 }
 }
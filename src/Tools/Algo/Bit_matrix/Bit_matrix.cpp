@@ -0,0 +1,126 @@
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Bit_matrix.hpp"
+
+using namespace aff3ct::tools;
+
+Bit_matrix
+::Bit_matrix(const unsigned n_rows, const unsigned n_cols)
+: n_rows(n_rows), n_cols(n_cols), n_words(Bit_matrix::n_words_for(n_cols)), data((size_t)n_rows * n_words, 0)
+{
+}
+
+Bit_matrix
+::Bit_matrix(const Sparse_matrix &S, const bool trans)
+: Bit_matrix(trans ? S.get_n_cols() : S.get_n_rows(), trans ? S.get_n_rows() : S.get_n_cols())
+{
+	for (unsigned r = 0; r < S.get_n_rows(); r++)
+		for (auto c : S.get_cols_from_row(r))
+		{
+			if (trans) this->set(c, r);
+			else       this->set(r, c);
+		}
+}
+
+Bit_matrix
+::~Bit_matrix()
+{
+}
+
+unsigned Bit_matrix
+::n_words_for(const unsigned n_bits)
+{
+	const auto n_words_reg = (unsigned)mipp::nElReg<int64_t>();
+	const auto n_words     = (n_bits + 63) / 64;
+	return ((n_words + n_words_reg -1) / n_words_reg) * n_words_reg;
+}
+
+void Bit_matrix
+::mul(const uint64_t *x, uint64_t *y) const
+{
+	std::fill(y, y + this->n_words, (uint64_t)0);
+
+	for (unsigned w = 0; w < (this->n_rows + 63) / 64; w++)
+	{
+		auto word = x[w];
+		for (unsigned r = w * 64; word && r < this->n_rows; r++, word >>= 1)
+			if (word & 1)
+				Bit_matrix::xor_words(y, (*this)[r], this->n_words);
+	}
+}
+
+bool Bit_matrix
+::operator==(const Bit_matrix &M) const
+{
+	// the padding bits are always 0: the packed rows can be compared word by word
+	return this->n_rows == M.n_rows && this->n_cols == M.n_cols && this->data == M.data;
+}
+
+bool Bit_matrix
+::operator!=(const Bit_matrix &M) const
+{
+	return !(*this == M);
+}
+
+Bit_matrix Bit_matrix
+::transpose() const
+{
+	Bit_matrix trans(this->n_cols, this->n_rows);
+
+	for (unsigned r = 0; r < this->n_rows; r++)
+		for (unsigned c = 0; c < this->n_cols; c++)
+			if (this->get(r, c))
+				trans.set(c, r);
+
+	return trans;
+}
+
+Bit_matrix Bit_matrix
+::inverse() const
+{
+	if (this->n_rows != this->n_cols)
+	{
+		std::stringstream message;
+		message << "The matrix has to be square ('n_rows' = " << this->n_rows << ", 'n_cols' = " << this->n_cols
+		        << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto n = this->n_rows;
+
+	Bit_matrix mat(*this), inv(n, n);
+	for (unsigned i = 0; i < n; i++)
+		inv.set(i, i);
+
+	for (unsigned c = 0; c < n; c++)
+	{
+		unsigned p = c;
+		while (p < n && !mat.get(p, c))
+			p++;
+
+		if (p == n)
+		{
+			std::stringstream message;
+			message << "The matrix is not invertible ('col' = " << c << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (p != c)
+		{
+			std::swap_ranges(mat[p], mat[p] + this->n_words, mat[c]);
+			std::swap_ranges(inv[p], inv[p] + this->n_words, inv[c]);
+		}
+
+		for (unsigned r = 0; r < n; r++)
+			if (r != c && mat.get(r, c))
+			{
+				Bit_matrix::xor_words(mat[r], mat[c], this->n_words);
+				Bit_matrix::xor_words(inv[r], inv[c], this->n_words);
+			}
+	}
+
+	return inv;
+}
@@ -0,0 +1,109 @@
+/*!
+ * \file
+ * \brief Dense binary matrix with 64 bits packed per word (computations in GF(2)).
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef BIT_MATRIX_HPP_
+#define BIT_MATRIX_HPP_
+
+#include <cstdint>
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Bit_matrix
+ *
+ * \brief Dense binary matrix, the bits are packed by rows in 64-bit words.
+ *
+ * The bit (r,c) is the bit 'c % 64' of the word 'c / 64' of the row 'r'. The rows are padded to a multiple of the
+ * SIMD register size so they can be XORed with MIPP, the padding bits are always 0.
+ */
+class Bit_matrix
+{
+private:
+	unsigned n_rows;
+	unsigned n_cols;
+	unsigned n_words; // number of words per row (padding included)
+
+	mipp::vector<uint64_t> data;
+
+public:
+	Bit_matrix(const unsigned n_rows = 0, const unsigned n_cols = 0);
+
+	/*!
+	 * \brief Builds the dense version of a sparse matrix.
+	 *
+	 * \param S:     the sparse matrix.
+	 * \param trans: if true, the transposed of S is built.
+	 */
+	explicit Bit_matrix(const Sparse_matrix &S, const bool trans = false);
+
+	virtual ~Bit_matrix();
+
+	inline unsigned get_n_rows () const { return this->n_rows;  }
+	inline unsigned get_n_cols () const { return this->n_cols;  }
+	inline unsigned get_n_words() const { return this->n_words; }
+
+	inline       uint64_t* operator[](const size_t row)       { return this->data.data() + row * this->n_words; }
+	inline const uint64_t* operator[](const size_t row) const { return this->data.data() + row * this->n_words; }
+
+	inline bool get (const size_t row, const size_t col) const;
+	inline void set (const size_t row, const size_t col, const bool bit = true);
+	inline void flip(const size_t row, const size_t col);
+
+	/*!
+	 * \brief Returns true if both matrices have the same dimensions and the same bits.
+	 */
+	bool operator==(const Bit_matrix &M) const;
+	bool operator!=(const Bit_matrix &M) const;
+
+	/*!
+	 * \brief Computes y = x.M, y is the XOR of the rows selected by the bits of x.
+	 *
+	 * \param x: packed input vector of 'n_rows' bits.
+	 * \param y: packed output vector of 'n_words' words.
+	 */
+	void mul(const uint64_t *x, uint64_t *y) const;
+
+	/*!
+	 * \brief Returns the transposed matrix.
+	 */
+	Bit_matrix transpose() const;
+
+	/*!
+	 * \brief Returns the inverse of the matrix (Gauss-Jordan elimination), throws if the matrix is not invertible.
+	 */
+	Bit_matrix inverse() const;
+
+	/*!
+	 * \brief Number of words required to store 'n_bits' packed bits (SIMD padding included).
+	 */
+	static unsigned n_words_for(const unsigned n_bits);
+
+	/*!
+	 * \brief dst ^= src on 'n_words' words (SIMD), 'n_words' has to be a multiple of the SIMD register size.
+	 */
+	static inline void xor_words(uint64_t *dst, const uint64_t *src, const unsigned n_words);
+
+	static inline bool get_bit(const uint64_t *words, const size_t pos);
+
+	template <typename B>
+	static inline void pack(const B *in, uint64_t *out, const unsigned n_bits);
+
+	template <typename B>
+	static inline void unpack(const uint64_t *in, B *out, const unsigned n_bits);
+};
+}
+}
+
+#include "Bit_matrix.hxx"
+
+#endif /* BIT_MATRIX_HPP_ */
@@ -0,0 +1,74 @@
+#include "Bit_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+bool Bit_matrix
+::get(const size_t row, const size_t col) const
+{
+	return Bit_matrix::get_bit((*this)[row], col);
+}
+
+void Bit_matrix
+::set(const size_t row, const size_t col, const bool bit)
+{
+	auto &w = (*this)[row][col >> 6];
+	const auto m = (uint64_t)1 << (col & 63);
+	w = bit ? (w | m) : (w & ~m);
+}
+
+void Bit_matrix
+::flip(const size_t row, const size_t col)
+{
+	(*this)[row][col >> 6] ^= (uint64_t)1 << (col & 63);
+}
+
+void Bit_matrix
+::xor_words(uint64_t *dst, const uint64_t *src, const unsigned n_words)
+{
+	for (unsigned w = 0; w < n_words; w += mipp::nElReg<int64_t>())
+	{
+		const auto r_dst = mipp::Reg<int64_t>((int64_t*)dst + w);
+		const auto r_src = mipp::Reg<int64_t>((int64_t*)src + w);
+		(r_dst ^ r_src).store((int64_t*)dst + w);
+	}
+}
+
+bool Bit_matrix
+::get_bit(const uint64_t *words, const size_t pos)
+{
+	return (words[pos >> 6] >> (pos & 63)) & 1;
+}
+
+template <typename B>
+void Bit_matrix
+::pack(const B *in, uint64_t *out, const unsigned n_bits)
+{
+	const auto n_full = n_bits >> 6;
+	for (unsigned w = 0; w < n_full; w++)
+	{
+		uint64_t word = 0;
+		for (unsigned b = 0; b < 64; b++)
+			word |= (uint64_t)(in[w * 64 + b] != 0) << b;
+		out[w] = word;
+	}
+
+	if (n_bits & 63)
+	{
+		uint64_t word = 0;
+		for (unsigned b = 0; b < (n_bits & 63); b++)
+			word |= (uint64_t)(in[n_full * 64 + b] != 0) << b;
+		out[n_full] = word;
+	}
+}
+
+template <typename B>
+void Bit_matrix
+::unpack(const uint64_t *in, B *out, const unsigned n_bits)
+{
+	for (unsigned i = 0; i < n_bits; i++)
+		out[i] = (B)((in[i >> 6] >> (i & 63)) & 1);
+}
+}
+}
@@ -0,0 +1,129 @@
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Bit_matrix_M4R.hpp"
+
+using namespace aff3ct::tools;
+
+// in-memory cache, shared by all the threads of the process: the hash of the packed matrix is completed by its
+// dimensions and by 'k', the matrix is kept in the entry and compared on a hit (two matrices can share a hash), the
+// tables are owned by their users
+using M4R_key = std::tuple<uint64_t, unsigned, unsigned, unsigned>;
+struct M4R_entry
+{
+	Bit_matrix                            M;
+	std::weak_ptr<const Bit_matrix_M4R> tables;
+};
+static std::mutex                            m4r_mutex;
+static std::multimap<M4R_key, M4R_entry> m4r_tables;
+
+Bit_matrix_M4R
+::Bit_matrix_M4R(const Bit_matrix &M, const unsigned k)
+: n_rows  (M.get_n_rows()                       ),
+  n_cols  (M.get_n_cols()                       ),
+  n_words (M.get_n_words()                      ),
+  k       (k                                    ),
+  n_groups(k ? (M.get_n_rows() + k -1) / k : 0  )
+{
+	if (k != 1 && k != 2 && k != 4 && k != 8)
+	{
+		std::stringstream message;
+		message << "'k' has to be 1, 2, 4 or 8 ('k' = " << k << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->tables.resize((size_t)n_groups * ((size_t)1 << k) * n_words, 0);
+
+	// the combination 'idx' is the combination 'idx' without its lowest set bit 'b', XORed with the row 'b'
+	const auto n_combs = 1u << k;
+	for (unsigned g = 0; g < n_groups; g++)
+	{
+		auto T = this->tables.data() + (size_t)g * n_combs * n_words;
+		for (unsigned idx = 1; idx < n_combs; idx++)
+		{
+			unsigned b = 0;
+			while (!((idx >> b) & 1))
+				b++;
+
+			const auto prev = idx & (idx -1);
+			std::copy(T + (size_t)prev * n_words, T + (size_t)(prev +1) * n_words, T + (size_t)idx * n_words);
+
+			const auto r = g * k + b;
+			if (r < n_rows)
+				Bit_matrix::xor_words(T + (size_t)idx * n_words, M[r], n_words);
+		}
+	}
+}
+
+Bit_matrix_M4R
+::~Bit_matrix_M4R()
+{
+}
+
+void Bit_matrix_M4R
+::mul(const uint64_t *x, uint64_t *y) const
+{
+	std::fill(y, y + this->n_words, (uint64_t)0);
+
+	const auto n_combs = 1u << this->k;
+	const auto mask    = (uint64_t)(n_combs -1);
+	for (unsigned g = 0; g < this->n_groups; g++)
+	{
+		// 'k' divides 64: a group never spans two words
+		const auto pos = g * this->k;
+		const auto idx = (unsigned)((x[pos >> 6] >> (pos & 63)) & mask);
+
+		if (idx)
+			Bit_matrix::xor_words(y, this->tables.data() + ((size_t)g * n_combs + idx) * this->n_words, this->n_words);
+	}
+}
+
+unsigned Bit_matrix_M4R
+::best_k(const unsigned n_rows, const unsigned n_cols, const size_t max_bytes)
+{
+	const auto row_bytes = (size_t)Bit_matrix::n_words_for(n_cols) * sizeof(uint64_t);
+	for (unsigned k = 8; k > 1; k /= 2)
+		if ((size_t)((n_rows + k -1) / k) * ((size_t)1 << k) * row_bytes <= max_bytes)
+			return k;
+	return 1;
+}
+
+std::shared_ptr<const Bit_matrix_M4R> Bit_matrix_M4R
+::get_shared(const Bit_matrix &M, const size_t max_bytes)
+{
+	const auto k = Bit_matrix_M4R::best_k(M.get_n_rows(), M.get_n_cols(), max_bytes);
+
+	// FNV-1a hash of the packed rows
+	uint64_t h = 14695981039346656037ULL;
+	for (unsigned r = 0; r < M.get_n_rows(); r++)
+		for (unsigned w = 0; w < M.get_n_words(); w++)
+		{
+			h ^= M[r][w];
+			h *= 1099511628211ULL;
+		}
+
+	const auto key = std::make_tuple(h, M.get_n_rows(), M.get_n_cols(), k);
+
+	// the tables are built under the lock: the other threads wait for them instead of building their own
+	std::lock_guard<std::mutex> lock(m4r_mutex);
+
+	for (auto it = m4r_tables.begin(); it != m4r_tables.end();)
+		if (it->second.tables.expired()) it = m4r_tables.erase(it);
+		else                             ++it;
+
+	const auto range = m4r_tables.equal_range(key);
+	for (auto it = range.first; it != range.second; ++it)
+		if (it->second.M == M)
+			if (auto tables = it->second.tables.lock())
+				return tables;
+
+	auto tables = std::make_shared<const Bit_matrix_M4R>(M, k);
+	m4r_tables.insert(std::make_pair(key, M4R_entry{M, tables}));
+
+	return tables;
+}
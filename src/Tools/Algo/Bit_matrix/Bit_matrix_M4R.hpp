@@ -0,0 +1,84 @@
+/*!
+ * \file
+ * \brief Vector-matrix product in GF(2) with the Method of Four Russians.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef BIT_MATRIX_M4R_HPP_
+#define BIT_MATRIX_M4R_HPP_
+
+#include <memory>
+#include <cstdint>
+#include <mipp.h>
+
+#include "Bit_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Bit_matrix_M4R
+ *
+ * \brief Precomputed tables of the Method of Four Russians (M4R) for the product y = x.M in GF(2).
+ *
+ * The rows of M are grouped by 'k', for each group the 2^k XOR combinations of its rows are precomputed. A product
+ * then requires one table lookup and one row XOR per group of 'k' bits of x instead of one row XOR per set bit.
+ * The tables take (2^k / k) times the memory of the packed matrix. They are never modified after the construction: a
+ * single instance can be shared by all the threads (see 'get_shared').
+ */
+class Bit_matrix_M4R
+{
+private:
+	unsigned n_rows;
+	unsigned n_cols;
+	unsigned n_words;  // number of words per row of M (padding included)
+	unsigned k;        // number of rows per group (1, 2, 4 or 8)
+	unsigned n_groups;
+
+	mipp::vector<uint64_t> tables; // 'n_groups' x 2^k rows of 'n_words' words
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param M: the matrix.
+	 * \param k: number of rows per group (1, 2, 4 or 8).
+	 */
+	explicit Bit_matrix_M4R(const Bit_matrix &M = Bit_matrix(), const unsigned k = 8);
+
+	virtual ~Bit_matrix_M4R();
+
+	inline unsigned get_n_rows () const { return this->n_rows;  }
+	inline unsigned get_n_cols () const { return this->n_cols;  }
+	inline unsigned get_n_words() const { return this->n_words; }
+	inline unsigned get_k      () const { return this->k;       }
+
+	/*!
+	 * \brief Computes y = x.M.
+	 *
+	 * \param x: packed input vector of 'n_rows' bits.
+	 * \param y: packed output vector of 'n_words' words.
+	 */
+	void mul(const uint64_t *x, uint64_t *y) const;
+
+	/*!
+	 * \brief Returns the largest 'k' for which the tables of a 'n_rows' x 'n_cols' matrix fit in 'max_bytes'
+	 *        (1 if none fits).
+	 */
+	static unsigned best_k(const unsigned n_rows, const unsigned n_cols, const size_t max_bytes);
+
+	/*!
+	 * \brief Gives the tables of a matrix from a process-wide cache: the encoders of the threads (and the successive
+	 *        codecs) which use the same matrix share the same tables. The tables are freed with their last user.
+	 *
+	 * \param M:         the matrix.
+	 * \param max_bytes: the memory budget of the tables (see 'best_k').
+	 */
+	static std::shared_ptr<const Bit_matrix_M4R> get_shared(const Bit_matrix &M, const size_t max_bytes);
+};
+}
+}
+
+#endif /* BIT_MATRIX_M4R_HPP_ */
@@ -0,0 +1,205 @@
+#include <cmath>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Demapper_PAM.hpp"
+
+using namespace aff3ct::tools;
+
+namespace
+{
+constexpr int max_bps = 16;
+
+// the symbols are processed one by one (T = R) or in the SIMD lanes (T = mipp::Reg<R>)
+template <typename T, typename R> struct lanes;
+
+template <typename R> struct lanes<R,R>
+{
+	static int  n    (                ) { return 1;  }
+	static R    load (const R *p      ) { return *p; }
+	static void store(R *p, const R v ) { *p = v;    }
+};
+
+template <typename R> struct lanes<mipp::Reg<R>,R>
+{
+	static int          n    (                          ) { return mipp::nElReg<R>(); }
+	static mipp::Reg<R> load (const R *p                ) { return mipp::Reg<R>(p);   }
+	static void         store(R *p, const mipp::Reg<R> v) { v.store(p);               }
+};
+}
+
+template <typename R>
+Demapper_PAM<R>
+::Demapper_PAM(const std::vector<R> &points, const std::string &max_type)
+: bps     ((int)std::log2(points.size())),
+  n_points((int)points.size()),
+  max_type(max_type),
+  points  (points),
+  buff_Y  (mipp::nElReg<R>()),
+  buff_G  (mipp::nElReg<R>()),
+  buff_S  (mipp::nElReg<R>()),
+  buff_La (mipp::nElReg<R>() * this->bps),
+  buff_L  (mipp::nElReg<R>() * this->bps),
+  buff_P  (mipp::nElReg<R>() * this->n_points)
+{
+	if (this->n_points < 1 || (1 << this->bps) != this->n_points)
+	{
+		std::stringstream message;
+		message << "'points.size()' has to be a power of 2 ('points.size()' = " << points.size() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->bps > max_bps)
+	{
+		std::stringstream message;
+		message << "'bps' has to be smaller or equal to " << max_bps << " ('bps' = " << this->bps << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (max_type != "MAX" && max_type != "MAXL" && max_type != "MAXS" && max_type != "MAXSS")
+	{
+		std::stringstream message;
+		message << "Unknown 'max_type' ('max_type' = " << max_type << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename R>
+Demapper_PAM<R>
+::~Demapper_PAM()
+{
+}
+
+template <typename R>
+int Demapper_PAM<R>
+::get_bps() const
+{
+	return this->bps;
+}
+
+template <typename R>
+void Demapper_PAM<R>
+::demodulate(const R *Y_N, const int Y_step, R *L_N, const int L_step, const int n_symbs, const R scale,
+             const R *G_N, const R *S_N, const R *La_N, const int n_bits_last)
+{
+	const auto n_bits = (n_bits_last < 0) ? this->bps : n_bits_last;
+	if (n_bits == 0 || n_bits > this->bps)
+	{
+		std::stringstream message;
+		message << "'n_bits_last' has to be between 1 and 'bps' ('n_bits_last' = " << n_bits_last
+		        << ", 'bps' = " << this->bps << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the max* of MIPP relies on approximations of exp and log: the safe max* is computed in scalar
+	     if (this->max_type == "MAX" ) this->template _demodulate<mipp::Reg<R>,max_i        <R>>(Y_N, Y_step, L_N, L_step, n_symbs, scale, G_N, S_N, La_N, n_bits);
+	else if (this->max_type == "MAXL") this->template _demodulate<mipp::Reg<R>,max_linear_i <R>>(Y_N, Y_step, L_N, L_step, n_symbs, scale, G_N, S_N, La_N, n_bits);
+	else if (this->max_type == "MAXS") this->template _demodulate<mipp::Reg<R>,max_star_i   <R>>(Y_N, Y_step, L_N, L_step, n_symbs, scale, G_N, S_N, La_N, n_bits);
+	else                               this->template _demodulate<R,           max_star_safe<R>>(Y_N, Y_step, L_N, L_step, n_symbs, scale, G_N, S_N, La_N, n_bits);
+}
+
+template <typename R>
+template <typename T, T (*MAXT)(const T, const T)>
+void Demapper_PAM<R>
+::_demodulate(const R *Y_N, const int Y_step, R *L_N, const int L_step, const int n_symbs, const R scale,
+              const R *G_N, const R *S_N, const R *La_N, const int n_bits_last)
+{
+	const auto V       = lanes<T,R>::n();
+	const auto apriori = La_N != nullptr;
+	const auto n_full  = (n_bits_last < this->bps) ? n_symbs -1 : n_symbs;
+
+	auto gather = [&](const int k, const int v, const int n_bits)
+	{
+		this->buff_Y[v] = Y_N[k * Y_step];
+		this->buff_G[v] = G_N ? G_N[k * Y_step]         : (R)1;
+		this->buff_S[v] = S_N ? S_N[k * Y_step] * scale : scale;
+		if (apriori)
+			for (auto b = 0; b < n_bits; b++)
+				this->buff_La[b * V + v] = La_N[k * L_step +b];
+	};
+
+	for (auto k0 = 0; k0 < n_full; k0 += V)
+	{
+		const auto n_act = std::min(V, n_full - k0);
+
+		// the unused lanes duplicate the last symbol of the block
+		for (auto v = 0; v < V; v++)
+			gather(k0 + std::min(v, n_act -1), v, this->bps);
+
+		this->template demodulate_symbs<T,MAXT>(this->n_points, this->bps, apriori);
+
+		for (auto v = 0; v < n_act; v++)
+			for (auto b = 0; b < this->bps; b++)
+				L_N[(k0 + v) * L_step +b] = this->buff_L[b * V + v];
+	}
+
+	// last symbol, if incomplete: with a priori LLRs only the points with the missing bits at 0 are considered
+	if (n_full < n_symbs)
+	{
+		for (auto v = 0; v < V; v++)
+			gather(n_full, v, n_bits_last);
+
+		this->template demodulate_symbs<T,MAXT>(apriori ? 1 << n_bits_last : this->n_points, n_bits_last, apriori);
+
+		for (auto b = 0; b < n_bits_last; b++)
+			L_N[n_full * L_step +b] = this->buff_L[b * V];
+	}
+}
+
+template <typename R>
+template <typename T, T (*MAXT)(const T, const T)>
+void Demapper_PAM<R>
+::demodulate_symbs(const int n_pts, const int n_bits, const bool apriori)
+{
+	const auto V    = lanes<T,R>::n();
+	const auto y    = lanes<T,R>::load(this->buff_Y.data());
+	const auto g    = lanes<T,R>::load(this->buff_G.data());
+	const auto s    = lanes<T,R>::load(this->buff_S.data());
+	const T    zero = (R)0;
+
+	T L0[max_bps], L1[max_bps], La[max_bps];
+	for (auto b = 0; b < n_bits; b++)
+		La[b] = apriori ? lanes<T,R>::load(this->buff_La.data() + b * V) : zero;
+
+	if (apriori)
+		lanes<T,R>::store(this->buff_P.data(), zero);
+
+	for (auto j = 0; j < n_pts; j++)
+	{
+		const T    p = this->points[j];
+		const auto d = y - g * p;
+		auto       m = zero - d * d * s;
+
+		if (apriori && j)
+		{
+			// the a priori metric of 'j' is the one of 'j' without its lowest set bit plus the LLR of this bit
+			auto l = 0;
+			while (!((j >> l) & 1))
+				l++;
+
+			const auto P = lanes<T,R>::load(this->buff_P.data() + (j & (j -1)) * V) + La[l];
+			lanes<T,R>::store(this->buff_P.data() + j * V, P);
+			m = m - P;
+		}
+
+		// the first point with the bit 'b' at 1 is '1 << b'
+		for (auto b = 0; b < n_bits; b++)
+			if ((j >> b) & 1) L1[b] = (j == (1 << b)) ? m : MAXT(L1[b], m);
+			else              L0[b] = (j == 0       ) ? m : MAXT(L0[b], m);
+	}
+
+	for (auto b = 0; b < n_bits; b++)
+		lanes<T,R>::store(this->buff_L.data() + b * V, L0[b] - L1[b] - La[b]);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::tools::Demapper_PAM<R_32>;
+template class aff3ct::tools::Demapper_PAM<R_64>;
+#else
+template class aff3ct::tools::Demapper_PAM<R>;
+#endif
+// ==================================================================================== explicit template instantiation
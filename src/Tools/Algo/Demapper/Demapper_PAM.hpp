@@ -0,0 +1,76 @@
+#ifndef DEMAPPER_PAM_HPP_
+#define DEMAPPER_PAM_HPP_
+
+#include <string>
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Soft demapper of a PAM dimension: the point 'j' of the constellation carries the bits of 'j' (LSB first). For the
+ * symbol 'k' and the bit 'b':
+ *     L[k][b] = MAX_{j, bit b = 0}(m_j) - MAX_{j, bit b = 1}(m_j) - La[k][b],
+ *     m_j     = -S[k] * (Y[k] - G[k] * p_j)^2 - sum_{l, bit l = 1 in j} La[k][l].
+ * The metric of a point is computed once per symbol and shared by all the bits, the symbols are processed in the SIMD
+ * lanes. With a max or a max* operator, a square QAM is two independent PAM dimensions: the I (resp. Q) part of the
+ * metrics cancels in the LLRs of the Q (resp. I) bits.
+ */
+template <typename R = float>
+class Demapper_PAM
+{
+private:
+	const int         bps;      // number of bits per symbol
+	const int         n_points; // number of points in the constellation
+	const std::string max_type; // MAX, MAXL, MAXS or MAXSS
+	std::vector<R>    points;   // constellation
+
+	mipp::vector<R> buff_Y;  // samples of a block of symbols (one per lane)
+	mipp::vector<R> buff_G;  // gains
+	mipp::vector<R> buff_S;  // scales
+	mipp::vector<R> buff_La; // a priori LLRs (bit by bit)
+	mipp::vector<R> buff_L;  // LLRs (bit by bit)
+	mipp::vector<R> buff_P;  // a priori metric of each point
+
+public:
+	Demapper_PAM(const std::vector<R> &points, const std::string &max_type = "MAXS");
+	virtual ~Demapper_PAM();
+
+	int get_bps() const;
+
+	/*
+	 * Y_N[k * Y_step] is the sample of the symbol 'k' and G_N[k * Y_step] and S_N[k * Y_step] its gain and its scale
+	 * (1 when the pointers are null, the scale is also multiplied by 'scale'). L_N[k * L_step +b] is the LLR of the bit
+	 * 'b' of the symbol 'k' and La_N[k * L_step +b] its a priori LLR (0 when the pointer is null).
+	 * Only 'n_bits_last' LLRs are computed for the last symbol: with a priori LLRs, its other bits are known to be 0
+	 * (as in the modulators).
+	 */
+	void demodulate(const R *Y_N, const int Y_step, R *L_N, const int L_step, const int n_symbs, const R scale,
+	                const R *G_N = nullptr, const R *S_N = nullptr, const R *La_N = nullptr,
+	                const int n_bits_last = -1);
+
+private:
+	template <typename T, T (*MAXT)(const T, const T)>
+	void _demodulate(const R *Y_N, const int Y_step, R *L_N, const int L_step, const int n_symbs, const R scale,
+	                 const R *G_N, const R *S_N, const R *La_N, const int n_bits_last);
+
+	template <typename T, T (*MAXT)(const T, const T)>
+	inline void demodulate_symbs(const int n_pts, const int n_bits, const bool apriori);
+};
+
+template <typename Q, proto_max<Q> MAX>
+inline std::string get_max_type()
+{
+	     if (MAX == tools::max       <Q>) return "MAX";
+	else if (MAX == tools::max_linear<Q>) return "MAXL";
+	else if (MAX == tools::max_star  <Q>) return "MAXS";
+	else                                  return "MAXSS";
+}
+}
+}
+
+#endif /* DEMAPPER_PAM_HPP_ */
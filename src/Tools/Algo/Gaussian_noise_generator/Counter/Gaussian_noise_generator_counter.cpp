@@ -0,0 +1,280 @@
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Gaussian_noise_generator_counter.hpp"
+
+using namespace aff3ct::tools;
+
+template <typename R>
+Gaussian_noise_generator_counter<R>
+::Gaussian_noise_generator_counter(const int seed)
+: Gaussian_noise_generator<R>(),
+  seed(0),
+  position(0),
+  is_set(false),
+  n_streams(1),
+  stream_id(0),
+  n_frames(1),
+  lanes(mipp::nElReg<int32_t>()),
+  words(4 * n_blocks_per_group),
+  buffer(group_size)
+{
+	if (n_blocks_per_group % mipp::nElReg<int32_t>())
+		throw runtime_error(__FILE__, __LINE__, __func__, "The SIMD width is not supported.");
+
+	for (auto i = 0; i < mipp::nElReg<int32_t>(); i++)
+		lanes[i] = i;
+
+	this->set_seed(seed);
+}
+
+template <typename R>
+Gaussian_noise_generator_counter<R>
+::~Gaussian_noise_generator_counter()
+{
+}
+
+template <typename R>
+void Gaussian_noise_generator_counter<R>
+::set_seed(const int seed)
+{
+	this->seed   = (uint32_t)seed;
+	this->is_set = false;
+	this->positions.clear();
+}
+
+template <typename R>
+void Gaussian_noise_generator_counter<R>
+::set_position(const unsigned long long position)
+{
+	this->position = position;
+	this->is_set   = true;
+}
+
+template <typename R>
+void Gaussian_noise_generator_counter<R>
+::set_interleaving(const unsigned n_streams, const unsigned stream_id, const unsigned n_frames)
+{
+	if (n_streams == 0)
+	{
+		std::stringstream message;
+		message << "'n_streams' has to be greater than 0 ('n_streams' = " << n_streams << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (stream_id >= n_streams)
+	{
+		std::stringstream message;
+		message << "'stream_id' has to be smaller than 'n_streams' ('stream_id' = " << stream_id
+		        << ", 'n_streams' = " << n_streams << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_frames == 0)
+	{
+		std::stringstream message;
+		message << "'n_frames' has to be greater than 0 ('n_frames' = " << n_frames << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->n_streams = n_streams;
+	this->stream_id = stream_id;
+	this->n_frames  = n_frames;
+}
+
+template <typename R>
+void Gaussian_noise_generator_counter<R>
+::set_key(const R sigma)
+{
+	// the SNR point is part of the key: the streams of two different noise levels are independent
+	const double sigma_d = (double)sigma;
+	uint64_t sigma_bits;
+	std::memcpy(&sigma_bits, &sigma_d, sizeof(sigma_bits));
+
+	const uint32_t key[4] = {this->seed, (uint32_t)sigma_bits, (uint32_t)(sigma_bits >> 32), 0};
+	threefry.set_key(key);
+}
+
+template <typename R>
+void Gaussian_noise_generator_counter<R>
+::generate_group(R *noise, const unsigned long long group, const R sigma, const R mu)
+{
+	throw runtime_error(__FILE__, __LINE__, __func__, "The Threefry random generator does not support this type.");
+}
+
+namespace aff3ct
+{
+namespace tools
+{
+template <>
+void Gaussian_noise_generator_counter<float>
+::generate_group(float *noise, const unsigned long long group, const float sigma, const float mu)
+{
+	const auto twopi = (float)(2.0 * 3.14159265358979323846);
+	const auto scale = 1.f / (float)(1 << 24);
+	const auto first = group * n_blocks_per_group;
+
+	const mipp::Reg<int32_t> r_lanes = lanes.data();
+	const mipp::Reg<int32_t> r_mask  = 0x00FFFFFF; // the right shift of the signed registers is arithmetic
+	mipp::Reg<int32_t> ctr[4], rnd[4];
+	ctr[1] = (int32_t)(uint32_t)(first >> 32);
+	ctr[2] = 0;
+	ctr[3] = 0;
+
+	// SIMD version of the Box Muller method, the 24 most significant bits of each word give a number between ]0,1[
+	for (unsigned j = 0; j < n_blocks_per_group; j += mipp::nElReg<int32_t>())
+	{
+		ctr[0] = r_lanes + mipp::Reg<int32_t>((int32_t)(uint32_t)(first + j));
+		threefry.rand_s32(ctr, rnd);
+
+		for (auto k = 0; k < 4; k += 2)
+		{
+			const auto u1 = (((rnd[k +0] >> 8) & r_mask).cvt<float>() + 0.5f) * scale;
+			const auto u2 = (((rnd[k +1] >> 8) & r_mask).cvt<float>() + 0.5f) * scale;
+
+			const auto radius = mipp::sqrt(mipp::log(u1) * -2.f) * sigma;
+			const auto theta  = u2 * twopi;
+
+			mipp::Reg<float> sintheta, costheta;
+			mipp::sincos(theta, sintheta, costheta);
+
+			auto awgn1 = radius * costheta + mu;
+			auto awgn2 = radius * sintheta + mu;
+
+			awgn1.storeu(&noise[(k +0) * n_blocks_per_group + j]);
+			awgn2.storeu(&noise[(k +1) * n_blocks_per_group + j]);
+		}
+	}
+}
+}
+}
+
+namespace aff3ct
+{
+namespace tools
+{
+template <>
+void Gaussian_noise_generator_counter<double>
+::generate_group(double *noise, const unsigned long long group, const double sigma, const double mu)
+{
+	const auto twopi = 2.0 * 3.14159265358979323846;
+	const auto scale = 1.0 / (double)(1ULL << 53);
+	const auto first = group * n_blocks_per_group;
+
+	const mipp::Reg<int32_t> r_lanes = lanes.data();
+	mipp::Reg<int32_t> ctr[4], rnd[4];
+	ctr[1] = (int32_t)(uint32_t)(first >> 32);
+	ctr[2] = 0;
+	ctr[3] = 0;
+
+	// the random words are computed in SIMD
+	for (unsigned j = 0; j < n_blocks_per_group; j += mipp::nElReg<int32_t>())
+	{
+		ctr[0] = r_lanes + mipp::Reg<int32_t>((int32_t)(uint32_t)(first + j));
+		threefry.rand_s32(ctr, rnd);
+
+		for (auto k = 0; k < 4; k++)
+			rnd[k].store(&words[k * n_blocks_per_group + j]);
+	}
+
+	// seq version of the Box Muller method, two words give a number between ]0,1[ with a 53-bit resolution (MIPP has
+	// no conversion from 64-bit integers to double nor double precision log/sincos for all the instruction sets)
+	const auto w = [&](const unsigned k, const unsigned i) { return (uint64_t)(uint32_t)words[k * n_blocks_per_group + i]; };
+	for (unsigned i = 0; i < n_blocks_per_group; i++)
+	{
+		const auto u1 = ((double)(((w(0, i) >> 5) << 26) | (w(1, i) >> 6)) + 0.5) * scale;
+		const auto u2 = ((double)(((w(2, i) >> 5) << 26) | (w(3, i) >> 6)) + 0.5) * scale;
+
+		const auto radius = std::sqrt(std::log(u1) * -2.0) * sigma;
+		const auto theta  = u2 * twopi;
+
+		noise[                     i] = radius * std::cos(theta) + mu;
+		noise[n_blocks_per_group + i] = radius * std::sin(theta) + mu;
+	}
+}
+}
+}
+
+template <typename R>
+void Gaussian_noise_generator_counter<R>
+::generate_range(R *noise, const unsigned long long first, const unsigned length, const R sigma, const R mu)
+{
+	const auto last = first + length;
+
+	// the groups are aligned on the absolute positions in the stream, the samples of the groups which are not fully
+	// requested are computed in a separate buffer
+	for (auto g = first / group_size; g * group_size < last; g++)
+	{
+		const auto g_first = g * group_size;
+		const auto g_last  = g_first + group_size;
+
+		if (g_first >= first && g_last <= last)
+			this->generate_group(noise + (g_first - first), g, sigma, mu);
+		else
+		{
+			this->generate_group(buffer.data(), g, sigma, mu);
+
+			const auto b = std::max(g_first, first);
+			const auto e = std::min(g_last,  last );
+			std::copy(buffer.data() + (b - g_first), buffer.data() + (e - g_first), noise + (b - first));
+		}
+	}
+}
+
+template <typename R>
+void Gaussian_noise_generator_counter<R>
+::generate(R *noise, const unsigned length, const R sigma, const R mu)
+{
+	if (length == 0)
+		return;
+
+	this->set_key(sigma);
+
+	if (this->is_set)
+	{
+		this->is_set = false;
+		this->generate_range(noise, this->position, length, sigma, mu);
+		return;
+	}
+
+	// each noise level has its own stream and its own position (0 the first time)
+	auto &position = this->positions[sigma];
+
+	if (this->n_streams == 1)
+		this->generate_range(noise, position, length, sigma, mu);
+	else
+	{
+		if (length % this->n_frames)
+		{
+			std::stringstream message;
+			message << "'length' has to be divisible by 'n_frames' ('length' = " << length
+			        << ", 'n_frames' = " << this->n_frames << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		// the k-th frame of this generator is the frame 'k * n_streams + stream_id' of the stream
+		const auto frame_size = (unsigned long long)(length / this->n_frames);
+		for (unsigned f = 0; f < this->n_frames; f++)
+		{
+			const auto k = position / frame_size + f;
+			const auto g = k * this->n_streams + this->stream_id;
+			this->generate_range(noise + f * frame_size, g * frame_size, (unsigned)frame_size, sigma, mu);
+		}
+	}
+
+	position += length;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::tools::Gaussian_noise_generator_counter<R_32>;
+template class aff3ct::tools::Gaussian_noise_generator_counter<R_64>;
+#else
+template class aff3ct::tools::Gaussian_noise_generator_counter<R>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,89 @@
+#ifndef GAUSSIAN_NOISE_GENERATOR_COUNTER_HPP_
+#define GAUSSIAN_NOISE_GENERATOR_COUNTER_HPP_
+
+#include <map>
+#include <mipp.h>
+
+#include "Tools/Algo/PRNG/PRNG_Threefry_simd.hpp"
+
+#include "../Gaussian_noise_generator.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Gaussian_noise_generator_counter
+ * \brief Gaussian noise generator built on a counter-based PRNG (Threefry-4x32).
+ *
+ * The value of the noise sample at the position p of the stream is a pure function of (seed, sigma, p): it does not
+ * depend on the previous calls nor on the thread that computes it. The stream is cut in frames: the frame g of length
+ * L is made of the samples [g * L, (g +1) * L[. Several generators with the same seed can share the stream
+ * (set_interleaving): the generator s of n takes the frames s, s +n, s +2n, ... whatever the number of frames per call.
+ * The noise of a frame only depends on its global index, not on the generator (thread) which computes it. A part of
+ * the stream can also be regenerated explicitly (set_position).
+ */
+template <typename R = float>
+class Gaussian_noise_generator_counter : public Gaussian_noise_generator<R>
+{
+private:
+	// a group of samples is computed from 16 consecutive Threefry counters whatever the SIMD width, each counter gives
+	// 4 samples in single precision and 2 samples in double precision (53-bit uniforms)
+	static constexpr unsigned n_blocks_per_group = 16;
+	static constexpr unsigned group_size = n_blocks_per_group * (sizeof(R) == sizeof(float) ? 4 : 2);
+
+	PRNG_Threefry_simd threefry;
+	uint32_t seed;
+
+	// each noise level (sigma) has its own stream and its own number of samples already generated by this generator
+	std::map<R,unsigned long long> positions;
+	unsigned long long             position;  // position set by 'set_position', used by the next call...
+	bool                           is_set;    // ...if this is true
+	unsigned                       n_streams; // number of generators which share the stream
+	unsigned                       stream_id; // frame taken by this generator in each group of 'n_streams' frames
+	unsigned                       n_frames;  // number of frames in a call to 'generate'
+
+	mipp::vector<int32_t> lanes;  // lane indexes (0, 1, ..., mipp::N<int32_t>() -1)
+	mipp::vector<int32_t> words;  // random words of a group (used in double precision)
+	mipp::vector<R>       buffer; // group of samples partially requested by the caller
+
+public:
+	explicit Gaussian_noise_generator_counter(const int seed = 0);
+	virtual ~Gaussian_noise_generator_counter();
+
+	virtual void set_seed(const int seed);
+	virtual void generate(R *noise, const unsigned length, const R sigma, const R mu = 0.0);
+
+	/*!
+	 * \brief Regenerates a part of the stream: the next call (whatever its sigma) gives the samples from 'position'.
+	 *        The frames taken by the following calls are not modified. The streams restart from their first frame
+	 *        after set_seed.
+	 *
+	 * \param position: the position (in number of samples), for instance 'frame_id * N' to regenerate a frame.
+	 */
+	void set_position(const unsigned long long position);
+
+	/*!
+	 * \brief Shares the stream with other generators keyed with the same seed: each call to 'generate' of length L
+	 *        is made of 'n_frames' frames of 'L / n_frames' samples, the k-th frame of this generator is the frame
+	 *        'k * n_streams + stream_id' of the stream (its samples start at '(k * n_streams + stream_id) * L /
+	 *        n_frames'). The frame length has to be the same for all the calls and all the generators.
+	 *
+	 * \param n_streams: the number of generators which share the stream.
+	 * \param stream_id: the id of this generator (in [0, n_streams[).
+	 * \param n_frames:  the number of frames in a call to 'generate'.
+	 */
+	void set_interleaving(const unsigned n_streams, const unsigned stream_id, const unsigned n_frames = 1);
+
+private:
+	void generate_range(R *noise, const unsigned long long first, const unsigned length, const R sigma, const R mu);
+	void generate_group(R *noise, const unsigned long long group, const R sigma, const R mu);
+	void set_key(const R sigma);
+};
+
+template <typename R = float>
+using Gaussian_gen_counter = Gaussian_noise_generator_counter<R>;
+}
+}
+
+#endif /* GAUSSIAN_NOISE_GENERATOR_COUNTER_HPP_ */
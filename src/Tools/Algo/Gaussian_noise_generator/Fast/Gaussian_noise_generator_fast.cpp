@@ -136,6 +136,62 @@ void Gaussian_noise_generator_fast<R>
 	}
 }
 
+template <typename R>
+void Gaussian_noise_generator_fast<R>
+::generate_and_add(const R *X_N, R *Y_N, const unsigned length, const R sigma, const R mu)
+{
+	const auto twopi = (R)(2.0 * 3.14159265358979323846);
+
+	// SIMD version of the Box Muller method in the polar form, the noise is directly added to the signal
+	const auto vec_loop_size = (int)(((int)length / (mipp::nElReg<R>() * 2)) * mipp::nElReg<R>() * 2);
+	for (auto i = 0; i < vec_loop_size; i += mipp::nElReg<R>() * 2)
+	{
+		const auto u1 = get_random_simd();
+		const auto u2 = get_random_simd();
+
+		const auto radius = mipp::sqrt(mipp::log(u1) * (R)-2.0) * sigma;
+		const auto theta  = u2 * twopi;
+
+		mipp::Reg<R> sintheta, costheta;
+		mipp::sincos(theta, sintheta, costheta);
+
+		const auto x1 = mipp::loadu<R>(&X_N[i                    ]);
+		const auto x2 = mipp::loadu<R>(&X_N[i + mipp::nElReg<R>()]);
+
+		auto y1 = x1 + (radius * costheta + mu);
+		auto y2 = x2 + (radius * sintheta + mu);
+
+		y1.storeu(&Y_N[i                    ]);
+		y2.storeu(&Y_N[i + mipp::nElReg<R>()]);
+	}
+
+	// seq version of the Box Muller method in the polar form
+	const auto seq_loop_size = (int)(length / 2) * 2;
+	for (auto i = vec_loop_size; i < seq_loop_size; i += 2)
+	{
+		const auto u1 = get_random();
+		const auto u2 = get_random();
+
+		const auto radius = (R)std::sqrt(std::log(u1) * (R)-2.0) * sigma;
+		const auto theta  = u2 * twopi;
+
+		Y_N[i +0] = X_N[i +0] + (radius * std::sin(theta) + mu);
+		Y_N[i +1] = X_N[i +1] + (radius * std::cos(theta) + mu);
+	}
+
+	// distribute the last odd element
+	if ((int)length != seq_loop_size)
+	{
+		const auto u1 = get_random();
+		const auto u2 = get_random();
+
+		const auto radius = (R)std::sqrt(std::log(u1) * (R)-2.0) * sigma;
+		const auto theta  = twopi * u2;
+
+		Y_N[length -1] = X_N[length -1] + (radius * std::sin(theta) + mu);
+	}
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef MULTI_PREC
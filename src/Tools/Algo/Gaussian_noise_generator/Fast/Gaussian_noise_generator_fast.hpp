@@ -25,6 +25,7 @@ public:
 
 	virtual void set_seed(const int seed);
 	virtual void generate(R *noise, const unsigned length, const R sigma, const R mu = 0.0);
+	virtual void generate_and_add(const R *X_N, R *Y_N, const unsigned length, const R sigma, const R mu = 0.0);
 
 private:
 	inline mipp::Reg<R> get_random_simd();
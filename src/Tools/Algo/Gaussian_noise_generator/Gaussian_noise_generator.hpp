@@ -25,8 +25,27 @@ public:
 		this->generate(noise.data(), (unsigned)noise.size(), sigma, mu);
 	}
 
+	template <class A = std::allocator<R>>
+	void generate_and_add(const std::vector<R,A> &X_N, std::vector<R,A> &Y_N, const R sigma, const R mu = 0.0)
+	{
+		this->generate_and_add(X_N.data(), Y_N.data(), (unsigned)Y_N.size(), sigma, mu);
+	}
+
 	virtual void set_seed(const int seed) = 0;
 	virtual void generate(R *noise, const unsigned length, const R sigma, const R mu = 0.0) = 0;
+
+	/*!
+	 * \brief Generates the noise and adds it to a signal: Y_N = X_N + noise ('X_N' and 'Y_N' must not overlap).
+	 *
+	 * The default implementation generates the noise in 'Y_N' and then adds 'X_N', the generators that can fuse
+	 * the two steps override it.
+	 */
+	virtual void generate_and_add(const R *X_N, R *Y_N, const unsigned length, const R sigma, const R mu = 0.0)
+	{
+		this->generate(Y_N, length, sigma, mu);
+		for (unsigned i = 0; i < length; i++)
+			Y_N[i] += X_N[i];
+	}
 };
 
 template <typename R = float>
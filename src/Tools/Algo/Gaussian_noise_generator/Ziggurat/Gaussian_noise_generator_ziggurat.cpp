@@ -0,0 +1,164 @@
+#include <cmath>
+#include <algorithm>
+
+#include "Gaussian_noise_generator_ziggurat.hpp"
+
+using namespace aff3ct::tools;
+
+constexpr double R_TAIL = 3.442619855899;      // start of the right tail
+constexpr double V_AREA = 9.91256303526217e-3; // area of each layer
+constexpr double M1     = 2147483648.0;        // 2^31
+
+static inline uint32_t abs32(const int32_t x)
+{
+	return (uint32_t)(x < 0 ? -(int64_t)x : (int64_t)x);
+}
+
+template <typename R>
+Gaussian_noise_generator_ziggurat<R>
+::Gaussian_noise_generator_ziggurat(const int seed)
+: Gaussian_noise_generator<R>(),
+  mt19937(seed),
+  mt19937_simd(),
+  words(n_words),
+  words_pos(n_words)
+{
+	// tables of the ziggurat (G. Marsaglia and W. W. Tsang, "The Ziggurat Method for Generating Random Variables")
+	auto dn = R_TAIL, tn = R_TAIL;
+	const auto q = V_AREA / std::exp(-0.5 * dn * dn);
+
+	kn[0] = (uint32_t)((dn / q) * M1);
+	kn[1] = 0;
+	wn[0] = q / M1;
+	wn[n_layers -1] = dn / M1;
+	fn[0] = 1.0;
+	fn[n_layers -1] = std::exp(-0.5 * dn * dn);
+
+	for (auto i = (int)n_layers -2; i >= 1; i--)
+	{
+		dn = std::sqrt(-2.0 * std::log(V_AREA / dn + std::exp(-0.5 * dn * dn)));
+		kn[i +1] = (uint32_t)((dn / tn) * M1);
+		tn = dn;
+		fn[i] = std::exp(-0.5 * dn * dn);
+		wn[i] = dn / M1;
+	}
+
+	this->set_seed(seed);
+}
+
+template <typename R>
+Gaussian_noise_generator_ziggurat<R>
+::~Gaussian_noise_generator_ziggurat()
+{
+}
+
+template <typename R>
+void Gaussian_noise_generator_ziggurat<R>
+::set_seed(const int seed)
+{
+	mt19937.seed(seed);
+
+	mipp::vector<int> seeds(mipp::nElReg<int>());
+	for (auto i = 0; i < mipp::nElReg<int>(); i++)
+		seeds[i] = mt19937.rand();
+	mt19937_simd.seed(seeds.data());
+
+	words_pos = n_words;
+}
+
+template <typename R>
+int32_t Gaussian_noise_generator_ziggurat<R>
+::get_word()
+{
+	if (words_pos == n_words)
+	{
+		for (unsigned i = 0; i < n_words; i += mipp::nElReg<int32_t>())
+			mt19937_simd.rand_s32().store(&words[i]);
+		words_pos = 0;
+	}
+
+	return words[words_pos++];
+}
+
+template <typename R>
+double Gaussian_noise_generator_ziggurat<R>
+::get_normal_slow(int32_t hz, uint32_t iz)
+{
+	while (true)
+	{
+		const auto x = hz * wn[iz];
+
+		// base strip: the sample is taken in the tail (x > R_TAIL)
+		if (iz == 0)
+		{
+			double xt, y;
+			do
+			{
+				xt = -std::log(mt19937.randd_oo()) / R_TAIL;
+				y  = -std::log(mt19937.randd_oo());
+			}
+			while (y + y < xt * xt);
+
+			return hz > 0 ? R_TAIL + xt : -R_TAIL - xt;
+		}
+
+		// wedge of the layer: exact rejection test
+		if (fn[iz] + mt19937.randd_oo() * (fn[iz -1] - fn[iz]) < std::exp(-0.5 * x * x))
+			return x;
+
+		hz = (int32_t)mt19937.rand_u32();
+		iz = mt19937.rand_u32() & (n_layers -1);
+
+		if (abs32(hz) < kn[iz])
+			return hz * wn[iz];
+	}
+}
+
+template <typename R>
+template <bool ADD>
+void Gaussian_noise_generator_ziggurat<R>
+::_generate(const R *X_N, R *Y_N, const unsigned length, const R sigma, const R mu)
+{
+	// one word gives the layer indexes of 4 consecutive samples (7 bits each)
+	for (unsigned i = 0; i < length; i += 4)
+	{
+		const auto idx = (uint32_t)this->get_word();
+		const auto n   = std::min(4u, length - i);
+
+		for (unsigned k = 0; k < n; k++)
+		{
+			const auto hz = this->get_word();
+			const auto iz = (idx >> (8 * k)) & (n_layers -1);
+
+			// fast path: the sample is inside the rectangle of its layer
+			const auto z = abs32(hz) < kn[iz] ? hz * wn[iz] : this->get_normal_slow(hz, iz);
+			const auto v = (R)z * sigma + mu;
+
+			Y_N[i + k] = ADD ? X_N[i + k] + v : v;
+		}
+	}
+}
+
+template <typename R>
+void Gaussian_noise_generator_ziggurat<R>
+::generate(R *noise, const unsigned length, const R sigma, const R mu)
+{
+	this->template _generate<false>(nullptr, noise, length, sigma, mu);
+}
+
+template <typename R>
+void Gaussian_noise_generator_ziggurat<R>
+::generate_and_add(const R *X_N, R *Y_N, const unsigned length, const R sigma, const R mu)
+{
+	this->template _generate<true>(X_N, Y_N, length, sigma, mu);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::tools::Gaussian_noise_generator_ziggurat<R_32>;
+template class aff3ct::tools::Gaussian_noise_generator_ziggurat<R_64>;
+#else
+template class aff3ct::tools::Gaussian_noise_generator_ziggurat<R>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,63 @@
+#ifndef GAUSSIAN_NOISE_GENERATOR_ZIGGURAT_HPP_
+#define GAUSSIAN_NOISE_GENERATOR_ZIGGURAT_HPP_
+
+#include <cstdint>
+#include <mipp.h>
+
+#include "Tools/Algo/PRNG/PRNG_MT19937.hpp"
+#include "Tools/Algo/PRNG/PRNG_MT19937_simd.hpp"
+
+#include "../Gaussian_noise_generator.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Gaussian_noise_generator_ziggurat
+ * \brief Gaussian noise generator based on the ziggurat method of Marsaglia and Tsang (128 layers).
+ *
+ * About 99% of the samples only require a random word, a table lookup, a comparison and a multiplication (no log,
+ * no sqrt and no sincos), the remaining samples go through the exact (but slower) rejection path. The random words
+ * are produced by blocks with the SIMD Mersenne Twister. The layer index is taken from a word independent of the
+ * sample value to avoid the correlations of the original 32-bit implementation.
+ */
+template <typename R = float>
+class Gaussian_noise_generator_ziggurat : public Gaussian_noise_generator<R>
+{
+private:
+	static constexpr unsigned n_layers = 128;
+	static constexpr unsigned n_words  = 320; // size of the block of random words (4 samples consume 5 words)
+
+	tools::PRNG_MT19937      mt19937;      // Mersenne Twister 19937 (scalar), for the rejection path
+	tools::PRNG_MT19937_simd mt19937_simd; // Mersenne Twister 19937 (SIMD), for the random words
+
+	uint32_t kn[n_layers]; // acceptance thresholds of the layers
+	double   wn[n_layers]; // widths of the layers (scaled by 2^-31)
+	double   fn[n_layers]; // values of the density at the layer boundaries
+
+	mipp::vector<int32_t> words;
+	unsigned              words_pos;
+
+public:
+	explicit Gaussian_noise_generator_ziggurat(const int seed = 0);
+	virtual ~Gaussian_noise_generator_ziggurat();
+
+	virtual void set_seed(const int seed);
+	virtual void generate(R *noise, const unsigned length, const R sigma, const R mu = 0.0);
+	virtual void generate_and_add(const R *X_N, R *Y_N, const unsigned length, const R sigma, const R mu = 0.0);
+
+private:
+	template <bool ADD>
+	void _generate(const R *X_N, R *Y_N, const unsigned length, const R sigma, const R mu);
+
+	inline int32_t get_word();
+	double         get_normal_slow(int32_t hz, uint32_t iz);
+};
+
+template <typename R = float>
+using Gaussian_gen_ziggurat = Gaussian_noise_generator_ziggurat<R>;
+}
+}
+
+#endif /* GAUSSIAN_NOISE_GENERATOR_ZIGGURAT_HPP_ */
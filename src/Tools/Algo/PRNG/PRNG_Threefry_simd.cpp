@@ -0,0 +1,74 @@
+#include "PRNG_Threefry_simd.hpp"
+
+using namespace aff3ct::tools;
+
+constexpr unsigned N_ROUNDS = 20;
+constexpr uint32_t PARITY   = 0x1BD11BDA; // Skein key schedule parity constant
+
+// rotation constants of Threefry-4x32
+constexpr int ROT[8][2] = {{10, 26}, {11, 21}, {13, 27}, {23,  5}, { 6, 20}, {17, 11}, {25, 10}, {18, 20}};
+
+// the right shift of the MIPP signed registers is arithmetic: the bits copied from the sign are masked to get the
+// logical shift of the rotation
+static inline mipp::Reg<int32_t> rotl(const mipp::Reg<int32_t> x, const int r)
+{
+	return (x << r) | ((x >> (32 - r)) & mipp::Reg<int32_t>((int32_t)((1u << r) - 1)));
+}
+
+PRNG_Threefry_simd::PRNG_Threefry_simd()
+{
+	const uint32_t key[4] = {0, 0, 0, 0};
+	this->set_key(key);
+}
+
+PRNG_Threefry_simd::~PRNG_Threefry_simd()
+{
+}
+
+void PRNG_Threefry_simd::set_key(const uint32_t key[4])
+{
+	ks[4] = PARITY;
+	for (auto i = 0; i < 4; i++)
+	{
+		ks[i]  = key[i];
+		ks[4] ^= key[i];
+	}
+}
+
+void PRNG_Threefry_simd::rand_s32(const mipp::Reg<int32_t> ctr[4], mipp::Reg<int32_t> out[4]) const
+{
+	auto x0 = ctr[0] + mipp::Reg<int32_t>((int32_t)ks[0]);
+	auto x1 = ctr[1] + mipp::Reg<int32_t>((int32_t)ks[1]);
+	auto x2 = ctr[2] + mipp::Reg<int32_t>((int32_t)ks[2]);
+	auto x3 = ctr[3] + mipp::Reg<int32_t>((int32_t)ks[3]);
+
+	for (unsigned r = 0; r < N_ROUNDS; r++)
+	{
+		const auto *rot = ROT[r % 8];
+		if (r % 2 == 0)
+		{
+			x0 += x1; x1 = rotl(x1, rot[0]); x1 ^= x0;
+			x2 += x3; x3 = rotl(x3, rot[1]); x3 ^= x2;
+		}
+		else
+		{
+			x0 += x3; x3 = rotl(x3, rot[0]); x3 ^= x0;
+			x2 += x1; x1 = rotl(x1, rot[1]); x1 ^= x2;
+		}
+
+		// key injection every 4 rounds
+		if (r % 4 == 3)
+		{
+			const auto s = (r + 1) / 4;
+			x0 += mipp::Reg<int32_t>((int32_t)(ks[(s +0) % 5]    ));
+			x1 += mipp::Reg<int32_t>((int32_t)(ks[(s +1) % 5]    ));
+			x2 += mipp::Reg<int32_t>((int32_t)(ks[(s +2) % 5]    ));
+			x3 += mipp::Reg<int32_t>((int32_t)(ks[(s +3) % 5] + s));
+		}
+	}
+
+	out[0] = x0;
+	out[1] = x1;
+	out[2] = x2;
+	out[3] = x3;
+}
@@ -0,0 +1,59 @@
+/*!
+ * \file
+ * \brief The Threefry-4x32 counter-based pseudo-random number generator (PRNG) with fast SIMD instructions.
+ *
+ * Threefry is a counter-based PRNG: the output is a pure function of a 128-bit counter and of a 128-bit key.
+ * There is no internal state to advance, so any part of the random stream can be computed independently of the
+ * others (this is the opposite of the Mersenne Twister where the whole sequence has to be replayed). Each SIMD lane
+ * computes a different counter.
+ *
+ * This implementation follows the Threefry-4x32-20 definition from "Parallel Random Numbers: As Easy as 1, 2, 3"
+ * (J. K. Salmon, M. A. Moraes, R. O. Dror and D. E. Shaw, SC'11). It only requires additions, rotations and xors
+ * on 32-bit integers and it is then efficiently vectorized with MIPP.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+
+#ifndef PRNG_THREEFRY_SIMD_HPP
+#define PRNG_THREEFRY_SIMD_HPP
+
+#include <cstdint>
+#include <mipp.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class PRNG_Threefry_simd
+ * \brief The Threefry-4x32-20 counter-based pseudo-random number generator (PRNG) with fast SIMD instructions.
+ */
+class PRNG_Threefry_simd
+{
+protected:
+	uint32_t ks[5]; /*!< Key schedule: the 4 words of the key and their parity word */
+
+public:
+	PRNG_Threefry_simd();
+	virtual ~PRNG_Threefry_simd();
+
+	/*!
+	 * \brief Sets the 128-bit key of the PRNG.
+	 *
+	 * \param key: the 4 words of the key.
+	 */
+	void set_key(const uint32_t key[4]);
+
+	/*!
+	 * \brief Computes the 128-bit random words associated to a vector of 128-bit counters.
+	 *
+	 * \param ctr: the 4 words of the counters (one counter per lane).
+	 * \param out: the 4 random words of each lane (signed 32-bit integers in the range INT32_MIN ... INT32_MAX).
+	 */
+	void rand_s32(const mipp::Reg<int32_t> ctr[4], mipp::Reg<int32_t> out[4]) const;
+};
+}
+}
+
+#endif // PRNG_THREEFRY_SIMD_HPP
@@ -0,0 +1,193 @@
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <iterator>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "SNR_sweep.hpp"
+
+using namespace aff3ct::tools;
+
+SNR_sweep
+::SNR_sweep(const float snr_min, const float snr_max, const float snr_step, const float snr_step_min,
+            const float max_decades, const float fer_floor)
+: snr_min     (snr_min                             ),
+  snr_max     (snr_max                             ),
+  snr_step    (snr_step                            ),
+  snr_step_min(snr_step_min                        ),
+  max_decades (max_decades                         ),
+  fer_floor   (fer_floor                           ),
+  snr_next    (snr_min                             ),
+  snr_stop    (std::numeric_limits<float>::max()   )
+{
+	if (snr_step <= 0.f)
+	{
+		std::stringstream message;
+		message << "'snr_step' has to be greater than 0 ('snr_step' = " << snr_step << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (snr_step_min < 0.f || max_decades < 0.f || fer_floor < 0.f)
+	{
+		std::stringstream message;
+		message << "'snr_step_min', 'max_decades' and 'fer_floor' have to be positive ('snr_step_min' = "
+		        << snr_step_min << ", 'max_decades' = " << max_decades << ", 'fer_floor' = " << fer_floor << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (max_decades > 0.f && (snr_step_min <= 0.f || snr_step_min > snr_step))
+	{
+		std::stringstream message;
+		message << "'snr_step_min' has to be greater than 0 and smaller or equal to 'snr_step' when the refinement is "
+		        << "enabled ('snr_step_min' = " << snr_step_min << ", 'snr_step' = " << snr_step << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+SNR_sweep
+::~SNR_sweep()
+{
+}
+
+bool SNR_sweep
+::next(float &snr)
+{
+	while (!this->refine.empty())
+	{
+		snr = *this->refine.begin();
+		this->refine.erase(this->refine.begin());
+
+		if (snr < this->snr_stop)
+			return true;
+	}
+
+	if (this->snr_next <= this->snr_max && this->snr_next < this->snr_stop)
+	{
+		snr = this->snr_next;
+		this->snr_next += this->snr_step;
+		return true;
+	}
+
+	return false;
+}
+
+void SNR_sweep
+::record(const float snr, const unsigned long long n_fra, const unsigned long long n_fe)
+{
+	const auto fer = n_fra ? (float)n_fe / (float)n_fra : 0.f;
+	this->results[snr] = fer;
+
+	if (this->fer_floor > 0.f && n_fra)
+	{
+		float low, high;
+		SNR_sweep::fer_interval(n_fra, n_fe, low, high);
+		if (high < this->fer_floor && snr < this->snr_stop)
+			this->snr_stop = snr;
+	}
+
+	if (this->max_decades > 0.f)
+	{
+		auto it = this->results.find(snr);
+		auto right = std::next(it);
+		if (right != this->results.end())
+			this->try_refine(snr, fer, right->first, right->second);
+		if (it != this->results.begin())
+		{
+			auto left = std::prev(it);
+			this->try_refine(left->first, left->second, snr, fer);
+		}
+	}
+}
+
+void SNR_sweep
+::try_refine(const float snr_low, const float fer_low, const float snr_high, const float fer_high)
+{
+	if (fer_low == 0.f) // no error on both sides, the waterfall is elsewhere
+		return;
+
+	const auto half = (snr_high - snr_low) / 2.f;
+	if (half < this->snr_step_min)
+		return;
+
+	const auto decades = fer_high > 0.f ? std::log10(fer_low / fer_high) : std::numeric_limits<float>::max();
+	if (decades > this->max_decades)
+		this->refine.insert(snr_low + half);
+}
+
+void SNR_sweep
+::fer_interval(const unsigned long long n_fra, const unsigned long long n_fe, float &low, float &high)
+{
+	if (n_fra == 0)
+	{
+		low  = 0.f;
+		high = 1.f;
+		return;
+	}
+
+	const double z      = 1.959964; // 95% confidence level
+	const double n      = (double)n_fra;
+	const double p      = (double)n_fe / n;
+	const double denom  = 1. + z * z / n;
+	const double center = (p + z * z / (2. * n)) / denom;
+	const double half   = z * std::sqrt(p * (1. - p) / n + z * z / (4. * n * n)) / denom;
+
+	low  = (float)std::max(0., center - half);
+	high = (float)std::min(1., center + half);
+}
+
+bool SNR_sweep
+::is_point_done(const unsigned long long n_fra, const unsigned long long n_fe, const float ci_width,
+                const float fer_floor)
+{
+	if (n_fra == 0)
+		return false;
+
+	float low, high;
+	SNR_sweep::fer_interval(n_fra, n_fe, low, high);
+
+	if (fer_floor > 0.f && high < fer_floor)
+		return true;
+
+	if (ci_width > 0.f && n_fe > 0)
+	{
+		const auto fer = (float)n_fe / (float)n_fra;
+		return (high - low) / 2.f <= ci_width * fer;
+	}
+
+	return false;
+}
+
+unsigned long long SNR_sweep
+::n_fra_floor(const unsigned long long n_fe, const float fer_floor)
+{
+	if (fer_floor <= 0.f)
+		return 0;
+
+	float low, high;
+	const auto below = [&](const unsigned long long n_fra) -> bool
+	{
+		SNR_sweep::fer_interval(n_fra, n_fe, low, high);
+		return high < fer_floor;
+	};
+
+	// the upper bound of the interval decreases with the number of frames: double it, then bisect
+	unsigned long long n_low = n_fe, n_high = std::max(n_fe, 1ull);
+	while (!below(n_high))
+	{
+		if (n_high > std::numeric_limits<unsigned long long>::max() / 2)
+			return std::numeric_limits<unsigned long long>::max();
+		n_low   = n_high;
+		n_high *= 2;
+	}
+
+	while (n_high - n_low > 1)
+	{
+		const auto n_mid = n_low + (n_high - n_low) / 2;
+		if (below(n_mid)) n_high = n_mid;
+		else              n_low  = n_mid;
+	}
+
+	return n_high;
+}
@@ -0,0 +1,122 @@
+/*!
+ * \file
+ * \brief Scheduler of the SNR points of a simulation.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef SNR_SWEEP_HPP_
+#define SNR_SWEEP_HPP_
+
+#include <map>
+#include <set>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class SNR_sweep
+ *
+ * \brief Gives the SNR points to simulate from 'snr_min' to 'snr_max' by steps of 'snr_step'.
+ *
+ * The sweep can be refined around the waterfall: when the FER drops by more than 'max_decades' decades between two
+ * neighbour points, the middle point is simulated right after (as long as the half distance is at least
+ * 'snr_step_min'). The pending middle points are given by increasing SNR, but they come after the regular points which
+ * surround them: the points are not given in SNR order when the sweep is refined. The sweep can also be stopped before
+ * 'snr_max': once a point has a FER confidence interval entirely below 'fer_floor', the points above it are not
+ * simulated.
+ */
+class SNR_sweep
+{
+private:
+	const float snr_min;
+	const float snr_max;
+	const float snr_step;
+	const float snr_step_min;
+	const float max_decades;
+	const float fer_floor;
+
+	float snr_next;                 // next point of the regular sweep
+	float snr_stop;                 // no point is simulated from this SNR
+	std::set<float> refine;         // middle points waiting to be simulated
+	std::map<float, float> results; // FER of the simulated points
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param snr_min:      first SNR of the sweep.
+	 * \param snr_max:      last SNR of the sweep.
+	 * \param snr_step:     SNR step of the regular sweep.
+	 * \param snr_step_min: minimal distance between two refined points (in ]0, 'snr_step'] when the refinement is
+	 *                      enabled).
+	 * \param max_decades:  maximal FER drop between two neighbour points (in decades, 0 disables the refinement).
+	 * \param fer_floor:    FER below which the sweep stops (0 disables the early stop).
+	 */
+	SNR_sweep(const float snr_min, const float snr_max, const float snr_step, const float snr_step_min = 0.f,
+	          const float max_decades = 0.f, const float fer_floor = 0.f);
+
+	virtual ~SNR_sweep();
+
+	/*!
+	 * \brief Gives the next SNR to simulate.
+	 *
+	 * \param snr: the next SNR.
+	 *
+	 * \return false if the sweep is over.
+	 */
+	bool next(float &snr);
+
+	/*!
+	 * \brief Records the result of a simulated point, the refined points and the stop are decided here.
+	 *
+	 * \param snr:   the simulated SNR.
+	 * \param n_fra: number of simulated frames.
+	 * \param n_fe:  number of frame errors.
+	 */
+	void record(const float snr, const unsigned long long n_fra, const unsigned long long n_fe);
+
+	/*!
+	 * \brief Wilson score interval of a FER at the 95% confidence level.
+	 *
+	 * \param n_fra: number of simulated frames.
+	 * \param n_fe:  number of frame errors.
+	 * \param low:   lower bound of the interval.
+	 * \param high:  upper bound of the interval.
+	 */
+	static void fer_interval(const unsigned long long n_fra, const unsigned long long n_fe, float &low, float &high);
+
+	/*!
+	 * \brief Tells if a point can be stopped before its frame errors limit.
+	 *
+	 * \param n_fra:     number of simulated frames.
+	 * \param n_fe:      number of frame errors.
+	 * \param ci_width:  relative half width of the FER confidence interval to reach (0 disables this criterion).
+	 * \param fer_floor: FER floor (0 disables this criterion).
+	 *
+	 * \return true if the relative half width of the confidence interval is below 'ci_width' or if the whole
+	 *         interval is below 'fer_floor'.
+	 */
+	static bool is_point_done(const unsigned long long n_fra, const unsigned long long n_fe, const float ci_width,
+	                          const float fer_floor);
+
+	/*!
+	 * \brief Gives the number of frames to simulate to reach a FER floor with a given number of frame errors: the
+	 *        FER floor criterion can only change when one of these numbers changes.
+	 *
+	 * \param n_fe:      number of frame errors.
+	 * \param fer_floor: FER floor (0 disables this criterion).
+	 *
+	 * \return the smallest number of frames for which the whole confidence interval is below 'fer_floor' (0 if the
+	 *         criterion is disabled).
+	 */
+	static unsigned long long n_fra_floor(const unsigned long long n_fe, const float fer_floor);
+
+private:
+	void try_refine(const float snr_low, const float fer_low, const float snr_high, const float fer_high);
+};
+}
+}
+
+#endif /* SNR_SWEEP_HPP_ */
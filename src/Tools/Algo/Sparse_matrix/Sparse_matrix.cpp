@@ -137,6 +137,155 @@ void Sparse_matrix
 	cols_max_degree = std::max(cols_max_degree, (unsigned)this->col_to_rows[col_index].size());
 
 	this->n_connections++;
+
+	// the new connection breaks the circulant blocks
+	if (this->is_qc())
+		this->qc = QC_descriptor();
+}
+
+void Sparse_matrix
+::add_connections(const uint32_t *row_degrees, const uint32_t *cols, const size_t n_connections)
+{
+	if (this->n_connections != 0)
+	{
+		std::stringstream message;
+		message << "The matrix has to be empty ('n_connections' = " << this->n_connections << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	size_t total = 0;
+	for (unsigned r = 0; r < this->n_rows; r++)
+		total += row_degrees[r];
+
+	if (total != n_connections)
+	{
+		std::stringstream message;
+		message << "The sum of the 'row_degrees' has to be equal to 'n_connections' (sum = " << total
+		        << ", 'n_connections' = " << n_connections << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the last row connected to each column, to detect the duplicated connections in linear time
+	std::vector<unsigned> last_row(this->n_cols, this->n_rows);
+	std::vector<unsigned> col_degrees(this->n_cols, 0);
+
+	size_t k = 0;
+	for (unsigned r = 0; r < this->n_rows; r++)
+	{
+		for (unsigned j = 0; j < row_degrees[r]; j++)
+		{
+			const auto c = cols[k + j];
+			if (c >= this->n_cols)
+			{
+				std::stringstream message;
+				message << "'col_index' has to be smaller than 'n_cols' ('col_index' = " << c
+				        << ", 'n_cols' = " << this->n_cols << ").";
+				throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+			}
+
+			if (last_row[c] == r)
+			{
+				std::stringstream message;
+				message << "'col_index' already exists ('col_index' = " << c << ", 'row_index' = " << r << ").";
+				throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+
+			last_row[c] = r;
+			col_degrees[c]++;
+		}
+
+		this->row_to_cols[r].assign(cols + k, cols + k + row_degrees[r]);
+		this->rows_max_degree = std::max(this->rows_max_degree, row_degrees[r]);
+		k += row_degrees[r];
+	}
+
+	for (unsigned c = 0; c < this->n_cols; c++)
+	{
+		this->col_to_rows[c].reserve(col_degrees[c]);
+		this->cols_max_degree = std::max(this->cols_max_degree, col_degrees[c]);
+	}
+
+	for (unsigned r = 0; r < this->n_rows; r++)
+		for (auto c : this->row_to_cols[r])
+			this->col_to_rows[c].push_back(r);
+
+	this->n_connections = (unsigned)n_connections;
+
+	if (this->is_qc() && n_connections)
+		this->qc = QC_descriptor();
+}
+
+bool Sparse_matrix
+::is_qc() const
+{
+	return this->qc.Z != 0;
+}
+
+const QC_descriptor& Sparse_matrix
+::get_qc_descriptor() const
+{
+	return this->qc;
+}
+
+void Sparse_matrix
+::set_qc_descriptor(const QC_descriptor &qc)
+{
+	if (qc.Z == 0 || qc.n_block_rows * qc.Z != this->n_rows || qc.n_block_cols * qc.Z != this->n_cols)
+	{
+		std::stringstream message;
+		message << "'qc.n_block_rows' * 'qc.Z' has to be equal to 'n_rows' and 'qc.n_block_cols' * 'qc.Z' has to be "
+		        << "equal to 'n_cols' ('qc.n_block_rows' = " << qc.n_block_rows << ", 'qc.n_block_cols' = "
+		        << qc.n_block_cols << ", 'qc.Z' = " << qc.Z << ", 'n_rows' = " << this->n_rows << ", 'n_cols' = "
+		        << this->n_cols << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (qc.shifts.size() != (size_t)qc.n_block_rows * qc.n_block_cols)
+	{
+		std::stringstream message;
+		message << "'qc.shifts.size()' has to be equal to 'qc.n_block_rows' * 'qc.n_block_cols' ('qc.shifts.size()' = "
+		        << qc.shifts.size() << ", 'qc.n_block_rows' = " << qc.n_block_rows << ", 'qc.n_block_cols' = "
+		        << qc.n_block_cols << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	unsigned n_blocks = 0;
+	for (unsigned i = 0; i < qc.n_block_rows; i++)
+		for (unsigned j = 0; j < qc.n_block_cols; j++)
+		{
+			const auto s = qc.shifts[i * qc.n_block_cols + j];
+			if (s == -1)
+				continue;
+
+			if (s < -1 || s >= (int)qc.Z)
+			{
+				std::stringstream message;
+				message << "The shift values have to be in [-1, 'qc.Z'[ ('i' = " << i << ", 'j' = " << j
+				        << ", 'shift' = " << s << ", 'qc.Z' = " << qc.Z << ").";
+				throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+			}
+
+			for (unsigned k = 0; k < qc.Z; k++)
+				if (!this->at(i * qc.Z + k, j * qc.Z + (k + s) % qc.Z))
+				{
+					std::stringstream message;
+					message << "The connections do not match the quasi-cyclic descriptor ('i' = " << i << ", 'j' = "
+					        << j << ", 'k' = " << k << ", 'shift' = " << s << ").";
+					throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+				}
+
+			n_blocks++;
+		}
+
+	if (n_blocks * qc.Z != this->n_connections)
+	{
+		std::stringstream message;
+		message << "The number of connections does not match the quasi-cyclic descriptor ('n_connections' = "
+		        << this->n_connections << ", 'n_blocks' = " << n_blocks << ", 'qc.Z' = " << qc.Z << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->qc = qc;
 }
 
 Sparse_matrix Sparse_matrix
@@ -155,6 +304,23 @@ void Sparse_matrix
 	std::swap(this->n_rows,          this->n_cols         );
 	std::swap(this->rows_max_degree, this->cols_max_degree);
 	std::swap(this->row_to_cols,     this->col_to_rows    );
+
+	if (this->is_qc())
+	{
+		// the block (i,j) becomes the block (j,i) and its shift 's' becomes 'Z - s'
+		QC_descriptor trans;
+		trans.Z            = this->qc.Z;
+		trans.n_block_rows = this->qc.n_block_cols;
+		trans.n_block_cols = this->qc.n_block_rows;
+		trans.shifts.resize(this->qc.shifts.size());
+		for (unsigned i = 0; i < this->qc.n_block_rows; i++)
+			for (unsigned j = 0; j < this->qc.n_block_cols; j++)
+			{
+				const auto s = this->qc.shifts[i * this->qc.n_block_cols + j];
+				trans.shifts[j * trans.n_block_cols + i] = (s == -1) ? -1 : (int)((this->qc.Z - s) % this->qc.Z);
+			}
+		this->qc = trans;
+	}
 }
 
 float Sparse_matrix
@@ -184,6 +350,8 @@ void Sparse_matrix
 		          [](const  std::vector<unsigned> &i1, const std::vector<unsigned> &i2) { return i1.size() > i2.size(); });
 	}
 
+	this->qc = QC_descriptor();
+
 	for (auto &r : this->row_to_cols)
 		r.clear();
 	for (size_t i = 0; i < this->col_to_rows.size(); i++)
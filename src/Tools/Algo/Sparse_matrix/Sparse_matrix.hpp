@@ -3,11 +3,27 @@
 
 #include <vector>
 #include <string>
+#include <cstddef>
+#include <cstdint>
 
 namespace aff3ct
 {
 namespace tools
 {
+/*
+ * Quasi-cyclic structure of a sparse matrix: the matrix is made of 'n_block_rows' x 'n_block_cols' square blocks of
+ * size Z. The block (i,j) is null if 'shifts[i * n_block_cols + j]' is -1, otherwise it is the identity matrix
+ * cyclically shifted by 's' = 'shifts[i * n_block_cols + j]': the row 'i * Z + k' is connected to the column
+ * 'j * Z + (k + s) % Z'.
+ */
+struct QC_descriptor
+{
+	unsigned         Z            = 0;
+	unsigned         n_block_rows = 0;
+	unsigned         n_block_cols = 0;
+	std::vector<int> shifts;
+};
+
 class Sparse_matrix
 {
 private:
@@ -20,6 +36,8 @@ private:
 	std::vector<std::vector<unsigned>> row_to_cols;
 	std::vector<std::vector<unsigned>> col_to_rows;
 
+	QC_descriptor qc; // empty if the quasi-cyclic structure is unknown
+
 public:
 	Sparse_matrix(const unsigned n_rows = 0, const unsigned n_cols = 1);
 	virtual ~Sparse_matrix();
@@ -42,6 +60,26 @@ public:
 
 	void add_connection(const size_t row_index, const size_t col_index);
 
+	/*
+	 * Add all the connections of an empty matrix from its compressed rows: the row 'r' is connected to the
+	 * 'row_degrees[r]' next column indexes of 'cols' (the rows one after the other, 'n_connections' indexes in
+	 * total). Unlike 'add_connection', the cost is linear in the number of connections.
+	 */
+	void add_connections(const uint32_t *row_degrees, const uint32_t *cols, const size_t n_connections);
+
+	/*
+	 * Return true if the quasi-cyclic structure of the matrix is known
+	 */
+	bool is_qc() const;
+
+	const QC_descriptor& get_qc_descriptor() const;
+
+	/*
+	 * Attach the quasi-cyclic structure of the matrix, the connections have to be already added and have to match the
+	 * descriptor. Any later modification of the connections drops the descriptor.
+	 */
+	void set_qc_descriptor(const QC_descriptor &qc);
+
 	/*
 	 * Return the transposed matrix of this matrix
 	 */
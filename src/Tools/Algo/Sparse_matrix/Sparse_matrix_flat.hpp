@@ -0,0 +1,94 @@
+/*!
+ * \file
+ * \brief Contiguous (CSR and CSC) representation of a sparse matrix.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef SPARSE_MATRIX_FLAT_HPP_
+#define SPARSE_MATRIX_FLAT_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include "Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Sparse_matrix_flat
+ *
+ * \brief Read-only and contiguous representation of a Sparse_matrix.
+ *
+ * The connections are stored both in the Compressed Sparse Row (CSR) and in the Compressed Sparse Column (CSC)
+ * formats: the columns connected to the row 'r' are in 'row_idx[row_ptr[r]]' ... 'row_idx[row_ptr[r +1] -1]' and the
+ * rows connected to the column 'c' are in 'col_idx[col_ptr[c]]' ... 'col_idx[col_ptr[c +1] -1]'. The connections are
+ * kept in the same order than in the Sparse_matrix.
+ *
+ * \tparam I: type of the indexes (uint16_t can be used when the number of rows and of columns is at most 65536).
+ */
+template <typename I = uint32_t>
+class Sparse_matrix_flat
+{
+private:
+	unsigned n_rows;
+	unsigned n_cols;
+
+	std::vector<uint32_t> row_ptr; /*!< CSR offsets (size 'n_rows' +1). */
+	std::vector<I>        row_idx; /*!< CSR column indexes. */
+	std::vector<uint32_t> col_ptr; /*!< CSC offsets (size 'n_cols' +1). */
+	std::vector<I>        col_idx; /*!< CSC row indexes. */
+
+	QC_descriptor qc;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param H: the sparse matrix to flatten.
+	 */
+	explicit Sparse_matrix_flat(const Sparse_matrix &H);
+
+	/*!
+	 * \brief Tells if the rows and the columns of a sparse matrix can be indexed with the type I.
+	 *
+	 * \param H: the sparse matrix to flatten.
+	 *
+	 * \return true if the number of rows and the number of columns are at most 'std::numeric_limits<I>::max()' +1.
+	 */
+	static bool is_indexable(const Sparse_matrix &H);
+
+	inline unsigned get_n_rows       () const;
+	inline unsigned get_n_cols       () const;
+	inline unsigned get_n_connections() const;
+
+	inline unsigned get_row_degree   (const size_t row_index) const;
+	inline unsigned get_col_degree   (const size_t col_index) const;
+	inline const I* get_cols_from_row(const size_t row_index) const;
+	inline const I* get_rows_from_col(const size_t col_index) const;
+
+	inline const std::vector<uint32_t>& get_row_ptr() const;
+	inline const std::vector<I       >& get_row_idx() const;
+	inline const std::vector<uint32_t>& get_col_ptr() const;
+	inline const std::vector<I       >& get_col_idx() const;
+
+	/*!
+	 * \brief Gives the position in the CSR order of each connection taken in the CSC order.
+	 *
+	 * The k-th connection of the row 'r' is the k-th time that 'r' is met when the columns are browsed in order.
+	 *
+	 * \return a vector of 'get_n_connections()' positions.
+	 */
+	std::vector<uint32_t> get_csc_to_csr() const;
+
+	inline bool                 is_qc            () const;
+	inline const QC_descriptor& get_qc_descriptor() const;
+};
+}
+}
+
+#include "Sparse_matrix_flat.hxx"
+
+#endif /* SPARSE_MATRIX_FLAT_HPP_ */
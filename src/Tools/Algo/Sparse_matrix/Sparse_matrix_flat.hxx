@@ -0,0 +1,165 @@
+#include <limits>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Sparse_matrix_flat.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <typename I>
+Sparse_matrix_flat<I>
+::Sparse_matrix_flat(const Sparse_matrix &H)
+: n_rows (H.get_n_rows()),
+  n_cols (H.get_n_cols()),
+  row_ptr(H.get_n_rows() +1, 0),
+  row_idx(H.get_n_connections()),
+  col_ptr(H.get_n_cols() +1, 0),
+  col_idx(H.get_n_connections()),
+  qc     (H.get_qc_descriptor())
+{
+	if (!Sparse_matrix_flat<I>::is_indexable(H))
+	{
+		const auto max_idx = (unsigned long long)std::numeric_limits<I>::max() +1;
+
+		std::stringstream message;
+		message << "'n_rows' and 'n_cols' have to be smaller or equal to 'max_idx' ('n_rows' = " << n_rows
+		        << ", 'n_cols' = " << n_cols << ", 'max_idx' = " << max_idx << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (unsigned r = 0; r < n_rows; r++)
+	{
+		const auto &cols = H.get_cols_from_row(r);
+		row_ptr[r +1] = row_ptr[r] + (uint32_t)cols.size();
+		for (size_t j = 0; j < cols.size(); j++)
+			row_idx[row_ptr[r] + j] = (I)cols[j];
+	}
+
+	for (unsigned c = 0; c < n_cols; c++)
+	{
+		const auto &rows = H.get_rows_from_col(c);
+		col_ptr[c +1] = col_ptr[c] + (uint32_t)rows.size();
+		for (size_t j = 0; j < rows.size(); j++)
+			col_idx[col_ptr[c] + j] = (I)rows[j];
+	}
+}
+
+template <typename I>
+bool Sparse_matrix_flat<I>
+::is_indexable(const Sparse_matrix &H)
+{
+	const auto max_idx = (unsigned long long)std::numeric_limits<I>::max() +1;
+	return (unsigned long long)H.get_n_rows() <= max_idx && (unsigned long long)H.get_n_cols() <= max_idx;
+}
+
+template <typename I>
+unsigned Sparse_matrix_flat<I>
+::get_n_rows() const
+{
+	return this->n_rows;
+}
+
+template <typename I>
+unsigned Sparse_matrix_flat<I>
+::get_n_cols() const
+{
+	return this->n_cols;
+}
+
+template <typename I>
+unsigned Sparse_matrix_flat<I>
+::get_n_connections() const
+{
+	return (unsigned)this->row_idx.size();
+}
+
+template <typename I>
+unsigned Sparse_matrix_flat<I>
+::get_row_degree(const size_t row_index) const
+{
+	return this->row_ptr[row_index +1] - this->row_ptr[row_index];
+}
+
+template <typename I>
+unsigned Sparse_matrix_flat<I>
+::get_col_degree(const size_t col_index) const
+{
+	return this->col_ptr[col_index +1] - this->col_ptr[col_index];
+}
+
+template <typename I>
+const I* Sparse_matrix_flat<I>
+::get_cols_from_row(const size_t row_index) const
+{
+	return this->row_idx.data() + this->row_ptr[row_index];
+}
+
+template <typename I>
+const I* Sparse_matrix_flat<I>
+::get_rows_from_col(const size_t col_index) const
+{
+	return this->col_idx.data() + this->col_ptr[col_index];
+}
+
+template <typename I>
+const std::vector<uint32_t>& Sparse_matrix_flat<I>
+::get_row_ptr() const
+{
+	return this->row_ptr;
+}
+
+template <typename I>
+const std::vector<I>& Sparse_matrix_flat<I>
+::get_row_idx() const
+{
+	return this->row_idx;
+}
+
+template <typename I>
+const std::vector<uint32_t>& Sparse_matrix_flat<I>
+::get_col_ptr() const
+{
+	return this->col_ptr;
+}
+
+template <typename I>
+const std::vector<I>& Sparse_matrix_flat<I>
+::get_col_idx() const
+{
+	return this->col_idx;
+}
+
+template <typename I>
+std::vector<uint32_t> Sparse_matrix_flat<I>
+::get_csc_to_csr() const
+{
+	std::vector<uint32_t> csc_to_csr(this->col_idx.size());
+	std::vector<uint32_t> n_met(this->n_rows, 0);
+
+	for (size_t k = 0; k < this->col_idx.size(); k++)
+	{
+		const auto r = this->col_idx[k];
+		csc_to_csr[k] = this->row_ptr[r] + n_met[r]++;
+	}
+
+	return csc_to_csr;
+}
+
+template <typename I>
+bool Sparse_matrix_flat<I>
+::is_qc() const
+{
+	return this->qc.Z != 0;
+}
+
+template <typename I>
+const QC_descriptor& Sparse_matrix_flat<I>
+::get_qc_descriptor() const
+{
+	return this->qc;
+}
+}
+}
@@ -0,0 +1,296 @@
+#if defined(__unix__) || defined(__unix) || defined(__APPLE__)
+	#define LDPC_CACHE_MMAP
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <memory>
+#include <chrono>
+#include <thread>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <utility>
+#include <functional>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Display/bash_tools.h"
+#include "Tools/Algo/Bit_matrix/Bit_matrix.hpp"
+
+#include "LDPC_matrix_handler.hpp"
+#include "LDPC_matrix_cache.hpp"
+
+using namespace aff3ct::tools;
+
+static const char     cache_magic[8] = {'A','F','F','3','C','T','_','G'};
+static const uint32_t cache_version  = 2;
+
+struct Cache_header
+{
+	char     magic[8];
+	uint32_t version;
+	uint32_t padding;
+	uint64_t hash;
+	uint32_t H_n_rows;
+	uint32_t H_n_cols;
+	uint32_t H_n_connections;
+	uint32_t n_rows;
+	uint32_t n_cols;
+	uint64_t n_connections;
+};
+
+// in-memory cache, shared by all the threads of the process: the hash of H is completed by its dimensions and its
+// number of connections, the entries are owned by their users
+using Cache_key = std::tuple<uint64_t, unsigned, unsigned, unsigned>;
+static std::mutex                                                        cache_mutex;
+static std::map<Cache_key, std::weak_ptr<const LDPC_matrix_cache::Entry>> cache_entries;
+
+uint64_t LDPC_matrix_cache
+::hash(const Sparse_matrix &H)
+{
+	uint64_t h = 14695981039346656037ULL;
+	const auto mix = [&h](const uint32_t v)
+	{
+		for (auto b = 0; b < 4; b++)
+		{
+			h ^= (v >> (8 * b)) & 0xFF;
+			h *= 1099511628211ULL;
+		}
+	};
+
+	mix(H.get_n_rows());
+	mix(H.get_n_cols());
+	for (unsigned r = 0; r < H.get_n_rows(); r++)
+	{
+		const auto &cols = H.get_cols_from_row(r);
+		mix((uint32_t)cols.size());
+		for (auto c : cols)
+			mix(c);
+	}
+
+	return h;
+}
+
+std::string LDPC_matrix_cache
+::get_path(const std::string &cache_dir, const uint64_t hash)
+{
+	std::stringstream path;
+	path << cache_dir;
+	if (!cache_dir.empty() && cache_dir.back() != '/' && cache_dir.back() != '\\')
+		path << "/";
+	path << "G_" << std::hex << std::setw(16) << std::setfill('0') << hash << ".bin";
+	return path.str();
+}
+
+// returns true if the columns of G are codewords of H (H.G^T = 0) and if the information bits positions are valid: the
+// hash only identifies H, this check rejects the files which do not hold a G of this H (hash collision, corruption)
+static bool check_G(const Sparse_matrix &H, const Sparse_matrix &G, const std::vector<unsigned> &info_bits_pos)
+{
+	const auto N = G.get_n_rows();
+	const auto K = G.get_n_cols();
+	const auto H_is_VN_by_CN = H.get_n_rows() == N;
+	if ((!H_is_VN_by_CN && H.get_n_cols() != N) || info_bits_pos.size() != K)
+		return false;
+
+	for (auto p : info_bits_pos)
+		if (p >= N)
+			return false;
+
+	// the XOR of the rows of G connected to a check node has to be null
+	const Bit_matrix G_packed(G);
+	std::vector<uint64_t> syndrome(G_packed.get_n_words());
+	const auto M = H_is_VN_by_CN ? H.get_n_cols() : H.get_n_rows();
+	for (unsigned m = 0; m < M; m++)
+	{
+		std::fill(syndrome.begin(), syndrome.end(), (uint64_t)0);
+		for (auto n : (H_is_VN_by_CN ? H.get_rows_from_col(m) : H.get_cols_from_row(m)))
+			for (unsigned w = 0; w < G_packed.get_n_words(); w++)
+				syndrome[w] ^= G_packed[n][w];
+
+		for (auto w : syndrome)
+			if (w)
+				return false;
+	}
+
+	return true;
+}
+
+static bool parse(const uint8_t *data, const size_t size, const uint64_t hash, const Sparse_matrix &H,
+                  Sparse_matrix &G, std::vector<unsigned> &info_bits_pos)
+{
+	if (size < sizeof(Cache_header))
+		return false;
+
+	Cache_header header;
+	std::memcpy(&header, data, sizeof(header));
+
+	if (std::memcmp(header.magic, cache_magic, sizeof(cache_magic)) || header.version != cache_version ||
+	    header.hash != hash || header.H_n_rows != H.get_n_rows() || header.H_n_cols != H.get_n_cols() ||
+	    header.H_n_connections != H.get_n_connections())
+		return false;
+
+	const auto n_words = (uint64_t)header.n_cols + header.n_rows + header.n_connections;
+	if (size != sizeof(Cache_header) + n_words * sizeof(uint32_t))
+		return false;
+
+	const auto words = (const uint32_t*)(data + sizeof(Cache_header));
+	const auto ibp   = words;
+	const auto deg   = ibp + header.n_cols;
+	const auto cols  = deg + header.n_rows;
+
+	info_bits_pos.assign(ibp, ibp + header.n_cols);
+
+	G = Sparse_matrix(header.n_rows, header.n_cols);
+	G.add_connections(deg, cols, header.n_connections);
+
+	return check_G(H, G, info_bits_pos);
+}
+
+bool LDPC_matrix_cache
+::load(const std::string &path, const uint64_t hash, const Sparse_matrix &H, Sparse_matrix &G,
+       std::vector<unsigned> &info_bits_pos)
+{
+	try
+	{
+#ifdef LDPC_CACHE_MMAP
+		const auto fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+			return false;
+
+		struct stat st;
+		if (::fstat(fd, &st) != 0 || st.st_size == 0)
+		{
+			::close(fd);
+			return false;
+		}
+
+		const auto size = (size_t)st.st_size;
+		auto data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd);
+		if (data == MAP_FAILED)
+			return false;
+
+		const auto ok = parse((const uint8_t*)data, size, hash, H, G, info_bits_pos);
+		::munmap(data, size);
+		return ok;
+#else
+		std::ifstream file(path, std::ios::in | std::ios::binary);
+		if (!file.is_open())
+			return false;
+
+		std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		return parse(data.data(), data.size(), hash, H, G, info_bits_pos);
+#endif
+	}
+	catch (std::exception const&)
+	{
+		return false; // corrupted file, the matrices are built again
+	}
+}
+
+void LDPC_matrix_cache
+::save(const std::string &path, const uint64_t hash, const Sparse_matrix &H, const Sparse_matrix &G,
+       const std::vector<unsigned> &info_bits_pos)
+{
+	if (info_bits_pos.size() != G.get_n_cols())
+	{
+		std::stringstream message;
+		message << "'info_bits_pos.size()' has to be equal to 'G.get_n_cols()' ('info_bits_pos.size()' = "
+		        << info_bits_pos.size() << ", 'G.get_n_cols()' = " << G.get_n_cols() << ").";
+		throw length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	Cache_header header;
+	std::memcpy(header.magic, cache_magic, sizeof(cache_magic));
+	header.version         = cache_version;
+	header.padding         = 0;
+	header.hash            = hash;
+	header.H_n_rows        = H.get_n_rows();
+	header.H_n_cols        = H.get_n_cols();
+	header.H_n_connections = H.get_n_connections();
+	header.n_rows          = G.get_n_rows();
+	header.n_cols          = G.get_n_cols();
+	header.n_connections   = G.get_n_connections();
+
+	std::vector<uint32_t> words;
+	words.reserve((size_t)header.n_cols + header.n_rows + header.n_connections);
+	words.insert(words.end(), info_bits_pos.begin(), info_bits_pos.end());
+	for (unsigned r = 0; r < G.get_n_rows(); r++)
+		words.push_back((uint32_t)G.get_cols_from_row(r).size());
+	for (unsigned r = 0; r < G.get_n_rows(); r++)
+		words.insert(words.end(), G.get_cols_from_row(r).begin(), G.get_cols_from_row(r).end());
+
+	// the file is written under a temporary name then renamed: a concurrent reader never sees a partial file
+	std::stringstream tmp_path;
+	tmp_path << path << ".tmp" << std::hash<std::thread::id>()(std::this_thread::get_id())
+	         << std::chrono::steady_clock::now().time_since_epoch().count();
+
+	// the cache is only an optimization: the simulation goes on without it if it can't be written
+	const auto warning = "The G matrix can't be written in the cache ('path' = \"" + path + "\"), it will be computed "
+	                     "again at the next launch.";
+
+	std::ofstream file(tmp_path.str(), std::ios::out | std::ios::binary);
+	if (!file.is_open())
+	{
+		std::clog << format_warning(warning) << std::endl;
+		return;
+	}
+
+	file.write((const char*)&header, sizeof(header));
+	file.write((const char*)words.data(), words.size() * sizeof(uint32_t));
+	file.close();
+	if (!file)
+	{
+		std::remove(tmp_path.str().c_str());
+		std::clog << format_warning(warning) << std::endl;
+		return;
+	}
+
+#ifdef _WIN32
+	std::remove(path.c_str()); // rename does not overwrite on Windows
+#endif
+	if (std::rename(tmp_path.str().c_str(), path.c_str()) != 0)
+		std::remove(tmp_path.str().c_str());
+}
+
+std::shared_ptr<const LDPC_matrix_cache::Entry> LDPC_matrix_cache
+::transform_H_to_G(const Sparse_matrix &H, const std::string &cache_dir)
+{
+	const auto h   = LDPC_matrix_cache::hash(H);
+	const auto key = Cache_key(h, H.get_n_rows(), H.get_n_cols(), H.get_n_connections());
+
+	std::lock_guard<std::mutex> lock(cache_mutex);
+
+	auto entry = cache_entries[key].lock();
+	if (entry == nullptr)
+	{
+		auto new_entry = std::make_shared<Entry>();
+
+		const auto path = cache_dir.empty() ? std::string() : LDPC_matrix_cache::get_path(cache_dir, h);
+		if (path.empty() || !LDPC_matrix_cache::load(path, h, H, new_entry->G, new_entry->info_bits_pos))
+		{
+			new_entry->G = LDPC_matrix_handler::transform_H_to_G(H, new_entry->info_bits_pos);
+
+			if (!path.empty())
+				LDPC_matrix_cache::save(path, h, H, new_entry->G, new_entry->info_bits_pos);
+		}
+
+		entry = new_entry;
+		cache_entries[key] = entry;
+	}
+
+	// forget the entries which are not used anymore
+	for (auto it = cache_entries.begin(); it != cache_entries.end();)
+		if (it->second.expired()) it = cache_entries.erase(it);
+		else                      ++it;
+
+	return entry;
+}
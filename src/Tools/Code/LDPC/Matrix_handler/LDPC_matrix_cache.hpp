@@ -0,0 +1,70 @@
+#ifndef LDPC_MATRIX_CACHE_HPP_
+#define LDPC_MATRIX_CACHE_HPP_
+
+#include <memory>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Cache of the matrices derived from a H matrix (the G matrix and the information bits positions), the entries are
+ * identified by a hash of the content of H, its dimensions and its number of connections. The cache lives in the
+ * memory of the process (so the threads and the successive codecs share the same Gaussian elimination and the same G)
+ * and, optionally, in a directory of binary files (so the next launches, the MPI ranks and the jobs of a sweep skip it
+ * too). The process only keeps the entries which are still used: an entry is freed with its last user.
+ *
+ * A cache file is made of (native endianness, 32-bit values unless specified):
+ *   - the magic string "AFF3CT_G", the version, a padding word, the hash of H (64-bit),
+ *   - the number of rows, of columns and of connections of H,
+ *   - the number of rows (N) and of columns (K) of G, the number of connections of G (64-bit),
+ *   - the K information bits positions,
+ *   - the N row degrees of G then the column indexes of each row.
+ * The file is memory-mapped at load when the system allows it. A loaded G is only accepted if H.G^T = 0 (the hash does
+ * not prove that the file holds a G of this H). The cache is optional: a file which can't be written only raises a
+ * warning.
+ */
+struct LDPC_matrix_cache
+{
+public:
+	struct Entry
+	{
+		Sparse_matrix         G;             // the transposed generator matrix (N x K)
+		std::vector<unsigned> info_bits_pos;
+	};
+
+	/*
+	 * FNV-1a hash of the dimensions and of the connections of a sparse matrix
+	 */
+	static uint64_t hash(const Sparse_matrix &H);
+
+	/*
+	 * Same as LDPC_matrix_handler::transform_H_to_G but the result is looked up in the cache first, and added to the
+	 * cache otherwise. The file cache is disabled if 'cache_dir' is empty. The entry has to be kept by the caller as
+	 * long as G is used.
+	 */
+	static std::shared_ptr<const Entry> transform_H_to_G(const Sparse_matrix &H, const std::string &cache_dir = "");
+
+	static std::string get_path(const std::string &cache_dir, const uint64_t hash);
+
+	/*
+	 * Return false if the file does not exist, does not match the given H or holds a G which does not verify H.G^T = 0
+	 */
+	static bool load(const std::string &path, const uint64_t hash, const Sparse_matrix &H, Sparse_matrix &G,
+	                 std::vector<unsigned> &info_bits_pos);
+
+	/*
+	 * Print a warning if the file can't be written
+	 */
+	static void save(const std::string &path, const uint64_t hash, const Sparse_matrix &H, const Sparse_matrix &G,
+	                 const std::vector<unsigned> &info_bits_pos);
+};
+}
+}
+
+#endif /* LDPC_MATRIX_CACHE_HPP_ */
@@ -108,6 +108,17 @@ Sparse_matrix QC
 		}
 	}
 
+	// keep the base graph and the shifts for the decoders that exploit the circulant structure
+	QC_descriptor qc;
+	qc.Z            = Z;
+	qc.n_block_rows = M_red;
+	qc.n_block_cols = N_red;
+	qc.shifts.resize(M_red * N_red);
+	for (unsigned i = 0; i < M_red; i++)
+		for (unsigned j = 0; j < N_red; j++)
+			qc.shifts[i * N_red + j] = H_red[i][j] < 0 ? -1 : H_red[i][j] % (int)Z;
+	H.set_qc_descriptor(qc);
+
 	return H.transpose();
 }
 
@@ -178,6 +178,66 @@ public:
 		return spc_seq<B, R, H>::apply(l_a, s_a, n_elmts);
 	}
 
+	// ----------------------------------------------------------------------------------------------------------- grep
+
+	template <int N_ELMTS = 0, class AB = std::allocator<B>, class AR = std::allocator<R>>
+	static void grep(std::vector<B,AB> &s, const std::vector<R,AR> &l, const int off_l_a, const int off_s_a,
+	                 const int n_elmts, const int period)
+	{
+		const R *__restrict l_a = l.data() + off_l_a;
+		      B *__restrict s_a = s.data() + off_s_a;
+
+		grep_seq<B, R>::apply(l_a, s_a, n_elmts, period);
+	}
+
+	// ------------------------------------------------------------------------------------------------------- grep_spc
+
+	template <int N_ELMTS = 0, class AB = std::allocator<B>, class AR = std::allocator<R>>
+	static void grep_spc(std::vector<B,AB> &s, const std::vector<R,AR> &l, const int off_l_a, const int off_s_a,
+	                     const int n_elmts)
+	{
+		const R *__restrict l_a = l.data() + off_l_a;
+		      B *__restrict s_a = s.data() + off_s_a;
+
+		grep_spc_seq<B, R>::apply(l_a, s_a, n_elmts);
+	}
+
+	// -------------------------------------------------------------------------------------------------------- grep_rm
+
+	template <int N_ELMTS = 0, class AB = std::allocator<B>, class AR = std::allocator<R>>
+	static void grep_rm(std::vector<B,AB> &s, const std::vector<R,AR> &l, const int off_l_a, const int off_s_a,
+	                    const int n_elmts)
+	{
+		const R *__restrict l_a = l.data() + off_l_a;
+		      B *__restrict s_a = s.data() + off_s_a;
+
+		grep_rm_seq<B, R>::apply(l_a, s_a, n_elmts);
+	}
+
+	// ------------------------------------------------------------------------------------------------------------ gpc
+
+	template <int N_ELMTS = 0, class AB = std::allocator<B>, class AR = std::allocator<R>>
+	static void gpc(std::vector<B,AB> &s, const std::vector<R,AR> &l, const int off_l_a, const int off_s_a,
+	                const int n_elmts, const int period)
+	{
+		const R *__restrict l_a = l.data() + off_l_a;
+		      B *__restrict s_a = s.data() + off_s_a;
+
+		gpc_seq<B, R>::apply(l_a, s_a, n_elmts, period);
+	}
+
+	// -------------------------------------------------------------------------------------------------------- gpc_rep
+
+	template <int N_ELMTS = 0, class AB = std::allocator<B>, class AR = std::allocator<R>>
+	static void gpc_rep(std::vector<B,AB> &s, const std::vector<R,AR> &l, const int off_l_a, const int off_s_a,
+	                    const int n_elmts)
+	{
+		const R *__restrict l_a = l.data() + off_l_a;
+		      B *__restrict s_a = s.data() + off_s_a;
+
+		gpc_rep_seq<B, R>::apply(l_a, s_a, n_elmts);
+	}
+
 	// ------------------------------------------------------------------------------------------------------------- xo
 
 	template <int N_ELMTS = 0>
@@ -5,6 +5,7 @@
 #include <mipp.h>
 
 #include "Tools/Math/utils.h"
+#include "Tools/Exception/exception.hpp"
 #include "Tools/Code/Polar/decoder_polar_functions.h"
 
 #include "functions_polar_inter_intra.h"
@@ -29,6 +30,16 @@ private:
 	static int os    (int off) { return (off / (sizeof(B) * 8)) * mipp::nElReg<B>(); }
 	static int ishift(int off) { return (off % (sizeof(B) * 8));                     }
 
+	// the bits of the generalized nodes are computed by the inter-frame kernels (one B per bit and per frame) in
+	// this buffer and then packed
+	static B* unpacked_bits(const int n_elmts)
+	{
+		static thread_local mipp::vector<B> s_u;
+		if (s_u.size() < (size_t)(n_elmts * mipp::nElReg<B>()))
+			s_u.resize(n_elmts * mipp::nElReg<B>());
+		return s_u.data();
+	}
+
 public:
 	static constexpr int get_n_frames() { return mipp::nElReg<R>(); }
 
@@ -198,6 +209,76 @@ public:
 		spc_inter_8bit_bitpacking<B, R, HI, N_ELMTS>::apply(l_a, s_a, init_shift, n_elmts);
 	}
 
+	// ----------------------------------------------------------------------------------------------------------- grep
+
+	template <int N_ELMTS = 0, class AB = std::allocator<B>, class AR = std::allocator<R>>
+	static void grep(std::vector<B,AB> &s, const std::vector<R,AR> &l, const int off_l_a, const int off_s_a,
+	                 const int n_elmts, const int period)
+	{
+		const R *__restrict l_a = l.data() + ol(off_l_a);
+		      B *__restrict s_a = s.data() + os(off_s_a);
+
+		auto s_u = unpacked_bits(n_elmts);
+		grep_inter<B, R>::apply(l_a, s_u, n_elmts, period);
+		pack_inter_8bit_bitpacking<B>::apply(s_u, s_a, ishift(off_s_a), n_elmts);
+	}
+
+	// ------------------------------------------------------------------------------------------------------- grep_spc
+
+	template <int N_ELMTS = 0, class AB = std::allocator<B>, class AR = std::allocator<R>>
+	static void grep_spc(std::vector<B,AB> &s, const std::vector<R,AR> &l, const int off_l_a, const int off_s_a,
+	                     const int n_elmts)
+	{
+		const R *__restrict l_a = l.data() + ol(off_l_a);
+		      B *__restrict s_a = s.data() + os(off_s_a);
+
+		auto s_u = unpacked_bits(n_elmts);
+		grep_spc_inter<B, R>::apply(l_a, s_u, n_elmts);
+		pack_inter_8bit_bitpacking<B>::apply(s_u, s_a, ishift(off_s_a), n_elmts);
+	}
+
+	// -------------------------------------------------------------------------------------------------------- grep_rm
+
+	template <int N_ELMTS = 0, class AB = std::allocator<B>, class AR = std::allocator<R>>
+	static void grep_rm(std::vector<B,AB> &s, const std::vector<R,AR> &l, const int off_l_a, const int off_s_a,
+	                    const int n_elmts)
+	{
+		const R *__restrict l_a = l.data() + ol(off_l_a);
+		      B *__restrict s_a = s.data() + os(off_s_a);
+
+		auto s_u = unpacked_bits(n_elmts);
+		grep_rm_inter<B, R>::apply(l_a, s_u, n_elmts);
+		pack_inter_8bit_bitpacking<B>::apply(s_u, s_a, ishift(off_s_a), n_elmts);
+	}
+
+	// ------------------------------------------------------------------------------------------------------------ gpc
+
+	template <int N_ELMTS = 0, class AB = std::allocator<B>, class AR = std::allocator<R>>
+	static void gpc(std::vector<B,AB> &s, const std::vector<R,AR> &l, const int off_l_a, const int off_s_a,
+	                const int n_elmts, const int period)
+	{
+		const R *__restrict l_a = l.data() + ol(off_l_a);
+		      B *__restrict s_a = s.data() + os(off_s_a);
+
+		auto s_u = unpacked_bits(n_elmts);
+		gpc_inter<B, R>::apply(l_a, s_u, n_elmts, period);
+		pack_inter_8bit_bitpacking<B>::apply(s_u, s_a, ishift(off_s_a), n_elmts);
+	}
+
+	// -------------------------------------------------------------------------------------------------------- gpc_rep
+
+	template <int N_ELMTS = 0, class AB = std::allocator<B>, class AR = std::allocator<R>>
+	static void gpc_rep(std::vector<B,AB> &s, const std::vector<R,AR> &l, const int off_l_a, const int off_s_a,
+	                    const int n_elmts)
+	{
+		const R *__restrict l_a = l.data() + ol(off_l_a);
+		      B *__restrict s_a = s.data() + os(off_s_a);
+
+		auto s_u = unpacked_bits(n_elmts);
+		gpc_rep_inter<B, R>::apply(l_a, s_u, n_elmts);
+		pack_inter_8bit_bitpacking<B>::apply(s_u, s_a, ishift(off_s_a), n_elmts);
+	}
+
 	// ------------------------------------------------------------------------------------------------------------- xo
 
 	template <int N_ELMTS = 0>
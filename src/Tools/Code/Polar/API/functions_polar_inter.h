@@ -1,6 +1,7 @@
 #ifndef FUNCTIONS_POLAR_INTER_H_
 #define FUNCTIONS_POLAR_INTER_H_
 
+#include <limits>
 #include <algorithm>
 #include <mipp.h>
 
@@ -178,6 +179,222 @@ struct spc_inter <B, R, HI, 0>
 		}
 	}
 };
+
+// ======================================================================================================= grep(), gpc()
+// ====================================================================================================================
+// ====================================================================================================================
+
+// the generalized nodes of W frames at once: the element 'i' of the frame 'f' is stored at 'i * W + f'
+template <typename B, typename R>
+struct gen_node_inter
+{
+	static constexpr int W = mipp::nElReg<R>();
+
+	static mipp::Reg<R> load_sat(const R *l_a)
+	{
+		// the LLRs are saturated to be symmetric (-127 instead of -128 with chars)
+		return mipp::max(mipp::Reg<R>(l_a), mipp::Reg<R>(-std::numeric_limits<R>::max()));
+	}
+
+	static mipp::Reg<B> bits(const mipp::Msk<mipp::N<R>()> m_b)
+	{
+		return mipp::blend(mipp::Reg<B>(bit_init<B>()), mipp::Reg<B>((B)0), m_b);
+	}
+
+	// repeats the 'period' bits of the source codewords
+	static void expand(const mipp::Msk<mipp::N<R>()> *m_bits, B *__restrict s_a, const int n_elmts, const int period)
+	{
+		for (auto j = 0; j < period; j++)
+		{
+			const auto r_b = gen_node_inter<B,R>::bits(m_bits[j]);
+			for (auto i = j; i < n_elmts; i += period)
+				r_b.store(s_a + i * W);
+		}
+	}
+
+	// sums of the LLRs of the 'period' sub-codes
+	static void fold(const R *__restrict l_a, mipp::Reg<R> *r_sums, const int n_elmts, const int period)
+	{
+		for (auto j = 0; j < period; j++)
+		{
+			r_sums[j] = mipp::Reg<R>((R)0);
+			for (auto i = j; i < n_elmts; i += period)
+				r_sums[j] += gen_node_inter<B,R>::load_sat(l_a + i * W);
+		}
+	}
+
+	// parities and least reliable absolute LLRs of the sub-code 'j'
+	static void sub_code(const R *__restrict l_a, const int n_elmts, const int period, const int j,
+	                     mipp::Msk<mipp::N<R>()> &m_par, mipp::Reg<R> &r_min)
+	{
+		const auto r_zero = mipp::Reg<R>((R)0);
+		const auto r_one  = mipp::Reg<R>((R)1);
+
+		auto r_par = mipp::Reg<R>((R)0);
+		r_min = mipp::Reg<R>(std::numeric_limits<R>::max());
+		for (auto i = j; i < n_elmts; i += period)
+		{
+			const auto r_l = gen_node_inter<B,R>::load_sat(l_a + i * W);
+			r_par = mipp::blend(r_one - r_par, r_par, r_l < r_zero);
+			r_min = mipp::min(r_min, mipp::abs(r_l));
+		}
+		m_par = r_par != r_zero;
+	}
+
+	// hard decisions of the sub-code 'j', the least reliable bit is flipped in the frames of 'm_flip'
+	static void decide(const R *__restrict l_a, B *__restrict s_a, const int n_elmts, const int period, const int j,
+	                   const mipp::Msk<mipp::N<R>()> m_flip, const mipp::Reg<R> r_min)
+	{
+		const auto r_zero = mipp::Reg<R>((R)0);
+
+		auto m_todo = m_flip;
+		for (auto i = j; i < n_elmts; i += period)
+		{
+			const auto r_l   = gen_node_inter<B,R>::load_sat(l_a + i * W);
+			const auto m_sel = m_todo & (mipp::abs(r_l) == r_min);
+
+			gen_node_inter<B,R>::bits((r_l < r_zero) ^ m_sel).store(s_a + i * W);
+			m_todo = m_todo & ~m_sel;
+		}
+	}
+};
+
+template <typename B, typename R>
+struct grep_inter
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_elmts, const int period)
+	{
+		constexpr auto W = mipp::nElReg<R>();
+		const auto r_zero = mipp::Reg<R>((R)0);
+
+		for (auto j = 0; j < period; j++)
+		{
+			auto r_sum = mipp::Reg<R>((R)0);
+			for (auto i = j; i < n_elmts; i += period)
+				r_sum += gen_node_inter<B,R>::load_sat(l_a + i * W);
+
+			const auto r_r = gen_node_inter<B,R>::bits(r_sum < r_zero);
+			for (auto i = j; i < n_elmts; i += period)
+				r_r.store(s_a + i * W);
+		}
+	}
+};
+
+template <typename B, typename R>
+struct grep_spc_inter
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_elmts)
+	{
+		const auto r_zero = mipp::Reg<R>((R)0);
+
+		mipp::Reg<R> r_sums[4];
+		gen_node_inter<B,R>::fold(l_a, r_sums, n_elmts, 4);
+
+		// SPC decoding of the sums in the lanes
+		mipp::Msk<mipp::N<R>()> m_bits[4];
+		auto r_min = mipp::abs(r_sums[0]);
+		auto m_odd = r_sums[0] < r_zero;
+		for (auto j = 1; j < 4; j++)
+		{
+			r_min = mipp::min(r_min, mipp::abs(r_sums[j]));
+			m_odd = m_odd ^ (r_sums[j] < r_zero);
+		}
+		for (auto j = 0; j < 4; j++)
+		{
+			const auto m_sel = m_odd & (mipp::abs(r_sums[j]) == r_min);
+			m_bits[j] = (r_sums[j] < r_zero) ^ m_sel;
+			m_odd = m_odd & ~m_sel;
+		}
+
+		gen_node_inter<B,R>::expand(m_bits, s_a, n_elmts, 4);
+	}
+};
+
+template <typename B, typename R>
+struct grep_rm_inter
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_elmts)
+	{
+		const auto r_zero = mipp::Reg<R>((R)0);
+
+		mipp::Reg<R> r_h[8];
+		gen_node_inter<B,R>::fold(l_a, r_h, n_elmts, 8);
+
+		// correlations with the 8 linear functions (see gen_node_seq::rm13)
+		for (auto len = 1; len < 8; len <<= 1)
+			for (auto i = 0; i < 8; i += 2 * len)
+				for (auto j = i; j < i + len; j++)
+				{
+					const auto r_x = r_h[j], r_y = r_h[j + len];
+					r_h[j      ] = r_x + r_y;
+					r_h[j + len] = r_x - r_y;
+				}
+
+		// the codeword bits of the best linear function are selected in the lanes
+		mipp::Msk<mipp::N<R>()> m_bits[8];
+		for (auto j = 0; j < 8; j++)
+			m_bits[j] = r_zero != r_zero;
+
+		auto r_best = r_h[0];
+		auto r_max  = mipp::abs(r_h[0]);
+		for (auto w = 1; w < 8; w++)
+		{
+			const auto r_abs    = mipp::abs(r_h[w]);
+			const auto m_better = r_abs > r_max;
+
+			r_max  = mipp::max(r_max, r_abs);
+			r_best = mipp::blend(r_h[w], r_best, m_better);
+			for (auto j = 0; j < 8; j++)
+			{
+				const auto wj = w & j;
+				m_bits[j] = (((wj >> 2) ^ (wj >> 1) ^ wj) & 1) ? (m_bits[j] | m_better) : (m_bits[j] & ~m_better);
+			}
+		}
+
+		const auto m_neg = r_best < r_zero;
+		for (auto j = 0; j < 8; j++)
+			m_bits[j] = m_bits[j] ^ m_neg;
+
+		gen_node_inter<B,R>::expand(m_bits, s_a, n_elmts, 8);
+	}
+};
+
+template <typename B, typename R>
+struct gpc_inter
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_elmts, const int period)
+	{
+		for (auto j = 0; j < period; j++)
+		{
+			mipp::Msk<mipp::N<R>()> m_par;
+			mipp::Reg<R> r_min;
+			gen_node_inter<B,R>::sub_code(l_a,      n_elmts, period, j, m_par, r_min);
+			gen_node_inter<B,R>::decide  (l_a, s_a, n_elmts, period, j, m_par, r_min);
+		}
+	}
+};
+
+template <typename B, typename R>
+struct gpc_rep_inter
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_elmts)
+	{
+		const auto r_zero = mipp::Reg<R>((R)0);
+
+		mipp::Msk<mipp::N<R>()> m_par[4];
+		mipp::Reg<R> r_min[4];
+		auto r_soft = r_zero;
+		for (auto j = 0; j < 4; j++)
+		{
+			gen_node_inter<B,R>::sub_code(l_a, n_elmts, 4, j, m_par[j], r_min[j]);
+			r_soft += mipp::blend(r_zero - r_min[j], r_min[j], m_par[j]);
+		}
+
+		const auto m_odd = r_soft < r_zero;
+		for (auto j = 0; j < 4; j++)
+			gen_node_inter<B,R>::decide(l_a, s_a, n_elmts, 4, j, m_par[j] ^ m_odd, r_min[j]);
+	}
+};
 }
 }
 
@@ -952,6 +952,31 @@ struct xo0_inter_8bit_bitpacking <B, 1>
 		mipp::store<B>(s_c, r_u_c_packed);
 	}
 };
+
+// ============================================================================================================= pack()
+// ====================================================================================================================
+// ====================================================================================================================
+
+// packs the bits of a node computed by an inter-frame kernel ('s_u': the bit 'i' of the frame 'f' is at 'i * W + f')
+template <typename B>
+struct pack_inter_8bit_bitpacking
+{
+	static void apply(const B *__restrict s_u, B *__restrict s_a, const int init_shift, const int n_elmts)
+	{
+		constexpr int W = mipp::nElReg<B>();
+		constexpr int n_bits = sizeof(B) * 8;
+
+		for (auto i = 0; i < n_elmts; i++)
+		{
+			const auto pos  = init_shift + i;
+			const auto mask = (B)(1 << (pos % n_bits));
+			auto s_w = s_a + (pos / n_bits) * W;
+
+			for (auto f = 0; f < W; f++)
+				s_w[f] = s_u[i * W + f] ? (B)(s_w[f] | mask) : (B)(s_w[f] & ~mask);
+		}
+	}
+};
 }
 }
 
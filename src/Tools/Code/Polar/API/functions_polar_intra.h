@@ -1,6 +1,7 @@
 #ifndef FUNCTIONS_POLAR_INTRA_H_
 #define FUNCTIONS_POLAR_INTRA_H_
 
+#include <limits>
 #include <algorithm>
 #include <mipp.h>
 
@@ -8,6 +9,7 @@
 #include "Tools/Code/Polar/decoder_polar_functions.h"
 
 #include "functions_polar_inter_intra.h"
+#include "functions_polar_seq.h"
 
 namespace aff3ct
 {
@@ -273,6 +275,251 @@ struct spc_intra <B, R, HI, 0>
 		return (s_prod_sign < 0);
 	}
 };
+
+// ======================================================================================================= grep(), gpc()
+// ====================================================================================================================
+// ====================================================================================================================
+
+// the generalized nodes in the SIMD lanes of a frame: 'n_elmts' has to be a multiple of the SIMD width
+template <typename B, typename R>
+struct gen_node_intra
+{
+	using A = typename gen_node_seq<B,R>::A;
+
+	static constexpr int W = mipp::nElReg<R>();
+	static constexpr int S = W > 8 ? W : 8; // size of the buffers of the sub-codes
+
+	static mipp::Reg<R> load_sat(const R *l_a)
+	{
+		// the LLRs are saturated to be symmetric (-127 instead of -128 with chars)
+		return mipp::max(mipp::Reg<R>(l_a), mipp::Reg<R>(-std::numeric_limits<R>::max()));
+	}
+
+	static A abs_sat(const R l)
+	{
+		return std::abs((A)std::max(l, (R)-std::numeric_limits<R>::max()));
+	}
+
+	// sums of the LLRs of the 'period' sub-codes ('period' <= 'S')
+	static void fold(const R *__restrict l_a, A *__restrict sums, const int n_elmts, const int period)
+	{
+		R tmp[W];
+		if (period >= W)
+		{
+			for (auto j = 0; j < period; j += W)
+			{
+				auto r_sum = mipp::Reg<R>((R)0);
+				for (auto i = j; i < n_elmts; i += period)
+					r_sum += gen_node_intra<B,R>::load_sat(l_a +i);
+
+				r_sum.storeu(tmp);
+				for (auto k = 0; k < W; k++)
+					sums[j +k] = (A)tmp[k];
+			}
+		}
+		else
+		{
+			// the lane 'k' of a register belongs to the sub-code 'k % period'
+			auto r_sum = mipp::Reg<R>((R)0);
+			for (auto i = 0; i < n_elmts; i += W)
+				r_sum += gen_node_intra<B,R>::load_sat(l_a +i);
+
+			r_sum.storeu(tmp);
+			for (auto j = 0; j < period; j++)
+				sums[j] = (A)0;
+			for (auto k = 0; k < W; k++)
+				sums[k % period] += (A)tmp[k];
+		}
+	}
+
+	// repeats the 'period' bits of the source codeword
+	static void expand(const B *__restrict bits, B *__restrict s_a, const int n_elmts, const int period)
+	{
+		if (period >= W)
+		{
+			for (auto j = 0; j < period; j += W)
+			{
+				mipp::Reg<B> r_b; r_b.loadu(bits +j);
+				for (auto i = j; i < n_elmts; i += period)
+					r_b.store(s_a +i);
+			}
+		}
+		else
+		{
+			B pattern[W];
+			for (auto k = 0; k < W; k++)
+				pattern[k] = bits[k % period];
+
+			mipp::Reg<B> r_b; r_b.loadu(pattern);
+			for (auto i = 0; i < n_elmts; i += W)
+				r_b.store(s_a +i);
+		}
+	}
+
+	// hard decisions in 's_a', parities and least reliable absolute LLRs of the sub-codes: of the sub-codes 'j0' to
+	// 'j0 + W -1' if 'period' >= W, of all the sub-codes otherwise
+	static void sub_codes(const R *__restrict l_a, B *__restrict s_a, const int n_elmts, const int period, const int j0,
+	                      bool *__restrict parity, A *__restrict min_abs)
+	{
+		const auto r_zero = mipp::Reg<R>((R)0);
+		const auto r_one  = mipp::Reg<R>((R)1);
+		const auto r_bit  = mipp::Reg<B>(bit_init<B>());
+		const auto r_b0   = mipp::Reg<B>((B)0);
+		const auto first  = period >= W ? j0     : 0;
+		const auto step   = period >= W ? period : W;
+
+		auto r_min = mipp::Reg<R>(std::numeric_limits<R>::max());
+		auto r_par = mipp::Reg<R>((R)0);
+		for (auto i = first; i < n_elmts; i += step)
+		{
+			const auto r_l    = gen_node_intra<B,R>::load_sat(l_a +i);
+			const auto m_sign = r_l < r_zero;
+
+			mipp::blend(r_bit, r_b0, m_sign).store(s_a +i);
+			r_par = mipp::blend(r_one - r_par, r_par, m_sign);
+			r_min = mipp::min(r_min, mipp::abs(r_l));
+		}
+
+		R par[W], mins[W];
+		r_par.storeu(par);
+		r_min.storeu(mins);
+		if (period >= W)
+		{
+			for (auto k = 0; k < W; k++)
+			{
+				parity [k] = par[k] != (R)0;
+				min_abs[k] = (A)mins[k];
+			}
+		}
+		else
+		{
+			for (auto j = 0; j < period; j++)
+			{
+				parity [j] = false;
+				min_abs[j] = std::numeric_limits<A>::max();
+			}
+			for (auto k = 0; k < W; k++)
+			{
+				parity [k % period] ^= par[k] != (R)0;
+				min_abs[k % period]  = std::min(min_abs[k % period], (A)mins[k]);
+			}
+		}
+	}
+
+	// flips the least reliable bit of the sub-code 'j'
+	static void flip(const R *__restrict l_a, B *__restrict s_a, const int n_elmts, const int period, const int j,
+	                 const A min_abs)
+	{
+		auto i = j;
+		while (i < n_elmts - period && gen_node_intra<B,R>::abs_sat(l_a[i]) != min_abs) i += period;
+		s_a[i] = s_a[i] ? (B)0 : bit_init<B>();
+	}
+};
+
+template <typename B, typename R>
+struct grep_intra
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_elmts, const int period)
+	{
+		constexpr auto W = mipp::nElReg<R>();
+
+		if (period >= W)
+		{
+			const auto r_zero = mipp::Reg<R>((R)0);
+			const auto r_bit  = mipp::Reg<B>(bit_init<B>());
+			const auto r_b0   = mipp::Reg<B>((B)0);
+
+			for (auto j = 0; j < period; j += W)
+			{
+				auto r_sum = mipp::Reg<R>((R)0);
+				for (auto i = j; i < n_elmts; i += period)
+					r_sum += gen_node_intra<B,R>::load_sat(l_a +i);
+
+				const auto r_r = mipp::blend(r_bit, r_b0, r_sum < r_zero);
+				for (auto i = j; i < n_elmts; i += period)
+					r_r.store(s_a +i);
+			}
+		}
+		else
+		{
+			typename gen_node_intra<B,R>::A sums[W];
+			B bits[W];
+			gen_node_intra<B,R>::fold(l_a, sums, n_elmts, period);
+			for (auto j = 0; j < period; j++)
+				bits[j] = (sums[j] < 0) * bit_init<B>();
+			gen_node_intra<B,R>::expand(bits, s_a, n_elmts, period);
+		}
+	}
+};
+
+template <typename B, typename R>
+struct grep_spc_intra
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_elmts)
+	{
+		typename gen_node_intra<B,R>::A sums[gen_node_intra<B,R>::S];
+		B bits[gen_node_intra<B,R>::S];
+		gen_node_intra<B,R>::fold  (l_a, sums, n_elmts, 4);
+		gen_node_seq  <B,R>::spc   (sums, bits, 4);
+		gen_node_intra<B,R>::expand(bits, s_a, n_elmts, 4);
+	}
+};
+
+template <typename B, typename R>
+struct grep_rm_intra
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_elmts)
+	{
+		typename gen_node_intra<B,R>::A sums[gen_node_intra<B,R>::S];
+		B bits[gen_node_intra<B,R>::S];
+		gen_node_intra<B,R>::fold  (l_a, sums, n_elmts, 8);
+		gen_node_seq  <B,R>::rm13  (sums, bits);
+		gen_node_intra<B,R>::expand(bits, s_a, n_elmts, 8);
+	}
+};
+
+template <typename B, typename R>
+struct gpc_intra
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_elmts, const int period)
+	{
+		constexpr auto W = mipp::nElReg<R>();
+
+		bool parity[gen_node_intra<B,R>::S];
+		typename gen_node_intra<B,R>::A min_abs[gen_node_intra<B,R>::S];
+		for (auto j0 = 0; j0 < period; j0 += W)
+		{
+			gen_node_intra<B,R>::sub_codes(l_a, s_a, n_elmts, period, j0, parity, min_abs);
+			for (auto k = 0; k < std::min(W, period); k++)
+				if (parity[k])
+					gen_node_intra<B,R>::flip(l_a, s_a, n_elmts, period, j0 +k, min_abs[k]);
+		}
+	}
+};
+
+template <typename B, typename R>
+struct gpc_rep_intra
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_elmts)
+	{
+		constexpr auto W = mipp::nElReg<R>();
+		using A = typename gen_node_intra<B,R>::A;
+
+		bool parity[gen_node_intra<B,R>::S];
+		A min_abs[gen_node_intra<B,R>::S];
+		for (auto j0 = 0; j0 < 4; j0 += W)
+			gen_node_intra<B,R>::sub_codes(l_a, s_a, n_elmts, 4, j0, parity + j0, min_abs + j0);
+
+		A soft = (A)0;
+		for (auto j = 0; j < 4; j++)
+			soft += parity[j] ? -min_abs[j] : min_abs[j];
+
+		const auto odd = soft < 0;
+		for (auto j = 0; j < 4; j++)
+			if (parity[j] != odd)
+				gen_node_intra<B,R>::flip(l_a, s_a, n_elmts, 4, j, min_abs[j]);
+	}
+};
 }
 }
 
@@ -1,6 +1,8 @@
 #ifndef FUNCTIONS_POLAR_SEQ_H_
 #define FUNCTIONS_POLAR_SEQ_H_
 
+#include <cmath>
+#include <limits>
 #include <algorithm>
 #ifdef _MSC_VER
 #include <iterator>
@@ -292,6 +294,193 @@ struct spc_seq <B, R, H, 0>
 	}
 };
 
+// ======================================================================================================= grep(), gpc()
+// ====================================================================================================================
+// ====================================================================================================================
+
+// decisions shared by the generalized nodes, on LLRs accumulated in 'A' (an integer instead of a char)
+template <typename B, typename R>
+struct gen_node_seq
+{
+	using A = decltype(R() + R());
+
+	// sums of the LLRs of each of the 'period' interleaved sub-codes
+	static void fold(const R *__restrict l_a, A *__restrict sums, const int n_elmts, const int period)
+	{
+		for (auto j = 0; j < period; j++)
+			sums[j] = (A)0;
+		for (auto i = 0; i < n_elmts; i += period)
+			for (auto j = 0; j < period; j++)
+				sums[j] += (A)l_a[i +j];
+	}
+
+	// repeats the 'period' bits of the source codeword
+	static void expand(const B *__restrict bits, B *__restrict s_a, const int n_elmts, const int period)
+	{
+		for (auto i = 0; i < n_elmts; i += period)
+			std::copy(bits, bits + period, s_a + i);
+	}
+
+	// ML decoding of a SPC code (Wagner): the least reliable bit is flipped if the parity is odd
+	template <typename T>
+	static void spc(const T *__restrict llrs, B *__restrict bits, const int n)
+	{
+		auto parity  = false;
+		auto min_pos = 0;
+		for (auto j = 0; j < n; j++)
+		{
+			bits[j] = (llrs[j] < 0) * bit_init<B>();
+			parity ^= (llrs[j] < 0);
+			if (std::abs(llrs[j]) < std::abs(llrs[min_pos]))
+				min_pos = j;
+		}
+
+		if (parity)
+			bits[min_pos] = bits[min_pos] ? (B)0 : bit_init<B>();
+	}
+
+	// ML decoding of the RM(1,3) code: its 16 codewords are the affine functions 'b ^ popcount(w & j)' of the index 'j'
+	// of the bit, the correlations with the 8 linear functions 'w' are given by a fast Hadamard transform
+	template <typename T>
+	static void rm13(const T *__restrict llrs, B *__restrict bits)
+	{
+		T h[8];
+		std::copy(llrs, llrs + 8, h);
+		for (auto len = 1; len < 8; len <<= 1)
+			for (auto i = 0; i < 8; i += 2 * len)
+				for (auto j = i; j < i + len; j++)
+				{
+					const auto x = h[j], y = h[j + len];
+					h[j      ] = x + y;
+					h[j + len] = x - y;
+				}
+
+		auto w = 0;
+		for (auto k = 1; k < 8; k++)
+			if (std::abs(h[k]) > std::abs(h[w]))
+				w = k;
+
+		const auto b = h[w] < 0;
+		for (auto j = 0; j < 8; j++)
+		{
+			const auto wj = w & j;
+			const auto parity = ((wj >> 2) ^ (wj >> 1) ^ wj) & 1;
+			bits[j] = ((int)b ^ parity) * bit_init<B>();
+		}
+	}
+};
+
+// G-Rep node: repetition of a rate-1 source of 'period' bits (Type-I when 'period' = 2)
+template <typename B, typename R>
+struct grep_seq
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_elmts, const int period)
+	{
+		for (auto j = 0; j < period; j++)
+		{
+			auto sum_l = (typename gen_node_seq<B,R>::A)0;
+			for (auto i = j; i < n_elmts; i += period)
+				sum_l += l_a[i];
+
+			const B r = (sum_l < 0) * bit_init<B>();
+			for (auto i = j; i < n_elmts; i += period)
+				s_a[i] = r;
+		}
+	}
+};
+
+// Type-II node: repetition of a SPC code of 4 bits
+template <typename B, typename R>
+struct grep_spc_seq
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_elmts)
+	{
+		typename gen_node_seq<B,R>::A sums[4];
+		B bits[4];
+		gen_node_seq<B,R>::fold  (l_a, sums, n_elmts, 4);
+		gen_node_seq<B,R>::spc   (sums, bits, 4);
+		gen_node_seq<B,R>::expand(bits, s_a, n_elmts, 4);
+	}
+};
+
+// Type-V node: repetition of the RM(1,3) code
+template <typename B, typename R>
+struct grep_rm_seq
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_elmts)
+	{
+		typename gen_node_seq<B,R>::A sums[8];
+		B bits[8];
+		gen_node_seq<B,R>::fold  (l_a, sums, n_elmts, 8);
+		gen_node_seq<B,R>::rm13  (sums, bits);
+		gen_node_seq<B,R>::expand(bits, s_a, n_elmts, 8);
+	}
+};
+
+// G-PC node: 'period' interleaved SPC codes (Type-III when 'period' = 2)
+template <typename B, typename R>
+struct gpc_seq
+{
+	using A = typename gen_node_seq<B,R>::A;
+
+	// hard decisions of a sub-code, returns its parity, its least reliable bit and its absolute LLR
+	static bool sub_code(const R *__restrict l_a, B *__restrict s_a, const int n_elmts, const int period, const int j,
+	                     int &min_pos, A &min_abs)
+	{
+		auto parity = false;
+		min_pos = j;
+		min_abs = std::numeric_limits<A>::max();
+		for (auto i = j; i < n_elmts; i += period)
+		{
+			const auto sign = l_a[i] < 0;
+			const auto abs  = sign ? -(A)l_a[i] : (A)l_a[i];
+
+			s_a[i] = sign * bit_init<B>();
+			parity ^= sign;
+			if (abs < min_abs)
+			{
+				min_abs = abs;
+				min_pos = i;
+			}
+		}
+		return parity;
+	}
+
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_elmts, const int period)
+	{
+		for (auto j = 0; j < period; j++)
+		{
+			int min_pos; A min_abs;
+			if (gpc_seq<B,R>::sub_code(l_a, s_a, n_elmts, period, j, min_pos, min_abs))
+				s_a[min_pos] = s_a[min_pos] ? (B)0 : bit_init<B>(); // correction
+		}
+	}
+};
+
+// Type-IV node: 4 interleaved codes with the same parity (even or odd), the common parity is decided from the sum of
+// the soft parities of the sub-codes
+template <typename B, typename R>
+struct gpc_rep_seq
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_elmts)
+	{
+		using A = typename gen_node_seq<B,R>::A;
+
+		bool parity[4]; int min_pos[4]; A min_abs[4];
+		A soft = (A)0;
+		for (auto j = 0; j < 4; j++)
+		{
+			parity[j] = gpc_seq<B,R>::sub_code(l_a, s_a, n_elmts, 4, j, min_pos[j], min_abs[j]);
+			soft += parity[j] ? -min_abs[j] : min_abs[j];
+		}
+
+		const auto odd = soft < 0;
+		for (auto j = 0; j < 4; j++)
+			if (parity[j] != odd)
+				s_a[min_pos[j]] = s_a[min_pos[j]] ? (B)0 : bit_init<B>(); // correction
+	}
+};
+
 // ================================================================================================================ x()
 // ====================================================================================================================
 // ====================================================================================================================
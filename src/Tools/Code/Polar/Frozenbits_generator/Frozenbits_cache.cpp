@@ -0,0 +1,92 @@
+#include <cmath>
+#include <map>
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include "Frozenbits_cache.hpp"
+
+using namespace aff3ct::tools;
+
+namespace
+{
+using Cache_key = std::tuple<std::string, int, int, int64_t>;
+
+struct Cache_entry
+{
+	std::once_flag        evaluated;
+	std::vector<uint32_t> best_channels;
+};
+}
+
+// in-memory cache, shared by all the threads of the process
+static std::mutex                                          cache_mutex;
+static std::map<Cache_key, std::shared_ptr<Cache_entry>> cache_entries;
+static std::deque<Cache_key>                               cache_order; // insertion order of the entries
+static size_t                                              cache_max_size = 64;
+
+int64_t Frozenbits_cache
+::quantize(const float sigma)
+{
+	return (int64_t)std::llround((double)sigma * 1e4);
+}
+
+void Frozenbits_cache
+::get(const std::string &method, const int N, const int K, const float sigma, std::vector<uint32_t> &best_channels,
+      const std::function<void()> &evaluate)
+{
+	const auto key = std::make_tuple(method, N, K, Frozenbits_cache::quantize(sigma));
+
+	std::shared_ptr<Cache_entry> entry;
+	{
+		std::lock_guard<std::mutex> lock(cache_mutex);
+
+		auto it = cache_entries.find(key);
+		if (it == cache_entries.end())
+		{
+			while (!cache_order.empty() && cache_entries.size() >= cache_max_size)
+			{
+				cache_entries.erase(cache_order.front());
+				cache_order.pop_front();
+			}
+
+			it = cache_entries.insert(std::make_pair(key, std::make_shared<Cache_entry>())).first;
+			cache_order.push_back(key);
+		}
+		entry = it->second;
+	}
+
+	// the evaluation is done out of the lock of the cache: the other points are not blocked, and if 'evaluate' throws
+	// the next call tries again
+	std::call_once(entry->evaluated, [&]()
+	{
+		evaluate();
+		entry->best_channels = best_channels;
+	});
+
+	best_channels = entry->best_channels;
+}
+
+void Frozenbits_cache
+::set_max_size(const size_t max_size)
+{
+	std::lock_guard<std::mutex> lock(cache_mutex);
+
+	cache_max_size = max_size;
+	while (!cache_order.empty() && cache_entries.size() > cache_max_size)
+	{
+		cache_entries.erase(cache_order.front());
+		cache_order.pop_front();
+	}
+}
+
+void Frozenbits_cache
+::clear()
+{
+	std::lock_guard<std::mutex> lock(cache_mutex);
+
+	cache_entries.clear();
+	cache_order.clear();
+}
@@ -0,0 +1,40 @@
+#ifndef FROZENBITS_CACHE_HPP_
+#define FROZENBITS_CACHE_HPP_
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Cache of the best channels computed by the frozen bits generators, the entries are identified by the construction
+ * method, N, K and the quantized sigma. The cache lives in the memory of the process: when the threads of a simulation
+ * reach a new SNR point at the same time, only one of them evaluates the best channels and the others wait for it.
+ */
+struct Frozenbits_cache
+{
+public:
+	/*
+	 * Sigma is quantized to 1e-4 (two sigmas with the same quantized value share the same frozen bits)
+	 */
+	static int64_t quantize(const float sigma);
+
+	/*
+	 * Fill 'best_channels' from the cache, 'evaluate' is called (by a single thread) to fill 'best_channels' if the
+	 * entry is not in the cache
+	 */
+	static void get(const std::string &method, const int N, const int K, const float sigma,
+	                std::vector<uint32_t> &best_channels, const std::function<void()> &evaluate);
+
+	static void set_max_size(const size_t max_size);
+
+	static void clear();
+};
+}
+}
+
+#endif /* FROZENBITS_CACHE_HPP_ */
@@ -9,10 +9,13 @@
 #define FROZENBITS_GENERATOR_HPP_
 
 #include <sstream>
+#include <string>
 #include <vector>
 
 #include "Tools/Exception/exception.hpp"
 
+#include "Frozenbits_cache.hpp"
+
 namespace aff3ct
 {
 namespace tools
@@ -86,7 +89,11 @@ public:
 			throw length_error(__FILE__, __LINE__, __func__, message.str());
 		}
 
-		this->evaluate();
+		const auto method = this->get_method();
+		if (method.empty())
+			this->evaluate();
+		else
+			Frozenbits_cache::get(method, N, K, sigma, best_channels, [this]() { this->evaluate(); });
 
 		// init frozen_bits vector, true means frozen bits, false means information bits
 		std::fill(frozen_bits.begin(), frozen_bits.end(), true);
@@ -105,6 +112,19 @@ public:
 	}
 
 protected:
+	/*!
+	 * \brief Gets the construction method.
+	 *
+	 * The best channels are cached by construction method, N, K and sigma (see Frozenbits_cache), they are evaluated
+	 * at each generation if the method is empty.
+	 *
+	 * \return the construction method.
+	 */
+	virtual std::string get_method() const
+	{
+		return "";
+	}
+
 	/*!
 	 * \brief Evaluates the best channels.
 	 *
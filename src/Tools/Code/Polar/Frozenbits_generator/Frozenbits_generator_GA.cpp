@@ -14,7 +14,7 @@ using namespace aff3ct::tools;
 
 Frozenbits_generator_GA
 ::Frozenbits_generator_GA(const int K, const int N, const float sigma)
-: Frozenbits_generator(K, N, sigma), m((int)std::log2(N)), z((int)std::exp2(m), 0)
+: Frozenbits_generator(K, N, sigma), m((int)std::log2(N)), z(N, 0), z_tmp(N / 2 +1), z_chk(N / 2 +1)
 {
 }
 
@@ -23,35 +23,64 @@ Frozenbits_generator_GA
 {
 }
 
+std::string Frozenbits_generator_GA
+::get_method() const
+{
+	return "GA";
+}
+
 void Frozenbits_generator_GA
 ::evaluate()
 {
-	for (unsigned i = 0; i != this->best_channels.size(); i++) 
+	for (unsigned i = 0; i != this->best_channels.size(); i++)
 		this->best_channels[i] = i;
 
-	for (auto i = 0; i < std::exp2(m); i++)
-		z[i] = 2.0 / std::pow((double)this->sigma, 2.0);
-
+	// the 2^l values of the level 'l' are contiguous (the value 't' of the level 'l' is the value 't * 2^(m-l)' of the
+	// final level), so each level is made of loops over contiguous arrays
+	z[0] = 2.0 / ((double)this->sigma * (double)this->sigma);
 	for (auto l = 1; l <= m; l++)
 	{
-		auto o1 = (int)std::exp2(m - l +1);
-		auto o2 = (int)std::exp2(m - l   );
+		const auto n = 1 << (l -1);
 
-		for (auto t = 0; t < (int)std::exp2(l -1); t++)
-		{
-			double T = z[t * o1];
-			
-			z[t * o1] = phi_inv(1.0 - std::pow(1.0 - phi(T), 2.0));
-			if (z[t * o1] == HUGE_VAL)
-				z[t * o1] = T + M_LN2 / (alpha * gamma);
+		std::copy(z.begin(), z.begin() + n, z_tmp.begin());
+		this->check_node(z_tmp.data(), z_chk.data(), n);
 
-			z[t * o1 + o2] = 2.0 * T;
+		for (auto t = 0; t < n; t++)
+		{
+			z[2 * t +0] = z_chk[t];
+			z[2 * t +1] = 2.0 * z_tmp[t];
 		}
 	}
 
 	std::sort(this->best_channels.begin(), this->best_channels.end(), [this](int i1, int i2) { return z[i1] > z[i2]; });
 }
 
+void Frozenbits_generator_GA
+::check_node(const double *T, double *z_out, const int n)
+{
+	// phi, each approximation is a separated loop without the other branch
+	for (auto t = 0; t < n; t++)
+		z_out[t] = std::exp(0.0564 * T[t] * T[t] - 0.48560 * T[t]);
+	for (auto t = 0; t < n; t++)
+		if (T[t] >= phi_pivot)
+			z_out[t] = std::exp(alpha * std::pow(T[t], gamma) + beta);
+
+	// 1 - (1 - phi)^2
+	for (auto t = 0; t < n; t++)
+	{
+		const auto p = 1.0 - z_out[t];
+		z_out[t] = 1.0 - p * p;
+	}
+
+	// phi^-1
+	for (auto t = 0; t < n; t++)
+	{
+		z_out[t] = this->phi_inv(z_out[t]);
+		if (z_out[t] == HUGE_VAL)
+			z_out[t] = T[t] + M_LN2 / (alpha * gamma);
+	}
+}
+
 double Frozenbits_generator_GA
 ::phi(double t)
 {
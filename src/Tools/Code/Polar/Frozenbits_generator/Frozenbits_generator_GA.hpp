@@ -2,6 +2,7 @@
 #define FROZENBITS_GENERATOR_GA_HPP_
 
 #include <limits>
+#include <string>
 #include <vector>
 
 #include "Frozenbits_generator.hpp"
@@ -15,6 +16,8 @@ class Frozenbits_generator_GA : public Frozenbits_generator
 private:
 	const int m;
 	std::vector<double> z;
+	std::vector<double> z_tmp;
+	std::vector<double> z_chk;
 
 	const double alpha = -0.4527;
 	const double beta  =  0.0218;
@@ -35,7 +38,10 @@ public:
 	~Frozenbits_generator_GA();
 
 protected:
+	std::string get_method() const;
+
 	void   evaluate();
+	void   check_node(const double *T, double *z_out, const int n); // phi^-1(1 - (1 - phi(T))^2) of 'n' values
 	double phi    (double t);
 	double phi_inv(double t);
 };
@@ -35,6 +35,12 @@ Frozenbits_generator_TV
 {
 }
 
+std::string Frozenbits_generator_TV
+::get_method() const
+{
+	return "TV:" + awgn_codes_dir;
+}
+
 void Frozenbits_generator_TV
 ::evaluate()
 {
@@ -29,6 +29,8 @@ public:
 	virtual ~Frozenbits_generator_TV();
 
 protected:
+	std::string get_method() const;
+
 	void evaluate();
 };
 }
@@ -6,6 +6,8 @@
 #include <iomanip>
 #include <string>
 
+#include "Tools/Code/Polar/Patterns/Pattern_polar_gen.hpp"
+
 #include "Pattern_polar_parser.hpp"
 
 using namespace aff3ct;
@@ -25,7 +27,10 @@ Pattern_polar_parser
   pattern_rate1(pattern_rate1),
   polar_tree(new Binary_tree<Pattern_polar_i>(m +1)),
   pattern_types(),
-  leaves_pattern_types()
+  pattern_periods(),
+  leaves_pattern_types(),
+  parsed_frozen_bits(frozen_bits),
+  outdated(false)
 {
 	this->recursive_allocate_nodes_patterns(this->polar_tree->get_root());
 	this->generate_nodes_indexes           (this->polar_tree->get_root());
@@ -45,7 +50,10 @@ Pattern_polar_parser
   pattern_rate1(patterns[pattern_rate1_id]),
   polar_tree(new Binary_tree<Pattern_polar_i>(m +1)),
   pattern_types(),
-  leaves_pattern_types()
+  pattern_periods(),
+  leaves_pattern_types(),
+  parsed_frozen_bits(frozen_bits),
+  outdated(false)
 {
 	this->recursive_allocate_nodes_patterns(this->polar_tree->get_root());
 	this->generate_nodes_indexes           (this->polar_tree->get_root());
@@ -61,15 +69,30 @@ Pattern_polar_parser
 void Pattern_polar_parser
 ::notify_frozenbits_update()
 {
+	this->outdated = true;
+}
+
+void Pattern_polar_parser
+::rebuild()
+{
+	this->outdated = false;
+
+	// the frozen bits are often notified without changing (e.g. when they come from the cache of the generator)
+	if (this->parsed_frozen_bits == this->frozen_bits)
+		return;
+
 	this->recursive_deallocate_nodes_patterns(this->polar_tree->get_root());
 	delete this->polar_tree;
 	this->polar_tree = nullptr;
 	this->pattern_types.clear();
+	this->pattern_periods.clear();
 	this->leaves_pattern_types.clear();
 
 	this->polar_tree = new Binary_tree<Pattern_polar_i>(m +1);
 	this->recursive_allocate_nodes_patterns(this->polar_tree->get_root());
 	this->generate_nodes_indexes           (this->polar_tree->get_root());
+
+	this->parsed_frozen_bits = this->frozen_bits;
 }
 
 void Pattern_polar_parser
@@ -124,14 +147,35 @@ void Pattern_polar_parser
 void Pattern_polar_parser
 ::generate_nodes_indexes(const Binary_node<Pattern_polar_i>* node_curr)
 {
+	const auto node_type = node_curr->get_c()->type();
+	const auto gen = is_generalized_node(node_type) ? dynamic_cast<const Pattern_polar_gen*>(node_curr->get_c()) : nullptr;
+
 	node_curr->get_c()->set_id((unsigned int)pattern_types.size());
-	pattern_types.push_back((unsigned char)node_curr->get_c()->type());
+	pattern_types.push_back((unsigned char)node_type);
+	pattern_periods.push_back(gen != nullptr ? gen->get_period() : 0);
 
 	if (!node_curr->is_leaf()) // stop condition
 	{
 		this->generate_nodes_indexes(node_curr->get_left() ); // recursive call
 		this->generate_nodes_indexes(node_curr->get_right()); // recursive call
 	}
+	else if (gen != nullptr)
+	{
+		// a generalized leaf is stored as its runs of frozen and information bits, so the information bits are
+		// extracted as for the rate 0 and the rate 1 leaves
+		const auto size = node_curr->get_c()->get_size();
+		std::vector<bool> fb(size);
+		Pattern_polar_gen::frozen_bits(node_curr, size, fb);
+
+		for (auto i = 0; i < size;)
+		{
+			auto j = i;
+			while (j < size && fb[j] == fb[i]) j++;
+			leaves_pattern_types.push_back(std::make_pair((unsigned char)(fb[i] ? polar_node_t::RATE_0
+			                                                                    : polar_node_t::RATE_1), j - i));
+			i = j;
+		}
+	}
 	else
 		leaves_pattern_types.push_back(std::make_pair<unsigned char, int>((unsigned char)node_curr->get_c()->type(),
 		                                                                  node_curr->get_c()->get_size()));
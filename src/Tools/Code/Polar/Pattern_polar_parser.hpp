@@ -38,7 +38,10 @@ protected:
 	const Pattern_polar_i               *pattern_rate1; /*!< Terminal pattern when the bit is an information bit. */
 	      Binary_tree<Pattern_polar_i>  *polar_tree;    /*!< Tree of patterns. */
 	      std::vector<unsigned char>     pattern_types; /*!< Tree of patterns represented with a vector of pattern IDs. */
+	      std::vector<int>               pattern_periods; /*!< Periods of the generalized nodes (0 for the others). */
 	      std::vector<std::pair<unsigned char, int>> leaves_pattern_types;
+	      std::vector<bool>              parsed_frozen_bits; /*!< Frozen bits of the current tree of patterns. */
+	      bool                           outdated;      /*!< True if the frozen bits have been notified since the last parsing. */
 
 public:
 	/*!
@@ -76,8 +79,22 @@ public:
 	 */
 	virtual ~Pattern_polar_parser();
 
+	/*!
+	 * \brief Marks the tree of patterns as outdated, the tree is rebuilt by the next call to
+	 *        Pattern_polar_parser::update (the successive notifications are merged in a single rebuild).
+	 */
 	virtual void notify_frozenbits_update();
 
+	/*!
+	 * \brief Rebuilds the tree of patterns if it is outdated and if the frozen bits have changed since the last
+	 *        parsing. Has to be called by the decoders before to read the tree.
+	 */
+	inline void update()
+	{
+		if (this->outdated)
+			this->rebuild();
+	}
+
 	/*!
 	 * \brief Gets a binary tree of patterns.
 	 *
@@ -109,6 +126,18 @@ public:
 		return (polar_node_t)pattern_types[node_id];
 	}
 
+	/*!
+	 * \brief Gets the period of a generalized node from the id of the node (see Pattern_polar_gen).
+	 *
+	 * \param node_id: id of the node
+	 *
+	 * \return the period of the node (0 if the node is not a generalized node).
+	 */
+	inline int get_node_period(const int node_id) const
+	{
+		return pattern_periods[node_id];
+	}
+
 	/*!
 	 * \brief Check if a node type exists in the the tree.
 	 *
@@ -153,6 +182,7 @@ public:
 	void release_patterns() const;
 
 private:
+	void rebuild();
 	void recursive_allocate_nodes_patterns  (      Binary_node<Pattern_polar_i>* node_curr);
 	void generate_nodes_indexes             (const Binary_node<Pattern_polar_i>* node_curr);
 	void recursive_deallocate_nodes_patterns(      Binary_node<Pattern_polar_i>* node_curr);
@@ -0,0 +1,152 @@
+#ifndef PATTERN_POLAR_GEN_HPP_
+#define PATTERN_POLAR_GEN_HPP_
+
+#include <vector>
+#include <sstream>
+#include <string>
+
+#include "Pattern_polar_i.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Generalized Fast-SSC nodes: the codeword of such a node of size 'n' is made of 'period' interleaved sub-codes (the
+ * bit 'i' belongs to the sub-code 'i % period'), so the node is decoded in one shot without its sub-tree:
+ *  - the G-Rep nodes (Type-I, Type-II, Type-V and G-Rep) repeat a small source codeword of 'period' bits, the LLRs of
+ *    a sub-code are summed then the source codeword is decoded (ML) from these 'period' sums;
+ *  - the G-PC nodes (Type-III, Type-IV and G-PC) are 'period' interleaved SPC codes (with the same parity for all the
+ *    sub-codes in the Type-IV case).
+ * The frozen bits are not stored in the tree: they are rebuilt from the types of the children of the node (a node is
+ * matched before its children are cut).
+ */
+class Pattern_polar_gen : public Pattern_polar_i
+{
+protected:
+	const int period;
+
+	Pattern_polar_gen(const int &N, const Binary_node<Pattern_polar_i>* node, const int min_level, const int max_level,
+	                  const int period)
+	: Pattern_polar_i(N, node, min_level, max_level),
+	  period(period)
+	{
+	}
+
+	Pattern_polar_gen(const int min_level, const int max_level, const int min_level_limit)
+	: Pattern_polar_i(min_level, max_level),
+	  period(0)
+	{
+		if (min_level < min_level_limit)
+		{
+			std::stringstream message;
+			message << "'min_level' has to be equal or greater than " << min_level_limit << " ('min_level' = "
+			        << min_level << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	// the period of a node that would have the frozen bits 'fb'
+	virtual int find_period(const std::vector<bool> &fb) const = 0;
+
+	// true if a node of size 'size' can be of this type with this period
+	virtual bool is_valid(const int size, const int period) const = 0;
+
+	// the score of the pattern when a node matches
+	virtual int score() const = 0;
+
+public:
+	virtual ~Pattern_polar_gen() {}
+
+	inline int get_period() const { return period; }
+
+	// true if the bit 'i' of a node of size 'size' and of period 'period' is frozen
+	virtual bool is_frozen(const int i, const int size, const int period) const = 0;
+
+	virtual std::string f() const { return ""; }
+	virtual std::string g() const { return ""; }
+
+	virtual int _match(const int &reverse_graph_depth, const Binary_node<Pattern_polar_i>* node_curr) const
+	{
+		const auto size = 1 << reverse_graph_depth;
+
+		std::vector<bool> fb(size);
+		Pattern_polar_gen::frozen_bits(node_curr, size, fb);
+
+		const auto p = this->find_period(fb);
+		if (!this->is_valid(size, p))
+			return 0;
+
+		for (auto i = 0; i < size; i++)
+			if (fb[i] != this->is_frozen(i, size, p))
+				return 0;
+
+		return this->score();
+	}
+
+	virtual bool is_terminal() const { return true; }
+
+	/*!
+	 * \brief Rebuilds the frozen bits of a node from the patterns of its sub-tree.
+	 *
+	 * \param node_curr: the node.
+	 * \param size:      the size of the node.
+	 * \param fb:        the frozen bits (true if frozen), filled from 'off'.
+	 * \param off:       offset of the node in 'fb'.
+	 */
+	static void frozen_bits(const Binary_node<Pattern_polar_i>* node_curr, const int size, std::vector<bool> &fb,
+	                        const int off = 0)
+	{
+		if (!node_curr->is_leaf())
+		{
+			Pattern_polar_gen::frozen_bits(node_curr->get_left (), size >> 1, fb, off               );
+			Pattern_polar_gen::frozen_bits(node_curr->get_right(), size >> 1, fb, off + (size >> 1));
+			return;
+		}
+
+		const auto pattern = node_curr->get_contents();
+		switch (pattern->type())
+		{
+			case polar_node_t::RATE_0: for (auto i = 0; i < size; i++) fb[off +i] = true;           break;
+			case polar_node_t::RATE_1: for (auto i = 0; i < size; i++) fb[off +i] = false;          break;
+			case polar_node_t::REP:    for (auto i = 0; i < size; i++) fb[off +i] = i < size -1;    break;
+			case polar_node_t::SPC:    for (auto i = 0; i < size; i++) fb[off +i] = i == 0;         break;
+			default:
+			{
+				const auto gen = dynamic_cast<const Pattern_polar_gen*>(pattern);
+				if (gen == nullptr)
+				{
+					std::stringstream message;
+					message << "The frozen bits of a '" << pattern->name() << "' leaf can't be rebuilt.";
+					throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+				}
+
+				for (auto i = 0; i < size; i++)
+					fb[off +i] = gen->is_frozen(i, size, gen->get_period());
+				break;
+			}
+		}
+	}
+
+protected:
+	static std::vector<bool> frozen_bits(const int &N, const Binary_node<Pattern_polar_i>* node_curr)
+	{
+		const auto size = N >> node_curr->get_depth();
+		std::vector<bool> fb(size);
+		Pattern_polar_gen::frozen_bits(node_curr, size, fb);
+		return fb;
+	}
+
+	static int count_frozen(const std::vector<bool> &fb)
+	{
+		auto n = 0;
+		for (auto f : fb) n += f ? 1 : 0;
+		return n;
+	}
+
+	static bool is_power_of_2(const int x) { return x > 0 && (x & (x -1)) == 0; }
+};
+}
+}
+
+#endif /* PATTERN_POLAR_GEN_HPP_ */
@@ -0,0 +1,71 @@
+#ifndef PATTERN_POLAR_GREP_HPP_
+#define PATTERN_POLAR_GREP_HPP_
+
+#include <vector>
+#include <string>
+
+#include "Pattern_polar_gen.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+// Generalized repetition node: only the 'period' last bits are information bits (a rate-1 source is repeated).
+class Pattern_polar_grep : public Pattern_polar_gen
+{
+protected:
+	Pattern_polar_grep(const int &N, const Binary_node<Pattern_polar_i>* node,
+	                   const int min_level = 2, const int max_level = -1)
+	: Pattern_polar_gen(N, node, min_level, max_level, period_of(frozen_bits(N, node)))
+	{
+	}
+
+	static int period_of(const std::vector<bool> &fb)
+	{
+		return (int)fb.size() - Pattern_polar_gen::count_frozen(fb);
+	}
+
+	virtual int find_period(const std::vector<bool> &fb) const { return Pattern_polar_grep::period_of(fb); }
+
+	virtual bool is_valid(const int size, const int period) const
+	{
+		return period >= 2 && period <= (size >> 1) && Pattern_polar_gen::is_power_of_2(period);
+	}
+
+	virtual int score() const { return 43; }
+
+public:
+	Pattern_polar_grep(const int min_level = 2, const int max_level = -1)
+	: Pattern_polar_gen(min_level, max_level, 2)
+	{
+	}
+
+	virtual Pattern_polar_i* alloc(const int &N, const Binary_node<Pattern_polar_i>* node) const
+	{
+		return new Pattern_polar_grep(N, node, min_level, max_level);
+	}
+
+	virtual Pattern_polar_i* clone() const
+	{
+		return new Pattern_polar_grep(*this);
+	}
+
+	virtual ~Pattern_polar_grep() {}
+
+	virtual polar_node_t type()       const { return polar_node_t::G_REP; }
+	virtual std::string  name()       const { return "G-Rep";             }
+	virtual std::string  short_name() const { return "gr";                }
+	virtual std::string  fill_color() const { return "#5C7A3F";           }
+	virtual std::string  font_color() const { return "#FFFFFF";           }
+
+	virtual std::string h() const { return "grep"; }
+
+	virtual bool is_frozen(const int i, const int size, const int period) const
+	{
+		return i < size - period;
+	}
+};
+}
+}
+
+#endif /* PATTERN_POLAR_GREP_HPP_ */
@@ -25,9 +25,22 @@ enum polar_node_t
 	REP_LEFT,
 	REP,
 	SPC,
+	TYPE_1,   // rate-0 then 2 info. bits
+	TYPE_2,   // rate-0 then 3 info. bits
+	TYPE_3,   // 2 frozen bits then rate-1
+	TYPE_4,   // 3 frozen bits then rate-1
+	TYPE_5,   // rate-0 then the frozen pattern of the RM(1,3) code
+	G_REP,    // rate-0 then a rate-1 source of 'period' bits
+	G_PC,     // 'period' frozen bits then rate-1
 	NB_PATTERNS
 };
 
+// the generalized nodes are made of 'period' interleaved sub-codes (see Pattern_polar_gen)
+inline bool is_generalized_node(const polar_node_t node_type)
+{
+	return node_type >= polar_node_t::TYPE_1 && node_type < polar_node_t::NB_PATTERNS;
+}
+
 // interface
 class Pattern_polar_i
 {
@@ -143,6 +156,9 @@ public:
 
 	virtual Pattern_polar_i* alloc(const int &n, const Binary_node<Pattern_polar_i>* node) const = 0;
 
+	// a copy of the pattern, for a decoder which has to own its patterns (they are released with the decoder)
+	virtual Pattern_polar_i* clone() const = 0;
+
 	virtual polar_node_t type()       const = 0;
 	virtual std::string  name()       const = 0;
 	virtual std::string  short_name() const = 0;
@@ -50,6 +50,11 @@ public:
 		return new Pattern_polar_spc(N, node, min_level, max_level);
 	}
 
+	virtual Pattern_polar_i* clone() const
+	{
+		return new Pattern_polar_spc(*this);
+	}
+
 	virtual ~Pattern_polar_spc() {}
 
 	virtual polar_node_t type()       const { return polar_node_t::SPC; }
@@ -29,6 +29,11 @@ public:
 		return new Pattern_polar_std(N, node);
 	}
 
+	virtual Pattern_polar_i* clone() const
+	{
+		return new Pattern_polar_std(*this);
+	}
+
 	virtual ~Pattern_polar_std() {}
 
 	virtual polar_node_t type()       const { return polar_node_t::STANDARD; }
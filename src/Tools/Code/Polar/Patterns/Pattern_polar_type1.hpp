@@ -0,0 +1,66 @@
+#ifndef PATTERN_POLAR_TYPE1_HPP_
+#define PATTERN_POLAR_TYPE1_HPP_
+
+#include <vector>
+#include <string>
+
+#include "Pattern_polar_gen.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+// Type-I node: only the 2 last bits are information bits (the 2 source bits are repeated).
+class Pattern_polar_type1 : public Pattern_polar_gen
+{
+protected:
+	Pattern_polar_type1(const int &N, const Binary_node<Pattern_polar_i>* node,
+	                    const int min_level = 2, const int max_level = -1)
+	: Pattern_polar_gen(N, node, min_level, max_level, 2)
+	{
+	}
+
+	virtual int find_period(const std::vector<bool> &fb) const { return 2; }
+
+	virtual bool is_valid(const int size, const int period) const
+	{
+		return size >= 4;
+	}
+
+	virtual int score() const { return 48; }
+
+public:
+	Pattern_polar_type1(const int min_level = 2, const int max_level = -1)
+	: Pattern_polar_gen(min_level, max_level, 2)
+	{
+	}
+
+	virtual Pattern_polar_i* alloc(const int &N, const Binary_node<Pattern_polar_i>* node) const
+	{
+		return new Pattern_polar_type1(N, node, min_level, max_level);
+	}
+
+	virtual Pattern_polar_i* clone() const
+	{
+		return new Pattern_polar_type1(*this);
+	}
+
+	virtual ~Pattern_polar_type1() {}
+
+	virtual polar_node_t type()       const { return polar_node_t::TYPE_1; }
+	virtual std::string  name()       const { return "Type-I";             }
+	virtual std::string  short_name() const { return "t1";                 }
+	virtual std::string  fill_color() const { return "#7A5C3F";            }
+	virtual std::string  font_color() const { return "#FFFFFF";            }
+
+	virtual std::string h() const { return "grep"; }
+
+	virtual bool is_frozen(const int i, const int size, const int period) const
+	{
+		return i < size -2;
+	}
+};
+}
+}
+
+#endif /* PATTERN_POLAR_TYPE1_HPP_ */
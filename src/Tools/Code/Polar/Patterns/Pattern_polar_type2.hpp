@@ -0,0 +1,66 @@
+#ifndef PATTERN_POLAR_TYPE2_HPP_
+#define PATTERN_POLAR_TYPE2_HPP_
+
+#include <vector>
+#include <string>
+
+#include "Pattern_polar_gen.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+// Type-II node: only the 3 last bits are information bits (a SPC code of 4 bits is repeated).
+class Pattern_polar_type2 : public Pattern_polar_gen
+{
+protected:
+	Pattern_polar_type2(const int &N, const Binary_node<Pattern_polar_i>* node,
+	                    const int min_level = 3, const int max_level = -1)
+	: Pattern_polar_gen(N, node, min_level, max_level, 4)
+	{
+	}
+
+	virtual int find_period(const std::vector<bool> &fb) const { return 4; }
+
+	virtual bool is_valid(const int size, const int period) const
+	{
+		return size >= 8;
+	}
+
+	virtual int score() const { return 47; }
+
+public:
+	Pattern_polar_type2(const int min_level = 3, const int max_level = -1)
+	: Pattern_polar_gen(min_level, max_level, 3)
+	{
+	}
+
+	virtual Pattern_polar_i* alloc(const int &N, const Binary_node<Pattern_polar_i>* node) const
+	{
+		return new Pattern_polar_type2(N, node, min_level, max_level);
+	}
+
+	virtual Pattern_polar_i* clone() const
+	{
+		return new Pattern_polar_type2(*this);
+	}
+
+	virtual ~Pattern_polar_type2() {}
+
+	virtual polar_node_t type()       const { return polar_node_t::TYPE_2; }
+	virtual std::string  name()       const { return "Type-II";            }
+	virtual std::string  short_name() const { return "t2";                 }
+	virtual std::string  fill_color() const { return "#6B4F7A";            }
+	virtual std::string  font_color() const { return "#FFFFFF";            }
+
+	virtual std::string h() const { return "grep_spc"; }
+
+	virtual bool is_frozen(const int i, const int size, const int period) const
+	{
+		return i < size -3;
+	}
+};
+}
+}
+
+#endif /* PATTERN_POLAR_TYPE2_HPP_ */
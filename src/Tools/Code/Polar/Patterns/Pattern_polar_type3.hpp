@@ -0,0 +1,66 @@
+#ifndef PATTERN_POLAR_TYPE3_HPP_
+#define PATTERN_POLAR_TYPE3_HPP_
+
+#include <vector>
+#include <string>
+
+#include "Pattern_polar_gen.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+// Type-III node: only the 2 first bits are frozen (2 interleaved SPC codes).
+class Pattern_polar_type3 : public Pattern_polar_gen
+{
+protected:
+	Pattern_polar_type3(const int &N, const Binary_node<Pattern_polar_i>* node,
+	                    const int min_level = 2, const int max_level = -1)
+	: Pattern_polar_gen(N, node, min_level, max_level, 2)
+	{
+	}
+
+	virtual int find_period(const std::vector<bool> &fb) const { return 2; }
+
+	virtual bool is_valid(const int size, const int period) const
+	{
+		return size >= 4;
+	}
+
+	virtual int score() const { return 46; }
+
+public:
+	Pattern_polar_type3(const int min_level = 2, const int max_level = -1)
+	: Pattern_polar_gen(min_level, max_level, 2)
+	{
+	}
+
+	virtual Pattern_polar_i* alloc(const int &N, const Binary_node<Pattern_polar_i>* node) const
+	{
+		return new Pattern_polar_type3(N, node, min_level, max_level);
+	}
+
+	virtual Pattern_polar_i* clone() const
+	{
+		return new Pattern_polar_type3(*this);
+	}
+
+	virtual ~Pattern_polar_type3() {}
+
+	virtual polar_node_t type()       const { return polar_node_t::TYPE_3; }
+	virtual std::string  name()       const { return "Type-III";           }
+	virtual std::string  short_name() const { return "t3";                 }
+	virtual std::string  fill_color() const { return "#3F6B7A";            }
+	virtual std::string  font_color() const { return "#FFFFFF";            }
+
+	virtual std::string h() const { return "gpc"; }
+
+	virtual bool is_frozen(const int i, const int size, const int period) const
+	{
+		return i < 2;
+	}
+};
+}
+}
+
+#endif /* PATTERN_POLAR_TYPE3_HPP_ */
@@ -0,0 +1,66 @@
+#ifndef PATTERN_POLAR_TYPE4_HPP_
+#define PATTERN_POLAR_TYPE4_HPP_
+
+#include <vector>
+#include <string>
+
+#include "Pattern_polar_gen.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+// Type-IV node: only the 3 first bits are frozen (4 interleaved codes with the same parity).
+class Pattern_polar_type4 : public Pattern_polar_gen
+{
+protected:
+	Pattern_polar_type4(const int &N, const Binary_node<Pattern_polar_i>* node,
+	                    const int min_level = 3, const int max_level = -1)
+	: Pattern_polar_gen(N, node, min_level, max_level, 4)
+	{
+	}
+
+	virtual int find_period(const std::vector<bool> &fb) const { return 4; }
+
+	virtual bool is_valid(const int size, const int period) const
+	{
+		return size >= 8;
+	}
+
+	virtual int score() const { return 45; }
+
+public:
+	Pattern_polar_type4(const int min_level = 3, const int max_level = -1)
+	: Pattern_polar_gen(min_level, max_level, 3)
+	{
+	}
+
+	virtual Pattern_polar_i* alloc(const int &N, const Binary_node<Pattern_polar_i>* node) const
+	{
+		return new Pattern_polar_type4(N, node, min_level, max_level);
+	}
+
+	virtual Pattern_polar_i* clone() const
+	{
+		return new Pattern_polar_type4(*this);
+	}
+
+	virtual ~Pattern_polar_type4() {}
+
+	virtual polar_node_t type()       const { return polar_node_t::TYPE_4; }
+	virtual std::string  name()       const { return "Type-IV";            }
+	virtual std::string  short_name() const { return "t4";                 }
+	virtual std::string  fill_color() const { return "#3F7A5C";            }
+	virtual std::string  font_color() const { return "#FFFFFF";            }
+
+	virtual std::string h() const { return "gpc_rep"; }
+
+	virtual bool is_frozen(const int i, const int size, const int period) const
+	{
+		return i < 3;
+	}
+};
+}
+}
+
+#endif /* PATTERN_POLAR_TYPE4_HPP_ */
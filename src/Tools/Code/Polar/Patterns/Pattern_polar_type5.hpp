@@ -0,0 +1,66 @@
+#ifndef PATTERN_POLAR_TYPE5_HPP_
+#define PATTERN_POLAR_TYPE5_HPP_
+
+#include <vector>
+#include <string>
+
+#include "Pattern_polar_gen.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+// Type-V node: only the bits 'n-5', 'n-3', 'n-2' and 'n-1' are information bits (the RM(1,3) code is repeated).
+class Pattern_polar_type5 : public Pattern_polar_gen
+{
+protected:
+	Pattern_polar_type5(const int &N, const Binary_node<Pattern_polar_i>* node,
+	                    const int min_level = 3, const int max_level = -1)
+	: Pattern_polar_gen(N, node, min_level, max_level, 8)
+	{
+	}
+
+	virtual int find_period(const std::vector<bool> &fb) const { return 8; }
+
+	virtual bool is_valid(const int size, const int period) const
+	{
+		return size >= 8;
+	}
+
+	virtual int score() const { return 44; }
+
+public:
+	Pattern_polar_type5(const int min_level = 3, const int max_level = -1)
+	: Pattern_polar_gen(min_level, max_level, 3)
+	{
+	}
+
+	virtual Pattern_polar_i* alloc(const int &N, const Binary_node<Pattern_polar_i>* node) const
+	{
+		return new Pattern_polar_type5(N, node, min_level, max_level);
+	}
+
+	virtual Pattern_polar_i* clone() const
+	{
+		return new Pattern_polar_type5(*this);
+	}
+
+	virtual ~Pattern_polar_type5() {}
+
+	virtual polar_node_t type()       const { return polar_node_t::TYPE_5; }
+	virtual std::string  name()       const { return "Type-V";             }
+	virtual std::string  short_name() const { return "t5";                 }
+	virtual std::string  fill_color() const { return "#7A3F5C";            }
+	virtual std::string  font_color() const { return "#FFFFFF";            }
+
+	virtual std::string h() const { return "grep_rm"; }
+
+	virtual bool is_frozen(const int i, const int size, const int period) const
+	{
+		return i < size -8 || i == size -8 || i == size -7 || i == size -6 || i == size -4;
+	}
+};
+}
+}
+
+#endif /* PATTERN_POLAR_TYPE5_HPP_ */
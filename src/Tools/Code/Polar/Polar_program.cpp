@@ -0,0 +1,115 @@
+#include <cmath>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Polar_program.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Polar_program
+::Polar_program(const Pattern_polar_parser &polar_patterns)
+: N(polar_patterns.get_polar_tree()->get_root()->get_c()->get_size()),
+  instructions(),
+  leaves_pattern_types(polar_patterns.get_leaves_pattern_types())
+{
+	const auto m = (int)std::log2(N);
+
+	int node_id = 0;
+	this->flatten(polar_patterns, 0, 0, m, node_id);
+}
+
+Polar_program
+::~Polar_program()
+{
+}
+
+void Polar_program
+::push(const polar_op_t op, const int rev_depth, const int off_l, const int off_s, const int param)
+{
+	Polar_instr instr;
+	instr.op        = (uint8_t)op;
+	instr.rev_depth = (uint8_t)rev_depth;
+	instr.off_l     = off_l;
+	instr.off_s     = off_s;
+	instr.param     = param;
+	instructions.push_back(instr);
+}
+
+void Polar_program
+::flatten(const Pattern_polar_parser &polar_patterns, const int off_l, const int off_s, const int rev_depth,
+          int &node_id)
+{
+	const int n_elmts = 1 << rev_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == polar_node_t::RATE_0) ||
+	                                 (node_type == polar_node_t::RATE_1) ||
+	                                 (node_type == polar_node_t::REP)    ||
+	                                 (node_type == polar_node_t::SPC)    ||
+	                                 is_generalized_node(node_type);
+
+	if (!is_terminal_pattern && rev_depth)
+	{
+		// f
+		switch (node_type)
+		{
+			case STANDARD: this->push(OP_F, rev_depth -1, off_l, off_s); break;
+			case REP_LEFT: this->push(OP_F, rev_depth -1, off_l, off_s); break;
+			default:
+				break;
+		}
+
+		this->flatten(polar_patterns, off_l + n_elmts, off_s, rev_depth -1, ++node_id); // left child
+
+		// g
+		switch (node_type)
+		{
+			case STANDARD:    this->push(OP_G,  rev_depth -1, off_l, off_s); break;
+			case RATE_0_LEFT: this->push(OP_G0, rev_depth -1, off_l, off_s); break;
+			case REP_LEFT:    this->push(OP_GR, rev_depth -1, off_l, off_s); break;
+			default:
+				break;
+		}
+
+		this->flatten(polar_patterns, off_l + n_elmts, off_s + n_elm_2, rev_depth -1, ++node_id); // right child
+
+		// xor
+		switch (node_type)
+		{
+			case STANDARD:    this->push(OP_XO,  rev_depth -1, off_l, off_s); break;
+			case RATE_0_LEFT: this->push(OP_XO0, rev_depth -1, off_l, off_s); break;
+			case REP_LEFT:    this->push(OP_XO,  rev_depth -1, off_l, off_s); break;
+			default:
+				break;
+		}
+	}
+	else
+	{
+		// h
+		const auto period = polar_patterns.get_node_period(node_id);
+		switch (node_type)
+		{
+			case RATE_0: this->push(OP_H0,       rev_depth, off_l, off_s        ); break;
+			case RATE_1: this->push(OP_H,        rev_depth, off_l, off_s        ); break;
+			case REP:    this->push(OP_REP,      rev_depth, off_l, off_s        ); break;
+			case SPC:    this->push(OP_SPC,      rev_depth, off_l, off_s        ); break;
+			case TYPE_1: this->push(OP_GREP,     rev_depth, off_l, off_s, 2     ); break;
+			case TYPE_2: this->push(OP_GREP_SPC, rev_depth, off_l, off_s        ); break;
+			case TYPE_3: this->push(OP_GPC,      rev_depth, off_l, off_s, 2     ); break;
+			case TYPE_4: this->push(OP_GPC_REP,  rev_depth, off_l, off_s        ); break;
+			case TYPE_5: this->push(OP_GREP_RM,  rev_depth, off_l, off_s        ); break;
+			case G_REP:  this->push(OP_GREP,     rev_depth, off_l, off_s, period); break;
+			case G_PC:   this->push(OP_GPC,      rev_depth, off_l, off_s, period); break;
+			default:
+			{
+				std::stringstream message;
+				message << "Unknown polar node type ('node_type' = " << (int)node_type << ", 'node_id' = "
+				        << node_id << ").";
+				throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+		}
+	}
+}
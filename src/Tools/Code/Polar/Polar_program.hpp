@@ -0,0 +1,98 @@
+/*!
+ * \file
+ * \brief Flattens the tree of a Pattern_polar_parser into a sequence of instructions for the SC fast decoders.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef POLAR_PROGRAM_HPP_
+#define POLAR_PROGRAM_HPP_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \brief Operations of a polar program (one per API_polar kernel).
+ */
+enum polar_op_t
+{
+	OP_F = 0,
+	OP_G,
+	OP_G0,
+	OP_GR,
+	OP_XO,
+	OP_XO0,
+	OP_H0,
+	OP_H,
+	OP_REP,
+	OP_SPC,
+	OP_GREP,
+	OP_GREP_SPC,
+	OP_GREP_RM,
+	OP_GPC,
+	OP_GPC_REP,
+	NB_OPS
+};
+
+/*!
+ * \brief An instruction of a polar program.
+ *
+ * 'rev_depth' is the log2 of the number of elements processed by the kernel: for the f, g and xor operations it is the
+ * size of the children of the node, the node is at 'off_l' in the LLRs (its children at 'off_l + 2^(rev_depth+1)')
+ * and at 'off_s' in the partial sums. 'param' is the period of the generalized nodes.
+ */
+struct Polar_instr
+{
+	uint8_t op;
+	uint8_t rev_depth;
+	int32_t off_l;
+	int32_t off_s;
+	int32_t param;
+};
+
+/*!
+ * \class Polar_program
+ * \brief The sequence of kernels executed by a SC fast decoder for a given tree of patterns.
+ *
+ * The tree of the parser is walked once in the order of the SC decoding (f, left child, g, right child, xor), so the
+ * decoder runs the program in a single loop instead of walking the tree and switching on the node types at each frame.
+ * The program does not depend on the types of the LLRs and of the bits: it is shared by all the decoders of a code.
+ */
+class Polar_program
+{
+protected:
+	const int                                        N;
+	      std::vector<Polar_instr>                   instructions;
+	      std::vector<std::pair<unsigned char, int>> leaves_pattern_types;
+
+public:
+	explicit Polar_program(const Pattern_polar_parser &polar_patterns);
+
+	virtual ~Polar_program();
+
+	inline int get_N() const { return N; }
+
+	inline const std::vector<Polar_instr>& get_instructions() const { return instructions; }
+
+	inline const std::vector<std::pair<unsigned char, int>>& get_leaves_pattern_types() const
+	{
+		return leaves_pattern_types;
+	}
+
+private:
+	void flatten(const Pattern_polar_parser &polar_patterns, const int off_l, const int off_s, const int rev_depth,
+	             int &node_id);
+
+	void push(const polar_op_t op, const int rev_depth, const int off_l, const int off_s, const int param = 0);
+};
+}
+}
+
+#endif /* POLAR_PROGRAM_HPP_ */
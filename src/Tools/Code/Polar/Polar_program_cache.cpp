@@ -0,0 +1,101 @@
+#include <map>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+
+#include "Polar_program_cache.hpp"
+
+using namespace aff3ct::tools;
+
+// in-memory cache, shared by all the threads of the process
+static std::mutex                                                cache_mutex;
+static std::map<uint64_t, std::shared_ptr<const Polar_program>> cache_entries;
+static std::deque<uint64_t>                                      cache_order; // insertion order of the entries
+static size_t                                                    cache_max_size = 64;
+
+uint64_t Polar_program_cache
+::hash(const std::vector<bool> &frozen_bits, const std::vector<Pattern_polar_i*> &polar_patterns, const int idx_r0,
+       const int idx_r1)
+{
+	uint64_t h = 14695981039346656037ULL;
+	const auto mix = [&h](const uint32_t v)
+	{
+		for (auto b = 0; b < 4; b++)
+		{
+			h ^= (v >> (8 * b)) & 0xFF;
+			h *= 1099511628211ULL;
+		}
+	};
+
+	mix((uint32_t)frozen_bits.size());
+	for (size_t i = 0; i < frozen_bits.size(); i += 32)
+	{
+		uint32_t word = 0;
+		for (size_t j = i; j < frozen_bits.size() && j < i + 32; j++)
+			word |= (uint32_t)frozen_bits[j] << (j - i);
+		mix(word);
+	}
+
+	mix((uint32_t)polar_patterns.size());
+	for (auto p : polar_patterns)
+	{
+		mix((uint32_t)p->type());
+		mix((uint32_t)p->get_min_lvl());
+		mix((uint32_t)p->get_max_lvl());
+	}
+	mix((uint32_t)idx_r0);
+	mix((uint32_t)idx_r1);
+
+	return h;
+}
+
+std::shared_ptr<const Polar_program> Polar_program_cache
+::get(const std::vector<bool> &frozen_bits, const std::vector<Pattern_polar_i*> &polar_patterns, const int idx_r0,
+      const int idx_r1)
+{
+	const auto h = Polar_program_cache::hash(frozen_bits, polar_patterns, idx_r0, idx_r1);
+
+	std::lock_guard<std::mutex> lock(cache_mutex);
+
+	auto it = cache_entries.find(h);
+	if (it == cache_entries.end())
+	{
+		Pattern_polar_parser parser((int)frozen_bits.size(), frozen_bits, polar_patterns, idx_r0, idx_r1);
+		std::shared_ptr<const Polar_program> program(new Polar_program(parser));
+
+		while (!cache_order.empty() && cache_entries.size() >= cache_max_size)
+		{
+			cache_entries.erase(cache_order.front());
+			cache_order.pop_front();
+		}
+
+		it = cache_entries.insert(std::make_pair(h, program)).first;
+		cache_order.push_back(h);
+	}
+
+	return it->second;
+}
+
+void Polar_program_cache
+::set_max_size(const size_t max_size)
+{
+	std::lock_guard<std::mutex> lock(cache_mutex);
+
+	cache_max_size = max_size;
+	while (!cache_order.empty() && cache_entries.size() > cache_max_size)
+	{
+		cache_entries.erase(cache_order.front());
+		cache_order.pop_front();
+	}
+}
+
+void Polar_program_cache
+::clear()
+{
+	std::lock_guard<std::mutex> lock(cache_mutex);
+
+	cache_entries.clear();
+	cache_order.clear();
+}
@@ -0,0 +1,44 @@
+#ifndef POLAR_PROGRAM_CACHE_HPP_
+#define POLAR_PROGRAM_CACHE_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Tools/Code/Polar/Patterns/Pattern_polar_i.hpp"
+#include "Tools/Code/Polar/Polar_program.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Cache of the polar programs, the entries are identified by a hash of the frozen bits and of the patterns (types and
+ * levels) used to parse the tree. The cache lives in the memory of the process: the threads of a simulation share the
+ * same program and a frozen bits update (a new SNR) reuses the program of a previous update instead of parsing the
+ * tree again. The oldest entries are dropped when the cache is full, the decoders keep their program alive.
+ */
+struct Polar_program_cache
+{
+public:
+	/*
+	 * FNV-1a hash of the frozen bits and of the patterns
+	 */
+	static uint64_t hash(const std::vector<bool> &frozen_bits, const std::vector<Pattern_polar_i*> &polar_patterns,
+	                     const int idx_r0, const int idx_r1);
+
+	/*
+	 * Return the program of the given frozen bits, the tree is parsed and flattened only if it is not in the cache
+	 */
+	static std::shared_ptr<const Polar_program> get(const std::vector<bool> &frozen_bits,
+	                                                const std::vector<Pattern_polar_i*> &polar_patterns,
+	                                                const int idx_r0, const int idx_r1);
+
+	static void set_max_size(const size_t max_size);
+
+	static void clear();
+};
+}
+}
+
+#endif /* POLAR_PROGRAM_CACHE_HPP_ */
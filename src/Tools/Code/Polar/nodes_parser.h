@@ -12,6 +12,13 @@
 #include "Tools/Code/Polar/Patterns/Pattern_polar_rep_left.hpp"
 #include "Tools/Code/Polar/Patterns/Pattern_polar_spc.hpp"
 #include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_type1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_type2.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_type3.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_type4.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_type5.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_grep.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_gpc.hpp"
 
 namespace aff3ct
 {
@@ -24,6 +31,7 @@ template <class R0   = Pattern_polar_r0,
           class REPL = Pattern_polar_rep_left,
           class SPC  = Pattern_polar_spc,
           class STD  = Pattern_polar_std>
+// the generalized nodes are also recognized: "T1" to "T5" (Type-I to Type-V), "GREP" (G-Rep) and "GPC" (G-PC)
 std::vector<Pattern_polar_i*> nodes_parser(const std::string &str_polar, int &idx_r0, int &idx_r1);
 }
 }
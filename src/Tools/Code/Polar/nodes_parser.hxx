@@ -9,6 +9,39 @@
 
 #include "nodes_parser.h"
 
+namespace aff3ct
+{
+namespace tools
+{
+// allocates a pattern from its key split on the '_' (ex: "GPC_8+" or "T1_4-16")
+template <class P>
+Pattern_polar_i* alloc_polar_pattern(const std::vector<std::string> &v_str1)
+{
+	if (v_str1.size() == 1)
+		return new P;
+
+	auto v_str2 = split(v_str1[1], '-');
+
+	if (v_str2.size() > 1)
+	{
+		auto min = (int)std::log2(std::stoi(v_str2[0]));
+		auto max = (int)std::log2(std::stoi(v_str2[1]));
+
+		return new P(min, max);
+	}
+	else
+	{
+		bool plus = v_str2[0].find("+") != std::string::npos;
+
+		auto min = (int)std::log2(std::stoi(v_str2[0]));
+
+		if (plus) return new P(min     );
+		else      return new P(min, min);
+	}
+}
+}
+}
+
 template <class R0, class R0L, class R1, class REP, class REPL, class SPC, class STD>
 std::vector<aff3ct::tools::Pattern_polar_i*> aff3ct::tools
 ::nodes_parser(const std::string &str_polar, int &idx_r0, int &idx_r1)
@@ -195,6 +228,13 @@ std::vector<aff3ct::tools::Pattern_polar_i*> aff3ct::tools
 					}
 				}
 			}
+			else if (v_str1[0] == "T1"  ) polar_patterns.push_back(alloc_polar_pattern<Pattern_polar_type1>(v_str1));
+			else if (v_str1[0] == "T2"  ) polar_patterns.push_back(alloc_polar_pattern<Pattern_polar_type2>(v_str1));
+			else if (v_str1[0] == "T3"  ) polar_patterns.push_back(alloc_polar_pattern<Pattern_polar_type3>(v_str1));
+			else if (v_str1[0] == "T4"  ) polar_patterns.push_back(alloc_polar_pattern<Pattern_polar_type4>(v_str1));
+			else if (v_str1[0] == "T5"  ) polar_patterns.push_back(alloc_polar_pattern<Pattern_polar_type5>(v_str1));
+			else if (v_str1[0] == "GREP") polar_patterns.push_back(alloc_polar_pattern<Pattern_polar_grep >(v_str1));
+			else if (v_str1[0] == "GPC" ) polar_patterns.push_back(alloc_polar_pattern<Pattern_polar_gpc  >(v_str1));
 			else
 			{
 				std::clog << format_warning("Unrecognized Polar node type (" + v_polar[i] + ").") << std::endl;
@@ -56,10 +56,14 @@ protected:
 	void write_header_binary(std::ofstream &file, const unsigned n_data, const unsigned data_size,
 	                         const std::vector<unsigned> &headers);
 	void write_body_binary(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned bytes);
+	void write_frame_text(std::ofstream &file, const char *frame, const unsigned size, const std::type_index type);
+	void write_frame_binary(std::ofstream &file, const char *frame, const unsigned bytes);
 
 private:
 	template <typename T>
 	void _write_body_text(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned size);
+	template <typename T>
+	void _write_frame_text(std::ofstream &file, const char *frame, const unsigned size);
 };
 }
 }
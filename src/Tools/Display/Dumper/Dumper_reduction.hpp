@@ -7,6 +7,11 @@ namespace aff3ct
 {
 namespace tools
 {
+/*!
+ * \deprecated The simulations stream the frames to the disk with the Dumper_stream and the Dumper_stream_writer classes
+ *             instead of reducing the in-memory buffers of the Dumper at the end of each point. This class is kept for
+ *             the users of the library and will be removed in a future release.
+ */
 class Dumper_reduction : Dumper
 {
 protected:
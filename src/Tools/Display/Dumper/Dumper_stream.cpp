@@ -0,0 +1,98 @@
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Dumper_stream.hpp"
+
+using namespace aff3ct::tools;
+
+Dumper_stream
+::Dumper_stream(const size_t ring_size)
+: Dumper(), ring_size(ring_size), slot_bytes(0), head(0), tail(0)
+{
+	if (ring_size == 0)
+	{
+		std::stringstream message;
+		message << "'ring_size' has to be greater than 0 ('ring_size' = " << ring_size << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+Dumper_stream
+::~Dumper_stream()
+{
+}
+
+void Dumper_stream
+::alloc_ring()
+{
+	size_t bytes = 0;
+	for (auto i = 0; i < (int)this->registered_data_ptr.size(); i++)
+		bytes += (size_t)this->registered_data_size[i] * (size_t)this->registered_data_sizeof[i];
+
+	this->slot_bytes = bytes;
+	this->ring         .resize(bytes * this->ring_size);
+	this->ring_frame_id.resize(this->ring_size);
+
+	this->head = 0;
+	this->tail = 0;
+}
+
+void Dumper_stream
+::add(const unsigned n_err, const int frame_id)
+{
+	if (frame_id < 0)
+	{
+		std::stringstream message;
+		message << "'frame_id' has to be positive ('frame_id' = " << frame_id << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_err < this->add_threshold || this->registered_data_ptr.empty())
+		return;
+
+	if (this->ring.empty())
+		throw runtime_error(__FILE__, __LINE__, __func__, "The ring is not allocated, 'Dumper_stream_writer::open' "
+		                                                  "has to be called before.");
+
+	const auto h = this->head.load(std::memory_order_relaxed);
+
+	// sleep until the writer thread releases slots when the ring is full
+	if (h - this->tail.load(std::memory_order_acquire) >= this->ring_size)
+	{
+		std::unique_lock<std::mutex> lock(this->mutex_ring);
+		this->cond_ring.wait(lock, [&]() { return h - this->tail.load(std::memory_order_acquire) < this->ring_size; });
+	}
+
+	const auto slot = h % this->ring_size;
+	auto dst = this->ring.data() + slot * this->slot_bytes;
+	for (auto i = 0; i < (int)this->registered_data_ptr.size(); i++)
+	{
+		const auto bytes = this->registered_data_size[i] * this->registered_data_sizeof[i];
+		if ((unsigned)frame_id < this->registered_data_n_frames[i])
+		{
+			const auto ptr = this->registered_data_ptr[i];
+			std::copy(ptr + bytes * (frame_id +0),
+			          ptr + bytes * (frame_id +1),
+			          dst);
+		}
+		dst += bytes;
+	}
+	this->ring_frame_id[slot] = frame_id;
+
+	// publish the slot to the writer thread
+	this->head.store(h +1, std::memory_order_release);
+}
+
+void Dumper_stream
+::release(const size_t new_tail)
+{
+	// the tail is updated under the lock: a simulation thread can't miss the notification between its test and its
+	// wait
+	{
+		std::lock_guard<std::mutex> lock(this->mutex_ring);
+		this->tail.store(new_tail, std::memory_order_release);
+	}
+	this->cond_ring.notify_one();
+}
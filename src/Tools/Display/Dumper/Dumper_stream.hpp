@@ -0,0 +1,52 @@
+#ifndef DUMPER_STREAM_HPP_
+#define DUMPER_STREAM_HPP_
+
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <condition_variable>
+
+#include "Dumper.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+class Dumper_stream_writer;
+
+/*
+ * Dumper of one simulation thread which does not keep the frames in memory: 'add' copies the registered data of the
+ * erroneous frame in a fixed size ring (single producer: the simulation thread, single consumer: the thread of the
+ * Dumper_stream_writer) and the writer appends them to the files while the simulation is running. The ring is
+ * lock-free, when it is full 'add' sleeps on a condition variable until the writer releases slots (no frame is lost).
+ */
+class Dumper_stream : public Dumper
+{
+	friend Dumper_stream_writer;
+
+protected:
+	const size_t        ring_size;  // number of frames in the ring
+	      size_t        slot_bytes; // bytes of all the registered data for one frame
+	std::vector<char>   ring;
+	std::vector<int>    ring_frame_id;
+	std::atomic<size_t> head;       // next slot to fill    (written by the simulation thread)
+	std::atomic<size_t> tail;       // next slot to write   (written by the writer thread)
+
+	std::mutex              mutex_ring; // only taken when the ring is full
+	std::condition_variable cond_ring;  // notified when the writer releases slots
+
+public:
+	explicit Dumper_stream(const size_t ring_size = 256);
+	virtual ~Dumper_stream();
+
+	virtual void add(const unsigned n_err, const int frame_id = 0);
+
+protected:
+	void alloc_ring();
+	void release(const size_t new_tail);
+};
+}
+}
+
+#endif /* DUMPER_STREAM_HPP_ */
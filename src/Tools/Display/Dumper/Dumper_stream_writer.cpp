@@ -0,0 +1,240 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Dumper_stream_writer.hpp"
+
+using namespace aff3ct::tools;
+
+Dumper_stream_writer
+::Dumper_stream_writer(std::vector<Dumper_stream*> &dumpers, const std::chrono::milliseconds freq)
+: dumpers(dumpers), freq(freq), stop_writer(false)
+{
+	this->checks();
+}
+
+Dumper_stream_writer
+::~Dumper_stream_writer()
+{
+	this->close(); // try to join the thread if this is not been done by the user
+}
+
+void Dumper_stream_writer
+::checks()
+{
+	if (dumpers.empty())
+	{
+		std::stringstream message;
+		message << "'dumpers.size()' should be greater than 0 ('dumpers.size()' = " << dumpers.size() << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto d : dumpers)
+		if (d == nullptr)
+			throw invalid_argument(__FILE__, __LINE__, __func__, "'dumpers' can't contain null pointers.");
+
+	const auto n_data_ref = dumpers[0]->registered_data_ptr.size();
+	for (auto j = 1; j < (int)dumpers.size(); j++)
+	{
+		const auto n_data_cur = dumpers[j]->registered_data_ptr.size();
+		if (n_data_cur != n_data_ref)
+		{
+			std::stringstream message;
+			message << "'n_data_cur' should be equal to 'n_data_ref' ('n_data_cur' = " << n_data_cur
+			        << ", 'n_data_ref' = " << n_data_ref << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		// the frames of all the threads are written in the same files
+		if (dumpers[j]->registered_data_size     != dumpers[0]->registered_data_size     ||
+		    dumpers[j]->registered_data_sizeof   != dumpers[0]->registered_data_sizeof   ||
+		    dumpers[j]->registered_data_type     != dumpers[0]->registered_data_type     ||
+		    dumpers[j]->registered_data_ext      != dumpers[0]->registered_data_ext      ||
+		    dumpers[j]->registered_data_bin      != dumpers[0]->registered_data_bin      ||
+		    dumpers[j]->registered_data_head     != dumpers[0]->registered_data_head     ||
+		    dumpers[j]->registered_data_n_frames != dumpers[0]->registered_data_n_frames)
+		{
+			std::stringstream message;
+			message << "The data registered in the dumper " << j << " should be the same as in the dumper 0.";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+}
+
+void Dumper_stream_writer
+::open(const std::string& base_path)
+{
+	if (base_path.empty())
+		throw invalid_argument(__FILE__, __LINE__, __func__, "'base_path' can't be empty.");
+
+	this->close();
+	this->checks();
+
+	for (auto d : this->dumpers)
+		d->alloc_ring();
+
+	const auto &ref = *this->dumpers[0];
+	const auto n_files = ref.registered_data_ptr.size();
+	this->files  = std::vector<std::ofstream>(n_files);
+	this->paths  = std::vector<std::string>(n_files);
+	this->n_data = std::vector<unsigned>(n_files, 0);
+
+	for (size_t i = 0; i < n_files; i++)
+	{
+		const auto &path = this->paths[i] = base_path + "." + ref.registered_data_ext[i];
+
+		const auto mode = ref.registered_data_bin[i] ? std::ofstream::out | std::ios_base::binary : std::ofstream::out;
+		this->files[i].open(path, mode);
+		if (!this->files[i].is_open())
+		{
+			std::stringstream message;
+			message << "Impossible to open the file ('path' = " << path << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->write_header(i);
+		this->files[i].flush();
+	}
+
+	// launch a thread dedicated to the writing of the frames
+	this->writer_thread = std::thread(Dumper_stream_writer::start_thread_writer, this);
+}
+
+void Dumper_stream_writer
+::close()
+{
+	this->stop_thread_writer();
+
+	// write the frames added since the last pass of the writer thread
+	if (!this->files.empty())
+		this->write();
+
+	for (auto &f : this->files)
+		f.close();
+	this->files.clear();
+}
+
+void Dumper_stream_writer
+::discard()
+{
+	this->stop_thread_writer();
+
+	// release the slots without writing the frames
+	for (auto d : this->dumpers)
+		d->release(d->head.load(std::memory_order_acquire));
+
+	for (auto &f : this->files)
+		f.close();
+
+	// nothing is kept from a point whose simulation failed
+	if (!this->files.empty())
+		for (auto &p : this->paths)
+			std::remove(p.c_str());
+
+	this->files.clear();
+}
+
+void Dumper_stream_writer
+::stop_thread_writer()
+{
+	if (this->writer_thread.joinable())
+	{
+		{
+			std::unique_lock<std::mutex> lock(this->mutex_writer);
+			this->stop_writer = true;
+		}
+		this->cond_writer.notify_all();
+		this->writer_thread.join();
+		this->stop_writer = false;
+	}
+}
+
+bool Dumper_stream_writer
+::write()
+{
+	auto &ref = *this->dumpers[0];
+
+	auto written = false;
+	for (auto d : this->dumpers)
+	{
+		const auto t = d->tail.load(std::memory_order_relaxed);
+		const auto h = d->head.load(std::memory_order_acquire);
+
+		for (auto s = t; s < h; s++)
+		{
+			const auto slot     = s % d->ring_size;
+			const auto frame_id = d->ring_frame_id[slot];
+
+			const char* frame = d->ring.data() + slot * d->slot_bytes;
+			for (size_t i = 0; i < this->files.size(); i++)
+			{
+				const auto size  = ref.registered_data_size[i];
+				const auto bytes = size * ref.registered_data_sizeof[i];
+
+				if ((unsigned)frame_id < ref.registered_data_n_frames[i])
+				{
+					if (ref.registered_data_bin[i])
+						ref.write_frame_binary(this->files[i], frame, bytes);
+					else
+						ref.write_frame_text  (this->files[i], frame, size, ref.registered_data_type[i]);
+					this->n_data[i]++;
+				}
+				frame += bytes;
+			}
+		}
+
+		// release the slots to the simulation thread
+		if (h != t)
+		{
+			d->release(h);
+			written = true;
+		}
+	}
+
+	if (written)
+	{
+		for (size_t i = 0; i < this->files.size(); i++)
+		{
+			auto &file = this->files[i];
+
+			// the frames are on the disk before they are counted in the header
+			file.flush();
+			file.seekp(0, std::ios_base::beg);
+			this->write_header(i);
+			file.seekp(0, std::ios_base::end);
+			file.flush();
+		}
+	}
+
+	return written;
+}
+
+void Dumper_stream_writer
+::write_header(const size_t i)
+{
+	auto &ref = *this->dumpers[0];
+	if (ref.registered_data_bin[i])
+		ref.write_header_binary(this->files[i], this->n_data[i], ref.registered_data_size[i], ref.registered_data_head[i]);
+	else
+		ref.write_header_text  (this->files[i], this->n_data[i], ref.registered_data_size[i], ref.registered_data_head[i]);
+}
+
+void Dumper_stream_writer
+::start_thread_writer(Dumper_stream_writer *writer)
+{
+	while (true)
+	{
+		const auto written = writer->write();
+
+		std::unique_lock<std::mutex> lock(writer->mutex_writer);
+		if (writer->stop_writer)
+			break;
+
+		// do not wait while the rings are being filled
+		if (!written)
+			writer->cond_writer.wait_for(lock, writer->freq);
+	}
+}
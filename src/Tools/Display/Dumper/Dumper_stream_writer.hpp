@@ -0,0 +1,74 @@
+#ifndef DUMPER_STREAM_WRITER_HPP_
+#define DUMPER_STREAM_WRITER_HPP_
+
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fstream>
+#include <condition_variable>
+
+#include "Dumper_stream.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Background writer of the Dumper_stream rings (one per simulation thread). Between 'open' and 'close' a thread drains
+ * the rings and appends the frames to the files ("base_path.ext", same formats as the Dumper). After each pass the
+ * body is flushed before the number of frames in the header is rewritten in place: the files are always readable and
+ * their header never counts a frame which is not completely written. The writer is not a Dumper itself: the registered
+ * data and the file formats are the ones of the first Dumper_stream.
+ */
+class Dumper_stream_writer
+{
+protected:
+	std::vector<Dumper_stream*>     dumpers;
+	const std::chrono::milliseconds freq;
+
+	std::vector<std::ofstream> files;
+	std::vector<std::string>   paths;
+	std::vector<unsigned>      n_data;
+
+	std::thread             writer_thread;
+	std::mutex              mutex_writer;
+	std::condition_variable cond_writer;
+	bool                    stop_writer;
+
+public:
+	explicit Dumper_stream_writer(std::vector<Dumper_stream*> &dumpers,
+	                              const std::chrono::milliseconds freq = std::chrono::milliseconds(10));
+	virtual ~Dumper_stream_writer();
+
+	/*!
+	 * \brief Creates the files (one per registered data) and starts the writer thread.
+	 *
+	 * \param base_path: the path of the files without the extension.
+	 */
+	void open(const std::string& base_path);
+
+	/*!
+	 * \brief Stops the writer thread, writes the remaining frames and closes the files. The simulation threads have to
+	 *        be joined before.
+	 */
+	void close();
+
+	/*!
+	 * \brief Stops the writer thread, drops the remaining frames and removes the files created by the last 'open'
+	 *        (used when the simulation of the point failed). The simulation threads have to be joined before.
+	 */
+	void discard();
+
+private:
+	void checks();
+	bool write();
+	void write_header(const size_t i);
+	void stop_thread_writer();
+	static void start_thread_writer(Dumper_stream_writer *writer);
+};
+}
+}
+
+#endif /* DUMPER_STREAM_WRITER_HPP_ */
@@ -1,3 +1,4 @@
+#include <cmath>
 #include <algorithm>
 #include <iomanip>
 
@@ -184,6 +185,66 @@ void Statistics
 	       << std::endl;
 }
 
+void Statistics
+::show_histograms_header(std::ostream &stream)
+{
+	stream << "#" << std::endl;
+	stream << "# " << tools::format("Histograms of the timers (percentage of the calls per range of latencies):", tools::Style::BOLD) << std::endl;
+	Statistics::separation2(stream);
+}
+
+void Statistics
+::show_histogram(const std::string&           module_sname,
+                 const std::string&           task_name,
+                 const std::string&           timer_name,
+                 const std::vector<uint32_t>& timer_hist,
+                       std::ostream           &stream)
+{
+	uint64_t n_calls = 0;
+	for (auto n : timer_hist)
+		n_calls += n;
+
+	if (n_calls == 0)
+		return;
+
+	auto format_ns = [](const double ns) -> std::string
+	{
+		std::stringstream ss;
+		ss << std::setprecision(3);
+		     if (ns < 1e3) ss << ns        << "ns";
+		else if (ns < 1e6) ss << ns * 1e-3 << "us";
+		else if (ns < 1e9) ss << ns * 1e-6 << "ms";
+		else               ss << ns * 1e-9 << "s";
+		return ss.str();
+	};
+
+	std::stringstream ssmodule, ssprocess, sssp;
+	ssmodule  << std::setw(12) << module_sname;
+	ssprocess << std::setw(17) << task_name;
+	sssp      << std::setw( 7) << timer_name;
+
+	stream << "# ";
+	stream << ssmodule.str()                                       << tools::format(" | ",  tools::Style::BOLD)
+	       << tools::format(ssprocess.str(), tools::Style::ITALIC) << tools::format(" | ",  tools::Style::BOLD)
+	       << tools::format(sssp     .str(), tools::Style::ITALIC) << tools::format(" || ", tools::Style::BOLD);
+
+	// the bin 'b' counts the durations in [2^(b-1), 2^b[ ns
+	auto is_first = true;
+	for (size_t b = 0; b < timer_hist.size(); b++)
+		if (timer_hist[b])
+		{
+			std::stringstream ssbin;
+			ssbin << "[" << (b ? format_ns(std::ldexp(1.0, (int)b -1)) : "0ns") << "," << format_ns(std::ldexp(1.0, (int)b))
+			      << "[ " << std::setprecision(2) << std::fixed << (100.0 * timer_hist[b]) / n_calls << "%";
+
+			if (!is_first)
+				stream << tools::format(" | ", tools::Style::BOLD);
+			stream << ssbin.str();
+			is_first = false;
+		}
+	stream << std::endl;
+}
+
 void Statistics
 ::show(std::vector<const module::Module*> modules, const bool ordered, std::ostream &stream)
 {
@@ -285,6 +346,20 @@ void Statistics
 
 		Statistics::show_task(total_sec, "TOTAL", "*", ttask_n_elmts, ttask_n_calls,
 		                      ttask_tot_duration, ttask_min_duration, ttask_max_duration, stream);
+
+		auto has_timers = false;
+		for (auto *t : tasks)
+			for (auto n : t->get_timers_n_calls())
+				has_timers |= n > 0;
+
+		if (has_timers)
+		{
+			Statistics::show_histograms_header(stream);
+			for (auto *t : tasks)
+				for (size_t i = 0; i < t->get_timers_name().size(); i++)
+					Statistics::show_histogram(t->get_module().get_short_name(), t->get_name(),
+					                           t->get_timers_name()[i], t->get_timers_hist()[i], stream);
+		}
 	}
 	else
 	{
@@ -418,8 +493,11 @@ void Statistics
 				{
 					timers_n_calls     [tn] += t->get_timers_n_calls()[tn];
 					timers_tot_duration[tn] += t->get_timers_total()[tn];
-					timers_min_duration[tn]  = std::min(task_min_duration, t->get_timers_min()[tn]);
-					timers_max_duration[tn]  = std::max(task_max_duration, t->get_timers_max()[tn]);
+					if (t->get_timers_n_calls()[tn])
+					{
+						timers_min_duration[tn] = std::min(timers_min_duration[tn], t->get_timers_min()[tn]);
+						timers_max_duration[tn] = std::max(timers_max_duration[tn], t->get_timers_max()[tn]);
+					}
 				}
 
 				Statistics::show_timer(task_total_sec, task_n_calls, timers_n_elmts,
@@ -431,6 +509,29 @@ void Statistics
 
 		Statistics::show_task(total_sec, "TOTAL", "*", ttask_n_elmts, ttask_n_calls,
 		                      ttask_tot_duration, ttask_min_duration, ttask_max_duration, stream);
+
+		auto has_timers = false;
+		for (auto &vt : tasks)
+			for (auto *t : vt)
+				for (auto n : t->get_timers_n_calls())
+					has_timers |= n > 0;
+
+		if (has_timers)
+		{
+			Statistics::show_histograms_header(stream);
+			for (auto &vt : tasks)
+				for (size_t tn = 0; tn < vt[0]->get_timers_name().size(); tn++)
+				{
+					// the histograms of the threads are merged
+					std::vector<uint32_t> timer_hist(module::Task::n_timer_bins, 0);
+					for (auto *t : vt)
+						for (size_t b = 0; b < timer_hist.size(); b++)
+							timer_hist[b] += t->get_timers_hist()[tn][b];
+
+					Statistics::show_histogram(vt[0]->get_module().get_short_name(), vt[0]->get_name(),
+					                           vt[0]->get_timers_name()[tn], timer_hist, stream);
+				}
+		}
 	}
 	else
 	{
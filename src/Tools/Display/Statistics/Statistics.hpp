@@ -54,6 +54,14 @@ private:
 	                       const std::chrono::nanoseconds timer_min_duration,
 	                       const std::chrono::nanoseconds timer_max_duration,
 	                             std::ostream             &stream = std::cout);
+
+	static void show_histograms_header(std::ostream &stream = std::cout);
+
+	static void show_histogram(const std::string&           module_sname,
+	                           const std::string&           task_name,
+	                           const std::string&           timer_name,
+	                           const std::vector<uint32_t>& timer_hist,
+	                                 std::ostream           &stream = std::cout);
 };
 
 using Stats = Statistics;
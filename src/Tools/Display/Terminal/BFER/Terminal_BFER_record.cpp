@@ -0,0 +1,221 @@
+#include <iomanip>
+#include <sstream>
+#include <functional>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Terminal_BFER_record.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+template <typename B>
+Terminal_BFER_record<B>
+::Terminal_BFER_record(const module::Monitor_BFER<B> &monitor, const std::string &type)
+: Terminal_BFER<B>(monitor),
+  type            (type   )
+{
+	if (type != "JSON" && type != "CSV")
+	{
+		std::stringstream message;
+		message << "'type' has to be 'JSON' or 'CSV' ('type' = " << type << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B>
+void Terminal_BFER_record<B>
+::set_modules(const std::vector<std::vector<const module::Module*>> &modules)
+{
+	this->modules = modules;
+}
+
+template <typename B>
+void Terminal_BFER_record<B>
+::legend(std::ostream &stream)
+{
+	if (this->type == "CSV")
+		stream << "record,time,esn0,ebn0,fra,be,fe,ber,fer,sim_thr,elapsed,interrupted,module,task,timer,n_calls,"
+		       << "duration" << std::endl;
+}
+
+template <typename B>
+void Terminal_BFER_record<B>
+::temp_report(std::ostream &stream)
+{
+	this->_record(stream, "temp");
+}
+
+template <typename B>
+void Terminal_BFER_record<B>
+::final_report(std::ostream &stream)
+{
+	Terminal::final_report(stream);
+
+	this->_record(stream, "final");
+
+	this->t_snr = std::chrono::steady_clock::now();
+}
+
+template <typename B>
+void Terminal_BFER_record<B>
+::_record(std::ostream &stream, const std::string &record_type)
+{
+	using namespace std::chrono;
+
+	const auto is_final = record_type == "final";
+	const auto fra      = this->monitor.get_n_analyzed_fra();
+	const auto be       = this->monitor.get_n_be();
+	const auto fe       = this->monitor.get_n_fe();
+	const auto ber      = fra ? this->monitor.get_ber() : 0.f;
+	const auto fer      = fra ? this->monitor.get_fer() : 0.f;
+	const auto elapsed  = (float)duration_cast<nanoseconds>(steady_clock::now() - this->t_snr).count() * 1e-9f;
+	const auto sim_thr  = elapsed > 0.f ? ((float)this->monitor.get_size() * (float)fra) / elapsed * 1e-6f : 0.f; // Mb/s
+
+	const auto null = (this->type == "JSON") ? "null" : "";
+
+	std::stringstream time, esn0, ebn0;
+	time << std::fixed << std::setprecision(6)
+	     << (double)duration_cast<microseconds>(system_clock::now().time_since_epoch()).count() * 1e-6;
+	if (this->is_esn0) esn0 << this->esn0; else esn0 << null;
+	if (this->is_ebn0) ebn0 << this->ebn0; else ebn0 << null;
+
+	// the record is built before to be written at once, a reader never gets an incomplete line
+	std::stringstream rec;
+	rec << std::setprecision(6);
+
+	if (this->type == "JSON")
+	{
+		rec << "{\"record\":\""  << record_type  << "\","
+		    << "\"time\":"       << time.str()   << ","
+		    << "\"esn0\":"       << esn0.str()   << ","
+		    << "\"ebn0\":"       << ebn0.str()   << ","
+		    << "\"fra\":"        << fra          << ","
+		    << "\"be\":"         << be           << ","
+		    << "\"fe\":"         << fe           << ","
+		    << "\"ber\":"        << ber          << ","
+		    << "\"fer\":"        << fer          << ","
+		    << "\"sim_thr\":"    << sim_thr      << ","
+		    << "\"elapsed\":"    << elapsed;
+
+		if (is_final)
+		{
+			rec << ",\"interrupted\":" << (module::Monitor::is_interrupt() ? "true" : "false")
+			    << ",\"tasks\":[";
+			this->_record_tasks([&](const std::string &module_name, const std::string &task_name,
+			                        const std::string &timer_name, const unsigned long long n_calls,
+			                        const double duration, const bool is_first)
+			{
+				rec << (is_first ? "" : ",")
+				    << "{\"module\":\"" << module_name << "\","
+				    <<  "\"task\":\""   << task_name   << "\","
+				    <<  "\"timer\":\""  << timer_name  << "\","
+				    <<  "\"n_calls\":"  << n_calls     << ","
+				    <<  "\"duration\":" << duration    << "}";
+			});
+			rec << "]";
+		}
+
+		rec << "}" << std::endl;
+	}
+	else // if (this->type == "CSV")
+	{
+		rec << record_type << ","
+		    << time.str()  << ","
+		    << esn0.str()  << ","
+		    << ebn0.str()  << ","
+		    << fra         << ","
+		    << be          << ","
+		    << fe          << ","
+		    << ber         << ","
+		    << fer         << ","
+		    << sim_thr     << ","
+		    << elapsed     << ","
+		    << (is_final ? (module::Monitor::is_interrupt() ? "1" : "0") : "")
+		    << ",,,,," << std::endl;
+
+		if (is_final)
+			this->_record_tasks([&](const std::string &module_name, const std::string &task_name,
+			                        const std::string &timer_name, const unsigned long long n_calls,
+			                        const double duration, const bool is_first)
+			{
+				rec << "task,"
+				    << time.str() << ","
+				    << esn0.str() << ","
+				    << ebn0.str() << ","
+				    << ",,,,,,,,"
+				    << module_name << ","
+				    << task_name   << ","
+				    << timer_name  << ","
+				    << n_calls     << ","
+				    << duration    << std::endl;
+			});
+	}
+
+	stream << rec.str() << std::flush;
+}
+
+template <typename B>
+void Terminal_BFER_record<B>
+::_record_tasks(std::function<void(const std::string&, const std::string&, const std::string&,
+                                   const unsigned long long, const double, const bool)> record_task)
+{
+	using namespace std::chrono;
+
+	// the tasks of the different threads are merged (same module, same task)
+	auto is_first = true;
+	for (auto &vm : this->modules)
+	{
+		if (vm.empty() || vm[0] == nullptr)
+			continue;
+
+		for (size_t t = 0; t < vm[0]->tasks.size(); t++)
+		{
+			unsigned long long n_calls  = 0;
+			auto               duration = nanoseconds(0);
+
+			const auto &timers_name = vm[0]->tasks[t]->get_timers_name();
+			std::vector<unsigned long long> timers_n_calls  (timers_name.size(), 0);
+			std::vector<nanoseconds       > timers_durations(timers_name.size(), nanoseconds(0));
+
+			for (auto *m : vm)
+			{
+				auto *tsk = m->tasks[t];
+				n_calls  += tsk->get_n_calls();
+				duration += tsk->get_duration_total();
+				for (size_t i = 0; i < timers_name.size(); i++)
+				{
+					timers_n_calls  [i] += tsk->get_timers_n_calls()[i];
+					timers_durations[i] += tsk->get_timers_total  ()[i];
+				}
+			}
+
+			// the durations are only measured when the statistics are enabled
+			if (duration.count() == 0)
+				continue;
+
+			const auto &module_name = vm[0]->get_short_name();
+			const auto  task_name   = vm[0]->tasks[t]->get_name();
+
+			record_task(module_name, task_name, "*", n_calls, (double)duration.count() * 1e-9, is_first);
+			is_first = false;
+
+			for (size_t i = 0; i < timers_name.size(); i++)
+				if (timers_n_calls[i])
+					record_task(module_name, task_name, timers_name[i], timers_n_calls[i],
+					            (double)timers_durations[i].count() * 1e-9, false);
+		}
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::tools::Terminal_BFER_record<B_8>;
+template class aff3ct::tools::Terminal_BFER_record<B_16>;
+template class aff3ct::tools::Terminal_BFER_record<B_32>;
+template class aff3ct::tools::Terminal_BFER_record<B_64>;
+#else
+template class aff3ct::tools::Terminal_BFER_record<B>;
+#endif
+// ==================================================================================== explicit template instantiation
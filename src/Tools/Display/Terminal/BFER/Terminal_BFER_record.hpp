@@ -0,0 +1,53 @@
+#ifndef TERMINAL_BFER_RECORD_HPP_
+#define TERMINAL_BFER_RECORD_HPP_
+
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "Module/Module.hpp"
+#include "Module/Monitor/BFER/Monitor_BFER.hpp"
+
+#include "Terminal_BFER.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Terminal_BFER_record
+ *
+ * \brief Machine-readable BFER terminal: writes one record per report, as a JSON object per line ("JSON") or as a
+ *        line of comma-separated values ("CSV").
+ *
+ * The temporary records only read the counters of the monitor (atomic loads), they can be produced at any time by the
+ * terminal thread without disturbing the simulation threads. The final record also gives the time spent in each task
+ * (and in each of its timers), the tasks have to be given with 'set_modules' and have to be idle.
+ */
+template <typename B = int>
+class Terminal_BFER_record : public Terminal_BFER<B>
+{
+protected:
+	const std::string                               type;
+	std::vector<std::vector<const module::Module*>> modules;
+
+public:
+	Terminal_BFER_record(const module::Monitor_BFER<B> &monitor, const std::string &type = "JSON");
+
+	virtual ~Terminal_BFER_record() {}
+
+	void set_modules(const std::vector<std::vector<const module::Module*>> &modules);
+
+	void legend      (std::ostream &stream);
+	void temp_report (std::ostream &stream);
+	void final_report(std::ostream &stream);
+
+protected:
+	void _record      (std::ostream &stream, const std::string &record_type);
+	void _record_tasks(std::function<void(const std::string&, const std::string&, const std::string&,
+	                                      const unsigned long long, const double, const bool)> record_task);
+};
+}
+}
+
+#endif /* TERMINAL_BFER_RECORD_HPP_ */
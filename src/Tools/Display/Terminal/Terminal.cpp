@@ -28,11 +28,17 @@ void Terminal
 
 void Terminal
 ::start_temp_report(const std::chrono::milliseconds freq)
+{
+	this->start_temp_report(std::clog, freq);
+}
+
+void Terminal
+::start_temp_report(std::ostream &stream, const std::chrono::milliseconds freq)
 {
 	this->stop_temp_report();
 
 	// launch a thread dedicated to the terminal display
-	term_thread = std::thread(Terminal::start_thread_terminal, this, freq);
+	term_thread = std::thread(Terminal::start_thread_terminal, this, &stream, freq);
 }
 
 void Terminal
@@ -49,13 +55,13 @@ void Terminal
 }
 
 void Terminal
-::start_thread_terminal(Terminal *terminal, const std::chrono::milliseconds freq)
+::start_thread_terminal(Terminal *terminal, std::ostream *stream, const std::chrono::milliseconds freq)
 {
 	const auto sleep_time = freq - std::chrono::milliseconds(0);
 	while (!terminal->stop_terminal)
 	{
 		std::unique_lock<std::mutex> lock(terminal->mutex_terminal);
 		if (terminal->cond_terminal.wait_for(lock, sleep_time) == std::cv_status::timeout)
-			terminal->temp_report(std::clog); // display statistics in the terminal
+			terminal->temp_report(*stream); // display statistics in the terminal
 	}
 }
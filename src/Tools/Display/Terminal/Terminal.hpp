@@ -65,10 +65,18 @@ public:
 
 	void start_temp_report(const std::chrono::milliseconds freq = std::chrono::milliseconds(500));
 
+	/*!
+	 * \brief Starts a thread which periodically calls the temporary report.
+	 *
+	 * \param stream: the stream to print the reports (has to live until 'stop_temp_report' is called).
+	 * \param freq:   the time between two reports.
+	 */
+	void start_temp_report(std::ostream &stream, const std::chrono::milliseconds freq = std::chrono::milliseconds(500));
+
 	void stop_temp_report();
 
 private:
-	static void start_thread_terminal(Terminal *terminal, const std::chrono::milliseconds freq);
+	static void start_thread_terminal(Terminal *terminal, std::ostream *stream, const std::chrono::milliseconds freq);
 };
 }
 }
@@ -0,0 +1,81 @@
+#ifndef CYCLE_COUNTER_HPP_
+#define CYCLE_COUNTER_HPP_
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define CYCLE_COUNTER_TSC
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#elif defined(__linux__)
+#define CYCLE_COUNTER_MONOTONIC_RAW
+#include <time.h>
+#endif
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Low overhead time stamps for the sub-task timers. On x86 the time stamp counter is read (no system call, a few tens
+ * of cycles), on the other Linux targets the raw monotonic clock is used, elsewhere the steady clock. The ticks are
+ * converted in nanoseconds with a ratio calibrated once against the steady clock (the counter is assumed invariant).
+ */
+class Cycle_counter
+{
+protected:
+	Cycle_counter() {}
+
+public:
+	static inline uint64_t now()
+	{
+#if defined(CYCLE_COUNTER_TSC)
+		return (uint64_t)__rdtsc();
+#elif defined(CYCLE_COUNTER_MONOTONIC_RAW)
+		timespec ts;
+		clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+		return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#else
+		return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+		                     std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+
+	static inline double get_ns_per_tick()
+	{
+#if defined(CYCLE_COUNTER_TSC)
+		static const double ns_per_tick = Cycle_counter::calibrate();
+		return ns_per_tick;
+#else
+		return 1.0;
+#endif
+	}
+
+	static inline std::chrono::nanoseconds to_ns(const uint64_t ticks)
+	{
+		return std::chrono::nanoseconds((std::chrono::nanoseconds::rep)((double)ticks * Cycle_counter::get_ns_per_tick()));
+	}
+
+private:
+	static double calibrate()
+	{
+		using namespace std::chrono;
+
+		const auto t_start = steady_clock::now();
+		const auto c_start = Cycle_counter::now();
+		auto t_stop = t_start;
+		while (t_stop - t_start < milliseconds(10))
+			t_stop = steady_clock::now();
+		const auto c_stop = Cycle_counter::now();
+
+		return (double)duration_cast<nanoseconds>(t_stop - t_start).count() / (double)(c_stop - c_start);
+	}
+};
+}
+}
+
+#endif /* CYCLE_COUNTER_HPP_ */
@@ -0,0 +1,69 @@
+#ifndef SUB_TASK_TIMER_HPP_
+#define SUB_TASK_TIMER_HPP_
+
+#include <cstdint>
+
+#include "Module/Task.hpp"
+
+#include "Cycle_counter.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Measures the sub-tasks of a task (the 'load', 'decode' and 'store' of a decoder for instance) with the cycle counter
+ * and accumulates them in the timers registered in the task. The timer starts when it is constructed and each 'lap'
+ * adds the time elapsed since the previous lap to a timer of the task.
+ *
+ * The sub-task timers are compiled only with the ENABLE_SUBTASK_TIMERS definition, otherwise this class is empty and
+ * its calls vanish. When they are compiled, they are active only if the statistics of the task are enabled.
+ */
+#ifdef ENABLE_SUBTASK_TIMERS
+class Sub_task_timer
+{
+private:
+	module::Task   &task;
+	const bool     enabled;
+	const uint64_t t_start;
+	      uint64_t t_lap;
+
+public:
+	explicit inline Sub_task_timer(module::Task &task)
+	: task   (task),
+	  enabled(task.is_stats()),
+	  t_start(enabled ? Cycle_counter::now() : 0),
+	  t_lap  (t_start)
+	{
+	}
+
+	inline void lap(const int timer_id)
+	{
+		if (enabled)
+		{
+			const auto t_now = Cycle_counter::now();
+			task.update_timer(timer_id, Cycle_counter::to_ns(t_now - t_lap));
+			t_lap = t_now;
+		}
+	}
+
+	// adds the time elapsed since the construction of the timer (all the laps)
+	inline void total(const int timer_id)
+	{
+		if (enabled)
+			task.update_timer(timer_id, Cycle_counter::to_ns(Cycle_counter::now() - t_start));
+	}
+};
+#else
+class Sub_task_timer
+{
+public:
+	explicit inline Sub_task_timer(module::Task &task) {}
+	inline void lap  (const int timer_id) {}
+	inline void total(const int timer_id) {}
+};
+#endif
+}
+}
+
+#endif /* SUB_TASK_TIMER_HPP_ */
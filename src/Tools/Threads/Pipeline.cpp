@@ -0,0 +1,320 @@
+#include <map>
+#include <thread>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Threads/Thread_pinning.hpp"
+
+#include "Pipeline.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Pipeline
+::Pipeline(const std::vector<std::vector<module::Task*>> &stages, const size_t n_slots)
+: stages(stages),
+  n_slots(n_slots ? n_slots : stages.size() +1),
+  stage_sockets(stages.size()),
+  aborted(false)
+{
+	if (stages.size() == 0)
+	{
+		std::stringstream message;
+		message << "'stages.size()' has to be greater than 0 ('stages.size()' = " << stages.size() << ").";
+		throw length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// find the stage which produces each buffer (a buffer can be shared by several output sockets)
+	std::map<void*,size_t> producers;
+	for (size_t s = 0; s < stages.size(); s++)
+		for (auto *t : stages[s])
+			for (auto *sck : t->sockets)
+				if (t->get_socket_type(*sck) == module::OUT && sck->get_dataptr() != nullptr &&
+				    !producers.count(sck->get_dataptr()))
+					producers[sck->get_dataptr()] = s;
+
+	// the buffers produced by a stage and consumed by a following stage have to be replicated in each slot
+	std::map<void*,size_t> shared_ids;
+	for (size_t s = 0; s < stages.size(); s++)
+		for (auto *t : stages[s])
+			for (auto *sck : t->sockets)
+			{
+				auto ptr = sck->get_dataptr();
+				if (t->get_socket_type(*sck) != module::OUT && producers.count(ptr) && producers[ptr] < s &&
+				    !shared_ids.count(ptr))
+				{
+					shared_ids[ptr] = this->buffers.size();
+					this->buffers.push_back(std::vector<mipp::vector<uint8_t>>(this->n_slots,
+					                                                           mipp::vector<uint8_t>(sck->get_databytes())));
+				}
+			}
+
+	// remember the sockets to rebind before the execution of each stage
+	for (size_t s = 0; s < stages.size(); s++)
+		for (auto *t : stages[s])
+			for (auto *sck : t->sockets)
+			{
+				auto ptr = sck->get_dataptr();
+				if (shared_ids.count(ptr))
+				{
+					this->stage_sockets[s].push_back(std::make_pair(sck, shared_ids[ptr]));
+					this->original_ptrs.push_back(std::make_pair(sck, ptr));
+				}
+			}
+
+	// the slots go from a stage to the next one, the last queue gives the free slots back to the first stage
+	for (size_t s = 0; s < stages.size(); s++)
+	{
+		this->queues  .push_back(new SPSC_queue<int>(this->n_slots +1)); // +1 for the stop token
+		this->waitings.push_back(new Waiting());
+	}
+
+	// all the slots are free at the beginning
+	for (auto slot = 0; slot < (int)this->n_slots; slot++)
+		this->queues.back()->try_push(slot);
+}
+
+Pipeline
+::~Pipeline()
+{
+	for (auto &q : this->queues)
+		if (q != nullptr) { delete q; q = nullptr; }
+	for (auto &w : this->waitings)
+		if (w != nullptr) { delete w; w = nullptr; }
+}
+
+size_t Pipeline
+::get_n_stages() const
+{
+	return this->stages.size();
+}
+
+size_t Pipeline
+::get_n_slots() const
+{
+	return this->n_slots;
+}
+
+void Pipeline
+::exec(const std::function<bool(void)> &keep_looping, const int first_puid)
+{
+	this->aborted   = false;
+	this->exception = nullptr;
+
+	std::vector<std::thread> threads(this->stages.size() -1);
+	for (size_t s = 1; s < this->stages.size(); s++)
+		threads[s -1] = std::thread(Pipeline::start_thread, this, s, &keep_looping,
+		                            first_puid >= 0 ? first_puid + (int)s : -1);
+
+	Pipeline::start_thread(this, 0, &keep_looping, first_puid);
+
+	for (auto &t : threads)
+		t.join();
+
+	this->reset();
+
+	if (this->exception != nullptr)
+		std::rethrow_exception(this->exception);
+}
+
+void Pipeline
+::start_thread(Pipeline *pipeline, const size_t s, const std::function<bool(void)> *keep_looping, const int puid)
+{
+	try
+	{
+		if (puid >= 0)
+			thread_pinning((size_t)puid);
+
+		pipeline->stage_loop(s, *keep_looping);
+	}
+	catch (...)
+	{
+		pipeline->mutex_exception.lock();
+		if (pipeline->exception == nullptr)
+			pipeline->exception = std::current_exception();
+		pipeline->mutex_exception.unlock();
+
+		pipeline->abort();
+	}
+}
+
+void Pipeline
+::stage_loop(const size_t s, const std::function<bool(void)> &keep_looping)
+{
+	const auto n_stages = this->stages.size();
+	const auto q_in     = (s + n_stages -1) % n_stages;
+	const auto q_out    = s;
+
+	int slot;
+	while (this->pop(q_in, slot))
+	{
+		if (slot == -1) // stop token: forward it to the next stage
+		{
+			if (s < n_stages -1)
+				this->push(q_out, slot);
+			return;
+		}
+
+		if (s == 0 && !keep_looping())
+		{
+			if (n_stages > 1)
+				this->push(q_out, -1);
+			return;
+		}
+
+		this->bind_slot(s, slot);
+		for (auto *t : this->stages[s])
+			t->exec();
+
+		if (!this->push(q_out, slot))
+			return;
+	}
+}
+
+bool Pipeline
+::step(const size_t s)
+{
+	const auto n_stages = this->stages.size();
+
+	int slot;
+	if (!this->queues[(s + n_stages -1) % n_stages]->try_pop(slot))
+		return false;
+
+	this->bind_slot(s, slot);
+	for (auto *t : this->stages[s])
+		t->exec();
+
+	// never full: there are only 'n_slots' slots in the queues
+	this->queues[s]->try_push(slot);
+	return true;
+}
+
+void Pipeline
+::reset()
+{
+	int slot;
+	for (auto *q : this->queues)
+		while (q->try_pop(slot));
+
+	for (slot = 0; slot < (int)this->n_slots; slot++)
+		this->queues.back()->try_push(slot);
+
+	this->restore();
+}
+
+void Pipeline
+::bind_slot(const size_t s, const int slot)
+{
+	for (auto &sb : this->stage_sockets[s])
+		sb.first->bind((void*)this->buffers[sb.second][slot].data());
+}
+
+bool Pipeline
+::push(const size_t q, const int slot)
+{
+	auto &queue = *this->queues  [q];
+	auto &w     = *this->waitings[q];
+
+	for (auto i = 0; i < n_spins; i++)
+	{
+		if (queue.try_push(slot))
+		{
+			this->notify(q);
+			return true;
+		}
+		if (this->aborted)
+			return false;
+		std::this_thread::yield();
+	}
+
+	// the queue is still full: sleep until the consumer pops a slot
+	std::unique_lock<std::mutex> lock(w.mutex);
+	w.n_waiting++;
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	while (!queue.try_push(slot))
+	{
+		if (this->aborted)
+		{
+			w.n_waiting--;
+			return false;
+		}
+		w.cond.wait(lock);
+	}
+	w.n_waiting--;
+	lock.unlock();
+
+	this->notify(q);
+	return true;
+}
+
+bool Pipeline
+::pop(const size_t q, int &slot)
+{
+	auto &queue = *this->queues  [q];
+	auto &w     = *this->waitings[q];
+
+	for (auto i = 0; i < n_spins; i++)
+	{
+		if (queue.try_pop(slot))
+		{
+			this->notify(q);
+			return true;
+		}
+		if (this->aborted)
+			return false;
+		std::this_thread::yield();
+	}
+
+	// the queue is still empty: sleep until the producer pushes a slot
+	std::unique_lock<std::mutex> lock(w.mutex);
+	w.n_waiting++;
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	while (!queue.try_pop(slot))
+	{
+		if (this->aborted)
+		{
+			w.n_waiting--;
+			return false;
+		}
+		w.cond.wait(lock);
+	}
+	w.n_waiting--;
+	lock.unlock();
+
+	this->notify(q);
+	return true;
+}
+
+void Pipeline
+::notify(const size_t q)
+{
+	auto &w = *this->waitings[q];
+
+	// the sleeping thread checks the queue with the lock taken before to wait: taking the lock here ensures that the
+	// notification can't be lost between its check and its wait
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (w.n_waiting.load() > 0)
+	{
+		std::lock_guard<std::mutex> lock(w.mutex);
+		w.cond.notify_all();
+	}
+}
+
+void Pipeline
+::abort()
+{
+	this->aborted = true;
+
+	for (auto *w : this->waitings)
+	{
+		std::lock_guard<std::mutex> lock(w->mutex);
+		w->cond.notify_all();
+	}
+}
+
+void Pipeline
+::restore()
+{
+	for (auto &op : this->original_ptrs)
+		op.first->bind(op.second);
+}
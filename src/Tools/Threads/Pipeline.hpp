@@ -0,0 +1,147 @@
+/*!
+ * \file
+ * \brief Executes a sequence of tasks split in stages, each stage being run by its own thread.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef PIPELINE_HPP
+#define PIPELINE_HPP
+
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <utility>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+#include <mipp.h>
+
+#include "Module/Task.hpp"
+#include "Module/Socket.hpp"
+
+#include "SPSC_queue.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Pipeline
+ *
+ * \brief Executes a sequence of tasks split in stages, each stage being run by its own thread.
+ *
+ * The buffers written by a stage and read by a following stage are replicated in "n_slots" slots. A slot holds all
+ * the data of one frame batch: it goes from a stage to the next one through a lock-free single-producer/single-consumer
+ * queue and it is given back to the first stage when the last stage has been executed. Before the execution of a stage,
+ * the sockets of its tasks are bound to the buffers of the current slot.
+ *
+ * A stage which waits for a slot first spins a few times on the queue (the slot is usually about to come) and then
+ * sleeps until the slot is pushed: the threads of the stages which are waiting do not burn the cores. The stages can
+ * also be executed one frame batch at a time by an external scheduler (see 'step').
+ *
+ * The sockets of the tasks have to be bound before the pipeline construction. The original bindings are restored
+ * at the end of the execution. The tasks of different stages are executed at the same time: they must not share
+ * states or buffers (the tasks of a same module should be put in the same stage).
+ */
+class Pipeline
+{
+private:
+	// number of tries before to sleep when a queue is empty (or full)
+	static constexpr int n_spins = 64;
+
+	struct Waiting
+	{
+		std::mutex              mutex;
+		std::condition_variable cond;
+		std::atomic<int>        n_waiting;
+		Waiting() : n_waiting(0) {}
+	};
+
+	const std::vector<std::vector<module::Task*>> stages;
+	const size_t n_slots;
+
+	std::vector<std::vector<mipp::vector<uint8_t>>>             buffers;       // [buffer id][slot id]
+	std::vector<std::vector<std::pair<module::Socket*,size_t>>> stage_sockets; // [stage id] -> (socket, buffer id)
+	std::vector<std::pair<module::Socket*,void*>>               original_ptrs; // the bindings to restore
+	std::vector<SPSC_queue<int>*>                               queues;        // from the stage 's' to 's+1'
+	std::vector<Waiting*>                                       waitings;      // the threads sleeping on each queue
+
+	std::atomic<bool>  aborted;
+	std::mutex         mutex_exception;
+	std::exception_ptr exception;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param stages:  the tasks of each stage (in execution order).
+	 * \param n_slots: the number of frame batches in flight (0 is the number of stages + 1).
+	 */
+	Pipeline(const std::vector<std::vector<module::Task*>> &stages, const size_t n_slots = 0);
+
+	/*!
+	 * \brief Destructor.
+	 */
+	~Pipeline();
+
+	/*!
+	 * \brief Gets the number of stages (= the number of threads used by the pipeline).
+	 *
+	 * \return the number of stages.
+	 */
+	size_t get_n_stages() const;
+
+	/*!
+	 * \brief Gets the number of slots (= the maximum number of frame batches in flight).
+	 *
+	 * \return the number of slots.
+	 */
+	size_t get_n_slots() const;
+
+	/*!
+	 * \brief Runs the pipeline until the stop condition is reached (blocking method).
+	 *
+	 * The exception raised by a stage (if any) is forwarded to the caller once all the threads have been joined.
+	 *
+	 * \param keep_looping: a predicate called by the first stage before each new frame batch, the pipeline is emptied
+	 *                      and stopped when it returns false.
+	 * \param first_puid:   if positive, the thread of the stage 's' is pinned on the logical core 'first_puid + s'.
+	 */
+	void exec(const std::function<bool(void)> &keep_looping, const int first_puid = -1);
+
+	/*!
+	 * \brief Executes the stage 's' on the next frame batch of its input queue (non-blocking method).
+	 *
+	 * Lets an external scheduler run the stages instead of the threads of 'exec': the calls for a same stage must not
+	 * overlap (and have to be ordered by the scheduler) but the stages can be executed at the same time by any
+	 * threads. The first stage takes the free slots, the last stage gives them back.
+	 *
+	 * \param s: the stage to execute.
+	 *
+	 * \return false if there is no frame batch ready for the stage 's'.
+	 */
+	bool step(const size_t s);
+
+	/*!
+	 * \brief Gives all the slots back to the first stage and restores the original bindings of the sockets (to call
+	 *        after the last 'step').
+	 */
+	void reset();
+
+private:
+	void stage_loop(const size_t s, const std::function<bool(void)> &keep_looping);
+	void bind_slot (const size_t s, const int slot);
+	bool push      (const size_t q, const int  slot);
+	bool pop       (const size_t q,       int &slot);
+	void notify    (const size_t q);
+	void abort     ();
+	void restore   ();
+
+	static void start_thread(Pipeline *pipeline, const size_t s, const std::function<bool(void)> *keep_looping,
+	                         const int puid);
+};
+}
+}
+
+#endif /* PIPELINE_HPP */
@@ -0,0 +1,85 @@
+/*!
+ * \file
+ * \brief Bounded lock-free queue for one producer thread and one consumer thread.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef SPSC_QUEUE_HPP
+#define SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class SPSC_queue
+ *
+ * \brief Bounded lock-free queue for one producer thread and one consumer thread.
+ *
+ * The head (written by the consumer) and the tail (written by the producer) are stored on separated cache lines to
+ * avoid the false sharing between the two threads.
+ *
+ * \tparam T: the type of the elements in the queue.
+ */
+template <typename T>
+class SPSC_queue
+{
+private:
+	static constexpr size_t cache_line_size = 64;
+
+	std::vector<T> ring;
+
+	std::atomic<size_t> head;
+	char pad_head[cache_line_size - sizeof(std::atomic<size_t>)];
+	std::atomic<size_t> tail;
+	char pad_tail[cache_line_size - sizeof(std::atomic<size_t>)];
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param capacity: the maximum number of elements in the queue.
+	 */
+	explicit SPSC_queue(const size_t capacity);
+
+	/*!
+	 * \brief Destructor.
+	 */
+	~SPSC_queue();
+
+	/*!
+	 * \brief Adds an element at the end of the queue (should only be called by the producer thread).
+	 *
+	 * \param elmt: the element to add.
+	 *
+	 * \return true if the element has been added, false if the queue is full.
+	 */
+	bool try_push(const T &elmt);
+
+	/*!
+	 * \brief Takes the element at the front of the queue (should only be called by the consumer thread).
+	 *
+	 * \param elmt: the taken element (unchanged if the queue is empty).
+	 *
+	 * \return true if an element has been taken, false if the queue is empty.
+	 */
+	bool try_pop(T &elmt);
+
+	/*!
+	 * \brief Gets the maximum number of elements in the queue.
+	 *
+	 * \return the capacity of the queue.
+	 */
+	size_t get_capacity() const;
+};
+}
+}
+
+#include "SPSC_queue.hxx"
+
+#endif /* SPSC_QUEUE_HPP */
@@ -0,0 +1,66 @@
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "SPSC_queue.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <typename T>
+SPSC_queue<T>
+::SPSC_queue(const size_t capacity)
+: ring(capacity +1), head(0), tail(0)
+{
+	if (capacity == 0)
+	{
+		std::stringstream message;
+		message << "'capacity' has to be greater than 0 ('capacity' = " << capacity << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename T>
+SPSC_queue<T>
+::~SPSC_queue()
+{
+}
+
+template <typename T>
+bool SPSC_queue<T>
+::try_push(const T &elmt)
+{
+	const auto cur_tail = this->tail.load(std::memory_order_relaxed);
+	const auto nxt_tail = (cur_tail +1) % this->ring.size();
+
+	if (nxt_tail == this->head.load(std::memory_order_acquire))
+		return false; // the queue is full
+
+	this->ring[cur_tail] = elmt;
+	this->tail.store(nxt_tail, std::memory_order_release);
+	return true;
+}
+
+template <typename T>
+bool SPSC_queue<T>
+::try_pop(T &elmt)
+{
+	const auto cur_head = this->head.load(std::memory_order_relaxed);
+
+	if (cur_head == this->tail.load(std::memory_order_acquire))
+		return false; // the queue is empty
+
+	elmt = this->ring[cur_head];
+	this->head.store((cur_head +1) % this->ring.size(), std::memory_order_release);
+	return true;
+}
+
+template <typename T>
+size_t SPSC_queue<T>
+::get_capacity() const
+{
+	return this->ring.size() -1;
+}
+}
+}
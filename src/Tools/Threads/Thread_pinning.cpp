@@ -0,0 +1,23 @@
+#include <thread>
+
+#if defined(__linux__) && !defined(__ANDROID__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "Thread_pinning.hpp"
+
+bool aff3ct::tools::thread_pinning(const size_t puid)
+{
+#if defined(__linux__) && !defined(__ANDROID__)
+	const auto n_cores = std::thread::hardware_concurrency() ? (size_t)std::thread::hardware_concurrency() : (size_t)1;
+
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+	CPU_SET(puid % n_cores, &cpuset);
+
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) == 0;
+#else
+	return false;
+#endif
+}
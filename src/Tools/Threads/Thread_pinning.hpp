@@ -0,0 +1,31 @@
+/*!
+ * \file
+ * \brief Pins the threads on the logical cores of the machine.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef THREAD_PINNING_HPP
+#define THREAD_PINNING_HPP
+
+#include <cstddef>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \brief Pins the calling thread on a logical core (processing unit).
+ *
+ * The id of the core is wrapped around the number of available cores, this way it is possible to pin more threads
+ * than cores. On the operating systems where the thread affinity is not supported this function does nothing.
+ *
+ * \param puid: id of the logical core (processing unit).
+ *
+ * \return true if the calling thread has been pinned, false otherwise.
+ */
+bool thread_pinning(const size_t puid);
+}
+}
+
+#endif /* THREAD_PINNING_HPP */
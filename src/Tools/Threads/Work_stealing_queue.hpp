@@ -0,0 +1,109 @@
+/*!
+ * \file
+ * \brief Double-ended queue of jobs owned by a thread and in which the other threads can steal jobs.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef WORK_STEALING_QUEUE_HPP
+#define WORK_STEALING_QUEUE_HPP
+
+#include <atomic>
+#include <vector>
+#include <cstdint>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Work_stealing_queue
+ *
+ * \brief Double-ended queue of jobs owned by a thread and in which the other threads can steal jobs.
+ *
+ * The owner thread pushes and pops the jobs at the back of the queue (LIFO, to keep the data hot in its caches)
+ * while the thieves take the jobs at the front of the queue (FIFO, the oldest and coldest jobs).
+ *
+ * Lock-free implementation of the Chase-Lev deque (with the memory orders of Le et al., "Correct and Efficient
+ * Work-Stealing for Weak Memory Models", PPoPP 2013). The owner thread only synchronizes with the thieves when the
+ * queue holds a single job. The circular buffer grows when it is full, the old buffers are kept until the destruction
+ * of the queue because a thief can still be reading them.
+ *
+ * \tparam T: the type of the jobs, it has to be trivially copyable (the jobs are stored in std::atomic<T>).
+ */
+template <typename T>
+class Work_stealing_queue
+{
+private:
+	class Circular_buffer
+	{
+	private:
+		const int64_t  size;
+		std::atomic<T> *jobs;
+
+	public:
+		explicit Circular_buffer(const int64_t size);
+		~Circular_buffer();
+
+		int64_t get_size() const;
+
+		T    get(const int64_t i) const;
+		void put(const int64_t i, const T &job);
+
+		Circular_buffer* grow(const int64_t bottom, const int64_t top) const;
+	};
+
+	alignas(64) std::atomic<int64_t>          top;     // next job to steal (only incremented)
+	alignas(64) std::atomic<int64_t>          bottom;  // next free slot (owner side)
+	alignas(64) std::atomic<Circular_buffer*> buffer;
+	std::vector<Circular_buffer*>             retired; // the previous buffers (owner side)
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param size: the initial number of jobs that the queue can hold without to grow (a power of two).
+	 */
+	explicit Work_stealing_queue(const int64_t size = 64);
+
+	/*!
+	 * \brief Destructor.
+	 */
+	~Work_stealing_queue();
+
+	/*!
+	 * \brief Adds a job at the back of the queue (has to be called by the owner thread).
+	 *
+	 * \param job: the job to add.
+	 */
+	void push(const T &job);
+
+	/*!
+	 * \brief Takes the job at the back of the queue (has to be called by the owner thread).
+	 *
+	 * \param job: the taken job (unchanged if the queue is empty).
+	 *
+	 * \return true if a job has been taken, false if the queue is empty.
+	 */
+	bool pop(T &job);
+
+	/*!
+	 * \brief Takes the job at the front of the queue (can be called by any thread).
+	 *
+	 * \param job: the stolen job (unchanged if the queue is empty).
+	 *
+	 * \return true if a job has been stolen, false if the queue is empty or if another thread took the job first.
+	 */
+	bool steal(T &job);
+
+	/*!
+	 * \brief Removes all the jobs from the queue (no other thread has to access the queue at the same time).
+	 */
+	void clear();
+};
+}
+}
+
+#include "Work_stealing_queue.hxx"
+
+#endif /* WORK_STEALING_QUEUE_HPP */
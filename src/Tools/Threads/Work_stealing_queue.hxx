@@ -0,0 +1,161 @@
+#include <sstream>
+#include <type_traits>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Work_stealing_queue.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <typename T>
+Work_stealing_queue<T>::Circular_buffer
+::Circular_buffer(const int64_t size)
+: size(size), jobs(new std::atomic<T>[size])
+{
+}
+
+template <typename T>
+Work_stealing_queue<T>::Circular_buffer
+::~Circular_buffer()
+{
+	delete[] jobs;
+}
+
+template <typename T>
+int64_t Work_stealing_queue<T>::Circular_buffer
+::get_size() const
+{
+	return size;
+}
+
+template <typename T>
+T Work_stealing_queue<T>::Circular_buffer
+::get(const int64_t i) const
+{
+	return jobs[i & (size -1)].load(std::memory_order_relaxed);
+}
+
+template <typename T>
+void Work_stealing_queue<T>::Circular_buffer
+::put(const int64_t i, const T &job)
+{
+	jobs[i & (size -1)].store(job, std::memory_order_relaxed);
+}
+
+template <typename T>
+typename Work_stealing_queue<T>::Circular_buffer* Work_stealing_queue<T>::Circular_buffer
+::grow(const int64_t bottom, const int64_t top) const
+{
+	auto new_buffer = new Circular_buffer(2 * size);
+	for (auto i = top; i < bottom; i++)
+		new_buffer->put(i, this->get(i));
+	return new_buffer;
+}
+
+template <typename T>
+Work_stealing_queue<T>
+::Work_stealing_queue(const int64_t size)
+: top(0), bottom(0), buffer(nullptr)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "The jobs have to be trivially copyable.");
+
+	if (size <= 0 || (size & (size -1)))
+	{
+		std::stringstream message;
+		message << "'size' has to be a power of two ('size' = " << size << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	buffer.store(new Circular_buffer(size), std::memory_order_relaxed);
+}
+
+template <typename T>
+Work_stealing_queue<T>
+::~Work_stealing_queue()
+{
+	delete buffer.load(std::memory_order_relaxed);
+	for (auto b : retired)
+		delete b;
+}
+
+template <typename T>
+void Work_stealing_queue<T>
+::push(const T &job)
+{
+	const auto b = bottom.load(std::memory_order_relaxed);
+	const auto t = top   .load(std::memory_order_acquire);
+	auto       a = buffer.load(std::memory_order_relaxed);
+
+	if (b - t > a->get_size() -1)
+	{
+		// the queue is full, the thieves may still read the old buffer
+		retired.push_back(a);
+		a = a->grow(b, t);
+		buffer.store(a, std::memory_order_release);
+	}
+
+	a->put(b, job);
+	std::atomic_thread_fence(std::memory_order_release);
+	bottom.store(b +1, std::memory_order_relaxed);
+}
+
+template <typename T>
+bool Work_stealing_queue<T>
+::pop(T &job)
+{
+	const auto b = bottom.load(std::memory_order_relaxed) -1;
+	const auto a = buffer.load(std::memory_order_relaxed);
+	bottom.store(b, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	auto t = top.load(std::memory_order_relaxed);
+
+	if (t > b) // empty queue
+	{
+		bottom.store(b +1, std::memory_order_relaxed);
+		return false;
+	}
+
+	auto found = true;
+	const auto j = a->get(b);
+	if (t == b) // last job: race with the thieves
+	{
+		found = top.compare_exchange_strong(t, t +1, std::memory_order_seq_cst, std::memory_order_relaxed);
+		bottom.store(b +1, std::memory_order_relaxed);
+	}
+
+	if (found)
+		job = j;
+	return found;
+}
+
+template <typename T>
+bool Work_stealing_queue<T>
+::steal(T &job)
+{
+	auto t = top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	const auto b = bottom.load(std::memory_order_acquire);
+
+	if (t >= b) // empty queue
+		return false;
+
+	const auto a = buffer.load(std::memory_order_acquire);
+	const auto j = a->get(t);
+	if (!top.compare_exchange_strong(t, t +1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		return false;
+
+	job = j;
+	return true;
+}
+
+template <typename T>
+void Work_stealing_queue<T>
+::clear()
+{
+	top   .store(0, std::memory_order_relaxed);
+	bottom.store(0, std::memory_order_relaxed);
+}
+}
+}
@@ -39,13 +39,19 @@
 #include <Tools/Interleaver/Column_row/Interleaver_core_column_row.hpp>
 #include <Tools/Interleaver/LTE/Interleaver_core_LTE.hpp>
 #include <Tools/Threads/Barrier.hpp>
+#include <Tools/Threads/Thread_pinning.hpp>
+#include <Tools/Threads/Work_stealing_queue.hpp>
+#include <Tools/Threads/Pipeline.hpp>
+#include <Tools/Threads/SPSC_queue.hpp>
 #include <Tools/Math/Galois.hpp>
 #include <Tools/Algo/Sort/LC_sorter.hpp>
 #include <Tools/Algo/Sort/LC_sorter_simd.hpp>
 #include <Tools/Algo/PRNG/PRNG_MT19937_simd.hpp>
 #include <Tools/Algo/PRNG/PRNG_MT19937.hpp>
+#include <Tools/Algo/PRNG/PRNG_Threefry_simd.hpp>
 #include <Tools/Algo/Predicate.hpp>
 #include <Tools/Algo/Sparse_matrix/Sparse_matrix.hpp>
+#include <Tools/Algo/Sparse_matrix/Sparse_matrix_flat.hpp>
 #include <Tools/Algo/Tree/Binary_node.hpp>
 #include <Tools/Algo/Tree/Binary_tree.hpp>
 #include <Tools/Algo/Tree/Binary_tree_metric.hpp>
@@ -56,6 +62,12 @@
 #include <Tools/Algo/Gaussian_noise_generator/MKL/Gaussian_noise_generator_MKL.hpp>
 #include <Tools/Algo/Gaussian_noise_generator/Gaussian_noise_generator.hpp>
 #include <Tools/Algo/Gaussian_noise_generator/GSL/Gaussian_noise_generator_GSL.hpp>
+#include <Tools/Algo/Gaussian_noise_generator/Counter/Gaussian_noise_generator_counter.hpp>
+#include <Tools/Algo/Gaussian_noise_generator/Ziggurat/Gaussian_noise_generator_ziggurat.hpp>
+#include <Tools/Algo/Bit_matrix/Bit_matrix.hpp>
+#include <Tools/Algo/Bit_matrix/Bit_matrix_M4R.hpp>
+#include <Tools/Algo/SNR_sweep/SNR_sweep.hpp>
+#include <Tools/Algo/Demapper/Demapper_PAM.hpp>
 #include <Tools/SystemC/SC_Funnel.hpp>
 #include <Tools/SystemC/SC_Router.hpp>
 #include <Tools/SystemC/SC_Dummy.hpp>
@@ -77,6 +89,7 @@
 #include <Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator.hpp>
 #include <Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_file.hpp>
 #include <Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_TV.hpp>
+#include <Tools/Code/Polar/Frozenbits_generator/Frozenbits_cache.hpp>
 #include <Tools/Code/Polar/Patterns/Pattern_polar_r0_left.hpp>
 #include <Tools/Code/Polar/Patterns/Pattern_polar_spc.hpp>
 #include <Tools/Code/Polar/Patterns/Pattern_polar_std.hpp>
@@ -85,12 +98,23 @@
 #include <Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp>
 #include <Tools/Code/Polar/Patterns/Pattern_polar_rep.hpp>
 #include <Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp>
+#include <Tools/Code/Polar/Patterns/Pattern_polar_gen.hpp>
+#include <Tools/Code/Polar/Patterns/Pattern_polar_gpc.hpp>
+#include <Tools/Code/Polar/Patterns/Pattern_polar_grep.hpp>
+#include <Tools/Code/Polar/Patterns/Pattern_polar_type1.hpp>
+#include <Tools/Code/Polar/Patterns/Pattern_polar_type2.hpp>
+#include <Tools/Code/Polar/Patterns/Pattern_polar_type3.hpp>
+#include <Tools/Code/Polar/Patterns/Pattern_polar_type4.hpp>
+#include <Tools/Code/Polar/Patterns/Pattern_polar_type5.hpp>
 #include <Tools/Code/Polar/Pattern_polar_parser.hpp>
 #include <Tools/Code/Polar/Frozenbits_notifier.hpp>
+#include <Tools/Code/Polar/Polar_program.hpp>
+#include <Tools/Code/Polar/Polar_program_cache.hpp>
 #include <Tools/Code/LDPC/Standard/DVBS2/DVBS2_constants.hpp>
 #include <Tools/Code/LDPC/Standard/DVBS2/DVBS2_constants_64800.hpp>
 #include <Tools/Code/LDPC/Standard/DVBS2/DVBS2_constants_16200.hpp>
 #include <Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp>
+#include <Tools/Code/LDPC/Matrix_handler/LDPC_matrix_cache.hpp>
 #include <Tools/Code/LDPC/QC/QC.hpp>
 #include <Tools/Code/LDPC/AList/AList.hpp>
 #include <Tools/Code/BCH/BCH_polynomial_generator.hpp>
@@ -109,13 +133,18 @@
 #include <Tools/Code/Turbo/Post_processing_SISO/CRC/CRC_checker.hpp>
 #include <Tools/Arguments_reader.hpp>
 #include <Tools/Perf/Reorderer/Reorderer.hpp>
+#include <Tools/Perf/Timer/Cycle_counter.hpp>
+#include <Tools/Perf/Timer/Sub_task_timer.hpp>
 #include <Tools/Display/Frame_trace/Frame_trace.hpp>
 #include <Tools/Display/Dumper/Dumper.hpp>
 #include <Tools/Display/Dumper/Dumper_reduction.hpp>
+#include <Tools/Display/Dumper/Dumper_stream.hpp>
+#include <Tools/Display/Dumper/Dumper_stream_writer.hpp>
 #include <Tools/Display/Statistics/Statistics.hpp>
 #include <Tools/Display/Terminal/Terminal.hpp>
 #include <Tools/Display/Terminal/EXIT/Terminal_EXIT.hpp>
 #include <Tools/Display/Terminal/BFER/Terminal_BFER.hpp>
+#include <Tools/Display/Terminal/BFER/Terminal_BFER_record.hpp>
 #include <Tools/Exception/out_of_range/out_of_range.hpp>
 #include <Tools/Exception/range_error/range_error.hpp>
 #include <Tools/Exception/cannot_allocate/cannot_allocate.hpp>
@@ -171,8 +200,10 @@
 #include <Module/Decoder/Polar/SC/Decoder_polar_SC_naive.hpp>
 #include <Module/Decoder/Polar/SC/Decoder_polar_SC_naive_sys.hpp>
 #include <Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys.hpp>
+#include <Module/Decoder/Polar/SC/Decoder_polar_SC_spec_sys.hpp>
 #include <Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_MEM_fast_CA_sys.hpp>
 #include <Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_fast_CA_sys.hpp>
+#include <Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_inter_CA_sys.hpp>
 #include <Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive_sys.hpp>
 #include <Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive.hpp>
 #include <Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_sys.hpp>
@@ -180,7 +211,9 @@
 #include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_MEM_fast_CA_sys.hpp>
 #include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_CA_sys.hpp>
 #include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA.hpp>
+#include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_LV_fast_CA_sys.hpp>
 #include <Module/Decoder/Polar/SCL/Decoder_polar_SCL_MEM_fast_sys.hpp>
+#include <Module/Decoder/Polar/SCL/Decoder_polar_SCL_LV_fast_sys.hpp>
 #include <Module/Decoder/Decoder_SIHO_HIHO.hpp>
 #include <Module/Decoder/Decoder_HIHO.hpp>
 #include <Module/Decoder/RSC/BCJR/Seq_generic/Decoder_RSC_BCJR_seq_generic_std_json.hpp>
@@ -203,12 +236,15 @@
 #include <Module/Decoder/RSC/BCJR/Inter_intra/Decoder_RSC_BCJR_inter_intra_fast_x2_AVX.hpp>
 #include <Module/Decoder/RSC/BCJR/Inter_intra/Decoder_RSC_BCJR_inter_intra_fast_x2_SSE.hpp>
 #include <Module/Decoder/RSC/BCJR/Inter_intra/Decoder_RSC_BCJR_inter_intra.hpp>
+#include <Module/Decoder/RSC/BCJR/Window/Decoder_RSC_BCJR_window.hpp>
+#include <Module/Decoder/RSC/BCJR/Inter_generic/Decoder_RSC_BCJR_inter_generic.hpp>
 #include <Module/Decoder/Turbo_DB/Decoder_turbo_DB.hpp>
 #include <Module/Decoder/Repetition/Decoder_repetition_fast.hpp>
 #include <Module/Decoder/Repetition/Decoder_repetition_std.hpp>
 #include <Module/Decoder/Repetition/Decoder_repetition.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_offset_normalize_min_sum.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_ONMS_inter.hpp>
+#include <Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_ONMS_intra.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/LSPA/Decoder_LDPC_BP_layered_log_sum_product.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/AMS/Decoder_LDPC_BP_layered_approximate_min_star.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/SPA/Decoder_LDPC_BP_layered_sum_product.hpp>
@@ -223,9 +259,11 @@
 #include <Module/Decoder/Decoder_SIHO.hpp>
 #include <Module/Decoder/BCH/Decoder_BCH.hpp>
 #include <Module/Decoder/Generic/Chase/Decoder_chase_std.hpp>
+#include <Module/Decoder/Generic/Chase/Decoder_chase_fast.hpp>
 #include <Module/Decoder/Generic/ML/Decoder_maximum_likelihood.hpp>
 #include <Module/Decoder/Generic/ML/Decoder_maximum_likelihood_naive.hpp>
 #include <Module/Decoder/Generic/ML/Decoder_maximum_likelihood_std.hpp>
+#include <Module/Decoder/Generic/ML/Decoder_maximum_likelihood_fast.hpp>
 #include <Module/Decoder/Decoder_SISO.hpp>
 #include <Module/Decoder/NO/Decoder_NO.hpp>
 #include <Module/Decoder/RA/Decoder_RA.hpp>
@@ -255,6 +293,7 @@
 #include <Module/Quantizer/Quantizer.hpp>
 #include <Module/Quantizer/Tricky/Quantizer_tricky.hpp>
 #include <Module/Quantizer/NO/Quantizer_NO.hpp>
+#include <Module/Unpacker/Unpacker.hpp>
 #include <Module/CRC/Polynomial/CRC_polynomial.hpp>
 #include <Module/CRC/Polynomial/CRC_polynomial_fast.hpp>
 #include <Module/CRC/Polynomial/CRC_polynomial_inter.hpp>
@@ -290,6 +329,7 @@
 #include <Module/Codec/RA/Codec_RA.hpp>
 #include <Module/Codec/RSC_DB/Codec_RSC_DB.hpp>
 #include <Module/Codec/Turbo/Codec_turbo.hpp>
+#include <Module/Front_end/Front_end_BPSK_AWGN.hpp>
 #include <Factory/Tools/Interleaver/Interleaver_core.hpp>
 #include <Factory/Tools/Code/Polar/Frozenbits_generator.hpp>
 #include <Factory/Tools/Code/Turbo/Flip_and_check.hpp>
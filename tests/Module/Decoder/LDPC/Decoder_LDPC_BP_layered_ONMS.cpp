@@ -0,0 +1,109 @@
+#include <cmath>
+#include <random>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <cstdint>
+#include <cstdlib>
+#include <numeric>
+#include <iostream>
+#include <algorithm>
+#include <type_traits>
+#include <mipp.h>
+
+#include "Tools/types.h"
+
+#include "Tools/Code/LDPC/QC/QC.hpp"
+#include "Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_ONMS_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_ONMS_intra.hpp"
+
+using namespace aff3ct;
+
+// 4 x 8 base matrix, Z = 27 is not a multiple of the SIMD width (the intra-frame decoder pads the circulant blocks)
+const std::string qc_H = "8 4 27\n"
+                         " 3 -1 10  5  0  0 -1 -1\n"
+                         "-1  7  2 -1 -1  0  0 -1\n"
+                         "12 -1 -1 20  1 -1  0  0\n"
+                         "25  4 -1  8 -1 -1 -1  0\n";
+
+// the intra-frame (Z check nodes in the SIMD lanes) and the inter-frame (one frame per SIMD lane) decoders process
+// the check nodes in the same order (the Z check nodes of a layer are independent): with the same H and the same LLRs
+// they take the same decisions
+template <typename B, typename R>
+int test(const float norm, const R offset, std::mt19937 &gen)
+{
+	// the inter-frame decoder does not work in 8-bit fixed-point
+	if (std::is_integral<R>::value && sizeof(R) == 1)
+		return 0;
+
+	const auto n_ite = 10;
+
+	// the fixed-point LLRs are quantized with 2 (8-bit) or 3 (16-bit) bits for the fractional part
+	const auto is_fixed = std::is_integral<R>::value;
+	const auto q_scale  = is_fixed ? (sizeof(R) == 1 ? 4.  : 8.  ) : 1.;
+	const auto q_max    = is_fixed ? (sizeof(R) == 1 ? 31. : 2047.) : 1e9;
+	const auto type     = is_fixed ? std::to_string(8 * sizeof(R)) + "-bit" : std::string("floating-point");
+
+	std::istringstream stream(qc_H);
+	const auto H = tools::QC::read(stream);
+
+	const int N = (int)H.get_n_rows(), M = (int)H.get_n_cols(), K = N - M;
+	const int n_frames = mipp::nElReg<R>();
+
+	std::vector<unsigned> info_bits_pos(K);
+	std::iota(info_bits_pos.begin(), info_bits_pos.end(), 0);
+
+	// the syndrome is not checked: the inter-frame decoder stops when all the frames of the SIMD lanes are valid
+	module::Decoder_LDPC_BP_layered_ONMS_inter<B,R> dec_inter(K, N, n_ite, H, info_bits_pos, norm, offset, false, 1,
+	                                                           n_frames);
+	module::Decoder_LDPC_BP_layered_ONMS_intra<B,R> dec_intra(K, N, n_ite, H, info_bits_pos, norm, offset, false, 1,
+	                                                           n_frames);
+
+	// the all-zero codeword through a BPSK/AWGN channel (Eb/N0 ~ 1.5 dB), then quantized
+	std::normal_distribution<double> awgn(0.0, 0.75);
+	auto n_errors = 0;
+	for (auto t = 0; t < 10; t++)
+	{
+		mipp::vector<R> Y_N(N * n_frames);
+		for (auto &y : Y_N)
+		{
+			const auto llr = 2. * (1. + awgn(gen)) / (0.75 * 0.75) * q_scale;
+			y = (R)std::max(-q_max, std::min(q_max, is_fixed ? std::round(llr) : llr));
+		}
+
+		// the messages of the previous frames are kept by the decoders (turbo mode) unless they are reset
+		dec_inter.reset();
+		dec_intra.reset();
+
+		mipp::vector<B> V_inter(N * n_frames), V_intra(N * n_frames);
+		dec_inter.decode_siho_cw(Y_N, V_inter);
+		dec_intra.decode_siho_cw(Y_N, V_intra);
+
+		if (V_inter != V_intra)
+		{
+			n_errors++;
+			std::cerr << type << ", norm = " << norm << " (trial " << t << "): the intra-frame and the inter-frame "
+			          << "decoders take different decisions." << std::endl;
+			break;
+		}
+	}
+	return n_errors;
+}
+
+int main(int argc, char** argv)
+{
+	std::mt19937 gen(42);
+
+	auto n_errors = 0;
+#ifdef MULTI_PREC
+	n_errors += test<B_16,Q_16>(0.750f, (Q_16)1, gen);
+	n_errors += test<B_32,Q_32>(1.000f, (Q_32)0, gen);
+	n_errors += test<B_32,Q_32>(0.875f, (Q_32)0.25f, gen);
+	n_errors += test<B_64,Q_64>(0.875f, (Q_64)0.25, gen);
+#else
+	n_errors += test<B,Q>(0.750f, (Q)0, gen);
+	n_errors += test<B,Q>(1.000f, (Q)0, gen);
+#endif
+
+	return n_errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
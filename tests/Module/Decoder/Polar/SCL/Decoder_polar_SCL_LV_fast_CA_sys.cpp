@@ -0,0 +1,176 @@
+#include <cmath>
+#include <random>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <type_traits>
+#include <mipp.h>
+
+#include "Tools/types.h"
+
+#include "Tools/Code/Polar/nodes_parser.h"
+#include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_GA.hpp"
+#include "Module/CRC/Polynomial/CRC_polynomial.hpp"
+#include "Module/Encoder/Polar/Encoder_polar_sys.hpp"
+#include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_CA_sys.hpp"
+#include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_LV_fast_CA_sys.hpp"
+
+using namespace aff3ct;
+
+// frozen bits of a N = 256 and K = 159 code made of 32-bit nodes: rate 0, G-Rep (period 4 and 8), G-PC (period 4 and
+// 8), SPC and rate 1
+std::vector<bool> generalized_frozen_bits()
+{
+	// the first bits of each node are frozen
+	const int n_frozen[8] = {32, 28, 24, 4, 8, 1, 0, 0};
+
+	std::vector<bool> frozen_bits(256);
+	for (auto n = 0; n < 8; n++)
+		for (auto i = 0; i < 32; i++)
+			frozen_bits[32 * n +i] = i < n_frozen[n];
+	return frozen_bits;
+}
+
+// the list-vectorized decoder (paths in the SIMD lanes) and the fast SCL decoder (paths one after another) generate
+// the same candidates and keep the same paths: with the same frozen bits and the same LLRs they take the same decisions.
+// In fixed-point, the metrics of the candidates are often equal and the two decoders do not break the ties in the same
+// order (both choices are valid), so only their frame error rates are compared. With the generalized nodes, the list
+// rules keep only the cheapest flips of their sub-codes: the frame error rate is also compared to the one of the fast
+// SCL decoder without the generalized nodes
+template <typename B, typename R>
+int test(const int N, const int K, const int L, const float ebn0, const std::string &nodes, std::mt19937 &gen)
+{
+	using API_seq = tools::API_polar_dynamic_seq<B,R>;
+
+	const auto n_frames = 200;
+	const auto poly     = std::string("16-CCITT");
+	const auto K_info   = K - module::CRC_polynomial<B>::get_size(poly);
+
+	// the fixed-point LLRs are quantized with 1 (8-bit) or 2 (16-bit) bits for the fractional part
+	const auto is_fixed = std::is_integral<R>::value;
+	const auto q_scale  = is_fixed ? (sizeof(R) == 1 ? 2.f  : 4.f    ) : 1.f;
+	const auto q_max    = is_fixed ? (sizeof(R) == 1 ? 63.f : 8191.f ) : 1e9f;
+	const auto type     = is_fixed ? std::to_string(8 * sizeof(R)) + "-bit" : std::string("floating-point");
+
+	const auto esn0  = ebn0 + 10.f * std::log10((float)K_info / (float)N);
+	const auto sigma = std::sqrt(1.f / (2.f * std::pow(10.f, esn0 / 10.f)));
+
+	// without generalized nodes, the frozen bits are generated by the Gaussian approximation
+	std::vector<bool> frozen_bits(N);
+	if (nodes.empty())
+	{
+		tools::Frozenbits_generator_GA fb_generator(K, N, sigma);
+		fb_generator.generate(frozen_bits);
+	}
+	else
+		frozen_bits = generalized_frozen_bits();
+
+	// each decoder releases its patterns
+	const auto std_nodes = std::string("{R0,R0L,R1,REP,REPL,SPC_4}");
+	int idx_r0, idx_r1, idx_std_r0, idx_std_r1;
+	auto patterns_ref = tools::nodes_parser(nodes.empty() ? std_nodes : nodes, idx_r0,     idx_r1    );
+	auto patterns_lv  = tools::nodes_parser(nodes.empty() ? std_nodes : nodes, idx_r0,     idx_r1    );
+	auto patterns_std = tools::nodes_parser(                std_nodes,         idx_std_r0, idx_std_r1);
+
+	module::CRC_polynomial<B>                             crc    (K_info, poly);
+	module::Encoder_polar_sys<B>                          encoder(K, N, frozen_bits);
+	module::Decoder_polar_SCL_fast_CA_sys   <B,R,API_seq> dec_ref(K, N, L, frozen_bits, patterns_ref, idx_r0, idx_r1,
+	                                                              crc);
+	module::Decoder_polar_SCL_LV_fast_CA_sys<B,R        > dec_lv (K, N, L, frozen_bits, patterns_lv,  idx_r0, idx_r1,
+	                                                              crc);
+	module::Decoder_polar_SCL_fast_CA_sys   <B,R,API_seq> dec_std(K, N, L, frozen_bits, patterns_std, idx_std_r0,
+	                                                              idx_std_r1, crc);
+
+	std::bernoulli_distribution     bits(0.5);
+	std::normal_distribution<float> awgn(0.f, sigma);
+
+	mipp::vector<B> U_K1(K_info), U_K2(K), X_N(N), V_ref(K), V_lv(K), V_std(K);
+	mipp::vector<R> Y_N(N);
+	auto n_fe_ref = 0, n_fe_lv = 0, n_fe_std = 0, n_diff = 0;
+	for (auto f = 0; f < n_frames; f++)
+	{
+		for (auto &u : U_K1) u = (B)bits(gen);
+		crc.build(U_K1, U_K2);
+		encoder.encode(U_K2, X_N);
+
+		for (auto i = 0; i < N; i++)
+		{
+			const auto llr = 2.f * ((X_N[i] ? -1.f : 1.f) + awgn(gen)) / (sigma * sigma) * q_scale;
+			Y_N[i] = (R)std::max(-q_max, std::min(q_max, is_fixed ? std::round(llr) : llr));
+		}
+
+		dec_ref.decode_siho(Y_N, V_ref);
+		dec_lv .decode_siho(Y_N, V_lv );
+		if (!nodes.empty())
+			dec_std.decode_siho(Y_N, V_std);
+
+		// the fast decoders return the bits in the sign bit
+		auto fe_ref = false, fe_lv = false, fe_std = false, diff = false;
+		for (auto i = 0; i < K; i++)
+		{
+			fe_ref |= (V_ref[i] != 0) != (U_K2[i] != 0);
+			fe_lv  |= (V_lv [i] != 0) != (U_K2[i] != 0);
+			fe_std |= (V_std[i] != 0) != (U_K2[i] != 0);
+			diff   |= (V_ref[i] != 0) != (V_lv[i] != 0);
+		}
+		n_fe_ref += fe_ref;
+		n_fe_lv  += fe_lv;
+		n_fe_std += fe_std;
+		n_diff   += diff;
+	}
+
+	auto n_errors = 0;
+	if (!is_fixed && n_diff)
+	{
+		n_errors++;
+		std::cerr << type << ", N = " << N << ", K = " << K << ", L = " << L << ": the list-vectorized and the fast SCL "
+		          << "decoders take different decisions (" << n_diff << " frames)." << std::endl;
+	}
+	else if (is_fixed && std::abs(n_fe_lv - n_fe_ref) > std::max(5, n_fe_ref / 5))
+	{
+		n_errors++;
+		std::cerr << type << ", N = " << N << ", K = " << K << ", L = " << L << ": the list-vectorized and the fast SCL "
+		          << "decoders do not have the same frame error rate (" << n_fe_lv << " vs " << n_fe_ref << " frame "
+		          << "errors)." << std::endl;
+	}
+	if (!nodes.empty() && n_fe_ref - n_fe_std > std::max(10, n_fe_std / 2))
+	{
+		n_errors++;
+		std::cerr << type << ", N = " << N << ", K = " << K << ", L = " << L << ": the list rules of the generalized "
+		          << "nodes (" << nodes << ") degrade the frame error rate (" << n_fe_ref << " vs " << n_fe_std
+		          << " frame errors)." << std::endl;
+	}
+	return n_errors;
+}
+
+int main(int argc, char** argv)
+{
+	std::mt19937 gen(42);
+
+	const auto gen_nodes = std::string("{R0,R0L,R1,REP,REPL,SPC_4,GREP,GPC}");
+
+	auto n_errors = 0;
+	for (auto L = 2; L <= 32; L *= 2)
+	{
+#ifdef MULTI_PREC
+		n_errors += test<B_8, Q_8 >(256, 128, L, 1.5f, "",        gen);
+		n_errors += test<B_16,Q_16>(256, 128, L, 1.5f, "",        gen);
+		n_errors += test<B_32,Q_32>(256, 128, L, 1.5f, "",        gen);
+		n_errors += test<B_32,Q_32>( 64,  32, L, 1.5f, "",        gen);
+		n_errors += test<B_64,Q_64>(256, 128, L, 1.5f, "",        gen);
+		n_errors += test<B_8, Q_8 >(256, 159, L, 3.0f, gen_nodes, gen);
+		n_errors += test<B_16,Q_16>(256, 159, L, 3.0f, gen_nodes, gen);
+		n_errors += test<B_32,Q_32>(256, 159, L, 3.0f, gen_nodes, gen);
+#else
+		n_errors += test<B,Q>(256, 128, L, 1.5f, "",        gen);
+		n_errors += test<B,Q>( 64,  32, L, 1.5f, "",        gen);
+		n_errors += test<B,Q>(256, 159, L, 3.0f, gen_nodes, gen);
+#endif
+	}
+
+	return n_errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,163 @@
+#include <random>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+
+#include "Tools/Algo/Bit_packer.hpp"
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+#include "Module/Encoder/LDPC/From_QC/Encoder_LDPC_from_QC.hpp"
+#include "Module/Encoder/LDPC/From_H/Encoder_LDPC_from_H.hpp"
+
+using namespace aff3ct;
+
+using B = int;
+
+// gives access to the size of the gap (number of core parity bits) computed by the peeling of H2
+class Encoder_LDPC_from_QC_test : public module::Encoder_LDPC_from_QC<B>
+{
+public:
+	Encoder_LDPC_from_QC_test(const int K, const int N, const tools::Sparse_matrix &H)
+	: Encoder_LDPC_from_QC<B>(K, N, H) {}
+
+	size_t get_gap() const { return this->core_CN.size(); }
+};
+
+// H = [H1 H2] stored as in the alist files (one row per variable node, one column per check node): H1 is random and H2
+// is dual-diagonal, the first column of H2 has a third one in the middle when 'weight_3' is true (as in the IEEE
+// 802.11n/802.16e codes, H2 is then not triangular and the encoder has a non-zero gap)
+tools::Sparse_matrix build_H(const unsigned K, const unsigned M, const bool weight_3, std::mt19937 &gen)
+{
+	tools::Sparse_matrix H(K + M, M);
+
+	std::uniform_int_distribution<unsigned> dist(0, M -1);
+	for (unsigned v = 0; v < K; v++)
+	{
+		const auto c0 = dist(gen);
+		auto       c1 = dist(gen);
+		while (c1 == c0) c1 = dist(gen);
+		H.add_connection(v, c0);
+		H.add_connection(v, c1);
+	}
+
+	if (weight_3)
+	{
+		// the first parity bit is in the first, middle and last checks, the other ones are dual-diagonal
+		H.add_connection(K, 0    );
+		H.add_connection(K, M / 2);
+		H.add_connection(K, M -1 );
+		for (unsigned p = 1; p < M; p++)
+		{
+			H.add_connection(K + p, p -1);
+			H.add_connection(K + p, p   );
+		}
+	}
+	else
+	{
+		for (unsigned p = 0; p < M; p++)
+		{
+			H.add_connection(K + p, p);
+			if (p +1 < M)
+				H.add_connection(K + p, p +1);
+		}
+	}
+
+	return H;
+}
+
+bool check_syndrome(const tools::Sparse_matrix &H, const std::vector<B> &X_N)
+{
+	for (unsigned c = 0; c < H.get_n_cols(); c++)
+	{
+		auto parity = 0;
+		for (auto v : H.get_rows_from_col(c))
+			parity ^= X_N[v] ? 1 : 0;
+		if (parity)
+			return false;
+	}
+	return true;
+}
+
+template <class E>
+int test_encoder(const std::string &name, E &encoder, const tools::Sparse_matrix &H, const int K, const int N,
+                 std::mt19937 &gen)
+{
+	std::bernoulli_distribution dist(0.5);
+	std::vector<B> U_K(K), X_N(N);
+	std::vector<B> U_K_packed(K), X_N_packed(N), X_N_unpacked(N); // the packed frames keep the unpacked stride
+
+	const auto &info_bits_pos = encoder.get_info_bits_pos();
+
+	auto n_errors = 0;
+	for (auto f = 0; f < 20; f++)
+	{
+		for (auto &b : U_K) b = dist(gen);
+		encoder.encode(U_K, X_N);
+
+		if (!check_syndrome(H, X_N))
+		{
+			std::cerr << name << ": H.x != 0." << std::endl;
+			n_errors++;
+		}
+		if (!encoder.is_codeword(X_N.data()))
+		{
+			std::cerr << name << ": 'is_codeword' rejects a codeword." << std::endl;
+			n_errors++;
+		}
+		for (auto i = 0; i < K; i++)
+			if (X_N[info_bits_pos[i]] != U_K[i])
+			{
+				std::cerr << name << ": the information bits are not at 'info_bits_pos'." << std::endl;
+				n_errors++;
+				break;
+			}
+
+		tools::Bit_packer<B>::pack(U_K.data(), U_K_packed.data(), K);
+		encoder.encode_packed(U_K_packed, X_N_packed);
+		tools::Bit_packer<B>::unpack(X_N_packed.data(), X_N_unpacked.data(), N);
+		if (X_N_unpacked != X_N)
+		{
+			std::cerr << name << ": the packed encoding gives another codeword." << std::endl;
+			n_errors++;
+		}
+
+		X_N[f % N] = !X_N[f % N];
+		if (encoder.is_codeword(X_N.data()))
+		{
+			std::cerr << name << ": 'is_codeword' accepts a word with a wrong bit." << std::endl;
+			n_errors++;
+		}
+
+		if (n_errors)
+			break;
+	}
+	return n_errors;
+}
+
+int main(int argc, char** argv)
+{
+	std::mt19937 gen(42);
+
+	const int K = 120, M = 72, N = K + M;
+
+	auto n_errors = 0;
+	for (auto weight_3 : {false, true})
+	{
+		const auto H = build_H(K, M, weight_3, gen);
+		const std::string sfx = weight_3 ? " (weight-3 column)" : " (dual-diagonal)";
+
+		Encoder_LDPC_from_QC_test enc_QC(K, N, H);
+		if ((enc_QC.get_gap() == 0) == weight_3)
+		{
+			std::cerr << "Encoder_LDPC_from_QC" << sfx << ": the gap is " << enc_QC.get_gap() << "." << std::endl;
+			n_errors++;
+		}
+		n_errors += test_encoder("Encoder_LDPC_from_QC" + sfx, enc_QC, H, K, N, gen);
+
+		// G computed from H, encoded with the Four Russians tables
+		module::Encoder_LDPC_from_H<B> enc_H(K, N, H);
+		n_errors += test_encoder("Encoder_LDPC_from_H" + sfx, enc_H, H, K, N, gen);
+	}
+
+	return n_errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,156 @@
+#include <cmath>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <cstdlib>
+#include <iostream>
+
+#include "Tools/types.h"
+#include "Launcher/Code/Polar/Polar.hpp"
+#include "Launcher/Simulation/BFER_std.hpp"
+#include "Simulation/BFER/Standard/Threads/BFER_std_threads.hpp"
+
+using namespace aff3ct;
+
+#ifdef MULTI_PREC
+using B = B_32;
+using R = R_32;
+using Q = Q_32;
+#endif
+
+// the counters of the simulated SNR points
+struct Counters
+{
+	std::vector<unsigned long long> n_fra, n_be, n_fe;
+};
+
+class BFER_std_counters : public simulation::BFER_std_threads<B,R,Q>
+{
+	Counters &cnt;
+
+public:
+	BFER_std_counters(const factory::BFER_std::parameters &params, Counters &cnt)
+	: simulation::BFER_std_threads<B,R,Q>(params), cnt(cnt) {}
+
+protected:
+	void _launch()
+	{
+		simulation::BFER_std_threads<B,R,Q>::_launch();
+
+		auto &mnt = this->get_monitor_red();
+		cnt.n_fra.push_back(mnt.get_n_analyzed_fra());
+		cnt.n_be .push_back(mnt.get_n_be          ());
+		cnt.n_fe .push_back(mnt.get_n_fe          ());
+	}
+};
+
+class Launcher_counters : public launcher::Polar<launcher::BFER_std<B,R,Q>,B,R,Q>
+{
+	Counters &cnt;
+
+public:
+	Launcher_counters(const int argc, const char **argv, std::ostream &stream, Counters &cnt)
+	: launcher::Polar<launcher::BFER_std<B,R,Q>,B,R,Q>(argc, argv, stream), cnt(cnt) {}
+
+protected:
+	simulation::Simulation* build_simu()
+	{
+		return new BFER_std_counters(this->params, cnt);
+	}
+};
+
+bool simulate(std::vector<std::string> args, const bool packed, Counters &cnt)
+{
+	args.insert(args.begin(), "aff3ct");
+	if (packed)
+		args.push_back("--sim-packed");
+
+	std::vector<const char*> argv;
+	for (auto &a : args)
+		argv.push_back(a.c_str());
+
+	std::stringstream header;
+	Launcher_counters launcher((int)argv.size(), argv.data(), header, cnt);
+	return launcher.launch() == EXIT_SUCCESS && !cnt.n_fe.empty();
+}
+
+int test(const std::string &name, const std::vector<std::string> &args, const bool same_frames)
+{
+	Counters cnt_unpacked, cnt_packed;
+	if (!simulate(args, false, cnt_unpacked) || !simulate(args, true, cnt_packed))
+	{
+		std::cerr << name << ": the simulation failed." << std::endl;
+		return 1;
+	}
+
+	auto n_errors = 0;
+	for (size_t p = 0; p < cnt_unpacked.n_fe.size() && p < cnt_packed.n_fe.size(); p++)
+	{
+		const auto fer_unpacked = (double)cnt_unpacked.n_fe[p] / (double)cnt_unpacked.n_fra[p];
+		const auto fer_packed   = (double)cnt_packed  .n_fe[p] / (double)cnt_packed  .n_fra[p];
+
+		// the same frames are simulated when the source generates the same bits in the two modes, else the FERs are
+		// only statistically equal (the frames are simulated until 100 frame errors, the tolerance is 3 standard
+		// deviations of the FER estimation)
+		auto ok = true;
+		if (same_frames)
+			ok = cnt_unpacked.n_fra[p] == cnt_packed.n_fra[p] &&
+			     cnt_unpacked.n_be [p] == cnt_packed.n_be [p] &&
+			     cnt_unpacked.n_fe [p] == cnt_packed.n_fe [p];
+		else
+			ok = std::abs(fer_unpacked - fer_packed) < 3 * std::sqrt(2. / 100.) * std::max(fer_unpacked, fer_packed);
+
+		if (!ok)
+		{
+			std::cerr << name << ": point " << p << ", unpacked (FRA = " << cnt_unpacked.n_fra[p]
+			          << ", BE = " << cnt_unpacked.n_be[p] << ", FE = " << cnt_unpacked.n_fe[p] << ") != packed (FRA = "
+			          << cnt_packed.n_fra[p] << ", BE = " << cnt_packed.n_be[p] << ", FE = " << cnt_packed.n_fe[p]
+			          << ")." << std::endl;
+			n_errors++;
+		}
+	}
+
+	if (cnt_unpacked.n_fe.size() != cnt_packed.n_fe.size() || cnt_packed.n_fe.size() != 3)
+	{
+		std::cerr << name << ": " << cnt_unpacked.n_fe.size() << " and " << cnt_packed.n_fe.size()
+		          << " points were simulated instead of 3." << std::endl;
+		n_errors++;
+	}
+
+	return n_errors;
+}
+
+int main(int argc, char** argv)
+{
+	const std::vector<std::string> common = {"-m", "1.0", "-M", "2.0", "-s", "0.5", "-e", "100", "-t", "1", "-S", "7",
+	                                         "--ter-freq", "0", "--ter-no", "-C", "POLAR"};
+
+	auto with = [&](std::vector<std::string> args)
+	{
+		args.insert(args.end(), common.begin(), common.end());
+		return args;
+	};
+
+	auto n_errors = 0;
+
+	// the 'RAND' source is packed after the generation of the unpacked bits: the two chains simulate the same frames
+	// and take the same decisions
+	n_errors += test("SC, no CRC", with({"-K", "128", "-N", "256", "--src-type", "RAND"}), true);
+	n_errors += test("SCL, CRC FAST", with({"-K", "100", "-N", "256", "--src-type", "RAND", "--crc-poly", "16-IBM",
+	                                        "--crc-type", "FAST", "--dec-type", "SCL", "-L", "4"}), true);
+	n_errors += test("SCL, CRC STD, 3 frames", with({"-K", "100", "-N", "256", "--src-type", "RAND", "--crc-poly",
+	                                                 "16-IBM", "--crc-type", "STD", "--dec-type", "SCL", "-L", "4", "-F",
+	                                                 "3"}), true);
+	n_errors += test("SCL naive, CRC FAST, non-systematic", with({"-K", "61", "-N", "128", "--src-type", "RAND",
+	                                                              "--crc-poly", "8-DVB-S2", "--crc-type", "FAST",
+	                                                              "--dec-type", "SCL", "--dec-implem", "NAIVE", "-L", "4",
+	                                                              "--enc-no-sys"}), true);
+	n_errors += test("SC, no CRC, AZCW", with({"-K", "128", "-N", "256", "--src-type", "AZCW"}), true);
+
+	// the 'RAND_FAST' source writes its random words directly as packed bits: in general the frames are different
+	n_errors += test("SCL, CRC FAST, RAND_FAST", with({"-K", "100", "-N", "256", "--src-type", "RAND_FAST",
+	                                                   "--crc-poly", "16-IBM", "--crc-type", "FAST", "--dec-type", "SCL",
+	                                                   "-L", "4"}), false);
+
+	return n_errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,145 @@
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#include "Tools/Algo/Bit_matrix/Bit_matrix.hpp"
+#include "Tools/Algo/Bit_matrix/Bit_matrix_M4R.hpp"
+
+using namespace aff3ct;
+
+tools::Bit_matrix random_matrix(const unsigned n_rows, const unsigned n_cols, std::mt19937 &gen)
+{
+	std::bernoulli_distribution dist(0.5);
+	tools::Bit_matrix M(n_rows, n_cols);
+	for (unsigned i = 0; i < n_rows; i++)
+		for (unsigned j = 0; j < n_cols; j++)
+			M.set(i, j, dist(gen));
+	return M;
+}
+
+// the Four Russians product against the bit by bit product, for all the group sizes and a number of rows which is not
+// a multiple of the group size
+int test_mul(const unsigned n_rows, const unsigned n_cols, std::mt19937 &gen)
+{
+	const auto M = random_matrix(n_rows, n_cols, gen);
+
+	std::bernoulli_distribution dist(0.5);
+	std::vector<int> x(n_rows);
+	for (auto &b : x) b = dist(gen);
+
+	std::vector<int> y_ref(n_cols, 0);
+	for (unsigned i = 0; i < n_rows; i++)
+		if (x[i])
+			for (unsigned j = 0; j < n_cols; j++)
+				y_ref[j] ^= M.get(i, j) ? 1 : 0;
+
+	mipp::vector<uint64_t> x_p(tools::Bit_matrix::n_words_for(n_rows), 0);
+	tools::Bit_matrix::pack(x.data(), x_p.data(), n_rows);
+
+	auto n_errors = 0;
+	for (auto k : {1u, 2u, 4u, 8u})
+	{
+		tools::Bit_matrix_M4R M4R(M, k);
+
+		mipp::vector<uint64_t> y_p(M4R.get_n_words(), 0);
+		M4R.mul(x_p.data(), y_p.data());
+
+		std::vector<int> y(n_cols);
+		tools::Bit_matrix::unpack(y_p.data(), y.data(), n_cols);
+
+		if (y != y_ref)
+		{
+			std::cerr << "M4R (" << n_rows << " x " << n_cols << ", k = " << k << "): the product is wrong."
+			          << std::endl;
+			n_errors++;
+		}
+	}
+
+	mipp::vector<uint64_t> y_p(M.get_n_words(), 0);
+	M.mul(x_p.data(), y_p.data());
+	std::vector<int> y(n_cols);
+	tools::Bit_matrix::unpack(y_p.data(), y.data(), n_cols);
+	if (y != y_ref)
+	{
+		std::cerr << "Bit_matrix (" << n_rows << " x " << n_cols << "): the product is wrong." << std::endl;
+		n_errors++;
+	}
+
+	return n_errors;
+}
+
+// the cache gives the same tables for the same matrix and other tables for another matrix of the same dimensions
+int test_shared(std::mt19937 &gen)
+{
+	const auto A = random_matrix(50, 90, gen);
+	auto       B = A;
+	B.flip(17, 33);
+
+	const size_t budget = (size_t)1 << 20;
+	auto t_A1 = tools::Bit_matrix_M4R::get_shared(A, budget);
+	auto t_A2 = tools::Bit_matrix_M4R::get_shared(A, budget);
+	auto t_B  = tools::Bit_matrix_M4R::get_shared(B, budget);
+
+	auto n_errors = 0;
+	if (t_A1 != t_A2)
+	{
+		std::cerr << "get_shared: the tables of the same matrix are not shared." << std::endl;
+		n_errors++;
+	}
+	if (t_A1 == t_B)
+	{
+		std::cerr << "get_shared: two different matrices share the same tables." << std::endl;
+		n_errors++;
+	}
+	return n_errors;
+}
+
+int test_inverse(std::mt19937 &gen)
+{
+	// a random lower triangular matrix with a unit diagonal times a random upper one is invertible
+	const unsigned n = 70;
+	tools::Bit_matrix L(n, n), U(n, n);
+	std::bernoulli_distribution dist(0.5);
+	for (unsigned i = 0; i < n; i++)
+		for (unsigned j = 0; j < n; j++)
+		{
+			L.set(i, j, i == j || (j < i && dist(gen)));
+			U.set(i, j, i == j || (j > i && dist(gen)));
+		}
+
+	tools::Bit_matrix A(n, n);
+	for (unsigned i = 0; i < n; i++)
+		L.mul(U[i], A[i]); // the rows of U.L, the product of two invertible matrices
+
+	const auto inv = A.inverse();
+
+	tools::Bit_matrix I(n, n);
+	for (unsigned i = 0; i < n; i++)
+		inv.mul(A[i], I[i]);
+
+	for (unsigned i = 0; i < n; i++)
+		for (unsigned j = 0; j < n; j++)
+			if (I.get(i, j) != (i == j))
+			{
+				std::cerr << "Bit_matrix: A.inv(A) is not the identity." << std::endl;
+				return 1;
+			}
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	std::mt19937 gen(42);
+
+	auto n_errors = 0;
+	n_errors += test_mul(  1,   1, gen);
+	n_errors += test_mul( 13,  64, gen);
+	n_errors += test_mul(100, 150, gen);
+	n_errors += test_mul(259, 517, gen);
+	n_errors += test_shared (gen);
+	n_errors += test_inverse(gen);
+
+	return n_errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
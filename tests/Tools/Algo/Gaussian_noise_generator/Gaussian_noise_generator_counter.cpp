@@ -0,0 +1,172 @@
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+#include "Tools/types.h"
+#include "Tools/Algo/Gaussian_noise_generator/Counter/Gaussian_noise_generator_counter.hpp"
+
+using namespace aff3ct;
+
+template <typename R>
+int test_moments(const R sigma)
+{
+	const unsigned n = 1 << 20;
+	std::vector<R> noise(n);
+
+	tools::Gaussian_noise_generator_counter<R> generator(42);
+	generator.generate(noise.data(), n, sigma);
+
+	double sum = 0, sum2 = 0;
+	for (auto x : noise)
+	{
+		if (!std::isfinite((double)x))
+		{
+			std::cerr << "sizeof(R) = " << sizeof(R) << ": the noise is not finite (" << x << ")." << std::endl;
+			return 1;
+		}
+		sum  += (double)x;
+		sum2 += (double)x * (double)x;
+	}
+
+	// the standard deviation of the estimators is about sigma / sqrt(n) (mean) and sigma^2 * sqrt(2 / n) (variance),
+	// the tolerances are of 5 standard deviations
+	const auto s2   = (double)sigma * (double)sigma;
+	const auto mean = sum / n;
+	const auto var  = sum2 / n - mean * mean;
+
+	auto n_errors = 0;
+	if (std::abs(mean) > 5 * (double)sigma / std::sqrt((double)n))
+	{
+		std::cerr << "sizeof(R) = " << sizeof(R) << ": the mean is " << mean << "." << std::endl;
+		n_errors++;
+	}
+	if (std::abs(var - s2) > 5 * s2 * std::sqrt(2. / n))
+	{
+		std::cerr << "sizeof(R) = " << sizeof(R) << ": the variance is " << var << " instead of " << s2 << "."
+		          << std::endl;
+		n_errors++;
+	}
+	return n_errors;
+}
+
+template <typename R>
+int test_positions()
+{
+	const unsigned N = 100, n_streams = 3, n_calls = 4;
+	const R sigma = (R)0.7;
+
+	// the whole stream
+	std::vector<R> ref(N * n_streams * n_calls);
+	tools::Gaussian_noise_generator_counter<R> generator(7);
+	generator.generate(ref.data(), (unsigned)ref.size(), sigma);
+
+	auto n_errors = 0;
+
+	// interleaved generators (one frame per call): the call c of the generator s gives the frame c * n_streams + s
+	for (unsigned s = 0; s < n_streams; s++)
+	{
+		tools::Gaussian_noise_generator_counter<R> g(7);
+		g.set_interleaving(n_streams, s);
+
+		std::vector<R> noise(N);
+		for (unsigned c = 0; c < n_calls; c++)
+		{
+			g.generate(noise.data(), N, sigma);
+			for (unsigned i = 0; i < N; i++)
+				if (noise[i] != ref[(c * n_streams + s) * N + i])
+				{
+					std::cerr << "sizeof(R) = " << sizeof(R) << ": stream " << s << ", call " << c
+					          << ", the noise differs from the reference." << std::endl;
+					n_errors++;
+					break;
+				}
+		}
+	}
+
+	// replay of a block in the middle of the stream (not aligned on the groups)
+	std::vector<R> noise(N);
+	generator.set_position(5 * N +3);
+	generator.generate(noise.data(), N, sigma);
+	for (unsigned i = 0; i < N; i++)
+		if (noise[i] != ref[5 * N +3 +i])
+		{
+			std::cerr << "sizeof(R) = " << sizeof(R) << ": the replayed noise differs from the reference." << std::endl;
+			n_errors++;
+			break;
+		}
+
+	return n_errors;
+}
+
+template <typename R>
+int test_threads(const unsigned n_frames_ref, const unsigned n_frames)
+{
+	const unsigned N = 100, n_threads = 4, n_calls = 3;
+	const unsigned n_frames_tot = n_threads * n_frames * n_calls;
+	const R sigma = (R)0.9;
+
+	// one thread: the frames 0, 1, 2, ... by calls of 'n_frames_ref' frames
+	std::vector<R> ref(N * n_frames_tot);
+	tools::Gaussian_noise_generator_counter<R> generator(3);
+	generator.set_interleaving(1, 0, n_frames_ref);
+	for (unsigned f = 0; f < n_frames_tot; f += n_frames_ref)
+		generator.generate(ref.data() + f * N, N * n_frames_ref, sigma);
+
+	// 'n_threads' threads: the thread t takes the frames t, t + n_threads, ... by calls of 'n_frames' frames
+	for (unsigned t = 0; t < n_threads; t++)
+	{
+		tools::Gaussian_noise_generator_counter<R> g(3);
+		g.set_interleaving(n_threads, t, n_frames);
+
+		std::vector<R> noise(N * n_frames);
+		for (unsigned c = 0; c < n_calls; c++)
+		{
+			g.generate(noise.data(), N * n_frames, sigma);
+			for (unsigned f = 0; f < n_frames; f++)
+			{
+				const auto frame_id = (c * n_frames + f) * n_threads + t;
+				if (!std::equal(noise.begin() + f * N, noise.begin() + (f +1) * N, ref.begin() + frame_id * N))
+				{
+					std::cerr << "sizeof(R) = " << sizeof(R) << ": the noise of the frame " << frame_id
+					          << " differs between 1 thread (" << n_frames_ref << " frame(s) per call) and "
+					          << n_threads << " threads (" << n_frames << " frame(s) per call)." << std::endl;
+					return 1;
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	auto n_errors = 0;
+
+#ifdef MULTI_PREC
+	n_errors += test_moments<R_32>((R_32)1.0);
+	n_errors += test_moments<R_32>((R_32)0.5);
+	n_errors += test_moments<R_64>((R_64)1.0);
+	n_errors += test_moments<R_64>((R_64)0.5);
+
+	n_errors += test_positions<R_32>();
+	n_errors += test_positions<R_64>();
+
+	n_errors += test_threads<R_32>(1, 1);
+	n_errors += test_threads<R_32>(2, 3);
+	n_errors += test_threads<R_64>(1, 1);
+	n_errors += test_threads<R_64>(2, 3);
+#else
+	n_errors += test_moments<R>((R)1.0);
+	n_errors += test_moments<R>((R)0.5);
+
+	n_errors += test_positions<R>();
+
+	n_errors += test_threads<R>(1, 1);
+	n_errors += test_threads<R>(2, 3);
+#endif
+
+	return n_errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,53 @@
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mipp.h>
+
+#include "Tools/Algo/PRNG/PRNG_Threefry_simd.hpp"
+
+using namespace aff3ct;
+
+// known-answer vectors of Threefry-4x32-20 published with the Random123 library (kat_vectors): counter, key, output
+static const uint32_t kat[3][3][4] =
+{
+	{{0x00000000, 0x00000000, 0x00000000, 0x00000000},
+	 {0x00000000, 0x00000000, 0x00000000, 0x00000000},
+	 {0x9c6ca96a, 0xe17eae66, 0xfc10ecd4, 0x5256a7d8}},
+	{{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+	 {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+	 {0x2a881696, 0x57012287, 0xf6c7446e, 0xa16a6732}},
+	{{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+	 {0xa4093822, 0x299f31d0, 0x082efa98, 0xec4e6c89},
+	 {0x59cd1dbb, 0xb8879579, 0x86b5d00c, 0xac8b6d84}},
+};
+
+int main(int argc, char** argv)
+{
+	auto n_errors = 0;
+
+	tools::PRNG_Threefry_simd threefry;
+	for (auto v = 0; v < 3; v++)
+	{
+		threefry.set_key(kat[v][1]);
+
+		mipp::Reg<int32_t> ctr[4], out[4];
+		for (auto w = 0; w < 4; w++)
+			ctr[w] = (int32_t)kat[v][0][w];
+
+		threefry.rand_s32(ctr, out);
+
+		// all the lanes compute the same counter
+		for (auto w = 0; w < 4; w++)
+			for (auto l = 0; l < mipp::nElReg<int32_t>(); l++)
+				if ((uint32_t)out[w][l] != kat[v][2][w])
+				{
+					std::cerr << "KAT " << v << ", word " << w << ", lane " << l << ": 0x" << std::hex
+					          << std::setw(8) << std::setfill('0') << (uint32_t)out[w][l] << " instead of 0x"
+					          << std::setw(8) << kat[v][2][w] << std::dec << std::endl;
+					n_errors++;
+				}
+	}
+
+	return n_errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
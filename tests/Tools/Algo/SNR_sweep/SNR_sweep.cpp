@@ -0,0 +1,53 @@
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+
+#include "Tools/Algo/SNR_sweep/SNR_sweep.hpp"
+
+using namespace aff3ct;
+
+int main(int argc, char** argv)
+{
+	auto n_errors = 0;
+
+	// a waterfall between 1 and 2 dB: the refined points come after the regular ones, by increasing SNR
+	tools::SNR_sweep sweep(0.f, 3.f, 1.f, 0.25f, 1.f);
+	const auto fer = [](const float snr) -> float { return snr < 1.5f ? 1e-1f : 1e-5f; };
+
+	std::vector<float> snrs;
+	float snr;
+	while (sweep.next(snr))
+	{
+		snrs.push_back(snr);
+		sweep.record(snr, 100000, (unsigned long long)(fer(snr) * 100000));
+	}
+
+	const std::vector<float> ref = {0.f, 1.f, 2.f, 1.5f, 1.25f, 3.f};
+	if (snrs != ref)
+	{
+		std::cerr << "Wrong SNR points:";
+		for (auto s : snrs) std::cerr << " " << s;
+		std::cerr << std::endl;
+		n_errors++;
+	}
+
+	// the number of frames given for the FER floor is the smallest one which reaches it
+	for (auto n_fe : {0ull, 1ull, 10ull, 100ull})
+	{
+		const auto n_fra = tools::SNR_sweep::n_fra_floor(n_fe, 1e-3f);
+		if (!tools::SNR_sweep::is_point_done(n_fra, n_fe, 0.f, 1e-3f) ||
+		     tools::SNR_sweep::is_point_done(n_fra -1, n_fe, 0.f, 1e-3f))
+		{
+			std::cerr << "Wrong number of frames for the FER floor (n_fe = " << n_fe << ", n_fra = " << n_fra << ")."
+			          << std::endl;
+			n_errors++;
+		}
+	}
+
+	if (n_errors)
+		return EXIT_FAILURE;
+
+	std::cout << "The SNR sweep gives the expected points." << std::endl;
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,88 @@
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/API/API_polar_dynamic_inter.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_inter_8bit_bitpacking.hpp"
+
+using namespace aff3ct;
+
+using B = int8_t;
+using R = int8_t;
+
+using API_unpacked = tools::API_polar_dynamic_inter              <B,R>;
+using API_packed   = tools::API_polar_dynamic_inter_8bit_bitpacking<B,R>;
+
+constexpr int W = mipp::nElReg<R>();
+
+// decodes a node with both APIs and compares the packed bits with the unpacked ones
+template <class F_unpacked, class F_packed>
+int check(const char *name, const int n_elmts, const int off_s, std::mt19937 &gen, F_unpacked f_u, F_packed f_p)
+{
+	const auto N = 64;
+	std::uniform_int_distribution<int> dist(-40, 40);
+
+	mipp::vector<R> l(N * W);
+	for (auto &v : l) v = (R)dist(gen);
+
+	mipp::vector<B> s_u(N * W, 0);
+	mipp::vector<B> s_p(N / 8 * W);
+	for (auto &v : s_p) v = (B)dist(gen); // the bits outside the node have to be kept
+
+	const auto s_p_ref = s_p;
+
+	f_u(s_u, l, off_s, n_elmts);
+	f_p(s_p, l, off_s, n_elmts);
+
+	auto n_errors = 0;
+	for (auto i = 0; i < N; i++)
+		for (auto f = 0; f < W; f++)
+		{
+			const auto p_bit = (s_p    [(i / 8) * W + f] >> (i % 8)) & 1;
+			const auto r_bit = (s_p_ref[(i / 8) * W + f] >> (i % 8)) & 1;
+			const auto u_bit = (i >= off_s && i < off_s + n_elmts) ? (s_u[i * W + f] ? 1 : 0) : r_bit;
+			if (p_bit != u_bit)
+				n_errors++;
+		}
+
+	if (n_errors)
+		std::cerr << name << " (n_elmts = " << n_elmts << ", off_s = " << off_s << "): " << n_errors
+		          << " wrong bits." << std::endl;
+
+	return n_errors;
+}
+
+int main(int argc, char** argv)
+{
+	std::mt19937 gen(42);
+	auto n_errors = 0;
+
+	for (auto n_elmts : {8, 16, 32})
+		for (auto off_s : {0, n_elmts})
+		{
+			n_errors += check("grep", n_elmts, off_s, gen,
+				[](mipp::vector<B> &s, mipp::vector<R> &l, int o, int n) { API_unpacked::grep(s, l, o, o, n, 4); },
+				[](mipp::vector<B> &s, mipp::vector<R> &l, int o, int n) { API_packed  ::grep(s, l, o, o, n, 4); });
+			n_errors += check("grep_spc", n_elmts, off_s, gen,
+				[](mipp::vector<B> &s, mipp::vector<R> &l, int o, int n) { API_unpacked::grep_spc(s, l, o, o, n); },
+				[](mipp::vector<B> &s, mipp::vector<R> &l, int o, int n) { API_packed  ::grep_spc(s, l, o, o, n); });
+			n_errors += check("grep_rm", n_elmts, off_s, gen,
+				[](mipp::vector<B> &s, mipp::vector<R> &l, int o, int n) { API_unpacked::grep_rm(s, l, o, o, n); },
+				[](mipp::vector<B> &s, mipp::vector<R> &l, int o, int n) { API_packed  ::grep_rm(s, l, o, o, n); });
+			n_errors += check("gpc", n_elmts, off_s, gen,
+				[](mipp::vector<B> &s, mipp::vector<R> &l, int o, int n) { API_unpacked::gpc(s, l, o, o, n, 2); },
+				[](mipp::vector<B> &s, mipp::vector<R> &l, int o, int n) { API_packed  ::gpc(s, l, o, o, n, 2); });
+			n_errors += check("gpc_rep", n_elmts, off_s, gen,
+				[](mipp::vector<B> &s, mipp::vector<R> &l, int o, int n) { API_unpacked::gpc_rep(s, l, o, o, n); },
+				[](mipp::vector<B> &s, mipp::vector<R> &l, int o, int n) { API_packed  ::gpc_rep(s, l, o, o, n); });
+		}
+
+	if (n_errors)
+		return EXIT_FAILURE;
+
+	std::cout << "The bit-packed generalized nodes match the inter-frame ones." << std::endl;
+	return EXIT_SUCCESS;
+}